@@ -14,49 +14,188 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
 #include <cerrno>
 #include <charconv>
+#include <chrono>
 #include <cstring>
 #include <fstream>
+#include <optional>
 #include <print>
 #include <string_view>
 #include <vector>
 
 #include "sxt/base/error/panic.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/base/iterator/split.h"
 #include "sxt/base/num/divide_up.h"
 #include "sxt/base/num/fast_random_number_generator.h"
-#include "sxt/curve21/operation/add.h"
-#include "sxt/curve21/operation/double.h"
-#include "sxt/curve21/operation/neg.h"
-#include "sxt/curve21/type/element_p3.h"
+#include "sxt/base/system/file_io.h"
+#include "sxt/cbindings/base/curve_id.h"
+#include "sxt/cbindings/base/curve_id_utility.h"
+#include "sxt/curve_bng1/random/element_p2.h"
+#include "sxt/curve_g1/random/element_p2.h"
+#include "sxt/curve_gk/random/element_p2.h"
+#include "sxt/execution/cpu/for_each.h"
+#include "sxt/execution/cpu/thread_count.h"
 #include "sxt/multiexp/pippenger2/partition_table.h"
+#include "sxt/multiexp/pippenger2/partition_table_accessor.h"
 #include "sxt/ristretto/random/element.h"
 
 using namespace sxt;
 
 //--------------------------------------------------------------------------------------------------
-// make_partition_table
+// usage_v
+//--------------------------------------------------------------------------------------------------
+static constexpr std::string_view usage_v =
+    "Usage: blitzar make-partition-table <filename> <n> [--curve <curve>] "
+    "[--window-width <width>] [--generators <generators-file>]\n"
+    "\n"
+    "  <curve> is one of curve25519 (default), bls12-381, bn254, grumpkin or a numeric curve id.\n"
+    "  <generators-file> holds generators as an array of compact affine elements. If omitted,\n"
+    "  random generators are used.\n";
+
+//--------------------------------------------------------------------------------------------------
+// max_block_num_bytes_v
+//--------------------------------------------------------------------------------------------------
+// bound on the amount of memory used to buffer table slices before they're written
+static constexpr size_t max_block_num_bytes_v = size_t{1} << 30u;
+
+//--------------------------------------------------------------------------------------------------
+// generate_random_element
+//--------------------------------------------------------------------------------------------------
+using cg1rn::generate_random_element;
+using cgkrn::generate_random_element;
+using cn1rn::generate_random_element;
+using rstrn::generate_random_element;
+
+//--------------------------------------------------------------------------------------------------
+// parse_number
 //--------------------------------------------------------------------------------------------------
-static void make_partition_table(std::string_view filename, unsigned n) noexcept {
-  n = basn::divide_up(n, 16u) * 16u;
-  std::print("creating table {} {}\n", filename, n);
+static std::optional<unsigned> parse_number(std::string_view s) noexcept {
+  unsigned res;
+  if (auto err = std::from_chars(s.begin(), s.end(), res);
+      err.ec != std::errc{} || err.ptr != s.end()) {
+    return std::nullopt;
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// parse_curve_id
+//--------------------------------------------------------------------------------------------------
+static std::optional<cbnb::curve_id_t> parse_curve_id(std::string_view s) noexcept {
+  if (s == "curve25519" || s == "ristretto255") {
+    return cbnb::curve_id_t::curve25519;
+  }
+  if (s == "bls12-381") {
+    return cbnb::curve_id_t::bls12_381;
+  }
+  if (s == "bn254") {
+    return cbnb::curve_id_t::bn254;
+  }
+  if (s == "grumpkin") {
+    return cbnb::curve_id_t::grumpkin;
+  }
+  auto id = parse_number(s);
+  if (!id || *id > static_cast<unsigned>(cbnb::curve_id_t::grumpkin)) {
+    return std::nullopt;
+  }
+  return static_cast<cbnb::curve_id_t>(*id);
+}
 
-  // make generators
-  basn::fast_random_number_generator rng{1u, 2u};
-  std::vector<c21t::element_p3> generators(n);
-  rstrn::generate_random_elements(generators, rng);
+//--------------------------------------------------------------------------------------------------
+// make_generators
+//--------------------------------------------------------------------------------------------------
+template <class U, class T>
+static std::vector<T> make_generators(std::string_view generators_filename, unsigned n,
+                                      unsigned window_width) noexcept {
+  std::vector<T> res(basn::divide_up(n, window_width) * window_width, T::identity());
+  if (generators_filename.empty()) {
+    basn::fast_random_number_generator rng{1u, 2u};
+    for (unsigned i = 0; i < n; ++i) {
+      generate_random_element(res[i], rng);
+    }
+    return res;
+  }
+  std::vector<U> generators;
+  bassy::read_file(generators, generators_filename);
+  if (generators.size() < n) {
+    baser::panic("{} only contains {} generators", generators_filename, generators.size());
+  }
+  // padding with the identity leaves the sums of the last partition unchanged
+  for (unsigned i = 0; i < n; ++i) {
+    res[i] = T{generators[i]};
+  }
+  return res;
+}
 
-  // compute precomputed partition values
-  auto num_elements = 1u << 16u;
-  std::vector<c21t::element_p3> sums(num_elements * n / 16u);
-  mtxpp2::compute_partition_table<c21t::element_p3>(sums, generators);
+//--------------------------------------------------------------------------------------------------
+// make_partition_table
+//--------------------------------------------------------------------------------------------------
+template <class U, class T>
+static void make_partition_table(std::string_view filename, unsigned n, unsigned window_width,
+                                 std::string_view generators_filename) noexcept {
+  auto generators = make_generators<U, T>(generators_filename, n, window_width);
+  auto num_slices = generators.size() / window_width;
+  size_t table_size = 1u << window_width;
+  auto num_threads = xencpu::get_num_threads();
+  std::print("creating table {} for {} generators with a window width of {} using {} threads\n",
+             filename, generators.size(), window_width, num_threads);
 
-  // write table
   std::ofstream out{std::string{filename}, std::ios::binary};
   if (!out.good()) {
     baser::panic("failed to open {}: {}", filename, std::strerror(errno));
   }
-  out.write(reinterpret_cast<const char*>(sums.data()), sums.size() * sizeof(sums[0]));
+  mtxpp2::write_partition_table_header(out, {
+                                                .window_width = window_width,
+                                                .version = mtxpp2::partition_table_version_v,
+                                                .is_signed = false,
+                                                .is_glv = false,
+                                                .num_generators = n,
+                                            });
+
+  // compute blocks of slices in parallel and stream each block to disk
+  auto slices_per_block =
+      std::max<size_t>(num_threads, max_block_num_bytes_v / (table_size * sizeof(U)));
+  std::vector<U> sums(std::min(slices_per_block, num_slices) * table_size);
+  auto t1 = std::chrono::steady_clock::now();
+  for (size_t first = 0; first < num_slices; first += slices_per_block) {
+    auto last = std::min(first + slices_per_block, num_slices);
+    auto [chunk_first, chunk_last] = basit::split(basit::index_range{first, last},
+                                                  {
+                                                      .split_factor = num_threads,
+                                                  });
+    xencpu::concurrent_for_each(
+        chunk_first, chunk_last,
+        [&](const basit::index_range& rng) noexcept {
+          auto slices = basct::span<U>{sums}.subspan((rng.a() - first) * table_size,
+                                                     rng.size() * table_size);
+          auto slice_generators = basct::cspan<T>{generators}.subspan(
+              rng.a() * window_width, rng.size() * window_width);
+          mtxpp2::compute_partition_table<U, T>(slices, window_width, slice_generators);
+        },
+        num_threads);
+    out.write(reinterpret_cast<const char*>(sums.data()),
+              (last - first) * table_size * sizeof(U));
+    if (!out.good()) {
+      baser::panic("failed to write {}: {}", filename, std::strerror(errno));
+    }
+    std::print("computed {} of {} slices\n", last, num_slices);
+  }
+  out.close();
+  if (!out.good()) {
+    baser::panic("failed to close {}: {}", filename, std::strerror(errno));
+  }
+  auto t2 = std::chrono::steady_clock::now();
+
+  // report throughput
+  std::chrono::duration<double> elapsed = t2 - t1;
+  auto num_bytes = static_cast<double>(num_slices * table_size * sizeof(U));
+  std::print("computed {} table entries in {:.2f} seconds: {:.0f} generators/s, {:.2f} MB/s\n",
+             num_slices * table_size, elapsed.count(),
+             static_cast<double>(generators.size()) / elapsed.count(),
+             num_bytes / elapsed.count() / 1.0e6);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -70,18 +209,47 @@ int main(int argc, char* argv[]) {
   std::string_view cmd{argv[1]};
   if (cmd == "make-partition-table") {
     // create a table of precomputed values for Pippenger's partition algorithm
-    if (argc != 4) {
-      std::print(stderr, "Usage: blitzar make-partition-table <filename> <n>\n");
+    if (argc < 4 || argc % 2 != 0) {
+      std::print(stderr, "{}", usage_v);
       return -1;
     }
     std::string_view filename{argv[2]};
-    std::string_view n_str{argv[3]};
-    unsigned n;
-    if (auto err = std::from_chars(n_str.begin(), n_str.end(), n); err.ec != std::errc{}) {
-      std::print(stderr, "invalid number: {}\n", n_str);
+    auto n = parse_number(argv[3]);
+    if (!n) {
+      std::print(stderr, "invalid number: {}\n", argv[3]);
       return -1;
     }
-    make_partition_table(filename, n);
+    auto curve_id = cbnb::curve_id_t::curve25519;
+    unsigned window_width = 16;
+    std::string_view generators_filename;
+    for (int i = 4; i < argc; i += 2) {
+      std::string_view option{argv[i]};
+      std::string_view value{argv[i + 1]};
+      if (option == "--curve") {
+        auto id = parse_curve_id(value);
+        if (!id) {
+          std::print(stderr, "invalid curve: {}\n", value);
+          return -1;
+        }
+        curve_id = *id;
+      } else if (option == "--window-width") {
+        auto width = parse_number(value);
+        if (!width || *width == 0 || *width > 24) {
+          std::print(stderr, "invalid window width: {}\n", value);
+          return -1;
+        }
+        window_width = *width;
+      } else if (option == "--generators") {
+        generators_filename = value;
+      } else {
+        std::print(stderr, "unknown option: {}\n{}", option, usage_v);
+        return -1;
+      }
+    }
+    cbnb::switch_curve_type(
+        curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+          make_partition_table<U, T>(filename, *n, window_width, generators_filename);
+        });
   }
   return 0;
 }
@@ -0,0 +1,264 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <limits>
+#include <print>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "sxt/base/curve/element.h"
+#include "sxt/base/iterator/split.h"
+#include "sxt/base/num/fast_random_number_generator.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/batch_add.h"
+#include "sxt/curve21/operation/double.h"
+#include "sxt/curve21/operation/neg.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve_bng1/operation/add.h"
+#include "sxt/curve_bng1/operation/batch_add.h"
+#include "sxt/curve_bng1/operation/double.h"
+#include "sxt/curve_bng1/operation/endomorphism.h"
+#include "sxt/curve_bng1/operation/neg.h"
+#include "sxt/curve_bng1/random/element_p2.h"
+#include "sxt/curve_bng1/type/element_p2.h"
+#include "sxt/curve_g1/operation/add.h"
+#include "sxt/curve_g1/operation/batch_add.h"
+#include "sxt/curve_g1/operation/double.h"
+#include "sxt/curve_g1/operation/endomorphism.h"
+#include "sxt/curve_g1/operation/neg.h"
+#include "sxt/curve_g1/random/element_p2.h"
+#include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/curve_gk/operation/add.h"
+#include "sxt/curve_gk/operation/batch_add.h"
+#include "sxt/curve_gk/operation/double.h"
+#include "sxt/curve_gk/operation/endomorphism.h"
+#include "sxt/curve_gk/operation/neg.h"
+#include "sxt/curve_gk/random/element_p2.h"
+#include "sxt/curve_gk/type/element_p2.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/bucket_method2/cpu_multiexponentiation.h"
+#include "sxt/multiexp/bucket_method2/histogram_multiexponentiation.h"
+#include "sxt/multiexp/bucket_method2/small_width_multiexponentiation.h"
+#include "sxt/multiexp/curve/cpu_multiexponentiation.h"
+#include "sxt/multiexp/curve/straus_multiexponentiation.h"
+#include "sxt/multiexp/glv/curve_endomorphism.h"
+#include "sxt/multiexp/glv/multiexponentiation.h"
+#include "sxt/multiexp/selection/cost_profile.h"
+#include "sxt/multiexp/selection/engine.h"
+#include "sxt/multiexp/selection/engine_selection.h"
+#include "sxt/seqcommit/generator/base_element.h"
+
+using namespace sxt;
+
+//--------------------------------------------------------------------------------------------------
+// curve25519_generator
+//--------------------------------------------------------------------------------------------------
+static void curve25519_generator(c21t::element_p3& element, unsigned i) {
+  sqcgn::compute_base_element(element, i);
+}
+
+//--------------------------------------------------------------------------------------------------
+// bls12_381_generator
+//--------------------------------------------------------------------------------------------------
+static void bls12_381_generator(cg1t::element_p2& element, unsigned i) {
+  basn::fast_random_number_generator rng{i + 1, i + 2};
+  cg1rn::generate_random_element(element, rng);
+}
+
+//--------------------------------------------------------------------------------------------------
+// bn254_generator
+//--------------------------------------------------------------------------------------------------
+static void bn254_generator(cn1t::element_p2& element, unsigned i) {
+  basn::fast_random_number_generator rng{i + 1, i + 2};
+  cn1rn::generate_random_element(element, rng);
+}
+
+//--------------------------------------------------------------------------------------------------
+// grumpkin_generator
+//--------------------------------------------------------------------------------------------------
+static void grumpkin_generator(cgkt::element_p2& element, unsigned i) {
+  basn::fast_random_number_generator rng{i + 1, i + 2};
+  cgkrn::generate_random_element(element, rng);
+}
+
+//--------------------------------------------------------------------------------------------------
+// run_engine
+//--------------------------------------------------------------------------------------------------
+template <bascrv::element T>
+static void run_engine(basct::span<T> res, basct::cspan<T> generators,
+                       basct::cspan<mtxb::exponent_sequence> exponents,
+                       const mtxsel::multiexp_plan& plan) noexcept {
+  switch (plan.engine) {
+  case mtxsel::engine_t::straus:
+    mtxcrv::multiexponentiate_straus<T>(res, generators, exponents);
+    return;
+  case mtxsel::engine_t::signed_bucket:
+    mtxbk2::multiexponentiate_cpu<T>(res, generators, exponents, plan.num_threads,
+                                     plan.bit_width);
+    return;
+  case mtxsel::engine_t::multiproduct: {
+    basit::split_options split_options{
+        .min_chunk_size = plan.chunk_size,
+        .max_chunk_size = plan.chunk_size,
+        .split_factor = plan.num_threads,
+    };
+    auto products = mtxcrv::compute_multiexponentiation_cpu<T>(generators, exponents,
+                                                               split_options, plan.num_threads);
+    std::copy(products.begin(), products.end(), res.begin());
+    return;
+  }
+  case mtxsel::engine_t::small_width:
+    mtxbk2::multiexponentiate_small_width_cpu<T>(res, generators, exponents, plan.num_threads);
+    return;
+  case mtxsel::engine_t::histogram:
+    mtxbk2::multiexponentiate_histogram_cpu<T>(res, generators, exponents, plan.num_threads);
+    return;
+  case mtxsel::engine_t::glv:
+    if constexpr (mtxglv::curve_endomorphism<T>) {
+      mtxglv::multiexponentiate_cpu<T>(res, generators, exponents, plan.num_threads,
+                                       plan.bit_width);
+    }
+    return;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// num_histogram_values_v
+//--------------------------------------------------------------------------------------------------
+static constexpr unsigned num_histogram_values_v = 100;
+
+//--------------------------------------------------------------------------------------------------
+// calibrate_engine
+//--------------------------------------------------------------------------------------------------
+/**
+ * Time an engine on random exponents and return the nanoseconds per unit of estimated cost.
+ *
+ * The small width engine is timed on 1-byte exponents, the histogram engine on 32-byte exponents
+ * drawn from num_histogram_values_v distinct values, and the others on random 32-byte exponents.
+ */
+template <bascrv::element T>
+static double calibrate_engine(std::string_view curve, mtxsel::engine_t engine,
+                               basct::cspan<T> generators, unsigned num_samples) noexcept {
+  unsigned element_num_bytes = engine == mtxsel::engine_t::small_width ? 1 : 32;
+  auto n = generators.size();
+  std::vector<uint8_t> data(n * element_num_bytes);
+  std::mt19937 rng{0};
+  std::uniform_int_distribution<unsigned> dist{0, std::numeric_limits<uint8_t>::max()};
+  for (auto& x : data) {
+    x = static_cast<uint8_t>(dist(rng));
+  }
+  if (engine == mtxsel::engine_t::histogram) {
+    std::uniform_int_distribution<size_t> value_dist{
+        0, std::min<size_t>(num_histogram_values_v, n) - 1};
+    for (size_t i = 0; i < n; ++i) {
+      std::copy_n(data.data() + value_dist(rng) * element_num_bytes, element_num_bytes,
+                  data.data() + i * element_num_bytes);
+    }
+  }
+  mtxb::exponent_sequence exponents{
+      .element_nbytes = static_cast<uint8_t>(element_num_bytes),
+      .n = n,
+      .data = data.data(),
+  };
+  auto descriptor = mtxsel::describe_multiexponentiation(curve, sizeof(T), {&exponents, 1});
+  descriptor.has_endomorphism = mtxglv::curve_endomorphism<T>;
+  auto plan = *mtxsel::estimate_multiexponentiation(descriptor, engine);
+  memmg::managed_array<T> res(1);
+
+  // discard initial run
+  run_engine<T>(res, generators, {&exponents, 1}, plan);
+
+  // run benchmark
+  double elapse = 0;
+  for (unsigned i = 0; i < num_samples; ++i) {
+    auto t1 = std::chrono::steady_clock::now();
+    run_engine<T>(res, generators, {&exponents, 1}, plan);
+    auto t2 = std::chrono::steady_clock::now();
+    elapse += std::chrono::duration<double, std::nano>(t2 - t1).count();
+  }
+  auto coefficient = elapse / num_samples / plan.cost;
+  std::println("{} {}: {} ns per unit of cost", curve, mtxsel::to_string(engine), coefficient);
+  return coefficient;
+}
+
+//--------------------------------------------------------------------------------------------------
+// calibrate_curve
+//--------------------------------------------------------------------------------------------------
+template <bascrv::element T, class F>
+static void calibrate_curve(mtxsel::cost_profile& profile, std::string_view curve, unsigned n,
+                            unsigned num_samples, F generator_func) noexcept {
+  std::vector<T> generators(n);
+  for (unsigned i = 0; i < n; ++i) {
+    generator_func(generators[i], i);
+  }
+  for (unsigned i = 0; i < mtxsel::num_engines_v; ++i) {
+    auto engine = static_cast<mtxsel::engine_t>(i);
+    if (engine == mtxsel::engine_t::glv && !mtxglv::curve_endomorphism<T>) {
+      continue;
+    }
+    auto m = n;
+    if (engine == mtxsel::engine_t::straus) {
+      m = std::min<unsigned>(n, mtxcrv::straus_max_num_generators_v);
+    }
+    profile.set_coefficient(
+        curve, engine,
+        calibrate_engine<T>(curve, engine, basct::cspan<T>{generators.data(), m}, num_samples));
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// main
+//--------------------------------------------------------------------------------------------------
+int main(int argc, char* argv[]) {
+  if (argc != 4) {
+    std::println("Usage: benchmark <profile_file> <n> <num_samples>");
+    return -1;
+  }
+
+  // read arguments
+  const char* filename = argv[1];
+  std::string_view n_str{argv[2]};
+  std::string_view num_samples_str{argv[3]};
+  unsigned n, num_samples;
+  if (std::from_chars(n_str.begin(), n_str.end(), n).ec != std::errc{} || n == 0) {
+    std::println("invalid argument: {}\n", n_str);
+    return -1;
+  }
+  if (std::from_chars(num_samples_str.begin(), num_samples_str.end(), num_samples).ec !=
+          std::errc{} ||
+      num_samples == 0) {
+    std::println("invalid argument: {}\n", num_samples_str);
+    return -1;
+  }
+  std::println("n = {}", n);
+  std::println("num_samples = {}", num_samples);
+
+  // calibrate
+  mtxsel::cost_profile profile;
+  calibrate_curve<c21t::element_p3>(profile, "curve25519", n, num_samples, curve25519_generator);
+  calibrate_curve<cg1t::element_p2>(profile, "bls12_381", n, num_samples, bls12_381_generator);
+  calibrate_curve<cn1t::element_p2>(profile, "bn254", n, num_samples, bn254_generator);
+  calibrate_curve<cgkt::element_p2>(profile, "grumpkin", n, num_samples, grumpkin_generator);
+
+  mtxsel::write_cost_profile(filename, profile);
+  std::println("wrote cost profile to {}", filename);
+  return 0;
+}
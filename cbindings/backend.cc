@@ -26,6 +26,7 @@
 #include "sxt/cbindings/backend/computational_backend.h"
 #include "sxt/cbindings/backend/cpu_backend.h"
 #include "sxt/cbindings/backend/gpu_backend.h"
+#include "sxt/multiexp/selection/active_profile.h"
 #include "sxt/seqcommit/generator/precomputed_initializer.h"
 
 using namespace sxt;
@@ -41,6 +42,7 @@ static cbnbck::computational_backend* backend = nullptr;
 //--------------------------------------------------------------------------------------------------
 static void initialize_cpu_backend(const sxt_config* config) noexcept {
   backend = cbnbck::get_cpu_backend();
+  mtxsel::init_active_cost_profile();
   sqcgn::init_precomputed_components(config->num_precomputed_generators, false);
 }
 
@@ -130,6 +130,58 @@ struct sxt_sequence_descriptor {
   int is_signed;
 };
 
+/** describes a sparse sequence of values */
+struct sxt_sparse_sequence_descriptor {
+  // The number of bytes used to represent an element in the sequence.
+  // `element_nbytes` must be a power of `2` and must satisfy `1 <= element_nbytes <= 32`.
+  uint8_t element_nbytes;
+
+  // The number of stored elements in the sequence.
+  uint64_t n;
+
+  // Pointer to the data for the `n` stored elements of the sequence where each element encodes a
+  // number of `element_nbytes` bytes represented in the little endian format.
+  const uint8_t* data;
+
+  // Pointer to the `n` row indexes of the stored elements: element `j` of `data` is the value of
+  // row `indexes[j]` and every other row of the sequence is zero.
+  const uint64_t* indexes;
+
+  // Whether the elements are signed.
+  // Note: if signed, then `element_nbytes` must be `<= 16`.
+  int is_signed;
+};
+
+/** describes an update to rows of a sequence of values */
+struct sxt_sequence_update_descriptor {
+  // The number of bytes used to represent an element in the sequence.
+  // `element_nbytes` must be a power of `2` and must satisfy `1 <= element_nbytes <= 32`.
+  uint8_t element_nbytes;
+
+  // The number of updated rows.
+  uint64_t n;
+
+  // Pointer to the `n` values of the updated rows before the update, encoded as for `new_data`.
+  // If null, the rows are taken to have been zero (e.g. rows appended to the sequence).
+  const uint8_t* old_data;
+
+  // Pointer to the `n` values of the updated rows after the update where each element encodes a
+  // number of `element_nbytes` bytes represented in the little endian format.
+  const uint8_t* new_data;
+
+  // Pointer to the `n` row indexes of the updated rows: element `j` of `old_data` and `new_data`
+  // is the value of row `indexes[j]`. If null, the updated rows are the contiguous segment
+  // `offset, offset + 1, ..., offset + n - 1`.
+  const uint64_t* indexes;
+
+  // The first row of the updated segment when `indexes` is null.
+  uint64_t offset;
+
+  // Whether the elements are signed.
+  // Note: if signed, then `element_nbytes` must be `<= 16`.
+  int is_signed;
+};
+
 /** Describe inputs to a sumcheck proof.
  *
  * The sumcheck proof is constructed using a polynomial of the form
@@ -196,6 +248,12 @@ struct sxt_multiexp_handle;
  * # Return:
  *
  * - `0` on success; otherwise a nonzero error code
+ *
+ * # Notes:
+ *
+ * - with the cpu backend, if the environmental variable BLITZAR_MULTIEXP_PROFILE names a cost
+ *   profile (as written by the benchmark //benchmark/multi_exp_profile), its measured per-curve
+ *   coefficients are used to choose between the host multiexponentiation algorithms
  */
 int sxt_init(const struct sxt_config* config);
 
@@ -239,6 +297,9 @@ int sxt_init(const struct sxt_config* config);
  * # Considerations:
  *
  * - `num_sequences == 0` will skip the computation
+ * - with the cpu backend, sequences with at most 1024 distinct nonzero magnitudes are detected
+ *   automatically and can be committed to by summing the generators of each distinct value
+ *   followed by a multiexponentiation over only the distinct values
  */
 void sxt_curve25519_compute_pedersen_commitments(struct sxt_ristretto255_compressed* commitments,
                                                  uint32_t num_sequences,
@@ -280,6 +341,9 @@ void sxt_curve25519_compute_pedersen_commitments(struct sxt_ristretto255_compres
  * # Considerations:
  *
  * - `num_sequences == 0` will skip the computation
+ * - with the cpu backend, sequences with at most 1024 distinct nonzero magnitudes are detected
+ *   automatically and can be committed to by summing the generators of each distinct value
+ *   followed by a multiexponentiation over only the distinct values
  */
 void sxt_curve25519_compute_pedersen_commitments_with_generators(
     struct sxt_ristretto255_compressed* commitments, uint32_t num_sequences,
@@ -320,6 +384,12 @@ void sxt_curve25519_compute_pedersen_commitments_with_generators(
  * # Considerations:
  *
  * - `num_sequences == 0` will skip the computation
+ * - with the cpu backend, if the environmental variable BLITZAR_GLV is set to "1", sequences of
+ *   unsigned scalars wider than 128 bits can be split into two half-width scalars using the
+ *   curve's endomorphism (GLV decomposition) when the cost model predicts it's faster
+ * - with the cpu backend, sequences with at most 1024 distinct nonzero magnitudes are detected
+ *   automatically and can be committed to by summing the generators of each distinct value
+ *   followed by a multiexponentiation over only the distinct values
  */
 void sxt_bls12_381_g1_compute_pedersen_commitments_with_generators(
     struct sxt_bls12_381_g1_compressed* commitments, uint32_t num_sequences,
@@ -360,6 +430,12 @@ void sxt_bls12_381_g1_compute_pedersen_commitments_with_generators(
  * # Considerations:
  *
  * - `num_sequences == 0` will skip the computation
+ * - with the cpu backend, if the environmental variable BLITZAR_GLV is set to "1", sequences of
+ *   unsigned scalars wider than 128 bits can be split into two half-width scalars using the
+ *   curve's endomorphism (GLV decomposition) when the cost model predicts it's faster
+ * - with the cpu backend, sequences with at most 1024 distinct nonzero magnitudes are detected
+ *   automatically and can be committed to by summing the generators of each distinct value
+ *   followed by a multiexponentiation over only the distinct values
  */
 void sxt_bn254_g1_uncompressed_compute_pedersen_commitments_with_generators(
     struct sxt_bn254_g1* commitments, uint32_t num_sequences,
@@ -400,11 +476,191 @@ void sxt_bn254_g1_uncompressed_compute_pedersen_commitments_with_generators(
  * # Considerations:
  *
  * - `num_sequences == 0` will skip the computation
+ * - with the cpu backend, if the environmental variable BLITZAR_GLV is set to "1", sequences of
+ *   unsigned scalars wider than 128 bits can be split into two half-width scalars using the
+ *   curve's endomorphism (GLV decomposition) when the cost model predicts it's faster
+ * - with the cpu backend, sequences with at most 1024 distinct nonzero magnitudes are detected
+ *   automatically and can be committed to by summing the generators of each distinct value
+ *   followed by a multiexponentiation over only the distinct values
  */
 void sxt_grumpkin_uncompressed_compute_pedersen_commitments_with_generators(
     struct sxt_grumpkin* commitments, uint32_t num_sequences,
     const struct sxt_sequence_descriptor* descriptors, const struct sxt_grumpkin* generators);
 
+/**
+ * Compute the Pedersen commitments for sparse sequences of values using `curve25519` group
+ * elements.
+ *
+ * Denote the stored elements of sequence `i` by `a_ij` with row indexes `k_ij`. Then `res[i]`
+ * encodes the ristretto255 group value
+ *
+ * ```text
+ *     Prod_{j=1 to n_i} g_{k_ij} ^ a_ij
+ * ```
+ *
+ * where `n_i` represents the number of stored elements in sequence `i` and `g_k` is a group
+ * element determined by the `generators[k]` user value given as input. This is the same
+ * commitment as for a dense sequence with zeros in every row that isn't stored.
+ *
+ * # Arguments:
+ *
+ * - `commitments` (out): an array of length num_sequences where the computed commitments
+ *                     of each sequence must be written into
+ *
+ * - `num_sequences` (in): specifies the number of sequences
+ * - `descriptors` (in): an array of length `num_sequences` that specifies each sequence
+ * - `generators` (in): an array with an entry for every row index referenced by `descriptors`
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - backend not initialized or incorrectly initialized
+ * - `descriptors == nullptr`
+ * - `commitments == nullptr`
+ * - `descriptor[i].element_nbytes == 0`
+ * - `descriptor[i].element_nbytes > 32`
+ * - `descriptor[i].n > 0 && (descriptor[i].data == nullptr || descriptor[i].indexes == nullptr)`
+ *
+ * # Considerations:
+ *
+ * - `num_sequences == 0` will skip the computation
+ * - only the generators at the referenced row indexes are read, so the work and memory of the
+ *   computation scale with the number of stored elements rather than with the number of rows
+ * - sequences that share an `indexes` array share the generators gathered for it and are
+ *   computed as a single batch
+ */
+void sxt_curve25519_compute_sparse_pedersen_commitments_with_generators(
+    struct sxt_ristretto255_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_sparse_sequence_descriptor* descriptors,
+    const struct sxt_ristretto255* generators);
+
+/**
+ * Compute the Pedersen commitments for sparse sequences of values using `bls12-381` `G1` group
+ * elements.
+ *
+ * See `sxt_curve25519_compute_sparse_pedersen_commitments_with_generators` for the commitment
+ * computed and the conditions on the arguments. Only the referenced generators are converted from
+ * affine form.
+ */
+void sxt_bls12_381_g1_compute_sparse_pedersen_commitments_with_generators(
+    struct sxt_bls12_381_g1_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_sparse_sequence_descriptor* descriptors,
+    const struct sxt_bls12_381_g1* generators);
+
+/**
+ * Compute the Pedersen commitments for sparse sequences of values using `bn254` `G1` group
+ * elements.
+ *
+ * See `sxt_curve25519_compute_sparse_pedersen_commitments_with_generators` for the commitment
+ * computed and the conditions on the arguments. Only the referenced generators are converted from
+ * affine form.
+ */
+void sxt_bn254_g1_uncompressed_compute_sparse_pedersen_commitments_with_generators(
+    struct sxt_bn254_g1* commitments, uint32_t num_sequences,
+    const struct sxt_sparse_sequence_descriptor* descriptors,
+    const struct sxt_bn254_g1* generators);
+
+/**
+ * Compute the Pedersen commitments for sparse sequences of values using `grumpkin` group
+ * elements.
+ *
+ * See `sxt_curve25519_compute_sparse_pedersen_commitments_with_generators` for the commitment
+ * computed and the conditions on the arguments. Only the referenced generators are converted from
+ * affine form.
+ */
+void sxt_grumpkin_uncompressed_compute_sparse_pedersen_commitments_with_generators(
+    struct sxt_grumpkin* commitments, uint32_t num_sequences,
+    const struct sxt_sparse_sequence_descriptor* descriptors,
+    const struct sxt_grumpkin* generators);
+
+/**
+ * Update Pedersen commitments in place for changes to rows of the committed sequences using
+ * `curve25519` group elements.
+ *
+ * Denote the rows changed in sequence `i` by `k_ij` with old values `a_ij` and new values `b_ij`.
+ * Then on completion `commitments[i]` encodes the ristretto255 group value
+ *
+ * ```text
+ *     commitments[i] * Prod_{j=1 to n_i} g_{k_ij} ^ (b_ij - a_ij)
+ * ```
+ *
+ * where `n_i` represents the number of rows changed in sequence `i` and `g_k` is a group element
+ * determined by the `generators[k]` user value given as input. If `commitments[i]` was computed
+ * for the old values of the sequence, it becomes the commitment to the new values.
+ *
+ * Rows appended to a sequence are updated from zero: pass `old_data == nullptr` together with
+ * either the appended row indexes or `indexes == nullptr` and the `offset` of the first
+ * appended row.
+ *
+ * # Arguments:
+ *
+ * - `commitments` (in/out): an array of length num_sequences with the commitments to update
+ * - `num_sequences` (in): specifies the number of sequences
+ * - `descriptors` (in): an array of length `num_sequences` that specifies the update of each
+ *                    sequence
+ * - `generators` (in): an array with an entry for every row index referenced by `descriptors`
+ *
+ * # Abnormal program termination in case of:
+ *
+ * - backend not initialized or incorrectly initialized
+ * - `descriptors == nullptr`
+ * - `commitments == nullptr`
+ * - `generators == nullptr`
+ * - `descriptor[i].element_nbytes == 0`
+ * - `descriptor[i].element_nbytes > 32`
+ * - `descriptor[i].n > 0 && descriptor[i].new_data == nullptr`
+ * - `descriptor[i]` lists a changed row more than once
+ * - more than `UINT_MAX` distinct rows are updated
+ * - a compressed `commitments[i]` can't be decompressed to a group element
+ *
+ * # Considerations:
+ *
+ * - `num_sequences == 0` will skip the computation
+ * - the differences between the new and old values of every sequence are committed in a single
+ *   multiexponentiation over the generators of the distinct updated rows, so the cost scales with
+ *   the number of distinct updated rows times `num_sequences` rather than with the length of the
+ *   sequences. Updates to the same rows of several sequences are the cheapest to batch.
+ */
+void sxt_curve25519_update_pedersen_commitments_with_generators(
+    struct sxt_ristretto255_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_update_descriptor* descriptors,
+    const struct sxt_ristretto255* generators);
+
+/**
+ * Update Pedersen commitments in place for changes to rows of the committed sequences using
+ * `bls12-381` `G1` group elements.
+ *
+ * See `sxt_curve25519_update_pedersen_commitments_with_generators` for the update computed and
+ * the conditions on the arguments.
+ */
+void sxt_bls12_381_g1_update_pedersen_commitments_with_generators(
+    struct sxt_bls12_381_g1_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_update_descriptor* descriptors,
+    const struct sxt_bls12_381_g1* generators);
+
+/**
+ * Update Pedersen commitments in place for changes to rows of the committed sequences using
+ * `bn254` `G1` group elements.
+ *
+ * See `sxt_curve25519_update_pedersen_commitments_with_generators` for the update computed and
+ * the conditions on the arguments.
+ */
+void sxt_bn254_g1_uncompressed_update_pedersen_commitments_with_generators(
+    struct sxt_bn254_g1* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_update_descriptor* descriptors,
+    const struct sxt_bn254_g1* generators);
+
+/**
+ * Update Pedersen commitments in place for changes to rows of the committed sequences using
+ * `grumpkin` group elements.
+ *
+ * See `sxt_curve25519_update_pedersen_commitments_with_generators` for the update computed and
+ * the conditions on the arguments.
+ */
+void sxt_grumpkin_uncompressed_update_pedersen_commitments_with_generators(
+    struct sxt_grumpkin* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_update_descriptor* descriptors,
+    const struct sxt_grumpkin* generators);
+
 /**
  * Gets the pre-specified random generated elements used for the Pedersen commitments in the
  * `sxt_curve25519_compute_pedersen_commitments` function.
@@ -627,6 +883,11 @@ int sxt_curve25519_verify_inner_product(struct sxt_transcript* transcript, uint6
  * SXT_CURVE_BLS_381               struct sxt_bls12_381_g1_p2*
  * SXT_CURVE_BN_254                struct sxt_bn254_g1_p2*
  * SXT_CURVE_GRUMPKIN              struct sxt_grumpkin_p2*
+ *
+ * With the cpu backend, if the environmental variable BLITZAR_HUGE_PAGES is set to "1" (or "2m")
+ * or "1g", the table of precomputed sums is placed in 2 MB or 1 GB huge pages to reduce TLB
+ * misses. Reserved huge pages are used when available; otherwise, the table falls back to
+ * transparent huge pages. The same setting applies to the cpu sumcheck workspace.
  */
 struct sxt_multiexp_handle* sxt_multiexp_handle_new(unsigned curve_id, const void* generators,
                                                     unsigned n);
@@ -637,18 +898,96 @@ struct sxt_multiexp_handle* sxt_multiexp_handle_new(unsigned curve_id, const voi
  *
  * Reading the handle from a file can be significantly faster than calling
  * sxt_multiexp_handle_new.
+ *
+ * If the environmental variable BLITZAR_PARTITION_TABLE_MMAP is set to "1", the file is mapped
+ * into memory instead of read so that processes using the same file share its pages. Setting it
+ * to a comma-separated list of the flags "willneed" (start readahead) and "lock" (lock the
+ * pages in memory) also maps the file.
+ *
+ * Files written from a handle created with sxt_multiexp_handle_new_signed or
+ * sxt_multiexp_handle_new_glv are detected and read into a signed or GLV handle, respectively.
  */
 struct sxt_multiexp_handle* sxt_multiexp_handle_new_from_file(unsigned curve_id,
                                                               const char* filename);
 
+/**
+ * Create a handle for computing multiexponentiations using a fixed sequence of generators where
+ * scalars are split with GLV decomposition.
+ *
+ * The handle's table is built from the generators g_1, phi(g_1), ..., g_n, phi(g_n) where phi is
+ * the curve's endomorphism. Each scalar wider than 128 bits is then split into two 128-bit scalars
+ * k_1 and k_2 with k = k_1 + lambda k_2, which halves the number of bits processed. The handle is
+ * used with the same multiexponentiation functions as a handle from sxt_multiexp_handle_new.
+ *
+ * Only SXT_CURVE_BLS_381, SXT_CURVE_BN_254, and SXT_CURVE_GRUMPKIN are supported. Generators must
+ * belong to the prime order subgroup.
+ */
+struct sxt_multiexp_handle* sxt_multiexp_handle_new_glv(unsigned curve_id, const void* generators,
+                                                        unsigned n);
+
+/**
+ * Read a handle written from a handle created with sxt_multiexp_handle_new_glv.
+ *
+ * Aborts if the file wasn't written from a GLV handle.
+ */
+struct sxt_multiexp_handle* sxt_multiexp_handle_new_glv_from_file(unsigned curve_id,
+                                                                  const char* filename);
+
+/**
+ * Create a handle for computing multiexponentiations using a fixed sequence of generators where
+ * the table of precomputed sums is signed.
+ *
+ * A signed table stores only the sums g_0 +/- g_1 +/- ... +/- g_{w-1} for each group of w
+ * generators and recovers the remaining combinations by negation, so it takes half the memory of
+ * the table from sxt_multiexp_handle_new for the same window width. Setting
+ * BLITZAR_PARTITION_WINDOW_WIDTH to 17 gives a signed table of the same size as the default
+ * unsigned table with one less partition group per generator. The handle keeps a copy of the
+ * generators to correct for even scalars.
+ *
+ * Signed handles support every multiexponentiation function as well as
+ * sxt_multiexp_handle_extend and sxt_multiexp_handle_write_to_file, but they are always computed
+ * on the host, even with the gpu backend. The packed, varying length, and offset functions unpack
+ * the scalars to whole bytes, so each costs about as much as a multiexponentiation with the
+ * widest output's scalars over the generators that any output uses.
+ */
+struct sxt_multiexp_handle* sxt_multiexp_handle_new_signed(unsigned curve_id,
+                                                           const void* generators, unsigned n);
+
 /**
  * Write a multiexponentiation handle to file.
  *
  * Use this function in combination with sxt_multiexp_handle_new_from_file.
+ *
+ * Files are written in version 1 of the partition table format, which stores the number of
+ * generators and aligns the table for memory mapping. Versions of the library predating the
+ * format version can't read them. Files in the earlier format are still read.
  */
 void sxt_multiexp_handle_write_to_file(const struct sxt_multiexp_handle* handle,
                                        const char* filename);
 
+/**
+ * Append `count` generators to a multiexponentiation handle.
+ *
+ * Only the sums for the groups containing the new generators are computed, so extending a handle
+ * is much cheaper than creating a new one for all of the generators. `generators` must match the
+ * type indicated by the handle's curve (see sxt_multiexp_handle_new).
+ *
+ * If the handle was created with sxt_multiexp_handle_new_from_file, the file is updated as well.
+ * The new entries are written into the file in place, followed by the generator count in its
+ * header. The update isn't atomic: other processes that have the file mapped see the table change
+ * while it's written, and a crash during the update can leave the file damaged. Files store the
+ * number of generators in their header. For files written before the count was stored, the number
+ * of generators is recovered by treating trailing identity generators of the last group as
+ * padding, and extending the handle rewrites the file in the current format into a new file that
+ * replaces the old one.
+ *
+ * Extending a signed handle (see sxt_multiexp_handle_new_signed) recomputes the sums for its last
+ * partial group. A signed file stores its generators before the table, so extending a signed
+ * handle created from a file rewrites the whole file.
+ */
+void sxt_multiexp_handle_extend(struct sxt_multiexp_handle* handle, const void* generators,
+                                unsigned count);
+
 /**
  * Free resources for a multiexponentiation handle
  */
@@ -743,6 +1082,113 @@ void sxt_fixed_vlen_multiexponentiation(void* res, const struct sxt_multiexp_han
                                         const unsigned* output_lengths, unsigned num_outputs,
                                         const uint8_t* scalars);
 
+/**
+ * Compute a varying length multiexponentiation of scalars in packed format where each output
+ * starts at its own offset into the handle's generators.
+ *
+ * On completion `res` contains an array of size `num_outputs` for the multiexponentiation
+ * of the given `scalars` array.
+ *
+ * An entry output_bit_table[output_index] specifies the number of scalar bits used for
+ * output_index. Output output_index pairs its first output_lengths[output_index] scalars with the
+ * generators
+ *     g_{output_firsts[output_index]}, ..., g_{output_firsts[output_index] +
+ *                                              output_lengths[output_index] - 1}
+ *
+ * Unlike `sxt_fixed_vlen_multiexponentiation`, output_lengths need not be sorted and no scalars
+ * need to be supplied for generators before an output's offset.
+ *
+ * Put
+ *     bit_sum = sum_{output_index} output_bit_table[output_index]
+ * and let num_bytes denote the smallest integer greater than or equal to bit_sum that is a
+ * multiple of 8.
+ *
+ * Let n denote the length of the longest output. Then `scalars` specifies a contiguous
+ * multi-dimension `num_bytes` by `n` array laid out in a packed column-major order as specified by
+ * output_bit_table. Row j determines the scalar exponents of every output's j-th generator with
+ * the output scalars packed contiguously and padded with zeros.
+ *
+ * Note: `res` must match the generator type of the curve. See `sxt_multiexp_handle_new` for
+ * the types.
+ */
+void sxt_fixed_offset_multiexponentiation(void* res, const struct sxt_multiexp_handle* handle,
+                                          const unsigned* output_bit_table,
+                                          const unsigned* output_firsts,
+                                          const unsigned* output_lengths, unsigned num_outputs,
+                                          const uint8_t* scalars);
+
+/**
+ * Compute a sparse multiexponentiation using a handle to pre-specified generators.
+ *
+ * On completion `res` contains an array of size `num_outputs` for the multiexponentiation
+ * of the given `scalars` array.
+ *
+ * `indexes` specifies `n` generator indexes shared by every output and `scalars` specifies a
+ * contiguous multi-dimension `num_outputs` by `n` array laid out in column-major order as for
+ * `sxt_fixed_multiexponentiation`. An entry in the array specifies the `element_num_bytes` bytes of
+ * the scalar for generator `g_{indexes[j]}`; the scalars of all other generators are zero.
+ *
+ * For example, if `g_1, g_2, ..., g_m` are the generators associated with `handle`, `indexes` is
+ * `k_1, ..., k_n`, and the scalar array is
+ *
+ * ```text
+ *      s_11, s_12, ..., s_1n
+ *      s_21, s_22, ..., s_2n
+ * ```
+ *
+ * then `res` will contain the two values
+ *
+ * ```text
+ *      res[0] = g_{k_1}^s11 g_{k_2}^s12 ... g_{k_n}^s1n
+ *      res[1] = g_{k_1}^s21 g_{k_2}^s22 ... g_{k_n}^s2n
+ * ```
+ *
+ * Generators are read from the handle's table by index, so the work and memory of the
+ * computation scale with `n` rather than with the number of generators of the handle.
+ *
+ * Note: `res` must match the generator type of the curve. See `sxt_multiexp_handle_new` for
+ * the types.
+ */
+void sxt_fixed_sparse_multiexponentiation(void* res, const struct sxt_multiexp_handle* handle,
+                                          unsigned element_num_bytes, unsigned num_outputs,
+                                          unsigned n, const uint64_t* indexes,
+                                          const uint8_t* scalars);
+
+/**
+ * Update multiexponentiations in place for changes to scalars using a handle to pre-specified
+ * generators.
+ *
+ * `indexes` specifies `n` changed generator indexes shared by every output, and `old_scalars` and
+ * `new_scalars` specify the scalars of those generators before and after the change as
+ * contiguous multi-dimension `num_outputs` by `n` arrays laid out in column-major order as for
+ * `sxt_fixed_sparse_multiexponentiation`. If `indexes` is null, the changed generators are
+ * `g_{offset}, ..., g_{offset + n - 1}`. If `old_scalars` is null, the old scalars are taken
+ * to be zero (e.g. for rows appended to the committed columns).
+ *
+ * On completion, with `k_j` the changed generator indexes, `a_ij` the old scalars, and `b_ij` the
+ * new scalars, `res[i]` is replaced by
+ *
+ * ```text
+ *      res[i] g_{k_1}^(b_i1 - a_i1) ... g_{k_n}^(b_in - a_in)
+ * ```
+ *
+ * so that an output computed for the old scalars becomes the output for the new scalars. The
+ * differences `b_ij - a_ij` are split into non-negative parts and negated magnitudes and
+ * committed in a single sparse multiexponentiation whose scalars are only as wide as the largest
+ * difference, so the cost scales with `n` and the size of the changes rather than with the
+ * number of generators of the handle.
+ *
+ * The changed generator indexes must be distinct; the call aborts otherwise.
+ *
+ * Note: `res` must match the generator type of the curve. See `sxt_multiexp_handle_new` for
+ * the types.
+ */
+void sxt_fixed_update_multiexponentiation(void* res, const struct sxt_multiexp_handle* handle,
+                                          unsigned element_num_bytes, unsigned num_outputs,
+                                          unsigned n, const uint64_t* indexes, uint64_t offset,
+                                          const uint8_t* old_scalars,
+                                          const uint8_t* new_scalars);
+
 /**
  * Construct a sumcheck proof for a polynomial
  *
@@ -16,13 +16,86 @@
  */
 #include "cbindings/fixed_pedersen.h"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <numeric>
+#include <type_traits>
+#include <vector>
 
 #include "cbindings/backend.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/base/error/panic.h"
+#include "sxt/base/num/divide_up.h"
+#include "sxt/cbindings/base/curve_id_utility.h"
 #include "sxt/cbindings/base/multiexp_handle.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/update_delta.h"
+#include "sxt/multiexp/pippenger2/partition_table_accessor.h"
 
 using namespace sxt;
 
+//--------------------------------------------------------------------------------------------------
+// expand_glv_scalars
+//--------------------------------------------------------------------------------------------------
+/**
+ * Rewrite n rows of packed scalars into the 2n rows that pair with a GLV handle's expanded
+ * generators.
+ */
+static void expand_glv_scalars(memmg::managed_array<uint8_t>& scalars_p,
+                               std::vector<unsigned>& output_bit_table_p,
+                               const cbnb::multiexp_handle& h, const unsigned* output_bit_table,
+                               unsigned num_outputs, unsigned n, const uint8_t* scalars) noexcept {
+  auto backend = cbn::get_backend();
+  output_bit_table_p.resize(num_outputs);
+  backend->expand_glv_scalars(scalars_p, output_bit_table_p, h.curve_id,
+                              basct::cspan<unsigned>{output_bit_table, num_outputs}, n, scalars);
+}
+
+//--------------------------------------------------------------------------------------------------
+// narrow_scalar_width
+//--------------------------------------------------------------------------------------------------
+/**
+ * The fewest bytes, at least one, that hold every one of num_scalars little endian scalars of
+ * element_num_bytes bytes.
+ */
+static unsigned narrow_scalar_width(const uint8_t* scalars, unsigned element_num_bytes,
+                                    size_t num_scalars) noexcept {
+  unsigned res = 1;
+  for (size_t k = 0; k < num_scalars && res < element_num_bytes; ++k) {
+    auto scalar = scalars + k * element_num_bytes;
+    for (auto byte_index = element_num_bytes; byte_index-- > res;) {
+      if (scalar[byte_index] != 0) {
+        res = byte_index + 1u;
+        break;
+      }
+    }
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// max_length
+//--------------------------------------------------------------------------------------------------
+static unsigned max_length(const unsigned* output_lengths, unsigned num_outputs) noexcept {
+  unsigned res = 0;
+  for (unsigned i = 0; i < num_outputs; ++i) {
+    res = std::max(res, output_lengths[i]);
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// double_entries
+//--------------------------------------------------------------------------------------------------
+static std::vector<unsigned> double_entries(const unsigned* values, unsigned n) noexcept {
+  std::vector<unsigned> res(n);
+  for (unsigned i = 0; i < n; ++i) {
+    res[i] = 2u * values[i];
+  }
+  return res;
+}
+
 //--------------------------------------------------------------------------------------------------
 // sxt_multiexp_handle_new
 //--------------------------------------------------------------------------------------------------
@@ -31,11 +104,42 @@ struct sxt_multiexp_handle* sxt_multiexp_handle_new(unsigned curve_id, const voi
   auto res = std::make_unique<cbnb::multiexp_handle>();
   res->curve_id = static_cast<cbnb::curve_id_t>(curve_id);
   auto backend = cbn::get_backend();
+  res->num_generators = n;
   res->partition_table_accessor =
       backend->make_partition_table_accessor(res->curve_id, generators, n);
   return reinterpret_cast<sxt_multiexp_handle*>(res.release());
 }
 
+//--------------------------------------------------------------------------------------------------
+// sxt_multiexp_handle_new_glv
+//--------------------------------------------------------------------------------------------------
+struct sxt_multiexp_handle* sxt_multiexp_handle_new_glv(unsigned curve_id, const void* generators,
+                                                        unsigned n) {
+  auto res = std::make_unique<cbnb::multiexp_handle>();
+  res->curve_id = static_cast<cbnb::curve_id_t>(curve_id);
+  auto backend = cbn::get_backend();
+  res->num_generators = n;
+  res->use_glv = true;
+  res->partition_table_accessor =
+      backend->make_glv_partition_table_accessor(res->curve_id, generators, n);
+  return reinterpret_cast<sxt_multiexp_handle*>(res.release());
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_multiexp_handle_new_signed
+//--------------------------------------------------------------------------------------------------
+struct sxt_multiexp_handle* sxt_multiexp_handle_new_signed(unsigned curve_id,
+                                                           const void* generators, unsigned n) {
+  auto res = std::make_unique<cbnb::multiexp_handle>();
+  res->curve_id = static_cast<cbnb::curve_id_t>(curve_id);
+  auto backend = cbn::get_backend();
+  res->num_generators = n;
+  res->use_signed_table = true;
+  res->partition_table_accessor =
+      backend->make_signed_partition_table_accessor(res->curve_id, generators, n);
+  return reinterpret_cast<sxt_multiexp_handle*>(res.release());
+}
+
 //--------------------------------------------------------------------------------------------------
 // sxt_multiexp_handle_new_from_file
 //--------------------------------------------------------------------------------------------------
@@ -44,7 +148,39 @@ struct sxt_multiexp_handle* sxt_multiexp_handle_new_from_file(unsigned curve_id,
   auto res = std::make_unique<cbnb::multiexp_handle>();
   res->curve_id = static_cast<cbnb::curve_id_t>(curve_id);
   auto backend = cbn::get_backend();
+  if (mtxpp2::is_glv_partition_table_file(filename)) {
+    return sxt_multiexp_handle_new_glv_from_file(curve_id, filename);
+  }
+  if (mtxpp2::is_signed_partition_table_file(filename)) {
+    res->use_signed_table = true;
+    res->partition_table_accessor =
+        backend->read_signed_partition_table_accessor(res->curve_id, filename);
+    res->num_generators = backend->count_signed_partition_table_generators(
+        res->curve_id, *res->partition_table_accessor);
+    return reinterpret_cast<sxt_multiexp_handle*>(res.release());
+  }
+  res->partition_table_accessor = backend->read_partition_table_accessor(res->curve_id, filename);
+  res->num_generators =
+      backend->count_partition_table_generators(res->curve_id, *res->partition_table_accessor);
+  return reinterpret_cast<sxt_multiexp_handle*>(res.release());
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_multiexp_handle_new_glv_from_file
+//--------------------------------------------------------------------------------------------------
+struct sxt_multiexp_handle* sxt_multiexp_handle_new_glv_from_file(unsigned curve_id,
+                                                                  const char* filename) {
+  auto res = std::make_unique<cbnb::multiexp_handle>();
+  res->curve_id = static_cast<cbnb::curve_id_t>(curve_id);
+  auto backend = cbn::get_backend();
+  if (!mtxpp2::is_glv_partition_table_file(filename)) {
+    baser::panic("{} doesn't hold a GLV partition table", filename);
+  }
+  res->use_glv = true;
   res->partition_table_accessor = backend->read_partition_table_accessor(res->curve_id, filename);
+  auto num_generators =
+      backend->count_partition_table_generators(res->curve_id, *res->partition_table_accessor);
+  res->num_generators = basn::divide_up(num_generators, 2u);
   return reinterpret_cast<sxt_multiexp_handle*>(res.release());
 }
 
@@ -56,6 +192,29 @@ void sxt_multiexp_handle_write_to_file(const struct sxt_multiexp_handle* handle,
   auto backend = cbn::get_backend();
   auto h = reinterpret_cast<const cbnb::multiexp_handle*>(handle);
   backend->write_partition_table_accessor(h->curve_id, *h->partition_table_accessor, filename);
+  if (h->use_glv) {
+    mtxpp2::mark_glv_partition_table_file(filename);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_multiexp_handle_extend
+//--------------------------------------------------------------------------------------------------
+void sxt_multiexp_handle_extend(struct sxt_multiexp_handle* handle, const void* generators,
+                                unsigned count) {
+  auto backend = cbn::get_backend();
+  auto h = reinterpret_cast<cbnb::multiexp_handle*>(handle);
+  if (h->use_signed_table) {
+    backend->extend_signed_partition_table_accessor(h->curve_id, *h->partition_table_accessor,
+                                                    generators, count);
+  } else if (h->use_glv) {
+    backend->extend_glv_partition_table_accessor(h->curve_id, *h->partition_table_accessor,
+                                                 h->num_generators, generators, count);
+  } else {
+    backend->extend_partition_table_accessor(h->curve_id, *h->partition_table_accessor,
+                                             h->num_generators, generators, count);
+  }
+  h->num_generators += count;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -73,6 +232,17 @@ void sxt_fixed_multiexponentiation(void* res, const struct sxt_multiexp_handle*
                                    const uint8_t* scalars) {
   auto backend = cbn::get_backend();
   auto h = reinterpret_cast<const cbnb::multiexp_handle*>(handle);
+  if (h->use_signed_table) {
+    backend->fixed_signed_multiexponentiation(res, h->curve_id, *h->partition_table_accessor,
+                                              element_num_bytes, num_outputs, n, scalars);
+    return;
+  }
+  if (h->use_glv) {
+    std::vector<unsigned> output_bit_table(num_outputs, 8u * element_num_bytes);
+    sxt_fixed_packed_multiexponentiation(res, handle, output_bit_table.data(), num_outputs, n,
+                                         scalars);
+    return;
+  }
   backend->fixed_multiexponentiation(res, h->curve_id, *h->partition_table_accessor,
                                      element_num_bytes, num_outputs, n, scalars);
 }
@@ -85,6 +255,24 @@ void sxt_fixed_packed_multiexponentiation(void* res, const struct sxt_multiexp_h
                                           unsigned n, const uint8_t* scalars) {
   auto backend = cbn::get_backend();
   auto h = reinterpret_cast<const cbnb::multiexp_handle*>(handle);
+  if (h->use_signed_table) {
+    std::vector<unsigned> output_firsts(num_outputs);
+    std::vector<unsigned> output_lengths(num_outputs, n);
+    backend->fixed_signed_multiexponentiation(res, h->curve_id, *h->partition_table_accessor,
+                                              output_bit_table, output_firsts.data(),
+                                              output_lengths.data(), num_outputs, scalars);
+    return;
+  }
+  if (h->use_glv) {
+    memmg::managed_array<uint8_t> scalars_p;
+    std::vector<unsigned> output_bit_table_p;
+    expand_glv_scalars(scalars_p, output_bit_table_p, *h, output_bit_table, num_outputs, n,
+                       scalars);
+    backend->fixed_multiexponentiation(res, h->curve_id, *h->partition_table_accessor,
+                                       output_bit_table_p.data(), num_outputs, 2u * n,
+                                       scalars_p.data());
+    return;
+  }
   backend->fixed_multiexponentiation(res, h->curve_id, *h->partition_table_accessor,
                                      output_bit_table, num_outputs, n, scalars);
 }
@@ -98,6 +286,168 @@ void sxt_fixed_vlen_multiexponentiation(void* res, const struct sxt_multiexp_han
                                         const uint8_t* scalars) {
   auto backend = cbn::get_backend();
   auto h = reinterpret_cast<const cbnb::multiexp_handle*>(handle);
+  if (h->use_signed_table) {
+    std::vector<unsigned> output_firsts(num_outputs);
+    backend->fixed_signed_multiexponentiation(res, h->curve_id, *h->partition_table_accessor,
+                                              output_bit_table, output_firsts.data(),
+                                              output_lengths, num_outputs, scalars);
+    return;
+  }
+  if (h->use_glv) {
+    auto n = max_length(output_lengths, num_outputs);
+    memmg::managed_array<uint8_t> scalars_p;
+    std::vector<unsigned> output_bit_table_p;
+    expand_glv_scalars(scalars_p, output_bit_table_p, *h, output_bit_table, num_outputs, n,
+                       scalars);
+    auto output_lengths_p = double_entries(output_lengths, num_outputs);
+    backend->fixed_multiexponentiation(res, h->curve_id, *h->partition_table_accessor,
+                                       output_bit_table_p.data(), output_lengths_p.data(),
+                                       num_outputs, scalars_p.data());
+    return;
+  }
   backend->fixed_multiexponentiation(res, h->curve_id, *h->partition_table_accessor,
                                      output_bit_table, output_lengths, num_outputs, scalars);
 }
+
+//--------------------------------------------------------------------------------------------------
+// sxt_fixed_offset_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void sxt_fixed_offset_multiexponentiation(void* res, const struct sxt_multiexp_handle* handle,
+                                          const unsigned* output_bit_table,
+                                          const unsigned* output_firsts,
+                                          const unsigned* output_lengths, unsigned num_outputs,
+                                          const uint8_t* scalars) {
+  auto backend = cbn::get_backend();
+  auto h = reinterpret_cast<const cbnb::multiexp_handle*>(handle);
+  if (h->use_signed_table) {
+    backend->fixed_signed_multiexponentiation(res, h->curve_id, *h->partition_table_accessor,
+                                              output_bit_table, output_firsts, output_lengths,
+                                              num_outputs, scalars);
+    return;
+  }
+  if (h->use_glv) {
+    auto n = max_length(output_lengths, num_outputs);
+    memmg::managed_array<uint8_t> scalars_p;
+    std::vector<unsigned> output_bit_table_p;
+    expand_glv_scalars(scalars_p, output_bit_table_p, *h, output_bit_table, num_outputs, n,
+                       scalars);
+    auto output_firsts_p = double_entries(output_firsts, num_outputs);
+    auto output_lengths_p = double_entries(output_lengths, num_outputs);
+    backend->fixed_offset_multiexponentiation(
+        res, h->curve_id, *h->partition_table_accessor, output_bit_table_p.data(),
+        output_firsts_p.data(), output_lengths_p.data(), num_outputs, scalars_p.data());
+    return;
+  }
+  backend->fixed_offset_multiexponentiation(res, h->curve_id, *h->partition_table_accessor,
+                                            output_bit_table, output_firsts, output_lengths,
+                                            num_outputs, scalars);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_fixed_sparse_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void sxt_fixed_sparse_multiexponentiation(void* res, const struct sxt_multiexp_handle* handle,
+                                          unsigned element_num_bytes, unsigned num_outputs,
+                                          unsigned n, const uint64_t* indexes,
+                                          const uint8_t* scalars) {
+  auto backend = cbn::get_backend();
+  auto h = reinterpret_cast<const cbnb::multiexp_handle*>(handle);
+  if (h->use_signed_table) {
+    backend->fixed_signed_sparse_multiexponentiation(res, h->curve_id, *h->partition_table_accessor,
+                                                     element_num_bytes, num_outputs, n, indexes,
+                                                     scalars);
+    return;
+  }
+  if (h->use_glv) {
+    // a GLV handle's table interleaves each generator g with phi(g), so gather g directly
+    std::vector<uint64_t> indexes_p(n);
+    for (unsigned i = 0; i < n; ++i) {
+      indexes_p[i] = 2u * indexes[i];
+    }
+    backend->fixed_sparse_multiexponentiation(res, h->curve_id, *h->partition_table_accessor,
+                                              element_num_bytes, num_outputs, n,
+                                              indexes_p.data(), scalars);
+    return;
+  }
+  backend->fixed_sparse_multiexponentiation(res, h->curve_id, *h->partition_table_accessor,
+                                            element_num_bytes, num_outputs, n, indexes, scalars);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_fixed_update_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void sxt_fixed_update_multiexponentiation(void* res, const struct sxt_multiexp_handle* handle,
+                                          unsigned element_num_bytes, unsigned num_outputs,
+                                          unsigned n, const uint64_t* indexes, uint64_t offset,
+                                          const uint8_t* old_scalars,
+                                          const uint8_t* new_scalars) {
+  if (n == 0 || num_outputs == 0) {
+    return;
+  }
+  std::vector<uint64_t> indexes_p;
+  if (indexes == nullptr) {
+    indexes_p.resize(n);
+    std::iota(indexes_p.begin(), indexes_p.end(), offset);
+    indexes = indexes_p.data();
+  } else {
+    indexes_p.assign(indexes, indexes + n);
+    std::sort(indexes_p.begin(), indexes_p.end());
+    SXT_RELEASE_ASSERT(std::adjacent_find(indexes_p.begin(), indexes_p.end()) == indexes_p.end(),
+                       "the rows of an update must be distinct");
+  }
+
+  // Row j pairs generator g_{indexes[j]} with the deltas new - old of every output. Since the
+  // scalars are unsigned, output 2i sums the non-negative deltas of output i and output 2i + 1
+  // the magnitudes of its negative deltas. Without old scalars the deltas are the new scalars.
+  auto num_deltas = num_outputs;
+  auto scalars = new_scalars;
+  std::vector<uint8_t> scalars_p;
+  if (old_scalars != nullptr) {
+    num_deltas = 2u * num_outputs;
+    scalars_p.resize(size_t{element_num_bytes} * num_deltas * n);
+    for (unsigned j = 0; j < n; ++j) {
+      for (unsigned i = 0; i < num_outputs; ++i) {
+        auto positive = scalars_p.data() + (size_t{j} * num_deltas + 2u * i) * element_num_bytes;
+        auto scalar_offset = (size_t{j} * num_outputs + i) * element_num_bytes;
+        mtxb::write_update_delta(positive, positive + element_num_bytes,
+                                 new_scalars + scalar_offset, old_scalars + scalar_offset,
+                                 element_num_bytes, false);
+      }
+    }
+    scalars = scalars_p.data();
+  }
+
+  // only use as many bytes per scalar as the largest delta needs
+  auto num_scalars = size_t{num_deltas} * n;
+  auto delta_num_bytes = narrow_scalar_width(scalars, element_num_bytes, num_scalars);
+  if (delta_num_bytes < element_num_bytes) {
+    if (scalars_p.empty()) {
+      scalars_p.assign(scalars, scalars + num_scalars * element_num_bytes);
+    }
+    for (size_t k = 0; k < num_scalars; ++k) {
+      std::memmove(scalars_p.data() + k * delta_num_bytes,
+                   scalars_p.data() + k * element_num_bytes, delta_num_bytes);
+    }
+    scalars = scalars_p.data();
+  }
+
+  auto h = reinterpret_cast<const cbnb::multiexp_handle*>(handle);
+  cbnb::switch_curve_type(
+      h->curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+        memmg::managed_array<T> deltas(num_deltas);
+        sxt_fixed_sparse_multiexponentiation(deltas.data(), handle, delta_num_bytes, num_deltas,
+                                             n, indexes, scalars);
+        auto outputs = static_cast<T*>(res);
+        if (old_scalars == nullptr) {
+          for (unsigned i = 0; i < num_outputs; ++i) {
+            add(outputs[i], outputs[i], deltas[i]);
+          }
+          return;
+        }
+        for (unsigned i = 0; i < num_outputs; ++i) {
+          add(outputs[i], outputs[i], deltas[2u * i]);
+          neg(deltas[2u * i + 1u], deltas[2u * i + 1u]);
+          add(outputs[i], outputs[i], deltas[2u * i + 1u]);
+        }
+      });
+}
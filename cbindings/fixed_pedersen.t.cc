@@ -16,6 +16,7 @@
  */
 #include "cbindings/fixed_pedersen.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "cbindings/backend.h"
@@ -27,6 +28,9 @@
 #include "sxt/curve21/operation/overload.h"
 #include "sxt/curve21/type/element_p3.h"
 #include "sxt/curve21/type/literal.h"
+#include "sxt/curve_bng1/constant/generator.h"
+#include "sxt/curve_bng1/operation/add.h"
+#include "sxt/curve_bng1/type/element_p2.h"
 
 using namespace sxt;
 using sxt::c21t::operator""_c21;
@@ -118,6 +122,44 @@ TEST_CASE("we can compute multi-exponentiations with a fixed set of generators")
     sxt_multiexp_handle_free(hp);
   }
 
+  SECTION("we can extend a handle with the cpu backend") {
+    cbn::reset_backend_for_testing();
+    const sxt_config config = {SXT_CPU_BACKEND, 0};
+    REQUIRE(sxt_init(&config) == 0);
+
+    wrapped_handle h{generators.data(), 1};
+    REQUIRE(h.h != nullptr);
+    sxt_multiexp_handle_extend(h.h, static_cast<const void*>(generators.data() + 1), 2);
+
+    uint8_t scalars[] = {1, 2, 3};
+    c21t::element_p3 res;
+    sxt_fixed_multiexponentiation(&res, h.h, 1, 1, 3, scalars);
+    REQUIRE(res == generators[0] + 2 * generators[1] + 3 * generators[2]);
+  }
+
+  SECTION("we can extend a handle read from a file") {
+    cbn::reset_backend_for_testing();
+    const sxt_config config = {SXT_CPU_BACKEND, 0};
+    REQUIRE(sxt_init(&config) == 0);
+    bastst::temp_file temp_file{std::ios::binary};
+    temp_file.stream().close();
+
+    wrapped_handle h{generators.data(), 2};
+    REQUIRE(h.h != nullptr);
+    sxt_multiexp_handle_write_to_file(h.h, temp_file.name().c_str());
+
+    auto hp = sxt_multiexp_handle_new_from_file(SXT_CURVE_RISTRETTO255, temp_file.name().c_str());
+    sxt_multiexp_handle_extend(hp, static_cast<const void*>(generators.data() + 2), 1);
+    sxt_multiexp_handle_free(hp);
+
+    hp = sxt_multiexp_handle_new_from_file(SXT_CURVE_RISTRETTO255, temp_file.name().c_str());
+    uint8_t scalars[] = {1, 2, 3};
+    c21t::element_p3 res;
+    sxt_fixed_multiexponentiation(&res, hp, 1, 1, 3, scalars);
+    REQUIRE(res == generators[0] + 2 * generators[1] + 3 * generators[2]);
+    sxt_multiexp_handle_free(hp);
+  }
+
   SECTION("we can compute a multiexponentiation in packed form") {
     cbn::reset_backend_for_testing();
     const sxt_config config = {SXT_GPU_BACKEND, 0};
@@ -168,6 +210,92 @@ TEST_CASE("we can compute multi-exponentiations with a fixed set of generators")
     REQUIRE(res[1] == generators[0] + generators[1]);
   }
 
+  SECTION("we can compute a multiexponentiation with generator offsets on the host") {
+    cbn::reset_backend_for_testing();
+    const sxt_config config = {SXT_CPU_BACKEND, 0};
+    REQUIRE(sxt_init(&config) == 0);
+
+    wrapped_handle h{generators.data(), 3};
+    REQUIRE(h.h != nullptr);
+
+    uint8_t scalars[] = {0b1011, 0b1101};
+    unsigned bit_table[] = {3, 1};
+    unsigned firsts[] = {2, 1};
+    unsigned lengths[] = {1, 2};
+    c21t::element_p3 res[2];
+    sxt_fixed_offset_multiexponentiation(res, h.h, bit_table, firsts, lengths, 2, scalars);
+    REQUIRE(res[0] == 3 * generators[2]);
+    REQUIRE(res[1] == generators[1] + generators[2]);
+  }
+
+  SECTION("we can compute a sparse multiexponentiation on the host") {
+    cbn::reset_backend_for_testing();
+    const sxt_config config = {SXT_CPU_BACKEND, 0};
+    REQUIRE(sxt_init(&config) == 0);
+
+    wrapped_handle h{generators.data(), 3};
+    REQUIRE(h.h != nullptr);
+
+    uint64_t indexes[] = {2, 0};
+    uint8_t scalars[] = {3, 1, 5, 0};
+    c21t::element_p3 res[2];
+    sxt_fixed_sparse_multiexponentiation(res, h.h, 1, 2, 2, indexes, scalars);
+    REQUIRE(res[0] == 3 * generators[2] + 5 * generators[0]);
+    REQUIRE(res[1] == generators[2]);
+  }
+
+  SECTION("we can update a multiexponentiation for changed scalars on the host") {
+    cbn::reset_backend_for_testing();
+    const sxt_config config = {SXT_CPU_BACKEND, 0};
+    REQUIRE(sxt_init(&config) == 0);
+
+    wrapped_handle h{generators.data(), 3};
+    REQUIRE(h.h != nullptr);
+
+    c21t::element_p3 res[2] = {
+        2 * generators[0] + 3 * generators[2],
+        generators[1],
+    };
+    uint64_t indexes[] = {2, 1};
+    uint8_t old_scalars[] = {3, 0, 0, 1};
+    uint8_t new_scalars[] = {7, 4, 5, 0};
+    sxt_fixed_update_multiexponentiation(res, h.h, 1, 2, 2, indexes, 0, old_scalars,
+                                         new_scalars);
+    REQUIRE(res[0] == 2 * generators[0] + 7 * generators[2] + 5 * generators[1]);
+    REQUIRE(res[1] == 4 * generators[2]);
+  }
+
+  SECTION("we can update a multiexponentiation of wide scalars for small changes") {
+    cbn::reset_backend_for_testing();
+    const sxt_config config = {SXT_CPU_BACKEND, 0};
+    REQUIRE(sxt_init(&config) == 0);
+
+    wrapped_handle h{generators.data(), 3};
+    REQUIRE(h.h != nullptr);
+
+    c21t::element_p3 res[1] = {0x10203 * generators[1] + 0x40506 * generators[2]};
+    uint64_t indexes[] = {1, 2};
+    uint8_t old_scalars[] = {0x03, 0x02, 0x01, 0x06, 0x05, 0x04};
+    uint8_t new_scalars[] = {0x05, 0x02, 0x01, 0x01, 0x05, 0x04};
+    sxt_fixed_update_multiexponentiation(res, h.h, 3, 1, 2, indexes, 0, old_scalars,
+                                         new_scalars);
+    REQUIRE(res[0] == 0x10205 * generators[1] + 0x40501 * generators[2]);
+  }
+
+  SECTION("we can update a multiexponentiation for appended scalars on the host") {
+    cbn::reset_backend_for_testing();
+    const sxt_config config = {SXT_CPU_BACKEND, 0};
+    REQUIRE(sxt_init(&config) == 0);
+
+    wrapped_handle h{generators.data(), 3};
+    REQUIRE(h.h != nullptr);
+
+    c21t::element_p3 res[1] = {2 * generators[0]};
+    uint8_t new_scalars[] = {6, 9};
+    sxt_fixed_update_multiexponentiation(res, h.h, 1, 1, 2, nullptr, 1, nullptr, new_scalars);
+    REQUIRE(res[0] == 2 * generators[0] + 6 * generators[1] + 9 * generators[2]);
+  }
+
   SECTION("we can compute a multiexponentiation in packed form with three generators") {
     cbn::reset_backend_for_testing();
     const sxt_config config = {SXT_GPU_BACKEND, 0};
@@ -199,3 +327,238 @@ TEST_CASE("we can compute multi-exponentiations with a fixed set of generators")
     REQUIRE(res[1] == generators[0]);
   }
 }
+
+TEST_CASE("we can compute multi-exponentiations with a GLV handle") {
+  cbn::reset_backend_for_testing();
+  const sxt_config config = {SXT_CPU_BACKEND, 0};
+  REQUIRE(sxt_init(&config) == 0);
+
+  std::vector<cn1t::element_p2> generators(3);
+  generators[0] = cn1cn::generator_p2_v;
+  for (unsigned i = 1; i < generators.size(); ++i) {
+    cn1o::add(generators[i], generators[i - 1], cn1cn::generator_p2_v);
+  }
+
+  auto h = sxt_multiexp_handle_new(SXT_CURVE_BN_254, generators.data(), 2);
+  auto hp = sxt_multiexp_handle_new_glv(SXT_CURVE_BN_254, generators.data(), 2);
+  REQUIRE(hp != nullptr);
+
+  std::vector<uint8_t> scalars(32 * 3 * 2);
+  for (unsigned i = 0; i < scalars.size(); ++i) {
+    scalars[i] = static_cast<uint8_t>(37 * i + 11);
+  }
+  for (unsigned i = 31; i < scalars.size(); i += 32) {
+    scalars[i] = 0;
+  }
+
+  SECTION("we can compute a multiexponentiation with 32 byte scalars") {
+    cn1t::element_p2 expected[2], res[2];
+    sxt_fixed_multiexponentiation(expected, h, 32, 2, 2, scalars.data());
+    sxt_fixed_multiexponentiation(res, hp, 32, 2, 2, scalars.data());
+    REQUIRE(res[0] == expected[0]);
+    REQUIRE(res[1] == expected[1]);
+  }
+
+  SECTION("we can compute a multiexponentiation in packed form") {
+    unsigned bit_table[] = {256, 5, 256};
+    cn1t::element_p2 expected[3], res[3];
+    sxt_fixed_packed_multiexponentiation(expected, h, bit_table, 3, 2, scalars.data());
+    sxt_fixed_packed_multiexponentiation(res, hp, bit_table, 3, 2, scalars.data());
+    REQUIRE(res[0] == expected[0]);
+    REQUIRE(res[1] == expected[1]);
+    REQUIRE(res[2] == expected[2]);
+  }
+
+  SECTION("we can compute a multiexponentiation of varying length") {
+    unsigned bit_table[] = {256, 256};
+    unsigned lengths[] = {1, 2};
+    cn1t::element_p2 expected[2], res[2];
+    sxt_fixed_vlen_multiexponentiation(expected, h, bit_table, lengths, 2, scalars.data());
+    sxt_fixed_vlen_multiexponentiation(res, hp, bit_table, lengths, 2, scalars.data());
+    REQUIRE(res[0] == expected[0]);
+    REQUIRE(res[1] == expected[1]);
+  }
+
+  SECTION("we can compute a sparse multiexponentiation") {
+    uint64_t indexes[] = {1, 0};
+    cn1t::element_p2 expected[2], res[2];
+    sxt_fixed_sparse_multiexponentiation(expected, h, 32, 2, 2, indexes, scalars.data());
+    sxt_fixed_sparse_multiexponentiation(res, hp, 32, 2, 2, indexes, scalars.data());
+    REQUIRE(res[0] == expected[0]);
+    REQUIRE(res[1] == expected[1]);
+    cn1t::element_p2 dense[2];
+    std::vector<uint8_t> dense_scalars(scalars.begin(), scalars.begin() + 32 * 2 * 2);
+    std::copy_n(scalars.begin(), 64, dense_scalars.begin() + 64);
+    std::copy_n(scalars.begin() + 64, 64, dense_scalars.begin());
+    sxt_fixed_multiexponentiation(dense, h, 32, 2, 2, dense_scalars.data());
+    REQUIRE(res[0] == dense[0]);
+    REQUIRE(res[1] == dense[1]);
+  }
+
+  SECTION("we can update a multiexponentiation") {
+    // replace the second row of scalars with the third
+    uint64_t indexes[] = {1};
+    cn1t::element_p2 expected[2], res[2];
+    sxt_fixed_multiexponentiation(res, hp, 32, 2, 2, scalars.data());
+    sxt_fixed_update_multiexponentiation(res, hp, 32, 2, 1, indexes, 0, scalars.data() + 64,
+                                         scalars.data() + 128);
+    std::vector<uint8_t> updated_scalars(scalars.begin(), scalars.begin() + 128);
+    std::copy_n(scalars.begin() + 128, 64, updated_scalars.begin() + 64);
+    sxt_fixed_multiexponentiation(expected, h, 32, 2, 2, updated_scalars.data());
+    REQUIRE(res[0] == expected[0]);
+    REQUIRE(res[1] == expected[1]);
+  }
+
+  SECTION("we can extend a GLV handle and use generator offsets") {
+    sxt_multiexp_handle_extend(h, generators.data() + 2, 1);
+    sxt_multiexp_handle_extend(hp, generators.data() + 2, 1);
+    unsigned bit_table[] = {256, 256};
+    unsigned firsts[] = {1, 0};
+    unsigned lengths[] = {2, 3};
+    cn1t::element_p2 expected[2], res[2];
+    sxt_fixed_offset_multiexponentiation(expected, h, bit_table, firsts, lengths, 2,
+                                         scalars.data());
+    sxt_fixed_offset_multiexponentiation(res, hp, bit_table, firsts, lengths, 2, scalars.data());
+    REQUIRE(res[0] == expected[0]);
+    REQUIRE(res[1] == expected[1]);
+  }
+
+  SECTION("GLV handles written to a file are detected when read back") {
+    bastst::temp_file temp_file{std::ios::binary};
+    temp_file.stream().close();
+    sxt_multiexp_handle_write_to_file(hp, temp_file.name().c_str());
+    for (auto hpp : {
+             sxt_multiexp_handle_new_from_file(SXT_CURVE_BN_254, temp_file.name().c_str()),
+             sxt_multiexp_handle_new_glv_from_file(SXT_CURVE_BN_254, temp_file.name().c_str()),
+         }) {
+      cn1t::element_p2 expected[2], res[2];
+      sxt_fixed_multiexponentiation(expected, h, 32, 2, 2, scalars.data());
+      sxt_fixed_multiexponentiation(res, hpp, 32, 2, 2, scalars.data());
+      REQUIRE(res[0] == expected[0]);
+      REQUIRE(res[1] == expected[1]);
+      sxt_multiexp_handle_free(hpp);
+    }
+  }
+
+  sxt_multiexp_handle_free(h);
+  sxt_multiexp_handle_free(hp);
+}
+
+TEST_CASE("we can compute multi-exponentiations with a signed handle") {
+  std::vector<c21t::element_p3> generators = {
+      0x123_c21,
+      0x456_c21,
+      0x789_c21,
+  };
+
+  cbn::reset_backend_for_testing();
+  const sxt_config config = {SXT_CPU_BACKEND, 0};
+  REQUIRE(sxt_init(&config) == 0);
+
+  auto h = sxt_multiexp_handle_new_signed(SXT_CURVE_RISTRETTO255, generators.data(), 3);
+  REQUIRE(h != nullptr);
+
+  SECTION("we can compute a multiexponentiation") {
+    uint8_t scalars[] = {1, 0, 0, 2, 0, 0};
+    c21t::element_p3 res;
+    sxt_fixed_multiexponentiation(&res, h, 2, 1, 3, scalars);
+    REQUIRE(res == generators[0] + 2 * 256 * generators[1]);
+
+    uint8_t scalars_p[] = {6, 3, 1, 4, 2, 8};
+    c21t::element_p3 res_p[2];
+    sxt_fixed_multiexponentiation(res_p, h, 1, 2, 3, scalars_p);
+    REQUIRE(res_p[0] == 6 * generators[0] + generators[1] + 2 * generators[2]);
+    REQUIRE(res_p[1] == 3 * generators[0] + 4 * generators[1] + 8 * generators[2]);
+  }
+
+  SECTION("we can read and write a signed handle to a file") {
+    bastst::temp_file temp_file{std::ios::binary};
+    temp_file.stream().close();
+    sxt_multiexp_handle_write_to_file(h, temp_file.name().c_str());
+
+    auto hp = sxt_multiexp_handle_new_from_file(SXT_CURVE_RISTRETTO255, temp_file.name().c_str());
+    uint8_t scalars[] = {1, 2, 3};
+    c21t::element_p3 res;
+    sxt_fixed_multiexponentiation(&res, hp, 1, 1, 3, scalars);
+    REQUIRE(res == generators[0] + 2 * generators[1] + 3 * generators[2]);
+    sxt_multiexp_handle_free(hp);
+  }
+
+  SECTION("we can compute a sparse multiexponentiation") {
+    uint64_t indexes[] = {2, 0};
+    uint8_t scalars[] = {3, 1, 5, 0};
+    c21t::element_p3 res[2];
+    sxt_fixed_sparse_multiexponentiation(res, h, 1, 2, 2, indexes, scalars);
+    REQUIRE(res[0] == 3 * generators[2] + 5 * generators[0]);
+    REQUIRE(res[1] == generators[2]);
+  }
+
+  SECTION("we can update a multiexponentiation") {
+    c21t::element_p3 res[1] = {2 * generators[0] + 3 * generators[2]};
+    uint64_t indexes[] = {2};
+    uint8_t old_scalars[] = {3};
+    uint8_t new_scalars[] = {7};
+    sxt_fixed_update_multiexponentiation(res, h, 1, 1, 1, indexes, 0, old_scalars, new_scalars);
+    REQUIRE(res[0] == 2 * generators[0] + 7 * generators[2]);
+  }
+
+  SECTION("we can compute a multiexponentiation in packed form") {
+    uint8_t scalars[] = {0b1010, 0b0101, 0b1111};
+    unsigned bit_table[] = {3, 1};
+    c21t::element_p3 res[2];
+    sxt_fixed_packed_multiexponentiation(res, h, bit_table, 2, 3, scalars);
+    REQUIRE(res[0] == 2 * generators[0] + 5 * generators[1] + 7 * generators[2]);
+    REQUIRE(res[1] == generators[0] + generators[2]);
+  }
+
+  SECTION("we can compute a multiexponentiation of varying length") {
+    uint8_t scalars[] = {0b1011, 0b1101};
+    unsigned bit_table[] = {3, 1};
+    unsigned lengths[] = {1, 2};
+    c21t::element_p3 res[2];
+    sxt_fixed_vlen_multiexponentiation(res, h, bit_table, lengths, 2, scalars);
+    REQUIRE(res[0] == 3 * generators[0]);
+    REQUIRE(res[1] == generators[0] + generators[1]);
+  }
+
+  SECTION("we can compute a multiexponentiation with generator offsets") {
+    uint8_t scalars[] = {0b1011, 0b1101};
+    unsigned bit_table[] = {3, 1};
+    unsigned firsts[] = {2, 1};
+    unsigned lengths[] = {1, 2};
+    c21t::element_p3 res[2];
+    sxt_fixed_offset_multiexponentiation(res, h, bit_table, firsts, lengths, 2, scalars);
+    REQUIRE(res[0] == 3 * generators[2]);
+    REQUIRE(res[1] == generators[1] + generators[2]);
+  }
+
+  SECTION("we can extend a signed handle") {
+    c21t::element_p3 new_generators[] = {0xabc_c21, 0xdef_c21};
+    sxt_multiexp_handle_extend(h, new_generators, 2);
+    uint8_t scalars[] = {1, 2, 3, 4, 5};
+    c21t::element_p3 res;
+    sxt_fixed_multiexponentiation(&res, h, 1, 1, 5, scalars);
+    REQUIRE(res == generators[0] + 2 * generators[1] + 3 * generators[2] +
+                       4 * new_generators[0] + 5 * new_generators[1]);
+  }
+
+  SECTION("extending a signed handle read from a file updates the file") {
+    bastst::temp_file temp_file{std::ios::binary};
+    temp_file.stream().close();
+    sxt_multiexp_handle_write_to_file(h, temp_file.name().c_str());
+    auto hp = sxt_multiexp_handle_new_from_file(SXT_CURVE_RISTRETTO255, temp_file.name().c_str());
+    c21t::element_p3 new_generators[] = {0xabc_c21};
+    sxt_multiexp_handle_extend(hp, new_generators, 1);
+    sxt_multiexp_handle_free(hp);
+
+    hp = sxt_multiexp_handle_new_from_file(SXT_CURVE_RISTRETTO255, temp_file.name().c_str());
+    uint8_t scalars[] = {1, 2, 3, 4};
+    c21t::element_p3 res;
+    sxt_fixed_multiexponentiation(&res, hp, 1, 1, 4, scalars);
+    REQUIRE(res ==
+            generators[0] + 2 * generators[1] + 3 * generators[2] + 4 * new_generators[0]);
+    sxt_multiexp_handle_free(hp);
+  }
+
+  sxt_multiexp_handle_free(h);
+}
@@ -16,23 +16,43 @@
  */
 #include "cbindings/pedersen.h"
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <limits>
+#include <type_traits>
+#include <vector>
 
 #include "cbindings/backend.h"
 #include "sxt/base/error/assert.h"
+#include "sxt/cbindings/base/curve_id.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/neg.h"
 #include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve_bng1/operation/add.h"
+#include "sxt/curve_bng1/operation/neg.h"
 #include "sxt/curve_bng1/type/conversion_utility.h"
 #include "sxt/curve_bng1/type/element_affine.h"
 #include "sxt/curve_bng1/type/element_p2.h"
+#include "sxt/curve_g1/operation/add.h"
+#include "sxt/curve_g1/operation/compression.h"
+#include "sxt/curve_g1/operation/neg.h"
 #include "sxt/curve_g1/type/compressed_element.h"
 #include "sxt/curve_g1/type/conversion_utility.h"
 #include "sxt/curve_g1/type/element_affine.h"
 #include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/curve_gk/operation/add.h"
+#include "sxt/curve_gk/operation/neg.h"
 #include "sxt/curve_gk/type/conversion_utility.h"
 #include "sxt/curve_gk/type/element_affine.h"
 #include "sxt/curve_gk/type/element_p2.h"
 #include "sxt/memory/management/managed_array.h"
 #include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/base/generator_utility.h"
+#include "sxt/multiexp/base/sparse_sequence_utility.h"
+#include "sxt/multiexp/base/update_delta.h"
+#include "sxt/ristretto/base/byte_conversion.h"
+#include "sxt/ristretto/operation/compression.h"
 #include "sxt/ristretto/type/compressed_element.h"
 
 using namespace sxt;
@@ -67,17 +87,78 @@ static uint64_t populate_exponent_sequence(basct::span<mtxb::exponent_sequence>
   return longest_sequence;
 }
 
+//--------------------------------------------------------------------------------------------------
+// populate_exponent_sequence
+//--------------------------------------------------------------------------------------------------
+static uint64_t
+populate_exponent_sequence(basct::span<mtxb::exponent_sequence> sequences,
+                           basct::cspan<sxt_sparse_sequence_descriptor> descriptors) {
+  SXT_RELEASE_ASSERT(descriptors.data() != nullptr);
+
+  uint64_t num_generators = 0;
+
+  for (uint32_t i = 0; i < sequences.size(); ++i) {
+    auto& curr_descriptor = descriptors[i];
+
+    SXT_RELEASE_ASSERT(curr_descriptor.n == 0 || curr_descriptor.data != nullptr);
+
+    SXT_RELEASE_ASSERT(curr_descriptor.n == 0 || curr_descriptor.indexes != nullptr);
+
+    SXT_RELEASE_ASSERT(curr_descriptor.element_nbytes != 0 && curr_descriptor.element_nbytes <= 32);
+
+    sequences[i] = {
+        .element_nbytes = curr_descriptor.element_nbytes,
+        .n = curr_descriptor.n,
+        .data = curr_descriptor.data,
+        .is_signed = curr_descriptor.is_signed,
+        .indexes = curr_descriptor.indexes,
+    };
+
+    num_generators = std::max(num_generators, mtxb::count_generators(sequences[i]));
+  }
+
+  return num_generators;
+}
+
+//--------------------------------------------------------------------------------------------------
+// compact_generators
+//--------------------------------------------------------------------------------------------------
+/**
+ * For sparse sequences, copy out only the referenced generators so that converting them to
+ * projective form doesn't touch the rest.
+ */
+template <class T>
+static basct::cspan<T> compact_generators(std::vector<T>& generators_data,
+                                          std::vector<uint64_t>& indexes_data,
+                                          basct::span<mtxb::exponent_sequence> sequences,
+                                          const T* generators, uint64_t num_generators) {
+  basct::cspan<T> res{generators, num_generators};
+  if (!mtxb::has_sparse_sequences(sequences)) {
+    return res;
+  }
+  std::vector<uint64_t> generator_indexes;
+  mtxb::compact_sparse_sequences(generator_indexes, indexes_data, sequences);
+  generators_data.resize(generator_indexes.size());
+  mtxb::gather_generators<T>(generators_data, res, generator_indexes);
+  return generators_data;
+}
+
 //--------------------------------------------------------------------------------------------------
 // process_compute_pedersen_commitments
 //--------------------------------------------------------------------------------------------------
+template <class Descriptor = sxt_sequence_descriptor>
 static void process_compute_pedersen_commitments(struct sxt_ristretto255_compressed* commitments,
-                                                 basct::cspan<sxt_sequence_descriptor> descriptors,
+                                                 basct::cspan<Descriptor> descriptors,
                                                  const c21t::element_p3* generators,
                                                  uint64_t offset_generators) {
   if (descriptors.size() == 0)
     return;
 
   SXT_RELEASE_ASSERT(commitments != nullptr);
+  if constexpr (std::is_same_v<Descriptor, sxt_sparse_sequence_descriptor>) {
+    // sparse sequences are only committed to with explicit generators, as for the other curves
+    SXT_RELEASE_ASSERT(generators != nullptr);
+  }
   SXT_RELEASE_ASSERT(sxt::cbn::is_backend_initialized());
   static_assert(sizeof(rstt::compressed_element) == sizeof(sxt_ristretto255_compressed),
                 "types must be ABI compatible");
@@ -104,8 +185,9 @@ static void process_compute_pedersen_commitments(struct sxt_ristretto255_compres
 //--------------------------------------------------------------------------------------------------
 // process_compute_pedersen_commitments
 //--------------------------------------------------------------------------------------------------
+template <class Descriptor = sxt_sequence_descriptor>
 static void process_compute_pedersen_commitments(struct sxt_bls12_381_g1_compressed* commitments,
-                                                 basct::cspan<sxt_sequence_descriptor> descriptors,
+                                                 basct::cspan<Descriptor> descriptors,
                                                  const cg1t::element_affine* generators,
                                                  uint64_t offset_generators) {
   if (descriptors.size() == 0)
@@ -119,13 +201,16 @@ static void process_compute_pedersen_commitments(struct sxt_bls12_381_g1_compres
 
   memmg::managed_array<mtxb::exponent_sequence> sequences(descriptors.size());
   auto num_generators = populate_exponent_sequence(sequences, descriptors);
+  std::vector<cg1t::element_affine> generators_data;
+  std::vector<uint64_t> indexes_data;
+  auto generators_a =
+      compact_generators(generators_data, indexes_data, sequences, generators, num_generators);
 
   auto backend = cbn::get_backend();
 
   // Convert from affine to projective elements
-  memmg::managed_array<cg1t::element_p2> generators_p(num_generators);
-  cg1t::batch_to_element_p2(generators_p,
-                            basct::cspan<cg1t::element_affine>{generators, num_generators});
+  memmg::managed_array<cg1t::element_p2> generators_p(generators_a.size());
+  cg1t::batch_to_element_p2(generators_p, generators_a);
 
   backend->compute_commitments(
       {reinterpret_cast<cg1t::compressed_element*>(commitments), descriptors.size()}, sequences,
@@ -135,8 +220,9 @@ static void process_compute_pedersen_commitments(struct sxt_bls12_381_g1_compres
 //--------------------------------------------------------------------------------------------------
 // process_compute_pedersen_commitments
 //--------------------------------------------------------------------------------------------------
+template <class Descriptor = sxt_sequence_descriptor>
 static void process_compute_pedersen_commitments(struct sxt_bn254_g1* commitments,
-                                                 basct::cspan<sxt_sequence_descriptor> descriptors,
+                                                 basct::cspan<Descriptor> descriptors,
                                                  const cn1t::element_affine* generators,
                                                  uint64_t offset_generators) {
   if (descriptors.size() == 0)
@@ -150,13 +236,16 @@ static void process_compute_pedersen_commitments(struct sxt_bn254_g1* commitment
 
   memmg::managed_array<mtxb::exponent_sequence> sequences(descriptors.size());
   auto num_generators = populate_exponent_sequence(sequences, descriptors);
+  std::vector<cn1t::element_affine> generators_data;
+  std::vector<uint64_t> indexes_data;
+  auto generators_a =
+      compact_generators(generators_data, indexes_data, sequences, generators, num_generators);
 
   auto backend = cbn::get_backend();
 
   // Convert from affine to projective elements
-  memmg::managed_array<cn1t::element_p2> generators_p(num_generators);
-  cn1t::batch_to_element_p2(generators_p,
-                            basct::cspan<cn1t::element_affine>{generators, num_generators});
+  memmg::managed_array<cn1t::element_p2> generators_p(generators_a.size());
+  cn1t::batch_to_element_p2(generators_p, generators_a);
 
   backend->compute_commitments(
       {reinterpret_cast<cn1t::element_affine*>(commitments), descriptors.size()}, sequences,
@@ -166,8 +255,9 @@ static void process_compute_pedersen_commitments(struct sxt_bn254_g1* commitment
 //--------------------------------------------------------------------------------------------------
 // process_compute_pedersen_commitments
 //--------------------------------------------------------------------------------------------------
+template <class Descriptor = sxt_sequence_descriptor>
 static void process_compute_pedersen_commitments(struct sxt_grumpkin* commitments,
-                                                 basct::cspan<sxt_sequence_descriptor> descriptors,
+                                                 basct::cspan<Descriptor> descriptors,
                                                  const cgkt::element_affine* generators,
                                                  uint64_t offset_generators) {
   if (descriptors.size() == 0)
@@ -181,18 +271,169 @@ static void process_compute_pedersen_commitments(struct sxt_grumpkin* commitment
 
   memmg::managed_array<mtxb::exponent_sequence> sequences(descriptors.size());
   auto num_generators = populate_exponent_sequence(sequences, descriptors);
+  std::vector<cgkt::element_affine> generators_data;
+  std::vector<uint64_t> indexes_data;
+  auto generators_a =
+      compact_generators(generators_data, indexes_data, sequences, generators, num_generators);
 
   auto backend = cbn::get_backend();
 
   // Convert from affine to projective elements
-  memmg::managed_array<cgkt::element_p2> generators_p(num_generators);
-  cgkt::batch_to_element_p2(generators_p,
-                            basct::cspan<cgkt::element_affine>{generators, num_generators});
+  memmg::managed_array<cgkt::element_p2> generators_p(generators_a.size());
+  cgkt::batch_to_element_p2(generators_p, generators_a);
 
   backend->compute_commitments(
       {reinterpret_cast<cgkt::element_affine*>(commitments), descriptors.size()}, sequences,
       generators_p);
 }
+
+//--------------------------------------------------------------------------------------------------
+// to_generator
+//--------------------------------------------------------------------------------------------------
+static void to_generator(c21t::element_p3& e, const c21t::element_p3& g) noexcept { e = g; }
+
+static void to_generator(cg1t::element_p2& e, const cg1t::element_affine& g) noexcept {
+  cg1t::to_element_p2(e, g);
+}
+
+static void to_generator(cn1t::element_p2& e, const cn1t::element_affine& g) noexcept {
+  cn1t::to_element_p2(e, g);
+}
+
+static void to_generator(cgkt::element_p2& e, const cgkt::element_affine& g) noexcept {
+  cgkt::to_element_p2(e, g);
+}
+
+//--------------------------------------------------------------------------------------------------
+// update_row
+//--------------------------------------------------------------------------------------------------
+static uint64_t update_row(const sxt_sequence_update_descriptor& descriptor, uint64_t j) noexcept {
+  return descriptor.indexes != nullptr ? descriptor.indexes[j] : descriptor.offset + j;
+}
+
+//--------------------------------------------------------------------------------------------------
+// to_element
+//--------------------------------------------------------------------------------------------------
+static void to_element(c21t::element_p3& e, const sxt_ristretto255_compressed& c) noexcept {
+  auto rcode = rstb::from_bytes(e, reinterpret_cast<const uint8_t*>(&c));
+  SXT_RELEASE_ASSERT(rcode == 0, "commitment must be a valid ristretto255 encoding");
+}
+
+static void to_element(cg1t::element_p2& e, const sxt_bls12_381_g1_compressed& c) noexcept {
+  auto rcode = cg1o::decompress(e, reinterpret_cast<const cg1t::compressed_element&>(c));
+  SXT_RELEASE_ASSERT(rcode == 0, "commitment must be a valid bls12-381 G1 encoding");
+}
+
+static void to_element(cn1t::element_p2& e, const sxt_bn254_g1& c) noexcept {
+  cn1t::to_element_p2(e, reinterpret_cast<const cn1t::element_affine&>(c));
+}
+
+static void to_element(cgkt::element_p2& e, const sxt_grumpkin& c) noexcept {
+  cgkt::to_element_p2(e, reinterpret_cast<const cgkt::element_affine&>(c));
+}
+
+//--------------------------------------------------------------------------------------------------
+// from_element
+//--------------------------------------------------------------------------------------------------
+static void from_element(sxt_ristretto255_compressed& c, const c21t::element_p3& e) noexcept {
+  rsto::compress(reinterpret_cast<rstt::compressed_element&>(c), e);
+}
+
+static void from_element(sxt_bls12_381_g1_compressed& c, const cg1t::element_p2& e) noexcept {
+  cg1o::compress(reinterpret_cast<cg1t::compressed_element&>(c), e);
+}
+
+static void from_element(sxt_bn254_g1& c, const cn1t::element_p2& e) noexcept {
+  cn1t::to_element_affine(reinterpret_cast<cn1t::element_affine&>(c), e);
+}
+
+static void from_element(sxt_grumpkin& c, const cgkt::element_p2& e) noexcept {
+  cgkt::to_element_affine(reinterpret_cast<cgkt::element_affine&>(c), e);
+}
+
+//--------------------------------------------------------------------------------------------------
+// process_update_pedersen_commitments
+//--------------------------------------------------------------------------------------------------
+/**
+ * The deltas new - old of all sequences are committed in one multiexponentiation over the
+ * generators of the distinct updated rows. Since the backend multiexponentiation takes unsigned
+ * scalars, output 2i sums the non-negative deltas of sequence i and output 2i + 1 the magnitudes
+ * of its negative deltas.
+ */
+template <class Element, class Commitment, class Generator>
+static void
+process_update_pedersen_commitments(Commitment* commitments,
+                                    basct::cspan<sxt_sequence_update_descriptor> descriptors,
+                                    const Generator* generators, cbnb::curve_id_t curve_id) {
+  if (descriptors.size() == 0)
+    return;
+
+  SXT_RELEASE_ASSERT(commitments != nullptr);
+  SXT_RELEASE_ASSERT(descriptors.data() != nullptr);
+  SXT_RELEASE_ASSERT(generators != nullptr);
+  SXT_RELEASE_ASSERT(sxt::cbn::is_backend_initialized());
+
+  // collect the distinct updated rows
+  std::vector<uint64_t> rows;
+  unsigned element_nbytes = 1;
+  for (auto& curr_descriptor : descriptors) {
+    SXT_RELEASE_ASSERT(curr_descriptor.n == 0 || curr_descriptor.new_data != nullptr);
+    SXT_RELEASE_ASSERT(curr_descriptor.element_nbytes != 0 &&
+                       curr_descriptor.element_nbytes <= 32);
+    SXT_RELEASE_ASSERT(!curr_descriptor.is_signed || curr_descriptor.element_nbytes <= 16);
+    element_nbytes = std::max<unsigned>(element_nbytes, curr_descriptor.element_nbytes);
+    for (uint64_t j = 0; j < curr_descriptor.n; ++j) {
+      rows.push_back(update_row(curr_descriptor, j));
+    }
+  }
+  std::sort(rows.begin(), rows.end());
+  rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+  if (rows.empty()) {
+    return;
+  }
+  SXT_RELEASE_ASSERT(rows.size() <= std::numeric_limits<unsigned>::max(),
+                     "the number of updated rows must fit in an unsigned int");
+  auto n = static_cast<unsigned>(rows.size());
+  std::vector<Element> generators_p(n);
+  for (unsigned i = 0; i < n; ++i) {
+    to_generator(generators_p[i], generators[rows[i]]);
+  }
+
+  // lay out the deltas with the scalars of row i for output o at (i * num_outputs + o)
+  auto num_outputs = static_cast<unsigned>(2 * descriptors.size());
+  std::vector<uint8_t> scalars(size_t{n} * num_outputs * element_nbytes);
+  for (size_t output_index = 0; output_index < descriptors.size(); ++output_index) {
+    auto& curr_descriptor = descriptors[output_index];
+    auto curr_nbytes = curr_descriptor.element_nbytes;
+    for (uint64_t j = 0; j < curr_descriptor.n; ++j) {
+      auto row = update_row(curr_descriptor, j);
+      auto i = std::lower_bound(rows.begin(), rows.end(), row) - rows.begin();
+      auto positive = scalars.data() + (i * num_outputs + 2 * output_index) * element_nbytes;
+      SXT_RELEASE_ASSERT(std::all_of(positive, positive + 2 * element_nbytes,
+                                     [](uint8_t x) noexcept { return x == 0; }),
+                         "the rows of an update must be distinct");
+      auto old_value = curr_descriptor.old_data != nullptr
+                           ? curr_descriptor.old_data + j * curr_nbytes
+                           : nullptr;
+      mtxb::write_update_delta(positive, positive + element_nbytes,
+                               curr_descriptor.new_data + j * curr_nbytes, old_value,
+                               curr_nbytes, curr_descriptor.is_signed != 0);
+    }
+  }
+  std::vector<Element> deltas(num_outputs);
+  cbn::get_backend()->multiexponentiation(deltas.data(), curve_id, generators_p.data(),
+                                          element_nbytes, num_outputs, n, scalars.data());
+
+  // commitment += sum of positive deltas - sum of negative deltas
+  for (size_t i = 0; i < descriptors.size(); ++i) {
+    Element e;
+    to_element(e, commitments[i]);
+    add(e, e, deltas[2 * i]);
+    neg(deltas[2 * i + 1], deltas[2 * i + 1]);
+    add(e, e, deltas[2 * i + 1]);
+    from_element(commitments[i], e);
+  }
+}
 } // namespace sxt::cbn
 
 //--------------------------------------------------------------------------------------------------
@@ -249,3 +490,99 @@ void sxt_curve25519_compute_pedersen_commitments(sxt_ristretto255_compressed* co
   cbn::process_compute_pedersen_commitments(commitments, {descriptors, num_sequences}, nullptr,
                                             offset_generators);
 }
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_compute_sparse_pedersen_commitments_with_generators
+//--------------------------------------------------------------------------------------------------
+void sxt_curve25519_compute_sparse_pedersen_commitments_with_generators(
+    struct sxt_ristretto255_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_sparse_sequence_descriptor* descriptors,
+    const struct sxt_ristretto255* generators) {
+  cbn::process_compute_pedersen_commitments<sxt_sparse_sequence_descriptor>(
+      commitments, {descriptors, num_sequences},
+      reinterpret_cast<const c21t::element_p3*>(generators), 0);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_bls12_381_g1_compute_sparse_pedersen_commitments_with_generators
+//--------------------------------------------------------------------------------------------------
+void sxt_bls12_381_g1_compute_sparse_pedersen_commitments_with_generators(
+    struct sxt_bls12_381_g1_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_sparse_sequence_descriptor* descriptors,
+    const struct sxt_bls12_381_g1* generators) {
+  cbn::process_compute_pedersen_commitments<sxt_sparse_sequence_descriptor>(
+      commitments, {descriptors, num_sequences},
+      reinterpret_cast<const cg1t::element_affine*>(generators), 0);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_bn254_g1_uncompressed_compute_sparse_pedersen_commitments_with_generators
+//--------------------------------------------------------------------------------------------------
+void sxt_bn254_g1_uncompressed_compute_sparse_pedersen_commitments_with_generators(
+    struct sxt_bn254_g1* commitments, uint32_t num_sequences,
+    const struct sxt_sparse_sequence_descriptor* descriptors,
+    const struct sxt_bn254_g1* generators) {
+  cbn::process_compute_pedersen_commitments<sxt_sparse_sequence_descriptor>(
+      commitments, {descriptors, num_sequences},
+      reinterpret_cast<const cn1t::element_affine*>(generators), 0);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_grumpkin_uncompressed_compute_sparse_pedersen_commitments_with_generators
+//--------------------------------------------------------------------------------------------------
+void sxt_grumpkin_uncompressed_compute_sparse_pedersen_commitments_with_generators(
+    struct sxt_grumpkin* commitments, uint32_t num_sequences,
+    const struct sxt_sparse_sequence_descriptor* descriptors,
+    const struct sxt_grumpkin* generators) {
+  cbn::process_compute_pedersen_commitments<sxt_sparse_sequence_descriptor>(
+      commitments, {descriptors, num_sequences},
+      reinterpret_cast<const cgkt::element_affine*>(generators), 0);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_curve25519_update_pedersen_commitments_with_generators
+//--------------------------------------------------------------------------------------------------
+void sxt_curve25519_update_pedersen_commitments_with_generators(
+    struct sxt_ristretto255_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_update_descriptor* descriptors,
+    const struct sxt_ristretto255* generators) {
+  cbn::process_update_pedersen_commitments<c21t::element_p3>(
+      commitments, {descriptors, num_sequences},
+      reinterpret_cast<const c21t::element_p3*>(generators), cbnb::curve_id_t::curve25519);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_bls12_381_g1_update_pedersen_commitments_with_generators
+//--------------------------------------------------------------------------------------------------
+void sxt_bls12_381_g1_update_pedersen_commitments_with_generators(
+    struct sxt_bls12_381_g1_compressed* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_update_descriptor* descriptors,
+    const struct sxt_bls12_381_g1* generators) {
+  cbn::process_update_pedersen_commitments<cg1t::element_p2>(
+      commitments, {descriptors, num_sequences},
+      reinterpret_cast<const cg1t::element_affine*>(generators), cbnb::curve_id_t::bls12_381);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_bn254_g1_uncompressed_update_pedersen_commitments_with_generators
+//--------------------------------------------------------------------------------------------------
+void sxt_bn254_g1_uncompressed_update_pedersen_commitments_with_generators(
+    struct sxt_bn254_g1* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_update_descriptor* descriptors,
+    const struct sxt_bn254_g1* generators) {
+  cbn::process_update_pedersen_commitments<cn1t::element_p2>(
+      commitments, {descriptors, num_sequences},
+      reinterpret_cast<const cn1t::element_affine*>(generators), cbnb::curve_id_t::bn254);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sxt_grumpkin_uncompressed_update_pedersen_commitments_with_generators
+//--------------------------------------------------------------------------------------------------
+void sxt_grumpkin_uncompressed_update_pedersen_commitments_with_generators(
+    struct sxt_grumpkin* commitments, uint32_t num_sequences,
+    const struct sxt_sequence_update_descriptor* descriptors,
+    const struct sxt_grumpkin* generators) {
+  cbn::process_update_pedersen_commitments<cgkt::element_p2>(
+      commitments, {descriptors, num_sequences},
+      reinterpret_cast<const cgkt::element_affine*>(generators), cbnb::curve_id_t::grumpkin);
+}
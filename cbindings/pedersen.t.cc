@@ -16,6 +16,7 @@
  */
 #include "cbindings/pedersen.h"
 
+#include <random>
 #include <type_traits>
 #include <vector>
 
@@ -136,6 +137,41 @@ static sxt_sequence_descriptor make_sequence_descriptor(const std::vector<T>& da
   };
 }
 
+//--------------------------------------------------------------------------------------------------
+// make_sparse_sequence_descriptor
+//--------------------------------------------------------------------------------------------------
+template <class T>
+static sxt_sparse_sequence_descriptor
+make_sparse_sequence_descriptor(const std::vector<T>& data, const std::vector<uint64_t>& indexes) {
+  SXT_DEBUG_ASSERT(data.size() == indexes.size());
+  return {
+      .element_nbytes = sizeof(T),
+      .n = data.size(),
+      .data = reinterpret_cast<const uint8_t*>(data.data()),
+      .indexes = indexes.data(),
+      .is_signed = std::is_signed_v<T>,
+  };
+}
+
+//--------------------------------------------------------------------------------------------------
+// make_sequence_update_descriptor
+//--------------------------------------------------------------------------------------------------
+template <class T>
+static sxt_sequence_update_descriptor
+make_sequence_update_descriptor(const std::vector<T>& old_data, const std::vector<T>& new_data,
+                                const std::vector<uint64_t>& indexes) {
+  SXT_DEBUG_ASSERT(old_data.size() == new_data.size());
+  SXT_DEBUG_ASSERT(new_data.size() == indexes.size());
+  return {
+      .element_nbytes = sizeof(T),
+      .n = new_data.size(),
+      .old_data = reinterpret_cast<const uint8_t*>(old_data.data()),
+      .new_data = reinterpret_cast<const uint8_t*>(new_data.data()),
+      .indexes = indexes.data(),
+      .is_signed = std::is_signed_v<T>,
+  };
+}
+
 //--------------------------------------------------------------------------------------------------
 // compute_expected_ristretto255_commitment
 //--------------------------------------------------------------------------------------------------
@@ -315,6 +351,36 @@ static void test_ristretto255_pedersen_commitments_with_given_backend_and_no_gen
     REQUIRE(commit_c == commitments_data[2]);
   }
 
+  SECTION("We can compute commitments to a mix of low and high cardinality sequences") {
+    std::mt19937_64 rng{0};
+    const std::vector<uint64_t> values = {0, 5, 7, 1000};
+    std::vector<uint64_t> data_1(3000), data_2(3000), data_3(3000);
+    for (size_t i = 0; i < data_1.size(); ++i) {
+      data_1[i] = values[rng() % values.size()];
+      data_2[i] = rng() >> 2u;
+      data_3[i] = data_1[i] + data_2[i];
+    }
+    const sxt_sequence_descriptor valid_descriptors[] = {
+        make_sequence_descriptor(data_1),
+        make_sequence_descriptor(data_2),
+        make_sequence_descriptor(data_3),
+    };
+    constexpr uint64_t num_sequences = std::size(valid_descriptors);
+    rstt::compressed_element commitments_data[num_sequences];
+    sxt_curve25519_compute_pedersen_commitments(
+        reinterpret_cast<sxt_ristretto255_compressed*>(commitments_data), num_sequences,
+        valid_descriptors, 0);
+
+    rstt::compressed_element commitment_1;
+    sxt_curve25519_compute_pedersen_commitments(
+        reinterpret_cast<sxt_ristretto255_compressed*>(&commitment_1), 1, valid_descriptors, 0);
+    REQUIRE(commitment_1 == commitments_data[0]);
+
+    rstt::compressed_element expected;
+    rsto::add(expected, commitments_data[0], commitments_data[1]);
+    REQUIRE(expected == commitments_data[2]);
+  }
+
   SECTION("We can compute commitments with a non-zero offset generator") {
     const uint64_t offset_gens = 10;
     const std::vector<uint8_t> data = {1, 0, 2, 6, 0, 7};
@@ -355,6 +421,91 @@ static void test_ristretto255_pedersen_commitments_with_given_backend_and_genera
     REQUIRE(*reinterpret_cast<rstt::compressed_element*>(&commitments_data) == expected_commitment);
   }
 
+  SECTION("We can compute commitments to sparse sequences") {
+    const std::vector<uint32_t> data_1 = {0, 0, 5, 0, 0, 0, 0, 2000, 0, 7};
+    const std::vector<int16_t> data_2 = {0, -3, 0, 0, 0, 0, 0, 0, 0, 0};
+    const std::vector<uint32_t> values_1 = {2000, 5, 7};
+    const std::vector<uint64_t> indexes_1 = {7, 2, 9};
+    const std::vector<int16_t> values_2 = {-3};
+    const std::vector<uint64_t> indexes_2 = {1};
+    const std::vector<uint8_t> data_3 = {1, 2, 3};
+    const std::vector<uint64_t> indexes_3 = {0, 1, 2};
+    const sxt_sparse_sequence_descriptor descriptors[] = {
+        make_sparse_sequence_descriptor(values_1, indexes_1),
+        make_sparse_sequence_descriptor(values_2, indexes_2),
+        make_sparse_sequence_descriptor(data_3, indexes_3),
+        make_sparse_sequence_descriptor(values_1, indexes_1),
+    };
+    const auto generators = compute_random_curve25519_generators(data_1.size(), 10);
+
+    rstt::compressed_element commitments_data[4];
+    sxt_curve25519_compute_sparse_pedersen_commitments_with_generators(
+        reinterpret_cast<sxt_ristretto255_compressed*>(commitments_data), 4, descriptors,
+        reinterpret_cast<const sxt_ristretto255*>(generators.data()));
+
+    const sxt_sequence_descriptor dense_descriptors[] = {
+        make_sequence_descriptor(data_1),
+        make_sequence_descriptor(data_2),
+        make_sequence_descriptor(data_3),
+    };
+    rstt::compressed_element expected[3];
+    sxt_curve25519_compute_pedersen_commitments_with_generators(
+        reinterpret_cast<sxt_ristretto255_compressed*>(expected), 3, dense_descriptors,
+        reinterpret_cast<const sxt_ristretto255*>(generators.data()));
+    REQUIRE(commitments_data[0] == expected[0]);
+    REQUIRE(commitments_data[1] == expected[1]);
+    REQUIRE(commitments_data[2] == expected[2]);
+    REQUIRE(commitments_data[3] == expected[0]);
+  }
+
+  SECTION("We can update commitments for modified and appended rows") {
+    std::vector<int32_t> data_1 = {0, 3, 5, 0, 0, 0, 0, 2000, 0, 7};
+    std::vector<int32_t> data_2 = {1, 2, 3};
+    const auto generators = compute_random_curve25519_generators(data_1.size(), 10);
+    const sxt_sequence_descriptor dense_descriptors[] = {
+        make_sequence_descriptor(data_1),
+        make_sequence_descriptor(data_2),
+    };
+    rstt::compressed_element commitments_data[2];
+    sxt_curve25519_compute_pedersen_commitments_with_generators(
+        reinterpret_cast<sxt_ristretto255_compressed*>(commitments_data), 2, dense_descriptors,
+        reinterpret_cast<const sxt_ristretto255*>(generators.data()));
+
+    const std::vector<int32_t> old_values = {2000, 0, 3};
+    const std::vector<int32_t> new_values = {-4, 11, 3};
+    const std::vector<uint64_t> indexes = {7, 4, 1};
+    const std::vector<int32_t> appended_values = {-9, 8};
+    const sxt_sequence_update_descriptor updates[] = {
+        make_sequence_update_descriptor(old_values, new_values, indexes),
+        {
+            .element_nbytes = sizeof(int32_t),
+            .n = appended_values.size(),
+            .old_data = nullptr,
+            .new_data = reinterpret_cast<const uint8_t*>(appended_values.data()),
+            .indexes = nullptr,
+            .offset = data_2.size(),
+            .is_signed = 1,
+        },
+    };
+    sxt_curve25519_update_pedersen_commitments_with_generators(
+        reinterpret_cast<sxt_ristretto255_compressed*>(commitments_data), 2, updates,
+        reinterpret_cast<const sxt_ristretto255*>(generators.data()));
+
+    data_1[7] = -4;
+    data_1[4] = 11;
+    data_2.insert(data_2.end(), appended_values.begin(), appended_values.end());
+    const sxt_sequence_descriptor updated_descriptors[] = {
+        make_sequence_descriptor(data_1),
+        make_sequence_descriptor(data_2),
+    };
+    rstt::compressed_element expected[2];
+    sxt_curve25519_compute_pedersen_commitments_with_generators(
+        reinterpret_cast<sxt_ristretto255_compressed*>(expected), 2, updated_descriptors,
+        reinterpret_cast<const sxt_ristretto255*>(generators.data()));
+    REQUIRE(commitments_data[0] == expected[0]);
+    REQUIRE(commitments_data[1] == expected[1]);
+  }
+
   cbn::reset_backend_for_testing();
 }
 
@@ -387,6 +538,37 @@ static void test_bls12_381_g1_pedersen_commitments_with_given_backend_and_genera
     REQUIRE(*reinterpret_cast<cg1t::compressed_element*>(&commitments_data) == expected_commitment);
   }
 
+  SECTION("We can update commitments for modified rows") {
+    constexpr std::array<uint8_t, 32> a{0x1b, 0xa7, 0x6d, 0xa5, 0x98, 0x82, 0x56, 0x2b,
+                                        0xd2, 0x19, 0xf5, 0xe,  0xc8, 0xfa, 0x5,  0x85,
+                                        0x91, 0xe7, 0x1d, 0x5e, 0xd2, 0x60, 0x22, 0x10,
+                                        0x6a, 0xdc, 0x18, 0xfd, 0xfc, 0xf8, 0x9a, 0xc};
+    constexpr std::array<uint8_t, 32> b{0x01, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+                                        0x0,  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+                                        0x0,  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0};
+    constexpr std::array<uint8_t, 32> zero{};
+
+    std::vector<std::array<uint8_t, 32>> data = {a, b, zero};
+    const auto seq_descriptor = make_sequence_descriptor(data);
+    const auto generators = get_bls12_381_g1_generators(data.size(), 10);
+    sxt_bls12_381_g1_compressed commitments_data;
+    sxt_bls12_381_g1_compute_pedersen_commitments_with_generators(
+        &commitments_data, 1, &seq_descriptor,
+        reinterpret_cast<const sxt_bls12_381_g1*>(generators.data()));
+
+    const std::vector<std::array<uint8_t, 32>> old_values = {zero, a};
+    const std::vector<std::array<uint8_t, 32>> new_values = {a, b};
+    const std::vector<uint64_t> indexes = {2, 0};
+    const auto update = make_sequence_update_descriptor(old_values, new_values, indexes);
+    sxt_bls12_381_g1_update_pedersen_commitments_with_generators(
+        &commitments_data, 1, &update,
+        reinterpret_cast<const sxt_bls12_381_g1*>(generators.data()));
+
+    data = {b, b, a};
+    const auto expected_commitment = compute_expected_bls12_381_g1_commitment(data, generators);
+    REQUIRE(*reinterpret_cast<cg1t::compressed_element*>(&commitments_data) == expected_commitment);
+  }
+
   cbn::reset_backend_for_testing();
 }
 
@@ -419,6 +601,96 @@ static void test_bn254_g1_pedersen_commitments_with_given_backend_and_generators
     REQUIRE(*reinterpret_cast<cn1t::element_affine*>(&commitments_data) == expected_commitment);
   }
 
+  SECTION("We can compute commitments to sparse sequences") {
+    constexpr std::array<uint8_t, 32> a{0x1b, 0xa7, 0x6d, 0xa5, 0x98, 0x82, 0x56, 0x2b,
+                                        0xd2, 0x19, 0xf5, 0xe,  0xc8, 0xfa, 0x5,  0x85,
+                                        0x91, 0xe7, 0x1d, 0x5e, 0xd2, 0x60, 0x22, 0x10,
+                                        0x6a, 0xdc, 0x18, 0xfd, 0xfc, 0xf8, 0x9a, 0xc};
+    constexpr std::array<uint8_t, 32> b{0x01, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+                                        0x0,  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+                                        0x0,  0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0};
+    constexpr std::array<uint8_t, 32> zero{};
+
+    const std::vector<std::array<uint8_t, 32>> data = {zero, b, zero, a};
+    const std::vector<std::array<uint8_t, 32>> values = {a, b};
+    const std::vector<uint64_t> indexes = {3, 1};
+    const auto seq_descriptor = make_sparse_sequence_descriptor(values, indexes);
+    const auto generators = get_bn254_g1_generators(data.size(), 10);
+    const auto expected_commitment = compute_expected_bn254_g1_commitment(data, generators);
+
+    sxt_bn254_g1 commitments_data;
+    sxt_bn254_g1_uncompressed_compute_sparse_pedersen_commitments_with_generators(
+        &commitments_data, 1, &seq_descriptor,
+        reinterpret_cast<const sxt_bn254_g1*>(generators.data()));
+    REQUIRE(*reinterpret_cast<cn1t::element_affine*>(&commitments_data) == expected_commitment);
+  }
+
+  SECTION("We can update commitments for modified and appended rows") {
+    std::vector<uint64_t> data = {4, 0, 9, 1};
+    const auto seq_descriptor = make_sequence_descriptor(data);
+    const auto generators = get_bn254_g1_generators(6, 10);
+    sxt_bn254_g1 commitments_data;
+    sxt_bn254_g1_uncompressed_compute_pedersen_commitments_with_generators(
+        &commitments_data, 1, &seq_descriptor,
+        reinterpret_cast<const sxt_bn254_g1*>(generators.data()));
+
+    const std::vector<uint64_t> old_values = {9, 0, 0};
+    const std::vector<uint64_t> new_values = {2, 7, 12};
+    const std::vector<uint64_t> indexes = {2, 1, 5};
+    const auto update = make_sequence_update_descriptor(old_values, new_values, indexes);
+    sxt_bn254_g1_uncompressed_update_pedersen_commitments_with_generators(
+        &commitments_data, 1, &update, reinterpret_cast<const sxt_bn254_g1*>(generators.data()));
+
+    data = {4, 7, 2, 1, 0, 12};
+    const auto updated_descriptor = make_sequence_descriptor(data);
+    sxt_bn254_g1 expected_commitment;
+    sxt_bn254_g1_uncompressed_compute_pedersen_commitments_with_generators(
+        &expected_commitment, 1, &updated_descriptor,
+        reinterpret_cast<const sxt_bn254_g1*>(generators.data()));
+    REQUIRE(*reinterpret_cast<cn1t::element_affine*>(&commitments_data) ==
+            *reinterpret_cast<cn1t::element_affine*>(&expected_commitment));
+  }
+
+  SECTION("We can update commitments with different element sizes and overlapping rows") {
+    std::vector<uint8_t> data_1 = {255, 3, 0, 200};
+    std::vector<int16_t> data_2 = {-32768, 5, 32767, -1};
+    const auto generators = get_bn254_g1_generators(4, 10);
+    const sxt_sequence_descriptor descriptors[] = {
+        make_sequence_descriptor(data_1),
+        make_sequence_descriptor(data_2),
+    };
+    sxt_bn254_g1 commitments_data[2];
+    sxt_bn254_g1_uncompressed_compute_pedersen_commitments_with_generators(
+        commitments_data, 2, descriptors, reinterpret_cast<const sxt_bn254_g1*>(generators.data()));
+
+    const std::vector<uint8_t> old_values_1 = {255, 200};
+    const std::vector<uint8_t> new_values_1 = {0, 255};
+    const std::vector<uint64_t> indexes_1 = {0, 3};
+    const std::vector<int16_t> old_values_2 = {-32768, 32767, -1};
+    const std::vector<int16_t> new_values_2 = {32767, -32768, -1};
+    const std::vector<uint64_t> indexes_2 = {0, 2, 3};
+    const sxt_sequence_update_descriptor updates[] = {
+        make_sequence_update_descriptor(old_values_1, new_values_1, indexes_1),
+        make_sequence_update_descriptor(old_values_2, new_values_2, indexes_2),
+    };
+    sxt_bn254_g1_uncompressed_update_pedersen_commitments_with_generators(
+        commitments_data, 2, updates, reinterpret_cast<const sxt_bn254_g1*>(generators.data()));
+
+    data_1 = {0, 3, 0, 255};
+    data_2 = {32767, 5, -32768, -1};
+    const sxt_sequence_descriptor updated_descriptors[] = {
+        make_sequence_descriptor(data_1),
+        make_sequence_descriptor(data_2),
+    };
+    sxt_bn254_g1 expected[2];
+    sxt_bn254_g1_uncompressed_compute_pedersen_commitments_with_generators(
+        expected, 2, updated_descriptors, reinterpret_cast<const sxt_bn254_g1*>(generators.data()));
+    for (int i = 0; i < 2; ++i) {
+      REQUIRE(*reinterpret_cast<cn1t::element_affine*>(&commitments_data[i]) ==
+              *reinterpret_cast<cn1t::element_affine*>(&expected[i]));
+    }
+  }
+
   cbn::reset_backend_for_testing();
 }
 
@@ -451,6 +723,31 @@ static void test_grumpkin_pedersen_commitments_with_given_backend_and_generators
     REQUIRE(*reinterpret_cast<cgkt::element_affine*>(&commitments_data) == expected_commitment);
   }
 
+  SECTION("We can update commitments for modified rows") {
+    std::vector<int8_t> data = {4, -1, 9};
+    const auto seq_descriptor = make_sequence_descriptor(data);
+    const auto generators = get_grumpkin_generators(data.size(), 10);
+    sxt_grumpkin commitments_data;
+    sxt_grumpkin_uncompressed_compute_pedersen_commitments_with_generators(
+        &commitments_data, 1, &seq_descriptor,
+        reinterpret_cast<const sxt_grumpkin*>(generators.data()));
+
+    const std::vector<int8_t> old_values = {-1, 4};
+    const std::vector<int8_t> new_values = {3, -5};
+    const std::vector<uint64_t> indexes = {1, 0};
+    const auto update = make_sequence_update_descriptor(old_values, new_values, indexes);
+    sxt_grumpkin_uncompressed_update_pedersen_commitments_with_generators(
+        &commitments_data, 1, &update, reinterpret_cast<const sxt_grumpkin*>(generators.data()));
+
+    data = {-5, 3, 9};
+    sxt_grumpkin expected_commitment;
+    sxt_grumpkin_uncompressed_compute_pedersen_commitments_with_generators(
+        &expected_commitment, 1, &seq_descriptor,
+        reinterpret_cast<const sxt_grumpkin*>(generators.data()));
+    REQUIRE(*reinterpret_cast<cgkt::element_affine*>(&commitments_data) ==
+            *reinterpret_cast<cgkt::element_affine*>(&expected_commitment));
+  }
+
   cbn::reset_backend_for_testing();
 }
 
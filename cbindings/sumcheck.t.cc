@@ -19,9 +19,14 @@
 #include <vector>
 
 #include "cbindings/backend.h"
+#include "sxt/base/num/fast_random_number_generator.h"
 #include "sxt/base/test/unit_test.h"
+#include "sxt/cbindings/backend/callback_sumcheck_transcript.h"
+#include "sxt/proof/sumcheck/cpu_driver.h"
+#include "sxt/proof/sumcheck/proof_computation.h"
 #include "sxt/proof/sumcheck/reference_transcript.h"
 #include "sxt/scalar25/operation/overload.h"
+#include "sxt/scalar25/random/element.h"
 #include "sxt/scalar25/realization/field.h"
 #include "sxt/scalar25/type/literal.h"
 
@@ -95,3 +100,56 @@ TEST_CASE("we can create sumcheck proofs") {
     }
   }
 }
+
+TEST_CASE("sumcheck proofs on the CPU match proofs computed directly") {
+  cbn::reset_backend_for_testing();
+  const sxt_config config = {SXT_CPU_BACKEND, 0};
+  REQUIRE(sxt_init(&config) == 0);
+
+  basn::fast_random_number_generator rng{1, 2};
+  const unsigned n = 5;
+  const unsigned num_variables = 3;
+  std::vector<s25t::element> mles(2 * n);
+  s25rn::generate_random_elements(mles, rng);
+  std::vector<std::pair<s25t::element, unsigned>> product_table = {
+      {0x3_s25, 2},
+      {0x7_s25, 1},
+  };
+  std::vector<unsigned> product_terms = {0, 1, 1};
+  sumcheck_descriptor descriptor{
+      .mles = mles.data(),
+      .product_table = product_table.data(),
+      .product_terms = product_terms.data(),
+      .n = n,
+      .num_mles = 2,
+      .num_products = 2,
+      .num_product_terms = 3,
+      .round_degree = 2,
+  };
+
+  auto f = [](s25t::element* r, void* context, const s25t::element* polynomial,
+              unsigned polynomial_len) noexcept {
+    static_cast<prfsk::reference_transcript<s25t::element>*>(context)->round_challenge(
+        *r, {polynomial, polynomial_len});
+  };
+
+  std::vector<s25t::element> polynomials(3 * num_variables);
+  std::vector<s25t::element> evaluation_point(num_variables);
+  prft::transcript base_transcript{"abc"};
+  prfsk::reference_transcript<s25t::element> transcript{base_transcript};
+  sxt_prove_sumcheck(polynomials.data(), evaluation_point.data(), SXT_FIELD_SCALAR255,
+                     &descriptor, reinterpret_cast<void*>(+f), &transcript);
+
+  std::vector<s25t::element> expected_polynomials(polynomials.size());
+  std::vector<s25t::element> expected_evaluation_point(num_variables);
+  prft::transcript base_transcript_p{"abc"};
+  prfsk::reference_transcript<s25t::element> transcript_p{base_transcript_p};
+  cbnbck::callback_sumcheck_transcript<s25t::element> callback_transcript{+f, &transcript_p};
+  prfsk::cpu_driver<s25t::element> drv;
+  auto fut = prfsk::prove_sum<s25t::element>(expected_polynomials, expected_evaluation_point,
+                                             callback_transcript, drv, mles, product_table,
+                                             product_terms, n);
+  REQUIRE(fut.ready());
+  REQUIRE(polynomials == expected_polynomials);
+  REQUIRE(evaluation_point == expected_evaluation_point);
+}
@@ -0,0 +1,45 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "sxt/base/macro/cuda_callable.h"
+
+namespace sxt::basbt {
+//--------------------------------------------------------------------------------------------------
+// transpose8x8
+//--------------------------------------------------------------------------------------------------
+/**
+ * Transpose an 8x8 matrix of bits.
+ *
+ * Byte i of x holds row i of the matrix and bit j of a byte holds column j. After transposing,
+ * byte j of the result holds column j with bit i set to the value of row i.
+ *
+ * See Hacker's Delight, section 7-3.
+ */
+CUDA_CALLABLE constexpr uint64_t transpose8x8(uint64_t x) noexcept {
+  uint64_t t;
+  t = (x ^ (x >> 7u)) & 0x00aa00aa00aa00aaull;
+  x = x ^ t ^ (t << 7u);
+  t = (x ^ (x >> 14u)) & 0x0000cccc0000ccccull;
+  x = x ^ t ^ (t << 14u);
+  t = (x ^ (x >> 28u)) & 0x00000000f0f0f0f0ull;
+  x = x ^ t ^ (t << 28u);
+  return x;
+}
+} // namespace sxt::basbt
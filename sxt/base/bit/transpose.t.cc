@@ -0,0 +1,49 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/base/bit/transpose.h"
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::basbt;
+
+static bool get_bit(uint64_t x, unsigned row, unsigned column) noexcept {
+  return ((x >> (8u * row + column)) & 1u) != 0;
+}
+
+TEST_CASE("we can transpose 8x8 bit matrices") {
+  SECTION("we handle the zero and identity matrices") {
+    REQUIRE(transpose8x8(0) == 0);
+    REQUIRE(transpose8x8(0x8040201008040201ull) == 0x8040201008040201ull);
+  }
+
+  SECTION("a single row becomes a single column") {
+    REQUIRE(transpose8x8(0xffull) == 0x0101010101010101ull);
+    REQUIRE(transpose8x8(0b101ull << 8u) == ((1ull << 1u) | (1ull << 17u)));
+  }
+
+  SECTION("we can transpose an arbitrary matrix") {
+    uint64_t x = 0x0123456789abcdefull;
+    auto y = transpose8x8(x);
+    for (unsigned i = 0; i < 8; ++i) {
+      for (unsigned j = 0; j < 8; ++j) {
+        REQUIRE(get_bit(x, i, j) == get_bit(y, j, i));
+      }
+    }
+    REQUIRE(transpose8x8(y) == x);
+  }
+}
@@ -0,0 +1,49 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "sxt/base/container/span.h"
+
+namespace sxt::bascrv {
+//--------------------------------------------------------------------------------------------------
+// batch_addable
+//--------------------------------------------------------------------------------------------------
+/**
+ * Element types whose curve provides batch_add_inplace overloads that compute independent
+ * additions together.
+ *
+ * Curves opt in explicitly with a batch_addable member in their type header, so every translation
+ * unit selects the same path regardless of which operation headers it includes.
+ */
+template <class T>
+concept batch_addable = requires { requires T::batch_addable; };
+
+//--------------------------------------------------------------------------------------------------
+// batch_operations_declared
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks that the batch_add_inplace overload of a batch_addable type is visible.
+ *
+ * Code that takes the batched path asserts this, so that a translation unit missing the curve's
+ * batch_add operation header fails to compile instead of silently taking another path.
+ */
+template <class T>
+concept batch_operations_declared =
+    batch_addable<T> && requires(basct::span<T> res, basct::cspan<T> e) {
+      batch_add_inplace(res, e);
+    };
+} // namespace sxt::bascrv
@@ -0,0 +1,79 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "sxt/base/type/int.h"
+
+namespace sxt::bascrv {
+//--------------------------------------------------------------------------------------------------
+// make_uint128
+//--------------------------------------------------------------------------------------------------
+constexpr uint128_t make_uint128(uint64_t high, uint64_t low) noexcept {
+  return (static_cast<uint128_t>(high) << 64u) | low;
+}
+
+//--------------------------------------------------------------------------------------------------
+// decomposition_parameters
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parameters for splitting a scalar k into two half-length scalars k1 and k2 with
+ *
+ *    k = k1 + k2 lambda (mod r)
+ *
+ * where lambda is the eigenvalue of an efficiently computable endomorphism of the curve.
+ *
+ * (a1, b1) and (a2, b2) form a reduced basis of the lattice {(x, y) : x + y lambda = 0 (mod r)}
+ * with a1 b2 - a2 b1 = r. Writing (k, 0) = c1 (a1, b1) + c2 (a2, b2) with
+ *
+ *    c1 = k b2 / r
+ *    c2 = -k b1 / r
+ *
+ * and rounding c1 and c2 down gives the lattice point closest to (k, 0) from below. The
+ * difference, shifted by the lattice vector (w1, w2), is the decomposition
+ *
+ *    k1 = k - c1 a1 - c2 a2 + w1
+ *    k2 = -c1 b1 - c2 b2 + w2
+ *
+ * The shift is chosen so that both k1 and k2 are non-negative and less than 2^128. See
+ *
+ *   Faster Point Multiplication on Elliptic Curves with Efficient Endomorphisms
+ *   https://link.springer.com/chapter/10.1007/3-540-44647-8_11
+ */
+struct decomposition_parameters {
+  // the order of the group
+  std::array<uint64_t, 4> r;
+
+  // the numerators b2 and -b1
+  uint128_t n1;
+  uint128_t n2;
+
+  // floor(2^256 n1 / r) and floor(2^256 n2 / r), used to estimate c1 and c2
+  std::array<uint64_t, 3> g1;
+  std::array<uint64_t, 3> g2;
+
+  // the lattice basis and shift modulo 2^128
+  uint128_t a1;
+  uint128_t b1;
+  uint128_t a2;
+  uint128_t b2;
+  uint128_t w1;
+  uint128_t w2;
+};
+} // namespace sxt::bascrv
@@ -0,0 +1,168 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/base/field/montgomery_adx.h"
+
+#include "sxt/base/error/panic.h"
+#include "sxt/base/field/arithmetic_utility.h"
+
+// Each row of the product adds rdx * x[0..n) into the accumulator limbs with mulx, sending the low
+// words through the adox (overflow flag) chain and the high words through the adcx (carry flag)
+// chain so that the two additions don't serialize on a single flag. Since p's top limb is below
+// 2^62, the accumulator never exceeds n + 1 limbs, and the low limb of each reduction row becomes
+// zero, which lets the rows rotate through the limb registers instead of shifting them.
+#define SXT_MULX_ADD(offset, x, t_lo, t_hi)                                                        \
+  "mulxq " #offset "(%[" #x "]), %[lo], %[hi]\n\t"                                                 \
+  "adoxq %[lo], %[" #t_lo "]\n\t"                                                                  \
+  "adcxq %[hi], %[" #t_hi "]\n\t"
+
+#define SXT_FOLD_OVERFLOW(t)                                                                       \
+  "movl $0, %k[lo]\n\t"                                                                            \
+  "adoxq %[lo], %[" #t "]\n\t"
+
+#define SXT_PRODUCT_ROW4(offset, t0, t1, t2, t3, t4)                                               \
+  "movq " #offset "(%[b]), %%rdx\n\t"                                                              \
+  "xorl %k[lo], %k[lo]\n\t" SXT_MULX_ADD(0, a, t0, t1) SXT_MULX_ADD(8, a, t1, t2)                  \
+      SXT_MULX_ADD(16, a, t2, t3) SXT_MULX_ADD(24, a, t3, t4) SXT_FOLD_OVERFLOW(t4)
+
+#define SXT_REDUCTION_ROW4(t0, t1, t2, t3, t4)                                                     \
+  "movq %[" #t0 "], %%rdx\n\t"                                                                     \
+  "imulq %[inv], %%rdx\n\t"                                                                        \
+  "xorl %k[lo], %k[lo]\n\t" SXT_MULX_ADD(0, p, t0, t1) SXT_MULX_ADD(8, p, t1, t2)                  \
+      SXT_MULX_ADD(16, p, t2, t3) SXT_MULX_ADD(24, p, t3, t4) SXT_FOLD_OVERFLOW(t4)
+
+#define SXT_PRODUCT_ROW6(offset, t0, t1, t2, t3, t4, t5, t6)                                       \
+  "movq " #offset "(%[b]), %%rdx\n\t"                                                              \
+  "xorl %k[lo], %k[lo]\n\t" SXT_MULX_ADD(0, a, t0, t1) SXT_MULX_ADD(8, a, t1, t2)                  \
+      SXT_MULX_ADD(16, a, t2, t3) SXT_MULX_ADD(24, a, t3, t4) SXT_MULX_ADD(32, a, t4, t5)          \
+          SXT_MULX_ADD(40, a, t5, t6) SXT_FOLD_OVERFLOW(t6)
+
+#define SXT_REDUCTION_ROW6(t0, t1, t2, t3, t4, t5, t6)                                             \
+  "movq %[" #t0 "], %%rdx\n\t"                                                                     \
+  "imulq %[inv], %%rdx\n\t"                                                                        \
+  "xorl %k[lo], %k[lo]\n\t" SXT_MULX_ADD(0, p, t0, t1) SXT_MULX_ADD(8, p, t1, t2)                  \
+      SXT_MULX_ADD(16, p, t2, t3) SXT_MULX_ADD(24, p, t3, t4) SXT_MULX_ADD(32, p, t4, t5)          \
+          SXT_MULX_ADD(40, p, t5, t6) SXT_FOLD_OVERFLOW(t6)
+
+namespace sxt::basfld {
+//--------------------------------------------------------------------------------------------------
+// subtract_modulus
+//--------------------------------------------------------------------------------------------------
+/**
+ * h = t - p if t >= p and h = t otherwise
+ */
+template <unsigned N>
+static void subtract_modulus(uint64_t h[N], const uint64_t t[N], const uint64_t p[N]) noexcept {
+  uint64_t r[N];
+  uint64_t borrow = 0;
+  for (unsigned i = 0; i < N; ++i) {
+    sbb(r[i], borrow, t[i], p[i]);
+  }
+  // borrow is all ones if t < p
+  for (unsigned i = 0; i < N; ++i) {
+    h[i] = (t[i] & borrow) | (r[i] & ~borrow);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// montgomery_multiply4_adx
+//--------------------------------------------------------------------------------------------------
+void montgomery_multiply4_adx(uint64_t h[4], const uint64_t a[4], const uint64_t b[4],
+                              const uint64_t p[4], uint64_t inv) noexcept {
+#if defined(__x86_64__)
+  uint64_t t0, t1, t2, t3, t4, lo, hi;
+  asm("xorl %k[t0], %k[t0]\n\t"
+      "xorl %k[t1], %k[t1]\n\t"
+      "xorl %k[t2], %k[t2]\n\t"
+      "xorl %k[t3], %k[t3]\n\t"
+      "xorl %k[t4], %k[t4]\n\t"
+      // after each reduction row the low limb is zero and becomes the new high limb
+      SXT_PRODUCT_ROW4(0, t0, t1, t2, t3, t4) SXT_REDUCTION_ROW4(t0, t1, t2, t3, t4)
+          SXT_PRODUCT_ROW4(8, t1, t2, t3, t4, t0) SXT_REDUCTION_ROW4(t1, t2, t3, t4, t0)
+              SXT_PRODUCT_ROW4(16, t2, t3, t4, t0, t1) SXT_REDUCTION_ROW4(t2, t3, t4, t0, t1)
+                  SXT_PRODUCT_ROW4(24, t3, t4, t0, t1, t2) SXT_REDUCTION_ROW4(t3, t4, t0, t1, t2)
+      : [t0] "=&r"(t0), [t1] "=&r"(t1), [t2] "=&r"(t2), [t3] "=&r"(t3), [t4] "=&r"(t4),
+        [lo] "=&r"(lo), [hi] "=&r"(hi)
+      : [a] "r"(a), [b] "r"(b), [p] "r"(p), [inv] "rm"(inv)
+      : "rdx", "cc", "memory");
+  const uint64_t t[4] = {t4, t0, t1, t2};
+  subtract_modulus<4>(h, t, p);
+#else
+  baser::panic("montgomery_multiply4_adx requires an x86-64 host");
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+// montgomery_square4_adx
+//--------------------------------------------------------------------------------------------------
+void montgomery_square4_adx(uint64_t h[4], const uint64_t a[4], const uint64_t p[4],
+                            uint64_t inv) noexcept {
+  montgomery_multiply4_adx(h, a, a, p, inv);
+}
+
+//--------------------------------------------------------------------------------------------------
+// montgomery_multiply6_adx
+//--------------------------------------------------------------------------------------------------
+void montgomery_multiply6_adx(uint64_t h[6], const uint64_t a[6], const uint64_t b[6],
+                              const uint64_t p[6], uint64_t inv) noexcept {
+#if defined(__x86_64__)
+  uint64_t t0, t1, t2, t3, t4, t5, t6, lo, hi;
+  asm("xorl %k[t0], %k[t0]\n\t"
+      "xorl %k[t1], %k[t1]\n\t"
+      "xorl %k[t2], %k[t2]\n\t"
+      "xorl %k[t3], %k[t3]\n\t"
+      "xorl %k[t4], %k[t4]\n\t"
+      "xorl %k[t5], %k[t5]\n\t"
+      "xorl %k[t6], %k[t6]\n\t"
+      // after each reduction row the low limb is zero and becomes the new high limb
+      SXT_PRODUCT_ROW6(0, t0, t1, t2, t3, t4, t5, t6)
+          SXT_REDUCTION_ROW6(t0, t1, t2, t3, t4, t5, t6)
+              SXT_PRODUCT_ROW6(8, t1, t2, t3, t4, t5, t6, t0)
+                  SXT_REDUCTION_ROW6(t1, t2, t3, t4, t5, t6, t0)
+                      SXT_PRODUCT_ROW6(16, t2, t3, t4, t5, t6, t0, t1)
+                          SXT_REDUCTION_ROW6(t2, t3, t4, t5, t6, t0, t1)
+                              SXT_PRODUCT_ROW6(24, t3, t4, t5, t6, t0, t1, t2)
+                                  SXT_REDUCTION_ROW6(t3, t4, t5, t6, t0, t1, t2)
+                                      SXT_PRODUCT_ROW6(32, t4, t5, t6, t0, t1, t2, t3)
+                                          SXT_REDUCTION_ROW6(t4, t5, t6, t0, t1, t2, t3)
+                                              SXT_PRODUCT_ROW6(40, t5, t6, t0, t1, t2, t3, t4)
+                                                  SXT_REDUCTION_ROW6(t5, t6, t0, t1, t2, t3, t4)
+      : [t0] "=&r"(t0), [t1] "=&r"(t1), [t2] "=&r"(t2), [t3] "=&r"(t3), [t4] "=&r"(t4),
+        [t5] "=&r"(t5), [t6] "=&r"(t6), [lo] "=&r"(lo), [hi] "=&r"(hi)
+      : [a] "r"(a), [b] "r"(b), [p] "r"(p), [inv] "rm"(inv)
+      : "rdx", "cc", "memory");
+  const uint64_t t[6] = {t6, t0, t1, t2, t3, t4};
+  subtract_modulus<6>(h, t, p);
+#else
+  baser::panic("montgomery_multiply6_adx requires an x86-64 host");
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+// montgomery_square6_adx
+//--------------------------------------------------------------------------------------------------
+void montgomery_square6_adx(uint64_t h[6], const uint64_t a[6], const uint64_t p[6],
+                            uint64_t inv) noexcept {
+  montgomery_multiply6_adx(h, a, a, p, inv);
+}
+} // namespace sxt::basfld
+
+#undef SXT_MULX_ADD
+#undef SXT_FOLD_OVERFLOW
+#undef SXT_PRODUCT_ROW4
+#undef SXT_REDUCTION_ROW4
+#undef SXT_PRODUCT_ROW6
+#undef SXT_REDUCTION_ROW6
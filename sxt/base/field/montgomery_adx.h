@@ -0,0 +1,63 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace sxt::basfld {
+//--------------------------------------------------------------------------------------------------
+// montgomery_multiply4_adx
+//--------------------------------------------------------------------------------------------------
+/**
+ * h = a * b * 2^-256 mod p for four-limb operands a, b < p
+ *
+ * Host-only x86-64 implementation that interleaves the product and reduction (CIOS) with mulx and
+ * the independent adcx/adox carry chains. Requires p[3] < 2^62 and BMI2 and ADX support (see
+ * bassy::host_cpu_features_v); the result is fully reduced.
+ */
+void montgomery_multiply4_adx(uint64_t h[4], const uint64_t a[4], const uint64_t b[4],
+                              const uint64_t p[4], uint64_t inv) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// montgomery_square4_adx
+//--------------------------------------------------------------------------------------------------
+/**
+ * h = a * a * 2^-256 mod p with the same requirements as montgomery_multiply4_adx
+ */
+void montgomery_square4_adx(uint64_t h[4], const uint64_t a[4], const uint64_t p[4],
+                            uint64_t inv) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// montgomery_multiply6_adx
+//--------------------------------------------------------------------------------------------------
+/**
+ * h = a * b * 2^-384 mod p for six-limb operands a, b < p
+ *
+ * Requires p[5] < 2^62 and BMI2 and ADX support.
+ */
+void montgomery_multiply6_adx(uint64_t h[6], const uint64_t a[6], const uint64_t b[6],
+                              const uint64_t p[6], uint64_t inv) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// montgomery_square6_adx
+//--------------------------------------------------------------------------------------------------
+/**
+ * h = a * a * 2^-384 mod p with the same requirements as montgomery_multiply6_adx
+ */
+void montgomery_square6_adx(uint64_t h[6], const uint64_t a[6], const uint64_t p[6],
+                            uint64_t inv) noexcept;
+} // namespace sxt::basfld
@@ -0,0 +1,163 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/base/field/montgomery_adx.h"
+
+#include <array>
+#include <random>
+
+#include "sxt/base/field/arithmetic_utility.h"
+#include "sxt/base/system/cpu_features.h"
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::basfld;
+
+//--------------------------------------------------------------------------------------------------
+// reference_multiply
+//--------------------------------------------------------------------------------------------------
+template <size_t N>
+static std::array<uint64_t, N> reference_multiply(const std::array<uint64_t, N>& a,
+                                                  const std::array<uint64_t, N>& b,
+                                                  const std::array<uint64_t, N>& p,
+                                                  uint64_t inv) noexcept {
+  uint64_t t[N + 2] = {};
+  for (size_t i = 0; i < N; ++i) {
+    uint64_t carry = 0;
+    for (size_t j = 0; j < N; ++j) {
+      mac(t[j], carry, t[j], a[j], b[i]);
+    }
+    adc(t[N], t[N + 1], t[N], carry, 0);
+    auto m = t[0] * inv;
+    carry = 0;
+    uint64_t discard;
+    mac(discard, carry, t[0], m, p[0]);
+    for (size_t j = 1; j < N; ++j) {
+      mac(t[j - 1], carry, t[j], m, p[j]);
+    }
+    adc(t[N - 1], carry, t[N], carry, 0);
+    t[N] = t[N + 1] + carry;
+    t[N + 1] = 0;
+  }
+  std::array<uint64_t, N> res;
+  uint64_t borrow = 0;
+  for (size_t j = 0; j < N; ++j) {
+    sbb(res[j], borrow, t[j], p[j]);
+  }
+  uint64_t ignore;
+  sbb(ignore, borrow, t[N], 0);
+  if (borrow != 0) {
+    std::copy_n(t, N, res.begin());
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// random_element
+//--------------------------------------------------------------------------------------------------
+template <size_t N>
+static std::array<uint64_t, N> random_element(std::mt19937_64& rng,
+                                              const std::array<uint64_t, N>& p) noexcept {
+  std::array<uint64_t, N> res;
+  for (auto& x : res) {
+    x = rng();
+  }
+  res[N - 1] %= p[N - 1];
+  return res;
+}
+
+TEST_CASE("we can multiply four-limb elements with mulx and adx") {
+  if (!bassy::host_cpu_features_v.mulx_adx) {
+    return;
+  }
+
+  // the bn254 base field
+  constexpr std::array<uint64_t, 4> p = {0x3c208c16d87cfd47, 0x97816a916871ca8d,
+                                         0xb85045b68181585d, 0x30644e72e131a029};
+  constexpr uint64_t inv = 0x87d20782e4866389;
+  std::mt19937_64 rng{0};
+
+  SECTION("products match the portable implementation") {
+    for (int i = 0; i < 1000; ++i) {
+      auto a = random_element(rng, p);
+      auto b = random_element(rng, p);
+      std::array<uint64_t, 4> res;
+      montgomery_multiply4_adx(res.data(), a.data(), b.data(), p.data(), inv);
+      REQUIRE(res == reference_multiply(a, b, p, inv));
+    }
+  }
+
+  SECTION("the largest elements multiply correctly") {
+    auto a = p;
+    a[0] -= 1;
+    std::array<uint64_t, 4> res;
+    montgomery_multiply4_adx(res.data(), a.data(), a.data(), p.data(), inv);
+    REQUIRE(res == reference_multiply(a, a, p, inv));
+  }
+
+  SECTION("we can square elements") {
+    auto a = random_element(rng, p);
+    std::array<uint64_t, 4> res;
+    montgomery_square4_adx(res.data(), a.data(), p.data(), inv);
+    REQUIRE(res == reference_multiply(a, a, p, inv));
+  }
+
+  SECTION("the output can alias an input") {
+    auto a = random_element(rng, p);
+    auto b = random_element(rng, p);
+    auto expected = reference_multiply(a, b, p, inv);
+    montgomery_multiply4_adx(a.data(), a.data(), b.data(), p.data(), inv);
+    REQUIRE(a == expected);
+  }
+}
+
+TEST_CASE("we can multiply six-limb elements with mulx and adx") {
+  if (!bassy::host_cpu_features_v.mulx_adx) {
+    return;
+  }
+
+  // the bls12-381 base field
+  constexpr std::array<uint64_t, 6> p = {0xb9feffffffffaaab, 0x1eabfffeb153ffff,
+                                         0x6730d2a0f6b0f624, 0x64774b84f38512bf,
+                                         0x4b1ba7b6434bacd7, 0x1a0111ea397fe69a};
+  constexpr uint64_t inv = 0x89f3fffcfffcfffd;
+  std::mt19937_64 rng{0};
+
+  SECTION("products match the portable implementation") {
+    for (int i = 0; i < 1000; ++i) {
+      auto a = random_element(rng, p);
+      auto b = random_element(rng, p);
+      std::array<uint64_t, 6> res;
+      montgomery_multiply6_adx(res.data(), a.data(), b.data(), p.data(), inv);
+      REQUIRE(res == reference_multiply(a, b, p, inv));
+    }
+  }
+
+  SECTION("the largest elements multiply correctly") {
+    auto a = p;
+    a[0] -= 1;
+    std::array<uint64_t, 6> res;
+    montgomery_multiply6_adx(res.data(), a.data(), a.data(), p.data(), inv);
+    REQUIRE(res == reference_multiply(a, a, p, inv));
+  }
+
+  SECTION("we can square elements") {
+    auto a = random_element(rng, p);
+    std::array<uint64_t, 6> res;
+    montgomery_square6_adx(res.data(), a.data(), p.data(), inv);
+    REQUIRE(res == reference_multiply(a, a, p, inv));
+  }
+}
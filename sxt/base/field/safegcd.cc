@@ -0,0 +1,364 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/base/field/safegcd.h"
+
+#include <bit>
+
+#include "sxt/base/type/int.h"
+
+namespace sxt::basfld {
+namespace {
+//--------------------------------------------------------------------------------------------------
+// transition_matrix
+//--------------------------------------------------------------------------------------------------
+/**
+ * The matrix [[u, v], [q, r]] that maps (f, g) to 2^62 * (f', g') after a batch of 62 divsteps
+ */
+struct transition_matrix {
+  int64_t u;
+  int64_t v;
+  int64_t q;
+  int64_t r;
+};
+} // namespace
+
+static constexpr uint64_t m62_v = (uint64_t{1} << 62) - 1;
+
+//--------------------------------------------------------------------------------------------------
+// num_limbs62_v
+//--------------------------------------------------------------------------------------------------
+template <unsigned W> static constexpr unsigned num_limbs62_v = (64 * W + 61) / 62;
+
+//--------------------------------------------------------------------------------------------------
+// num_batches_v
+//--------------------------------------------------------------------------------------------------
+// Bernstein and Yang show that floor((49 * d + 57) / 17) divsteps suffice to bring g to zero for
+// any f, g < 2^d with d >= 46 (Theorem 11.2)
+template <unsigned W>
+static constexpr unsigned num_batches_v = ((49 * 64 * W + 57) / 17 + 61) / 62;
+
+//--------------------------------------------------------------------------------------------------
+// to_signed62
+//--------------------------------------------------------------------------------------------------
+template <unsigned W>
+static void to_signed62(int64_t r[num_limbs62_v<W>], const uint64_t a[W]) noexcept {
+  for (unsigned i = 0; i < num_limbs62_v<W>; ++i) {
+    auto bit = 62 * i;
+    auto limb = bit / 64;
+    auto shift = bit % 64;
+    uint64_t x = 0;
+    if (limb < W) {
+      x = a[limb] >> shift;
+      if (shift > 2 && limb + 1 < W) {
+        x |= a[limb + 1] << (64 - shift);
+      }
+    }
+    r[i] = static_cast<int64_t>(x & m62_v);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// from_signed62
+//--------------------------------------------------------------------------------------------------
+// Requires every limb of r to be in [0, 2^62). For W <= 6, a 64-bit limb never straddles more
+// than two 62-bit limbs.
+template <unsigned W>
+static void from_signed62(uint64_t h[W], const int64_t r[num_limbs62_v<W>]) noexcept {
+  for (unsigned j = 0; j < W; ++j) {
+    auto bit = 64 * j;
+    auto i = bit / 62;
+    auto shift = bit % 62;
+    auto x = static_cast<uint64_t>(r[i]) >> shift;
+    if (i + 1 < num_limbs62_v<W>) {
+      x |= static_cast<uint64_t>(r[i + 1]) << (62 - shift);
+    }
+    h[j] = x;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// inverse_mod_2_62
+//--------------------------------------------------------------------------------------------------
+static uint64_t inverse_mod_2_62(uint64_t p) noexcept {
+  // p * p = 1 mod 8 for odd p, and each Newton step doubles the number of correct bits
+  auto x = p;
+  for (int i = 0; i < 5; ++i) {
+    x *= 2 - p * x;
+  }
+  return x & m62_v;
+}
+
+//--------------------------------------------------------------------------------------------------
+// divsteps62
+//--------------------------------------------------------------------------------------------------
+// Performs 62 divsteps
+//
+//    (delta, f, g) -> (1 - delta, g, (g - f) / 2)   if delta > 0 and g is odd
+//                     (1 + delta, f, (g + f) / 2)   if g is odd
+//                     (1 + delta, f, g / 2)         otherwise
+//
+// on the low 62 bits of f and g without branching on their values, and returns the updated delta.
+static int64_t divsteps62(int64_t delta, uint64_t f, uint64_t g, transition_matrix& t) noexcept {
+  // invariant: f * 2^i = u * f0 + v * g0 and g * 2^i = q * f0 + r * g0 after i steps
+  uint64_t u = 1, v = 0, q = 0, r = 1;
+  for (int i = 0; i < 62; ++i) {
+    // c1 is all ones if delta > 0 and g is odd; c2 is all ones if g is odd
+    auto c2 = -(g & 1);
+    auto c1 = static_cast<uint64_t>((-delta) >> 63) & c2;
+
+    // conditionally negate f, u, v and add them to g, q, r
+    auto x = (f ^ c1) - c1;
+    auto y = (u ^ c1) - c1;
+    auto z = (v ^ c1) - c1;
+    g += x & c2;
+    q += y & c2;
+    r += z & c2;
+
+    // in the swap case, f, u, v become the old g, q, r
+    f += g & c1;
+    u += q & c1;
+    v += r & c1;
+
+    delta = static_cast<int64_t>((static_cast<uint64_t>(delta) ^ c1) - c1) + 1;
+    g >>= 1;
+    u <<= 1;
+    v <<= 1;
+  }
+  t.u = static_cast<int64_t>(u);
+  t.v = static_cast<int64_t>(v);
+  t.q = static_cast<int64_t>(q);
+  t.r = static_cast<int64_t>(r);
+  return delta;
+}
+
+//--------------------------------------------------------------------------------------------------
+// divsteps62_vartime
+//--------------------------------------------------------------------------------------------------
+// Computes the same transition as divsteps62, but handles each run of divsteps on an even g with
+// a single shift.
+static int64_t divsteps62_vartime(int64_t delta, uint64_t f, uint64_t g,
+                                  transition_matrix& t) noexcept {
+  uint64_t u = 1, v = 0, q = 0, r = 1;
+  int i = 62;
+  while (true) {
+    // halve g for each trailing zero, capped by the number of remaining divsteps
+    auto zeros = std::countr_zero(g | (~uint64_t{0} << i));
+    g >>= zeros;
+    u <<= zeros;
+    v <<= zeros;
+    delta += zeros;
+    i -= zeros;
+    if (i == 0) {
+      break;
+    }
+
+    // g is odd
+    if (delta > 0) {
+      delta = -delta;
+      auto tmp = f;
+      f = g;
+      g = -tmp;
+      tmp = u;
+      u = q;
+      q = -tmp;
+      tmp = v;
+      v = r;
+      r = -tmp;
+    }
+    g += f;
+    q += u;
+    r += v;
+
+    // g is now even and the halving that completes this divstep happens on the next iteration
+  }
+  t.u = static_cast<int64_t>(u);
+  t.v = static_cast<int64_t>(v);
+  t.q = static_cast<int64_t>(q);
+  t.r = static_cast<int64_t>(r);
+  return delta;
+}
+
+//--------------------------------------------------------------------------------------------------
+// update_fg
+//--------------------------------------------------------------------------------------------------
+// (f, g) = t * (f, g) / 2^62, where the division is exact
+template <unsigned N>
+static void update_fg(int64_t f[N], int64_t g[N], const transition_matrix& t) noexcept {
+  int128_t cf = static_cast<int128_t>(t.u) * f[0] + static_cast<int128_t>(t.v) * g[0];
+  int128_t cg = static_cast<int128_t>(t.q) * f[0] + static_cast<int128_t>(t.r) * g[0];
+  cf >>= 62;
+  cg >>= 62;
+  for (unsigned i = 1; i < N; ++i) {
+    cf += static_cast<int128_t>(t.u) * f[i] + static_cast<int128_t>(t.v) * g[i];
+    cg += static_cast<int128_t>(t.q) * f[i] + static_cast<int128_t>(t.r) * g[i];
+    f[i - 1] = static_cast<int64_t>(static_cast<uint64_t>(cf) & m62_v);
+    g[i - 1] = static_cast<int64_t>(static_cast<uint64_t>(cg) & m62_v);
+    cf >>= 62;
+    cg >>= 62;
+  }
+  f[N - 1] = static_cast<int64_t>(cf);
+  g[N - 1] = static_cast<int64_t>(cg);
+}
+
+//--------------------------------------------------------------------------------------------------
+// update_de
+//--------------------------------------------------------------------------------------------------
+// (d, e) = (t * (d, e) + p * (md, me)) / 2^62, where md and me are chosen to make the division
+// exact. Keeps d and e in the range (-2p, p).
+template <unsigned N>
+static void update_de(int64_t d[N], int64_t e[N], const transition_matrix& t, const int64_t p[N],
+                      uint64_t pinv62) noexcept {
+  // if d (or e) is negative, add p times the coefficient it's multiplied by so that the result
+  // stays above -2p
+  auto sd = d[N - 1] >> 63;
+  auto se = e[N - 1] >> 63;
+  auto md = (t.u & sd) + (t.v & se);
+  auto me = (t.q & sd) + (t.r & se);
+  int128_t cd = static_cast<int128_t>(t.u) * d[0] + static_cast<int128_t>(t.v) * e[0];
+  int128_t ce = static_cast<int128_t>(t.q) * d[0] + static_cast<int128_t>(t.r) * e[0];
+
+  // adjust md and me so that the low 62 bits of cd + p * md and ce + p * me are zero
+  md -= static_cast<int64_t>(
+      (pinv62 * static_cast<uint64_t>(cd) + static_cast<uint64_t>(md)) & m62_v);
+  me -= static_cast<int64_t>(
+      (pinv62 * static_cast<uint64_t>(ce) + static_cast<uint64_t>(me)) & m62_v);
+  cd += static_cast<int128_t>(p[0]) * md;
+  ce += static_cast<int128_t>(p[0]) * me;
+  cd >>= 62;
+  ce >>= 62;
+  for (unsigned i = 1; i < N; ++i) {
+    cd += static_cast<int128_t>(t.u) * d[i] + static_cast<int128_t>(t.v) * e[i] +
+          static_cast<int128_t>(p[i]) * md;
+    ce += static_cast<int128_t>(t.q) * d[i] + static_cast<int128_t>(t.r) * e[i] +
+          static_cast<int128_t>(p[i]) * me;
+    d[i - 1] = static_cast<int64_t>(static_cast<uint64_t>(cd) & m62_v);
+    e[i - 1] = static_cast<int64_t>(static_cast<uint64_t>(ce) & m62_v);
+    cd >>= 62;
+    ce >>= 62;
+  }
+  d[N - 1] = static_cast<int64_t>(cd);
+  e[N - 1] = static_cast<int64_t>(ce);
+}
+
+//--------------------------------------------------------------------------------------------------
+// propagate_carries
+//--------------------------------------------------------------------------------------------------
+template <unsigned N> static void propagate_carries(int64_t d[N]) noexcept {
+  for (unsigned i = 0; i < N - 1; ++i) {
+    d[i + 1] += d[i] >> 62;
+    d[i] &= static_cast<int64_t>(m62_v);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// normalize
+//--------------------------------------------------------------------------------------------------
+// Maps d in (-2p, p) to sign(f) * d mod p in [0, p)
+template <unsigned N>
+static void normalize(int64_t d[N], int64_t f_top, const int64_t p[N]) noexcept {
+  auto cond_add = d[N - 1] >> 63;
+  auto cond_negate = f_top >> 63;
+  for (unsigned i = 0; i < N; ++i) {
+    d[i] += p[i] & cond_add;
+    d[i] = (d[i] ^ cond_negate) - cond_negate;
+  }
+  propagate_carries<N>(d);
+  cond_add = d[N - 1] >> 63;
+  for (unsigned i = 0; i < N; ++i) {
+    d[i] += p[i] & cond_add;
+  }
+  propagate_carries<N>(d);
+}
+
+//--------------------------------------------------------------------------------------------------
+// is_zero
+//--------------------------------------------------------------------------------------------------
+template <unsigned N> static bool is_zero(const int64_t g[N]) noexcept {
+  int64_t acc = 0;
+  for (unsigned i = 0; i < N; ++i) {
+    acc |= g[i];
+  }
+  return acc == 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+// invert_safegcd
+//--------------------------------------------------------------------------------------------------
+template <unsigned W, bool Vartime>
+static void invert_safegcd(uint64_t h[W], const uint64_t a[W], const uint64_t p[W]) noexcept {
+  constexpr auto N = num_limbs62_v<W>;
+
+  // invariant: d * a = f mod p and e * a = g mod p
+  int64_t pm[N], f[N], g[N], d[N] = {}, e[N] = {};
+  to_signed62<W>(pm, p);
+  to_signed62<W>(g, a);
+  for (unsigned i = 0; i < N; ++i) {
+    f[i] = pm[i];
+  }
+  e[0] = 1;
+  auto pinv62 = inverse_mod_2_62(p[0]);
+
+  int64_t delta = 1;
+  transition_matrix t;
+  if constexpr (Vartime) {
+    while (!is_zero<N>(g)) {
+      delta = divsteps62_vartime(delta, static_cast<uint64_t>(f[0]), static_cast<uint64_t>(g[0]),
+                                 t);
+      update_de<N>(d, e, t, pm, pinv62);
+      update_fg<N>(f, g, t);
+    }
+  } else {
+    for (unsigned i = 0; i < num_batches_v<W>; ++i) {
+      delta = divsteps62(delta, static_cast<uint64_t>(f[0]), static_cast<uint64_t>(g[0]), t);
+      update_de<N>(d, e, t, pm, pinv62);
+      update_fg<N>(f, g, t);
+    }
+  }
+
+  // g is now zero and f = +/-gcd(a, p) = +/-1, unless a is zero in which case d is also zero
+  normalize<N>(d, f[N - 1], pm);
+  from_signed62<W>(h, d);
+}
+
+//--------------------------------------------------------------------------------------------------
+// invert4_safegcd
+//--------------------------------------------------------------------------------------------------
+void invert4_safegcd(uint64_t h[4], const uint64_t a[4], const uint64_t p[4]) noexcept {
+  invert_safegcd<4, false>(h, a, p);
+}
+
+//--------------------------------------------------------------------------------------------------
+// invert4_safegcd_vartime
+//--------------------------------------------------------------------------------------------------
+void invert4_safegcd_vartime(uint64_t h[4], const uint64_t a[4], const uint64_t p[4]) noexcept {
+  invert_safegcd<4, true>(h, a, p);
+}
+
+//--------------------------------------------------------------------------------------------------
+// invert6_safegcd
+//--------------------------------------------------------------------------------------------------
+void invert6_safegcd(uint64_t h[6], const uint64_t a[6], const uint64_t p[6]) noexcept {
+  invert_safegcd<6, false>(h, a, p);
+}
+
+//--------------------------------------------------------------------------------------------------
+// invert6_safegcd_vartime
+//--------------------------------------------------------------------------------------------------
+void invert6_safegcd_vartime(uint64_t h[6], const uint64_t a[6], const uint64_t p[6]) noexcept {
+  invert_safegcd<6, true>(h, a, p);
+}
+} // namespace sxt::basfld
@@ -0,0 +1,63 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace sxt::basfld {
+//--------------------------------------------------------------------------------------------------
+// invert4_safegcd
+//--------------------------------------------------------------------------------------------------
+/**
+ * h = a^-1 mod p for a four-limb value a and an odd prime p < 2^256
+ *
+ * a doesn't need to be reduced. h = 0 if a = 0 and is unspecified if a is some other multiple of p.
+ *
+ * Host-only implementation of Bernstein and Yang's constant-time gcd: a fixed number of
+ * branch-free divsteps, performed in batches of 62 whose transition matrices are applied to signed
+ * 62-bit limb representations of (f, g) and the Bezout coefficients. The result is fully reduced.
+ *
+ * See https://eprint.iacr.org/2019/266
+ */
+void invert4_safegcd(uint64_t h[4], const uint64_t a[4], const uint64_t p[4]) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// invert4_safegcd_vartime
+//--------------------------------------------------------------------------------------------------
+/**
+ * Variable-time variant of invert4_safegcd that skips runs of divsteps on even g and stops as
+ * soon as g reaches zero. Only use with public data.
+ */
+void invert4_safegcd_vartime(uint64_t h[4], const uint64_t a[4], const uint64_t p[4]) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// invert6_safegcd
+//--------------------------------------------------------------------------------------------------
+/**
+ * h = a^-1 mod p for a six-limb value a and an odd prime p < 2^384 with the same guarantees as
+ * invert4_safegcd
+ */
+void invert6_safegcd(uint64_t h[6], const uint64_t a[6], const uint64_t p[6]) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// invert6_safegcd_vartime
+//--------------------------------------------------------------------------------------------------
+/**
+ * Variable-time variant of invert6_safegcd. Only use with public data.
+ */
+void invert6_safegcd_vartime(uint64_t h[6], const uint64_t a[6], const uint64_t p[6]) noexcept;
+} // namespace sxt::basfld
@@ -0,0 +1,182 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/base/field/safegcd.h"
+
+#include <array>
+#include <random>
+
+#include "sxt/base/field/arithmetic_utility.h"
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::basfld;
+
+//--------------------------------------------------------------------------------------------------
+// add_mod
+//--------------------------------------------------------------------------------------------------
+template <size_t N>
+static std::array<uint64_t, N> add_mod(const std::array<uint64_t, N>& a,
+                                       const std::array<uint64_t, N>& b,
+                                       const std::array<uint64_t, N>& p) noexcept {
+  std::array<uint64_t, N> sum, res;
+  uint64_t carry = 0;
+  for (size_t i = 0; i < N; ++i) {
+    adc(sum[i], carry, a[i], b[i], carry);
+  }
+  uint64_t borrow = 0;
+  for (size_t i = 0; i < N; ++i) {
+    sbb(res[i], borrow, sum[i], p[i]);
+  }
+  if (carry == 0 && borrow != 0) {
+    return sum;
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// multiply_mod
+//--------------------------------------------------------------------------------------------------
+template <size_t N>
+static std::array<uint64_t, N> multiply_mod(const std::array<uint64_t, N>& a,
+                                            const std::array<uint64_t, N>& b,
+                                            const std::array<uint64_t, N>& p) noexcept {
+  std::array<uint64_t, N> res = {};
+  for (size_t i = N; i-- > 0;) {
+    for (int j = 63; j >= 0; --j) {
+      res = add_mod(res, res, p);
+      if ((b[i] >> j) & 1) {
+        res = add_mod(res, a, p);
+      }
+    }
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// invert
+//--------------------------------------------------------------------------------------------------
+template <size_t N>
+static std::array<uint64_t, N> invert(const std::array<uint64_t, N>& a,
+                                      const std::array<uint64_t, N>& p, bool vartime) noexcept {
+  std::array<uint64_t, N> res;
+  if constexpr (N == 4) {
+    if (vartime) {
+      invert4_safegcd_vartime(res.data(), a.data(), p.data());
+    } else {
+      invert4_safegcd(res.data(), a.data(), p.data());
+    }
+  } else {
+    if (vartime) {
+      invert6_safegcd_vartime(res.data(), a.data(), p.data());
+    } else {
+      invert6_safegcd(res.data(), a.data(), p.data());
+    }
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// exercise_inversion
+//--------------------------------------------------------------------------------------------------
+template <size_t N>
+static void exercise_inversion(const std::array<uint64_t, N>& p, bool vartime) noexcept {
+  std::array<uint64_t, N> zero = {};
+  std::array<uint64_t, N> one = {1};
+
+  // 0 maps to 0
+  REQUIRE(invert(zero, p, vartime) == zero);
+
+  // 1 is its own inverse
+  REQUIRE(invert(one, p, vartime) == one);
+
+  // so is p - 1
+  auto p_minus_1 = p;
+  p_minus_1[0] -= 1;
+  REQUIRE(invert(p_minus_1, p, vartime) == p_minus_1);
+
+  // the inverse of 2 is (p + 1) / 2
+  std::array<uint64_t, N> two = {2};
+  auto half = p;
+  for (size_t i = 0; i < N; ++i) {
+    half[i] >>= 1;
+    if (i + 1 < N) {
+      half[i] |= p[i + 1] << 63;
+    }
+  }
+  half = add_mod(half, one, p);
+  REQUIRE(invert(two, p, vartime) == half);
+
+  // random elements
+  std::mt19937 rng{static_cast<unsigned>(N)};
+  std::uniform_int_distribution<uint64_t> dist;
+  for (int i = 0; i < 100; ++i) {
+    std::array<uint64_t, N> a;
+    for (auto& x : a) {
+      x = dist(rng);
+    }
+    a[N - 1] %= p[N - 1];
+    auto a_inv = invert(a, p, vartime);
+    REQUIRE(multiply_mod(a, a_inv, p) == one);
+    REQUIRE(invert(a_inv, p, vartime) == a);
+
+    // a + p has the same inverse when it fits
+    std::array<uint64_t, N> a_plus_p;
+    uint64_t carry = 0;
+    for (size_t j = 0; j < N; ++j) {
+      adc(a_plus_p[j], carry, a[j], p[j], carry);
+    }
+    if (carry == 0) {
+      REQUIRE(invert(a_plus_p, p, vartime) == a_inv);
+    }
+  }
+}
+
+TEST_CASE("we can invert four-limb field elements") {
+  // bn254 base field
+  std::array<uint64_t, 4> p1{0x3c208c16d87cfd47, 0x97816a916871ca8d, 0xb85045b68181585d,
+                             0x30644e72e131a029};
+
+  // 2^255 - 19
+  std::array<uint64_t, 4> p2{0xffffffffffffffed, 0xffffffffffffffff, 0xffffffffffffffff,
+                             0x7fffffffffffffff};
+
+  // 2^256 - 2^32 - 977 exercises the full width
+  std::array<uint64_t, 4> p3{0xfffffffefffffc2f, 0xffffffffffffffff, 0xffffffffffffffff,
+                             0xffffffffffffffff};
+
+  SECTION("in constant time") {
+    exercise_inversion(p1, false);
+    exercise_inversion(p2, false);
+    exercise_inversion(p3, false);
+  }
+
+  SECTION("in variable time") {
+    exercise_inversion(p1, true);
+    exercise_inversion(p2, true);
+    exercise_inversion(p3, true);
+  }
+}
+
+TEST_CASE("we can invert six-limb field elements") {
+  // bls12-381 base field
+  std::array<uint64_t, 6> p{0xb9feffffffffaaab, 0x1eabfffeb153ffff, 0x6730d2a0f6b0f624,
+                            0x64774b84f38512bf, 0x4b1ba7b6434bacd7, 0x1a0111ea397fe69a};
+
+  SECTION("in constant time") { exercise_inversion(p, false); }
+
+  SECTION("in variable time") { exercise_inversion(p, true); }
+}
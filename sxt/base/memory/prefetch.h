@@ -0,0 +1,43 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sxt::basm {
+//--------------------------------------------------------------------------------------------------
+// cache_line_size_v
+//--------------------------------------------------------------------------------------------------
+inline constexpr size_t cache_line_size_v = 64;
+
+//--------------------------------------------------------------------------------------------------
+// prefetch
+//--------------------------------------------------------------------------------------------------
+/**
+ * Hint that the cache lines covering [data, data + size) will soon be read.
+ */
+inline void prefetch(const void* data, size_t size) noexcept {
+  auto first = reinterpret_cast<uintptr_t>(data) & ~(cache_line_size_v - 1);
+  auto last = reinterpret_cast<uintptr_t>(data) + size;
+  for (auto p = first; p < last; p += cache_line_size_v) {
+    __builtin_prefetch(reinterpret_cast<const void*>(p));
+  }
+}
+
+template <class T> void prefetch(const T* data) noexcept { prefetch(data, sizeof(T)); }
+} // namespace sxt::basm
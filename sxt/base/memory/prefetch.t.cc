@@ -0,0 +1,42 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/base/memory/prefetch.h"
+
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::basm;
+
+TEST_CASE("we can prefetch memory") {
+  std::vector<uint8_t> data(1000);
+
+  SECTION("we can prefetch an empty range") { prefetch(data.data(), 0); }
+
+  SECTION("we can prefetch a range spanning multiple cache lines") {
+    prefetch(data.data() + 3, data.size() - 3);
+  }
+
+  SECTION("we can prefetch an object") {
+    struct big {
+      uint8_t data[100];
+    } b{};
+    prefetch(&b);
+    REQUIRE(b.data[0] == 0);
+  }
+}
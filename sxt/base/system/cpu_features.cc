@@ -0,0 +1,79 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/base/system/cpu_features.h"
+
+#include <cstdint>
+
+#if defined(__x86_64__)
+#include <cpuid.h>
+#endif
+
+namespace sxt::bassy {
+#if defined(__x86_64__)
+//--------------------------------------------------------------------------------------------------
+// read_xcr0
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read the register that records which vector states the operating system saves.
+ */
+static uint64_t read_xcr0() noexcept {
+  uint32_t eax, edx;
+  asm volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (static_cast<uint64_t>(edx) << 32) | eax;
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------
+// detect_cpu_features
+//--------------------------------------------------------------------------------------------------
+cpu_features detect_cpu_features() noexcept {
+  cpu_features res;
+#if defined(__x86_64__)
+  unsigned eax, ebx, ecx, edx;
+  if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) {
+    return res;
+  }
+  constexpr unsigned osxsave_bit = 1u << 27;
+  uint64_t xcr0 = 0;
+  if ((ecx & osxsave_bit) != 0) {
+    xcr0 = read_xcr0();
+  }
+  // SSE and AVX state, plus the opmask and upper ZMM state for AVX-512
+  constexpr uint64_t avx_state = 0x6;
+  constexpr uint64_t avx512_state = 0xe6;
+
+  if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0) {
+    return res;
+  }
+  constexpr unsigned avx2_bit = 1u << 5;
+  constexpr unsigned bmi2_bit = 1u << 8;
+  constexpr unsigned avx512f_bit = 1u << 16;
+  constexpr unsigned adx_bit = 1u << 19;
+  constexpr unsigned avx512_ifma_bit = 1u << 21;
+  res.mulx_adx = (ebx & bmi2_bit) != 0 && (ebx & adx_bit) != 0;
+  res.avx2 = (xcr0 & avx_state) == avx_state && (ebx & avx2_bit) != 0;
+  res.avx512_ifma = (xcr0 & avx512_state) == avx512_state && (ebx & avx512f_bit) != 0 &&
+                    (ebx & avx512_ifma_bit) != 0;
+#endif
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// host_cpu_features_v
+//--------------------------------------------------------------------------------------------------
+const cpu_features host_cpu_features_v = detect_cpu_features();
+} // namespace sxt::bassy
@@ -0,0 +1,56 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+namespace sxt::bassy {
+//--------------------------------------------------------------------------------------------------
+// cpu_features
+//--------------------------------------------------------------------------------------------------
+/**
+ * Instruction set extensions of the host CPU that have specialized code paths.
+ */
+struct cpu_features {
+  // mulx from BMI2 together with adcx and adox from ADX
+  bool mulx_adx = false;
+
+  // 256-bit integer vectors, enabled by the operating system
+  bool avx2 = false;
+
+  // 512-bit vectors with the 52-bit integer multiply-add instructions, enabled by the operating
+  // system
+  bool avx512_ifma = false;
+};
+
+//--------------------------------------------------------------------------------------------------
+// detect_cpu_features
+//--------------------------------------------------------------------------------------------------
+/**
+ * Query the host CPU with CPUID.
+ */
+cpu_features detect_cpu_features() noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// host_cpu_features_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * The features of the host CPU, detected once during static initialization.
+ *
+ * All features read as unsupported until then, so code that runs before initialization takes the
+ * portable path.
+ */
+extern const cpu_features host_cpu_features_v;
+} // namespace sxt::bassy
@@ -0,0 +1,34 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/base/system/cpu_features.h"
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::bassy;
+
+TEST_CASE("we can detect the features of the host CPU") {
+  auto features = detect_cpu_features();
+  REQUIRE(features.mulx_adx == host_cpu_features_v.mulx_adx);
+  REQUIRE(features.avx2 == host_cpu_features_v.avx2);
+  REQUIRE(features.avx512_ifma == host_cpu_features_v.avx512_ifma);
+#if !defined(__x86_64__)
+  REQUIRE(!features.mulx_adx);
+  REQUIRE(!features.avx2);
+  REQUIRE(!features.avx512_ifma);
+#endif
+}
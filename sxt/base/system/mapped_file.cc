@@ -0,0 +1,106 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/base/system/mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include "sxt/base/error/panic.h"
+#include "sxt/base/log/log.h"
+
+namespace sxt::bassy {
+//--------------------------------------------------------------------------------------------------
+// constructor
+//--------------------------------------------------------------------------------------------------
+mapped_file::mapped_file(const char* filename, const mapped_file_options& options) noexcept {
+  auto fd = ::open(filename, O_RDONLY | O_CLOEXEC);
+  if (fd == -1) {
+    baser::panic("failed to open {}: {}", filename, std::strerror(errno));
+  }
+  struct stat st;
+  if (::fstat(fd, &st) != 0) {
+    baser::panic("failed to stat {}: {}", filename, std::strerror(errno));
+  }
+  size_ = static_cast<size_t>(st.st_size);
+  if (size_ == 0) {
+    ::close(fd);
+    return;
+  }
+  auto data = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+  if (data == MAP_FAILED) {
+    baser::panic("failed to map {}: {}", filename, std::strerror(errno));
+  }
+  // the mapping stays valid after the descriptor is closed
+  ::close(fd);
+  data_ = static_cast<const uint8_t*>(data);
+  if (options.will_need && ::madvise(data, size_, MADV_WILLNEED) != 0) {
+    basl::error("failed to advise readahead for {}: {}", filename, std::strerror(errno));
+  }
+  if (options.lock) {
+    if (::mlock(data, size_) == 0) {
+      locked_ = true;
+    } else {
+      // locking commonly fails because of RLIMIT_MEMLOCK; the mapping is still usable
+      basl::error("failed to lock {} bytes of {} into memory: {}", size_, filename,
+                  std::strerror(errno));
+    }
+  }
+}
+
+mapped_file::mapped_file(mapped_file&& other) noexcept
+    : data_{std::exchange(other.data_, nullptr)}, size_{std::exchange(other.size_, 0)},
+      locked_{std::exchange(other.locked_, false)} {}
+
+//--------------------------------------------------------------------------------------------------
+// destructor
+//--------------------------------------------------------------------------------------------------
+mapped_file::~mapped_file() noexcept { this->reset(); }
+
+//--------------------------------------------------------------------------------------------------
+// operator=
+//--------------------------------------------------------------------------------------------------
+mapped_file& mapped_file::operator=(mapped_file&& other) noexcept {
+  this->reset();
+  data_ = std::exchange(other.data_, nullptr);
+  size_ = std::exchange(other.size_, 0);
+  locked_ = std::exchange(other.locked_, false);
+  return *this;
+}
+
+//--------------------------------------------------------------------------------------------------
+// reset
+//--------------------------------------------------------------------------------------------------
+void mapped_file::reset() noexcept {
+  if (data_ == nullptr) {
+    return;
+  }
+  auto data = const_cast<uint8_t*>(data_);
+  if (locked_) {
+    ::munlock(data, size_);
+  }
+  ::munmap(data, size_);
+  data_ = nullptr;
+  size_ = 0;
+  locked_ = false;
+}
+} // namespace sxt::bassy
@@ -0,0 +1,74 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "sxt/base/container/span.h"
+
+namespace sxt::bassy {
+//--------------------------------------------------------------------------------------------------
+// mapped_file_options
+//--------------------------------------------------------------------------------------------------
+struct mapped_file_options {
+  // advise the kernel that the whole file will be needed soon so that it starts readahead
+  bool will_need = false;
+
+  // lock the mapped pages into memory
+  bool lock = false;
+};
+
+//--------------------------------------------------------------------------------------------------
+// mapped_file
+//--------------------------------------------------------------------------------------------------
+/**
+ * Map a file read-only into memory.
+ *
+ * The mapping is shared, so processes that map the same file share a single copy of its pages
+ * in the page cache.
+ */
+class mapped_file {
+public:
+  mapped_file() noexcept = default;
+
+  explicit mapped_file(const char* filename, const mapped_file_options& options = {}) noexcept;
+
+  mapped_file(const mapped_file&) = delete;
+  mapped_file(mapped_file&& other) noexcept;
+
+  ~mapped_file() noexcept;
+
+  mapped_file& operator=(const mapped_file&) = delete;
+  mapped_file& operator=(mapped_file&& other) noexcept;
+
+  const uint8_t* data() const noexcept { return data_; }
+
+  size_t size() const noexcept { return size_; }
+
+  bool locked() const noexcept { return locked_; }
+
+  basct::cspan<uint8_t> bytes() const noexcept { return {data_, size_}; }
+
+private:
+  const uint8_t* data_ = nullptr;
+  size_t size_ = 0;
+  bool locked_ = false;
+
+  void reset() noexcept;
+};
+} // namespace sxt::bassy
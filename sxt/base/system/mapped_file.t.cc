@@ -0,0 +1,63 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/base/system/mapped_file.h"
+
+#include <utility>
+#include <vector>
+
+#include "sxt/base/system/file_io.h"
+#include "sxt/base/test/temp_file.h"
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::bassy;
+
+TEST_CASE("we can map files into memory") {
+  bastst::temp_file temp_file{std::ios::binary};
+  temp_file.stream().close();
+
+  std::vector<uint8_t> data = {1, 2, 3};
+
+  SECTION("we can map an empty file") {
+    mapped_file f{temp_file.name().c_str()};
+    REQUIRE(f.size() == 0);
+    REQUIRE(f.data() == nullptr);
+  }
+
+  SECTION("we can map a file with data") {
+    write_file<uint8_t>(temp_file.name().c_str(), data);
+    mapped_file f{temp_file.name().c_str()};
+    REQUIRE(std::vector<uint8_t>(f.bytes().begin(), f.bytes().end()) == data);
+  }
+
+  SECTION("we can map a file with readahead and locking") {
+    write_file<uint8_t>(temp_file.name().c_str(), data);
+    mapped_file f{temp_file.name().c_str(), {.will_need = true, .lock = true}};
+    REQUIRE(std::vector<uint8_t>(f.bytes().begin(), f.bytes().end()) == data);
+  }
+
+  SECTION("we can move a mapped file") {
+    write_file<uint8_t>(temp_file.name().c_str(), data);
+    mapped_file f{temp_file.name().c_str()};
+    mapped_file fp{std::move(f)};
+    REQUIRE(f.data() == nullptr);
+    REQUIRE(fp.size() == data.size());
+    f = std::move(fp);
+    REQUIRE(f.size() == data.size());
+    REQUIRE(f.data()[2] == 3);
+  }
+}
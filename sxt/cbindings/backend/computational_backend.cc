@@ -17,19 +17,260 @@
 
 #include "sxt/cbindings/backend/computational_backend.h"
 
+#include <algorithm>
+
+#include "sxt/base/error/panic.h"
+#include "sxt/base/num/divide_up.h"
+#include "sxt/cbindings/backend/computational_backend_utility.h"
 #include "sxt/cbindings/base/curve_id_utility.h"
+#include "sxt/curve_bng1/operation/endomorphism.h"
+#include "sxt/curve_g1/operation/endomorphism.h"
+#include "sxt/curve_gk/operation/endomorphism.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/glv/curve_endomorphism.h"
+#include "sxt/multiexp/glv/expansion.h"
 #include "sxt/multiexp/pippenger2/in_memory_partition_table_accessor.h"
+#include "sxt/multiexp/pippenger2/in_memory_partition_table_accessor_utility.h"
+#include "sxt/multiexp/pippenger2/signed_multiexponentiation.h"
+#include "sxt/multiexp/pippenger2/signed_partition_table_accessor.h"
+#include "sxt/multiexp/pippenger2/signed_partition_table_accessor_utility.h"
+#include "sxt/multiexp/pippenger2/window_width.h"
 
 namespace sxt::cbnbck {
+//--------------------------------------------------------------------------------------------------
+// expand_glv_generators
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pair each generator g with phi(g) so that a table built from the expanded generators can be
+ * used with GLV decomposed scalars.
+ */
+template <class T>
+static memmg::managed_array<T> expand_glv_generators(const void* generators, unsigned n) noexcept {
+  memmg::managed_array<T> res;
+  if constexpr (mtxglv::curve_endomorphism<T>) {
+    res.resize(2u * n);
+    mtxglv::expand_generators<T>(res, basct::cspan<T>{static_cast<const T*>(generators), n});
+  } else {
+    baser::panic("curve doesn't support GLV decomposition");
+  }
+  return res;
+}
+
 //--------------------------------------------------------------------------------------------------
 // write_partition_table_accessor
 //--------------------------------------------------------------------------------------------------
 void computational_backend::write_partition_table_accessor(
-    cbnb::curve_id_t curve_id, const mtxpp2::partition_table_accessor_base& accessor,
+    cbnb::curve_id_t /*curve_id*/, const mtxpp2::partition_table_accessor_base& accessor,
     const char* filename) const noexcept {
+  // both unsigned and signed accessors know how to write themselves
+  accessor.write_to_file(filename);
+}
+
+//--------------------------------------------------------------------------------------------------
+// count_partition_table_generators
+//--------------------------------------------------------------------------------------------------
+unsigned computational_backend::count_partition_table_generators(
+    cbnb::curve_id_t curve_id,
+    const mtxpp2::partition_table_accessor_base& accessor) const noexcept {
+  unsigned res = 0;
+  cbnb::switch_curve_type(
+      curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+        res = mtxpp2::count_partition_table_generators<U, T>(
+            static_cast<const mtxpp2::partition_table_accessor<U>&>(accessor));
+      });
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// extend_partition_table_accessor
+//--------------------------------------------------------------------------------------------------
+void computational_backend::extend_partition_table_accessor(
+    cbnb::curve_id_t curve_id, mtxpp2::partition_table_accessor_base& accessor,
+    unsigned num_generators, const void* generators, unsigned n) const noexcept {
+  cbnb::switch_curve_type(
+      curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+        mtxpp2::extend_partition_table_accessor<U, T>(
+            static_cast<mtxpp2::partition_table_accessor<U>&>(accessor), num_generators,
+            basct::cspan<T>{static_cast<const T*>(generators), n});
+      });
+}
+
+//--------------------------------------------------------------------------------------------------
+// make_glv_partition_table_accessor
+//--------------------------------------------------------------------------------------------------
+std::unique_ptr<mtxpp2::partition_table_accessor_base>
+computational_backend::make_glv_partition_table_accessor(cbnb::curve_id_t curve_id,
+                                                         const void* generators,
+                                                         unsigned n) const noexcept {
+  std::unique_ptr<mtxpp2::partition_table_accessor_base> res;
+  cbnb::switch_curve_type(
+      curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+        auto generators_p = expand_glv_generators<T>(generators, n);
+        res = this->make_partition_table_accessor(curve_id, generators_p.data(), 2u * n);
+      });
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// extend_glv_partition_table_accessor
+//--------------------------------------------------------------------------------------------------
+void computational_backend::extend_glv_partition_table_accessor(
+    cbnb::curve_id_t curve_id, mtxpp2::partition_table_accessor_base& accessor,
+    unsigned num_generators, const void* generators, unsigned n) const noexcept {
+  cbnb::switch_curve_type(
+      curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+        auto generators_p = expand_glv_generators<T>(generators, n);
+        this->extend_partition_table_accessor(curve_id, accessor, 2u * num_generators,
+                                              generators_p.data(), 2u * n);
+      });
+}
+
+//--------------------------------------------------------------------------------------------------
+// make_signed_partition_table_accessor
+//--------------------------------------------------------------------------------------------------
+/**
+ * Signed partition tables are only accessed from the host, so both backends keep them in huge
+ * pages when enabled.
+ */
+std::unique_ptr<mtxpp2::partition_table_accessor_base>
+computational_backend::make_signed_partition_table_accessor(cbnb::curve_id_t curve_id,
+                                                            const void* generators,
+                                                            unsigned n) const noexcept {
+  std::unique_ptr<mtxpp2::partition_table_accessor_base> res;
+  auto window_width = mtxpp2::get_default_window_width();
+  cbnb::switch_curve_type(
+      curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+        res = mtxpp2::make_signed_partition_table_accessor<U, T>(
+            basct::cspan<T>{static_cast<const T*>(generators), n},
+            make_signed_partition_table_alloc(sizeof(U), n, window_width), window_width);
+      });
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// read_signed_partition_table_accessor
+//--------------------------------------------------------------------------------------------------
+std::unique_ptr<mtxpp2::partition_table_accessor_base>
+computational_backend::read_signed_partition_table_accessor(cbnb::curve_id_t curve_id,
+                                                            const char* filename) const noexcept {
+  std::unique_ptr<mtxpp2::partition_table_accessor_base> res;
+  cbnb::switch_curve_type(
+      curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+        res = std::make_unique<mtxpp2::signed_partition_table_accessor<U>>(
+            filename, make_partition_table_alloc(filename));
+      });
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// count_signed_partition_table_generators
+//--------------------------------------------------------------------------------------------------
+unsigned computational_backend::count_signed_partition_table_generators(
+    cbnb::curve_id_t curve_id,
+    const mtxpp2::partition_table_accessor_base& accessor) const noexcept {
+  unsigned res = 0;
+  cbnb::switch_curve_type(
+      curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+        res = static_cast<const mtxpp2::signed_partition_table_accessor<U>&>(accessor)
+                  .num_generators();
+      });
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// extend_signed_partition_table_accessor
+//--------------------------------------------------------------------------------------------------
+void computational_backend::extend_signed_partition_table_accessor(
+    cbnb::curve_id_t curve_id, mtxpp2::partition_table_accessor_base& accessor,
+    const void* generators, unsigned n) const noexcept {
+  cbnb::switch_curve_type(
+      curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+        mtxpp2::extend_signed_partition_table_accessor<U, T>(
+            static_cast<mtxpp2::signed_partition_table_accessor<U>&>(accessor),
+            basct::cspan<T>{static_cast<const T*>(generators), n});
+      });
+}
+
+//--------------------------------------------------------------------------------------------------
+// fixed_signed_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void computational_backend::fixed_signed_multiexponentiation(
+    void* res, cbnb::curve_id_t curve_id, const mtxpp2::partition_table_accessor_base& accessor,
+    unsigned element_num_bytes, unsigned num_outputs, unsigned n,
+    const uint8_t* scalars) const noexcept {
+  cbnb::switch_curve_type(
+      curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+        basct::span<T> res_span{static_cast<T*>(res), num_outputs};
+        basct::cspan<uint8_t> scalars_span{scalars, size_t{element_num_bytes} * num_outputs * n};
+        mtxpp2::signed_multiexponentiate<T>(
+            res_span, static_cast<const mtxpp2::signed_partition_table_accessor<U>&>(accessor),
+            element_num_bytes, scalars_span);
+      });
+}
+
+void computational_backend::fixed_signed_multiexponentiation(
+    void* res, cbnb::curve_id_t curve_id, const mtxpp2::partition_table_accessor_base& accessor,
+    const unsigned* output_bit_table, const unsigned* output_firsts,
+    const unsigned* output_lengths, unsigned num_outputs, const uint8_t* scalars) const noexcept {
+  size_t bit_sum = 0;
+  unsigned n = 0;
+  for (unsigned output_index = 0; output_index < num_outputs; ++output_index) {
+    bit_sum += output_bit_table[output_index];
+    n = std::max(n, output_lengths[output_index]);
+  }
+  basct::cspan<uint8_t> scalars_span{scalars, basn::divide_up<size_t>(bit_sum, 8u) * n};
+  cbnb::switch_curve_type(
+      curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+        mtxpp2::signed_multiexponentiate<T>(
+            basct::span<T>{static_cast<T*>(res), num_outputs},
+            static_cast<const mtxpp2::signed_partition_table_accessor<U>&>(accessor),
+            basct::cspan<unsigned>{output_bit_table, num_outputs},
+            basct::cspan<unsigned>{output_firsts, num_outputs},
+            basct::cspan<unsigned>{output_lengths, num_outputs}, scalars_span);
+      });
+}
+
+//--------------------------------------------------------------------------------------------------
+// fixed_signed_sparse_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void computational_backend::fixed_signed_sparse_multiexponentiation(
+    void* res, cbnb::curve_id_t curve_id, const mtxpp2::partition_table_accessor_base& accessor,
+    unsigned element_num_bytes, unsigned num_outputs, unsigned n, const uint64_t* indexes,
+    const uint8_t* scalars) const noexcept {
+  cbnb::switch_curve_type(
+      curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+        memmg::managed_array<U> generators_p(n);
+        static_cast<const mtxpp2::signed_partition_table_accessor<U>&>(accessor)
+            .gather_generators(generators_p, basct::cspan<uint64_t>{indexes, n});
+        memmg::managed_array<T> generators(n);
+        std::transform(generators_p.begin(), generators_p.end(), generators.begin(),
+                       [](const U& u) noexcept { return T{u}; });
+        this->multiexponentiation(res, curve_id, generators.data(), element_num_bytes,
+                                  num_outputs, n, scalars);
+      });
+}
+
+//--------------------------------------------------------------------------------------------------
+// expand_glv_scalars
+//--------------------------------------------------------------------------------------------------
+void computational_backend::expand_glv_scalars(memmg::managed_array<uint8_t>& res,
+                                               basct::span<unsigned> res_bit_table,
+                                               cbnb::curve_id_t curve_id,
+                                               basct::cspan<unsigned> bit_table, unsigned n,
+                                               const uint8_t* scalars) const noexcept {
+  size_t bit_sum = 0;
+  for (auto width : bit_table) {
+    bit_sum += width;
+  }
+  basct::cspan<uint8_t> scalars_span{scalars, basn::divide_up<size_t>(bit_sum, 8u) * n};
   cbnb::switch_curve_type(
       curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
-        static_cast<const mtxpp2::partition_table_accessor<U>&>(accessor).write_to_file(filename);
+        if constexpr (mtxglv::curve_endomorphism<T>) {
+          mtxglv::expand_packed_scalars(res, res_bit_table, bit_table, scalars_span, n,
+                                        mtxglv::decomposition_parameters_v<T>);
+        } else {
+          baser::panic("curve doesn't support GLV decomposition");
+        }
       });
 }
 } // namespace sxt::cbnbck
@@ -23,6 +23,7 @@
 #include "sxt/base/container/span.h"
 #include "sxt/cbindings/base/curve_id.h"
 #include "sxt/cbindings/base/sumcheck_descriptor.h"
+#include "sxt/memory/management/managed_array_fwd.h"
 #include "sxt/multiexp/pippenger2/partition_table_accessor_base.h"
 
 namespace sxt::mtxb {
@@ -109,6 +110,14 @@ public:
                                     basct::cspan<rstt::compressed_element> r_vector,
                                     const s25t::element& ap_value) const noexcept = 0;
 
+  /**
+   * Compute multiexponentiations of host generators of the curve's element type with a
+   * num_outputs by n array of scalars laid out in column-major order.
+   */
+  virtual void multiexponentiation(void* res, cbnb::curve_id_t curve_id, const void* generators,
+                                   unsigned element_num_bytes, unsigned num_outputs, unsigned n,
+                                   const uint8_t* scalars) const noexcept = 0;
+
   virtual std::unique_ptr<mtxpp2::partition_table_accessor_base>
   make_partition_table_accessor(cbnb::curve_id_t curve_id, const void* generators,
                                 unsigned n) const noexcept = 0;
@@ -129,11 +138,80 @@ public:
                                          const unsigned* output_lengths, unsigned num_outputs,
                                          const uint8_t* scalars) const noexcept = 0;
 
+  virtual void
+  fixed_offset_multiexponentiation(void* res, cbnb::curve_id_t curve_id,
+                                   const mtxpp2::partition_table_accessor_base& accessor,
+                                   const unsigned* output_bit_table, const unsigned* output_firsts,
+                                   const unsigned* output_lengths, unsigned num_outputs,
+                                   const uint8_t* scalars) const noexcept = 0;
+
+  virtual void
+  fixed_sparse_multiexponentiation(void* res, cbnb::curve_id_t curve_id,
+                                   const mtxpp2::partition_table_accessor_base& accessor,
+                                   unsigned element_num_bytes, unsigned num_outputs, unsigned n,
+                                   const uint64_t* indexes,
+                                   const uint8_t* scalars) const noexcept = 0;
+
   virtual std::unique_ptr<mtxpp2::partition_table_accessor_base>
   read_partition_table_accessor(cbnb::curve_id_t curve_id, const char* filename) const noexcept = 0;
 
   void write_partition_table_accessor(cbnb::curve_id_t curve_id,
                                       const mtxpp2::partition_table_accessor_base& accessor,
                                       const char* filename) const noexcept;
+
+  unsigned count_partition_table_generators(
+      cbnb::curve_id_t curve_id,
+      const mtxpp2::partition_table_accessor_base& accessor) const noexcept;
+
+  void extend_partition_table_accessor(cbnb::curve_id_t curve_id,
+                                       mtxpp2::partition_table_accessor_base& accessor,
+                                       unsigned num_generators, const void* generators,
+                                       unsigned n) const noexcept;
+
+  std::unique_ptr<mtxpp2::partition_table_accessor_base>
+  make_glv_partition_table_accessor(cbnb::curve_id_t curve_id, const void* generators,
+                                    unsigned n) const noexcept;
+
+  void extend_glv_partition_table_accessor(cbnb::curve_id_t curve_id,
+                                           mtxpp2::partition_table_accessor_base& accessor,
+                                           unsigned num_generators, const void* generators,
+                                           unsigned n) const noexcept;
+
+  std::unique_ptr<mtxpp2::partition_table_accessor_base>
+  make_signed_partition_table_accessor(cbnb::curve_id_t curve_id, const void* generators,
+                                       unsigned n) const noexcept;
+
+  std::unique_ptr<mtxpp2::partition_table_accessor_base>
+  read_signed_partition_table_accessor(cbnb::curve_id_t curve_id,
+                                       const char* filename) const noexcept;
+
+  unsigned count_signed_partition_table_generators(
+      cbnb::curve_id_t curve_id,
+      const mtxpp2::partition_table_accessor_base& accessor) const noexcept;
+
+  void extend_signed_partition_table_accessor(cbnb::curve_id_t curve_id,
+                                              mtxpp2::partition_table_accessor_base& accessor,
+                                              const void* generators, unsigned n) const noexcept;
+
+  void fixed_signed_multiexponentiation(void* res, cbnb::curve_id_t curve_id,
+                                        const mtxpp2::partition_table_accessor_base& accessor,
+                                        unsigned element_num_bytes, unsigned num_outputs,
+                                        unsigned n, const uint8_t* scalars) const noexcept;
+
+  void fixed_signed_multiexponentiation(void* res, cbnb::curve_id_t curve_id,
+                                        const mtxpp2::partition_table_accessor_base& accessor,
+                                        const unsigned* output_bit_table,
+                                        const unsigned* output_firsts,
+                                        const unsigned* output_lengths, unsigned num_outputs,
+                                        const uint8_t* scalars) const noexcept;
+
+  void fixed_signed_sparse_multiexponentiation(
+      void* res, cbnb::curve_id_t curve_id, const mtxpp2::partition_table_accessor_base& accessor,
+      unsigned element_num_bytes, unsigned num_outputs, unsigned n, const uint64_t* indexes,
+      const uint8_t* scalars) const noexcept;
+
+  void expand_glv_scalars(memmg::managed_array<uint8_t>& res, basct::span<unsigned> res_bit_table,
+                          cbnb::curve_id_t curve_id, basct::cspan<unsigned> bit_table, unsigned n,
+                          const uint8_t* scalars) const noexcept;
 };
 } // namespace sxt::cbnbck
@@ -17,9 +17,15 @@
 #include "sxt/cbindings/backend/computational_backend_utility.h"
 
 #include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
 
 #include "sxt/base/error/assert.h"
 #include "sxt/base/num/divide_up.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/memory/resource/huge_page_resource.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
 
 namespace sxt::cbnbck {
 //--------------------------------------------------------------------------------------------------
@@ -48,4 +54,54 @@ basct::cspan<uint8_t> make_scalars_span(const uint8_t* data,
   auto output_num_bytes = basn::divide_up<size_t>(output_bit_sum, 8u);
   return basct::cspan<uint8_t>{data, output_num_bytes * n};
 }
+
+//--------------------------------------------------------------------------------------------------
+// make_exponent_sequences
+//--------------------------------------------------------------------------------------------------
+void make_exponent_sequences(basct::span<mtxb::exponent_sequence> sequences,
+                             memmg::managed_array<uint8_t>& data, unsigned element_num_bytes,
+                             unsigned n, const uint8_t* scalars) noexcept {
+  auto num_outputs = sequences.size();
+  SXT_RELEASE_ASSERT(element_num_bytes > 0 && element_num_bytes <= 32);
+  data.resize(num_outputs * n * element_num_bytes);
+  for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+    auto out = data.data() + output_index * n * element_num_bytes;
+    for (unsigned i = 0; i < n; ++i) {
+      std::memcpy(out + i * element_num_bytes,
+                  scalars + (i * num_outputs + output_index) * element_num_bytes,
+                  element_num_bytes);
+    }
+    sequences[output_index] = {
+        .element_nbytes = static_cast<uint8_t>(element_num_bytes),
+        .n = n,
+        .data = out,
+        .is_signed = 0,
+    };
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// make_partition_table_alloc
+//--------------------------------------------------------------------------------------------------
+basm::alloc_t make_partition_table_alloc(size_t element_size, size_t n,
+                                         unsigned window_width) noexcept {
+  auto num_entries = basn::divide_up<size_t>(n, window_width) << window_width;
+  return memr::get_huge_page_alloc(num_entries * element_size);
+}
+
+basm::alloc_t make_partition_table_alloc(const char* filename) noexcept {
+  std::error_code ec;
+  auto num_bytes = std::filesystem::file_size(filename, ec);
+  return memr::get_huge_page_alloc(ec ? 0 : num_bytes);
+}
+
+//--------------------------------------------------------------------------------------------------
+// make_signed_partition_table_alloc
+//--------------------------------------------------------------------------------------------------
+basm::alloc_t make_signed_partition_table_alloc(size_t element_size, size_t n,
+                                                unsigned window_width) noexcept {
+  auto num_groups = basn::divide_up<size_t>(n, window_width);
+  auto num_entries = (num_groups << (window_width - 1u)) + num_groups * window_width;
+  return memr::get_huge_page_alloc(num_entries * element_size);
+}
 } // namespace sxt::cbnbck
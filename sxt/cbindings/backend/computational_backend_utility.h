@@ -16,9 +16,16 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 #include "sxt/base/container/span.h"
+#include "sxt/base/memory/alloc.h"
+#include "sxt/memory/management/managed_array_fwd.h"
+
+namespace sxt::mtxb {
+struct exponent_sequence;
+}
 
 namespace sxt::cbnbck {
 //--------------------------------------------------------------------------------------------------
@@ -27,4 +34,40 @@ namespace sxt::cbnbck {
 basct::cspan<uint8_t> make_scalars_span(const uint8_t* data,
                                         basct::cspan<unsigned> output_bit_table,
                                         basct::cspan<unsigned> output_lengths) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// make_exponent_sequences
+//--------------------------------------------------------------------------------------------------
+/**
+ * Copy a num_outputs by n array of scalars laid out in column-major order into data so that each
+ * output has a contiguous exponent sequence.
+ */
+void make_exponent_sequences(basct::span<mtxb::exponent_sequence> sequences,
+                             memmg::managed_array<uint8_t>& data, unsigned element_num_bytes,
+                             unsigned n, const uint8_t* scalars) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// make_partition_table_alloc
+//--------------------------------------------------------------------------------------------------
+/**
+ * Partition tables are accessed randomly so we place them in huge pages when enabled to reduce
+ * TLB misses.
+ *
+ * Get an allocator for the partition table of n generators with entries of element_size bytes,
+ * or for a table read from filename.
+ */
+basm::alloc_t make_partition_table_alloc(size_t element_size, size_t n,
+                                         unsigned window_width) noexcept;
+
+basm::alloc_t make_partition_table_alloc(const char* filename) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// make_signed_partition_table_alloc
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get an allocator for the signed partition table of n generators, which also holds the
+ * generators padded to a multiple of the window width.
+ */
+basm::alloc_t make_signed_partition_table_alloc(size_t element_size, size_t n,
+                                                unsigned window_width) noexcept;
 } // namespace sxt::cbnbck
@@ -19,6 +19,8 @@
 #include <vector>
 
 #include "sxt/base/test/unit_test.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
 
 using namespace sxt;
 using namespace sxt::cbnbck;
@@ -55,3 +57,27 @@ TEST_CASE("we can make a span for the referenced scalars") {
     REQUIRE(span.data() == data);
   }
 }
+
+TEST_CASE("we can copy column-major scalars into exponent sequences") {
+  memmg::managed_array<uint8_t> data;
+
+  SECTION("we handle a single output") {
+    std::vector<uint8_t> scalars = {1, 2, 3};
+    std::vector<mtxb::exponent_sequence> sequences(1);
+    make_exponent_sequences(sequences, data, 1, 3, scalars.data());
+    REQUIRE(sequences[0].element_nbytes == 1);
+    REQUIRE(sequences[0].n == 3);
+    REQUIRE(std::vector<uint8_t>(sequences[0].data, sequences[0].data + 3) == scalars);
+  }
+
+  SECTION("we handle multiple outputs with multibyte scalars") {
+    std::vector<uint8_t> scalars = {1, 2, 3, 4, 5, 6, 7, 8};
+    std::vector<mtxb::exponent_sequence> sequences(2);
+    make_exponent_sequences(sequences, data, 2, 2, scalars.data());
+    std::vector<uint8_t> expected1 = {1, 2, 5, 6};
+    std::vector<uint8_t> expected2 = {3, 4, 7, 8};
+    REQUIRE(sequences[1].element_nbytes == 2);
+    REQUIRE(std::vector<uint8_t>(sequences[0].data, sequences[0].data + 4) == expected1);
+    REQUIRE(std::vector<uint8_t>(sequences[1].data, sequences[1].data + 4) == expected2);
+  }
+}
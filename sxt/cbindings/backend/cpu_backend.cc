@@ -16,46 +16,74 @@
  */
 #include "sxt/cbindings/backend/cpu_backend.h"
 
+#include <algorithm>
 #include <cstring>
 #include <numeric>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "sxt/base/error/assert.h"
 #include "sxt/base/error/panic.h"
+#include "sxt/base/log/log.h"
 #include "sxt/base/num/ceil_log2.h"
 #include "sxt/base/num/divide_up.h"
 #include "sxt/cbindings/backend/callback_sumcheck_transcript.h"
 #include "sxt/cbindings/backend/computational_backend_utility.h"
+#include "sxt/cbindings/backend/montgomery_sumcheck_transcript.h"
 #include "sxt/cbindings/base/curve_id_utility.h"
 #include "sxt/cbindings/base/field_id_utility.h"
 #include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/batch_add.h"
 #include "sxt/curve21/operation/double.h"
 #include "sxt/curve21/operation/neg.h"
 #include "sxt/curve_bng1/operation/add.h"
+#include "sxt/curve_bng1/operation/batch_add.h"
 #include "sxt/curve_bng1/operation/double.h"
+#include "sxt/curve_bng1/operation/endomorphism.h"
 #include "sxt/curve_bng1/operation/neg.h"
 #include "sxt/curve_bng1/type/conversion_utility.h"
 #include "sxt/curve_bng1/type/element_affine.h"
 #include "sxt/curve_bng1/type/element_p2.h"
 #include "sxt/curve_g1/operation/add.h"
+#include "sxt/curve_g1/operation/batch_add.h"
 #include "sxt/curve_g1/operation/compression.h"
 #include "sxt/curve_g1/operation/double.h"
+#include "sxt/curve_g1/operation/endomorphism.h"
 #include "sxt/curve_g1/operation/neg.h"
 #include "sxt/curve_g1/type/compressed_element.h"
 #include "sxt/curve_g1/type/element_p2.h"
 #include "sxt/curve_gk/operation/add.h"
+#include "sxt/curve_gk/operation/batch_add.h"
 #include "sxt/curve_gk/operation/double.h"
+#include "sxt/curve_gk/operation/endomorphism.h"
 #include "sxt/curve_gk/operation/neg.h"
 #include "sxt/curve_gk/type/conversion_utility.h"
 #include "sxt/curve_gk/type/element_affine.h"
 #include "sxt/curve_gk/type/element_p2.h"
 #include "sxt/execution/async/future.h"
+#include "sxt/execution/cpu/thread_count.h"
 #include "sxt/memory/management/managed_array.h"
 #include "sxt/multiexp/base/exponent_sequence.h"
-#include "sxt/multiexp/curve/multiexponentiation.h"
+#include "sxt/multiexp/base/sparse_sequence_utility.h"
+#include "sxt/multiexp/bucket_method2/cpu_multiexponentiation.h"
+#include "sxt/multiexp/bucket_method2/histogram_multiexponentiation.h"
+#include "sxt/multiexp/bucket_method2/small_width_multiexponentiation.h"
+#include "sxt/multiexp/curve/cpu_multiexponentiation.h"
+#include "sxt/multiexp/curve/straus_multiexponentiation.h"
+#include "sxt/multiexp/glv/curve_endomorphism.h"
+#include "sxt/multiexp/glv/decomposition_option.h"
+#include "sxt/multiexp/glv/multiexponentiation.h"
+#include "sxt/multiexp/glv/scalar_decomposition.h"
 #include "sxt/multiexp/pippenger2/in_memory_partition_table_accessor_utility.h"
+#include "sxt/multiexp/pippenger2/mapped_partition_table_accessor.h"
+#include "sxt/multiexp/pippenger2/mapping_options.h"
 #include "sxt/multiexp/pippenger2/multiexponentiation.h"
 #include "sxt/multiexp/pippenger2/variable_length_multiexponentiation.h"
+#include "sxt/multiexp/pippenger2/window_width.h"
+#include "sxt/multiexp/selection/active_profile.h"
+#include "sxt/multiexp/selection/engine.h"
+#include "sxt/multiexp/selection/engine_selection.h"
 #include "sxt/proof/inner_product/cpu_driver.h"
 #include "sxt/proof/inner_product/proof_computation.h"
 #include "sxt/proof/inner_product/proof_descriptor.h"
@@ -64,9 +92,261 @@
 #include "sxt/proof/transcript/transcript.h"
 #include "sxt/ristretto/operation/compression.h"
 #include "sxt/ristretto/type/compressed_element.h"
+#include "sxt/scalar25/operation/montgomery.h"
+#include "sxt/scalar25/type/montgomery_element.h"
 #include "sxt/seqcommit/generator/precomputed_generators.h"
 
 namespace sxt::cbnbck {
+//--------------------------------------------------------------------------------------------------
+// use_glv_decomposition
+//--------------------------------------------------------------------------------------------------
+/**
+ * For curves with an efficient endomorphism, GLV decomposition can be opted into with the
+ * BLITZAR_GLV environment variable. It then becomes a candidate engine for the planner.
+ */
+template <bascrv::element T> static bool use_glv_decomposition() noexcept {
+  if constexpr (mtxglv::curve_endomorphism<T>) {
+    return mtxglv::use_decomposition();
+  } else {
+    return false;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_planned_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+/**
+ * Choose between Straus's method, the signed digit bucket method, the threaded bitwise
+ * multiproduct decomposition, value bucketing for boolean and other 1 or 2 byte columns, value
+ * histograms for low cardinality columns, and GLV decomposition when enabled with the cost models
+ * of plan_multiexponentiation, scaled by the active cost profile for the curve.
+ *
+ * distinct_value_counts holds the already computed distinct value count of each sequence,
+ * max_magnitudes the already computed small width magnitude of each sequence (0 for wider
+ * sequences), and histograms, if not empty, the already built value histogram of each sequence.
+ */
+template <bascrv::element T>
+static memmg::managed_array<T> compute_planned_multiexponentiation(
+    std::string_view curve, basct::cspan<T> generators,
+    basct::cspan<mtxb::exponent_sequence> value_sequences,
+    basct::cspan<size_t> distinct_value_counts, basct::cspan<unsigned> max_magnitudes,
+    basct::cspan<mtxbk2::value_histogram> histograms = {}) noexcept {
+  memmg::managed_array<T> res(value_sequences.size());
+  if (res.empty()) {
+    return res;
+  }
+  auto descriptor = mtxsel::describe_multiexponentiation(curve, sizeof(T), value_sequences,
+                                                         distinct_value_counts, max_magnitudes);
+  descriptor.has_endomorphism = use_glv_decomposition<T>();
+  auto plan = mtxsel::plan_multiexponentiation(descriptor, mtxsel::get_active_cost_profile());
+  basl::info("computing a {} multiexponentiation of length {} with the {} engine", curve,
+             descriptor.n, mtxsel::to_string(plan.engine));
+  switch (plan.engine) {
+  case mtxsel::engine_t::straus:
+    mtxcrv::multiexponentiate_straus<T>(res, generators, value_sequences);
+    return res;
+  case mtxsel::engine_t::signed_bucket:
+    mtxbk2::multiexponentiate_cpu<T>(res, generators, value_sequences, plan.num_threads,
+                                     plan.bit_width);
+    return res;
+  case mtxsel::engine_t::multiproduct:
+    return mtxcrv::compute_multiexponentiation_cpu<T>(generators, value_sequences,
+                                                      {
+                                                          .min_chunk_size = plan.chunk_size,
+                                                          .max_chunk_size = plan.chunk_size,
+                                                          .split_factor = plan.num_threads,
+                                                      },
+                                                      plan.num_threads);
+  case mtxsel::engine_t::small_width:
+    mtxbk2::multiexponentiate_small_width_cpu<T>(res, generators, value_sequences,
+                                                 plan.num_threads, max_magnitudes);
+    return res;
+  case mtxsel::engine_t::histogram:
+    mtxbk2::multiexponentiate_histogram_cpu<T>(res, generators, value_sequences,
+                                               plan.num_threads, histograms);
+    return res;
+  case mtxsel::engine_t::glv:
+    if constexpr (mtxglv::curve_endomorphism<T>) {
+      mtxglv::multiexponentiate_cpu<T>(res, generators, value_sequences, plan.num_threads,
+                                       plan.bit_width);
+      return res;
+    }
+    break;
+  }
+  __builtin_unreachable();
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_dense_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+/**
+ * Low cardinality columns are planned separately from the rest of a batch so that they can use
+ * value histograms without forcing the other columns onto that engine. Their histograms are built
+ * while detecting them and handed to the histogram engine. The magnitudes of narrow columns are
+ * read off those histograms where possible so that the planner and the small width engine
+ * don't rescan them. Wide columns only count their values up to the number for which the planner
+ * could choose the histogram engine, and aren't scanned at all if it never would.
+ *
+ * When GLV decomposition is enabled, unsigned columns wider than a decomposed scalar are also
+ * planned separately so that narrow columns aren't expanded with zero partner rows.
+ */
+template <bascrv::element T>
+static memmg::managed_array<T>
+compute_dense_multiexponentiation(std::string_view curve, basct::cspan<T> generators,
+                                  basct::cspan<mtxb::exponent_sequence> value_sequences) noexcept {
+  static constexpr unsigned num_partitions = 3;
+  auto use_glv = use_glv_decomposition<T>();
+  auto num_outputs = value_sequences.size();
+  std::vector<size_t> distinct_value_counts(num_outputs);
+  std::vector<unsigned> max_magnitudes(num_outputs);
+  std::vector<size_t> output_indexes[num_partitions];
+  std::vector<mtxb::exponent_sequence> partitions[num_partitions];
+  std::vector<size_t> partition_counts[num_partitions];
+  std::vector<unsigned> partition_magnitudes[num_partitions];
+  std::vector<mtxbk2::value_histogram> histograms;
+  auto num_threads = xencpu::get_num_threads();
+  auto& profile = mtxsel::get_active_cost_profile();
+  mtxbk2::value_histogram histogram;
+  for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+    auto& seq = value_sequences[output_index];
+    auto is_small_width = seq.element_nbytes <= mtxbk2::max_small_width_num_bytes_v;
+    auto num_distinct = mtxbk2::max_histogram_num_values_v + 1;
+    unsigned max_magnitude = 0;
+    auto max_num_values = mtxbk2::max_histogram_num_values_v;
+    if (!is_small_width) {
+      auto descriptor = mtxsel::describe_multiexponentiation(
+          curve, sizeof(T), basct::cspan<mtxb::exponent_sequence>{&seq, 1},
+          basct::cspan<size_t>{&num_distinct, 1});
+      descriptor.has_endomorphism = use_glv;
+      max_num_values = mtxsel::max_planned_histogram_num_values(descriptor, profile);
+    }
+    if (max_num_values > 0 &&
+        mtxbk2::make_value_histogram(histogram, seq, max_num_values, num_threads)) {
+      num_distinct = histogram.values.size() / seq.element_nbytes;
+      if (is_small_width) {
+        max_magnitude = mtxbk2::compute_max_small_magnitude(histogram.values, seq.element_nbytes);
+      }
+      histograms.emplace_back(std::move(histogram));
+    } else if (is_small_width) {
+      max_magnitude = mtxbk2::compute_max_small_magnitude(seq);
+    }
+    distinct_value_counts[output_index] = num_distinct;
+    max_magnitudes[output_index] = max_magnitude;
+    unsigned partition_index = 1;
+    if (num_distinct <= mtxbk2::max_histogram_num_values_v) {
+      partition_index = 0;
+    } else if (use_glv && seq.is_signed == 0 &&
+               seq.element_nbytes > mtxglv::decomposition_num_bytes_v) {
+      partition_index = 2;
+    }
+    output_indexes[partition_index].push_back(output_index);
+    partitions[partition_index].push_back(seq);
+    partition_counts[partition_index].push_back(num_distinct);
+    partition_magnitudes[partition_index].push_back(max_magnitude);
+  }
+  if (output_indexes[0].size() == num_outputs) {
+    return compute_planned_multiexponentiation<T>(curve, generators, value_sequences,
+                                                  distinct_value_counts, max_magnitudes,
+                                                  histograms);
+  }
+  for (auto& indexes : output_indexes) {
+    if (indexes.size() == num_outputs) {
+      return compute_planned_multiexponentiation<T>(curve, generators, value_sequences,
+                                                    distinct_value_counts, max_magnitudes);
+    }
+  }
+  memmg::managed_array<T> res(num_outputs);
+  for (unsigned partition_index = 0; partition_index < num_partitions; ++partition_index) {
+    if (partitions[partition_index].empty()) {
+      continue;
+    }
+    auto values = compute_planned_multiexponentiation<T>(
+        curve, generators, partitions[partition_index], partition_counts[partition_index],
+        partition_magnitudes[partition_index],
+        partition_index == 0 ? basct::cspan<mtxbk2::value_histogram>{histograms}
+                             : basct::cspan<mtxbk2::value_histogram>{});
+    for (size_t i = 0; i < values.size(); ++i) {
+      res[output_indexes[partition_index][i]] = values[i];
+    }
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sparse sequences are computed with the generators gathered from their indexes so that the work
+ * scales with the number of stored elements.
+ */
+template <bascrv::element T>
+static memmg::managed_array<T>
+compute_multiexponentiation(std::string_view curve, basct::cspan<T> generators,
+                            basct::cspan<mtxb::exponent_sequence> value_sequences) noexcept {
+  return mtxb::compute_sparse_multiexponentiation<T>(
+      generators, value_sequences,
+      [&](basct::cspan<T> generators_p,
+          basct::cspan<mtxb::exponent_sequence> value_sequences_p) noexcept {
+        return compute_dense_multiexponentiation<T>(curve, generators_p, value_sequences_p);
+      });
+}
+
+//--------------------------------------------------------------------------------------------------
+// prove_montgomery_sumcheck
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a sumcheck proof over scalar25 elements, converting to Montgomery form only at the
+ * boundaries so that the proof's many multiplications avoid a full reduction.
+ */
+static void prove_montgomery_sumcheck(
+    basct::span<s25t::element> polynomials, basct::span<s25t::element> evaluation_point,
+    prfsk::sumcheck_transcript<s25t::element>& transcript, basct::cspan<s25t::element> mles,
+    basct::cspan<std::pair<s25t::element, unsigned>> product_table,
+    basct::cspan<unsigned> product_terms, unsigned n) noexcept {
+  using T = s25t::montgomery_element;
+  std::vector<T> mles_p(mles.size());
+  for (size_t i = 0; i < mles.size(); ++i) {
+    s25o::to_montgomery(mles_p[i], mles[i]);
+  }
+  std::vector<std::pair<T, unsigned>> product_table_p(product_table.size());
+  for (size_t i = 0; i < product_table.size(); ++i) {
+    s25o::to_montgomery(product_table_p[i].first, product_table[i].first);
+    product_table_p[i].second = product_table[i].second;
+  }
+  std::vector<T> polynomials_p(polynomials.size());
+  std::vector<T> evaluation_point_p(evaluation_point.size());
+
+  montgomery_sumcheck_transcript transcript_p{transcript};
+  prfsk::cpu_driver<T> drv;
+  auto fut = prfsk::prove_sum<T>(polynomials_p, evaluation_point_p, transcript_p, drv, mles_p,
+                                 product_table_p, product_terms, n);
+  SXT_RELEASE_ASSERT(fut.ready());
+
+  for (size_t i = 0; i < polynomials.size(); ++i) {
+    s25o::from_montgomery(polynomials[i], polynomials_p[i]);
+  }
+  for (size_t i = 0; i < evaluation_point.size(); ++i) {
+    s25o::from_montgomery(evaluation_point[i], evaluation_point_p[i]);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// get_curve_name
+//--------------------------------------------------------------------------------------------------
+static std::string_view get_curve_name(cbnb::curve_id_t curve_id) noexcept {
+  switch (curve_id) {
+  case cbnb::curve_id_t::curve25519:
+    return "curve25519";
+  case cbnb::curve_id_t::bls12_381:
+    return "bls12_381";
+  case cbnb::curve_id_t::bn254:
+    return "bn254";
+  case cbnb::curve_id_t::grumpkin:
+    return "grumpkin";
+  }
+  baser::panic("unsupported curve id {}", static_cast<unsigned>(curve_id));
+}
+
 //--------------------------------------------------------------------------------------------------
 // prove_sumcheck
 //--------------------------------------------------------------------------------------------------
@@ -103,6 +383,12 @@ void cpu_backend::prove_sumcheck(void* polynomials, void* evaluation_point, unsi
             descriptor.product_terms,
             descriptor.num_product_terms,
         };
+        if constexpr (std::is_same_v<T, s25t::element>) {
+          prove_montgomery_sumcheck(polynomials_span, evaluation_point_span, transcript,
+                                    mles_span, product_table_span, product_terms_span,
+                                    descriptor.n);
+          return;
+        }
         prfsk::cpu_driver<T> drv;
         auto fut =
             prfsk::prove_sum<T>(polynomials_span, evaluation_point_span, transcript, drv, mles_span,
@@ -117,7 +403,8 @@ void cpu_backend::prove_sumcheck(void* polynomials, void* evaluation_point, unsi
 void cpu_backend::compute_commitments(basct::span<rstt::compressed_element> commitments,
                                       basct::cspan<mtxb::exponent_sequence> value_sequences,
                                       basct::cspan<c21t::element_p3> generators) const noexcept {
-  auto values = mtxcrv::compute_multiexponentiation<c21t::element_p3>(generators, value_sequences);
+  auto values =
+      compute_multiexponentiation<c21t::element_p3>("curve25519", generators, value_sequences);
   rsto::batch_compress(commitments, values);
 }
 
@@ -127,7 +414,8 @@ void cpu_backend::compute_commitments(basct::span<rstt::compressed_element> comm
 void cpu_backend::compute_commitments(basct::span<cg1t::compressed_element> commitments,
                                       basct::cspan<mtxb::exponent_sequence> value_sequences,
                                       basct::cspan<cg1t::element_p2> generators) const noexcept {
-  auto values = mtxcrv::compute_multiexponentiation<cg1t::element_p2>(generators, value_sequences);
+  auto values =
+      compute_multiexponentiation<cg1t::element_p2>("bls12_381", generators, value_sequences);
   cg1o::batch_compress(commitments, values);
 }
 
@@ -137,7 +425,8 @@ void cpu_backend::compute_commitments(basct::span<cg1t::compressed_element> comm
 void cpu_backend::compute_commitments(basct::span<cn1t::element_affine> commitments,
                                       basct::cspan<mtxb::exponent_sequence> value_sequences,
                                       basct::cspan<cn1t::element_p2> generators) const noexcept {
-  auto values = mtxcrv::compute_multiexponentiation<cn1t::element_p2>(generators, value_sequences);
+  auto values =
+      compute_multiexponentiation<cn1t::element_p2>("bn254", generators, value_sequences);
   cn1t::batch_to_element_affine(commitments, values);
 }
 
@@ -147,7 +436,8 @@ void cpu_backend::compute_commitments(basct::span<cn1t::element_affine> commitme
 void cpu_backend::compute_commitments(basct::span<cgkt::element_affine> commitments,
                                       basct::cspan<mtxb::exponent_sequence> value_sequences,
                                       basct::cspan<cgkt::element_p2> generators) const noexcept {
-  auto values = mtxcrv::compute_multiexponentiation<cgkt::element_p2>(generators, value_sequences);
+  auto values =
+      compute_multiexponentiation<cgkt::element_p2>("grumpkin", generators, value_sequences);
   cgkt::batch_to_element_affine(commitments, values);
 }
 
@@ -190,6 +480,25 @@ bool cpu_backend::verify_inner_product(prft::transcript& transcript,
       .value();
 }
 
+//--------------------------------------------------------------------------------------------------
+// multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void cpu_backend::multiexponentiation(void* res, cbnb::curve_id_t curve_id,
+                                      const void* generators, unsigned element_num_bytes,
+                                      unsigned num_outputs, unsigned n,
+                                      const uint8_t* scalars) const noexcept {
+  cbnb::switch_curve_type(curve_id, [&]<class U, class T>(std::type_identity<U>,
+                                                          std::type_identity<T>) noexcept {
+    basct::cspan<T> generators_span{static_cast<const T*>(generators), n};
+    memmg::managed_array<mtxb::exponent_sequence> value_sequences(num_outputs);
+    memmg::managed_array<uint8_t> data;
+    make_exponent_sequences(value_sequences, data, element_num_bytes, n, scalars);
+    auto values =
+        compute_multiexponentiation<T>(get_curve_name(curve_id), generators_span, value_sequences);
+    std::copy(values.begin(), values.end(), static_cast<T*>(res));
+  });
+}
+
 //--------------------------------------------------------------------------------------------------
 // make_partition_table_accessor
 //--------------------------------------------------------------------------------------------------
@@ -199,12 +508,13 @@ cpu_backend::make_partition_table_accessor(cbnb::curve_id_t curve_id, const void
   std::unique_ptr<mtxpp2::partition_table_accessor_base> res;
   cbnb::switch_curve_type(
       curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+        auto alloc = make_partition_table_alloc(sizeof(U), n, mtxpp2::get_default_window_width());
         if constexpr (std::is_same_v<U, T>) {
           res = mtxpp2::make_in_memory_partition_table_accessor<T>(
-              basct::cspan<T>{static_cast<const T*>(generators), n}, basm::alloc_t{});
+              basct::cspan<T>{static_cast<const T*>(generators), n}, alloc);
         } else {
           res = mtxpp2::make_in_memory_partition_table_accessor<U, T>(
-              basct::cspan<T>{static_cast<const T*>(generators), n}, basm::alloc_t{});
+              basct::cspan<T>{static_cast<const T*>(generators), n}, alloc);
         }
       });
   return res;
@@ -261,6 +571,44 @@ void cpu_backend::fixed_multiexponentiation(void* res, cbnb::curve_id_t curve_id
   });
 }
 
+//--------------------------------------------------------------------------------------------------
+// fixed_offset_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void cpu_backend::fixed_offset_multiexponentiation(
+    void* res, cbnb::curve_id_t curve_id, const mtxpp2::partition_table_accessor_base& accessor,
+    const unsigned* output_bit_table, const unsigned* output_firsts,
+    const unsigned* output_lengths, unsigned num_outputs, const uint8_t* scalars) const noexcept {
+  cbnb::switch_curve_type(curve_id, [&]<class U, class T>(std::type_identity<U>,
+                                                          std::type_identity<T>) noexcept {
+    basct::span<T> res_span{static_cast<T*>(res), num_outputs};
+    basct::cspan<unsigned> output_bit_table_span{output_bit_table, num_outputs};
+    basct::cspan<unsigned> output_firsts_span{output_firsts, num_outputs};
+    basct::cspan<unsigned> output_lengths_span{output_lengths, num_outputs};
+    auto scalars_span = make_scalars_span(scalars, output_bit_table_span, output_lengths_span);
+    mtxpp2::offset_multiexponentiate<T>(
+        res_span, static_cast<const mtxpp2::partition_table_accessor<U>&>(accessor),
+        output_bit_table_span, output_firsts_span, output_lengths_span, scalars_span);
+  });
+}
+
+//--------------------------------------------------------------------------------------------------
+// fixed_sparse_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void cpu_backend::fixed_sparse_multiexponentiation(
+    void* res, cbnb::curve_id_t curve_id, const mtxpp2::partition_table_accessor_base& accessor,
+    unsigned element_num_bytes, unsigned num_outputs, unsigned n, const uint64_t* indexes,
+    const uint8_t* scalars) const noexcept {
+  cbnb::switch_curve_type(curve_id, [&]<class U, class T>(std::type_identity<U>,
+                                                          std::type_identity<T>) noexcept {
+    memmg::managed_array<T> generators(n);
+    mtxpp2::gather_partition_table_generators<U, T>(
+        generators, static_cast<const mtxpp2::partition_table_accessor<U>&>(accessor),
+        basct::cspan<uint64_t>{indexes, n});
+    this->multiexponentiation(res, curve_id, generators.data(), element_num_bytes, num_outputs, n,
+                              scalars);
+  });
+}
+
 //--------------------------------------------------------------------------------------------------
 // read_partition_table_accessor
 //--------------------------------------------------------------------------------------------------
@@ -268,10 +616,16 @@ std::unique_ptr<mtxpp2::partition_table_accessor_base>
 cpu_backend::read_partition_table_accessor(cbnb::curve_id_t curve_id,
                                            const char* filename) const noexcept {
   std::unique_ptr<mtxpp2::partition_table_accessor_base> res;
+  auto mapping_options = mtxpp2::get_mapping_options();
   cbnb::switch_curve_type(curve_id, [&]<class U, class T>(std::type_identity<U>,
                                                           std::type_identity<T>) noexcept {
-    res =
-        std::make_unique<mtxpp2::in_memory_partition_table_accessor<U>>(filename, basm::alloc_t{});
+    if (mapping_options) {
+      res = std::make_unique<mtxpp2::mapped_partition_table_accessor<U>>(filename,
+                                                                         *mapping_options);
+      return;
+    }
+    res = std::make_unique<mtxpp2::in_memory_partition_table_accessor<U>>(
+        filename, make_partition_table_alloc(filename));
   });
   return res;
 }
@@ -63,6 +63,10 @@ public:
                             basct::cspan<rstt::compressed_element> r_vector,
                             const s25t::element& ap_value) const noexcept override;
 
+  void multiexponentiation(void* res, cbnb::curve_id_t curve_id, const void* generators,
+                           unsigned element_num_bytes, unsigned num_outputs, unsigned n,
+                           const uint8_t* scalars) const noexcept override;
+
   std::unique_ptr<mtxpp2::partition_table_accessor_base>
   make_partition_table_accessor(cbnb::curve_id_t curve_id, const void* generators,
                                 unsigned n) const noexcept override;
@@ -83,6 +87,19 @@ public:
                                  unsigned num_outputs,
                                  const uint8_t* scalars) const noexcept override;
 
+  void fixed_offset_multiexponentiation(void* res, cbnb::curve_id_t curve_id,
+                                        const mtxpp2::partition_table_accessor_base& accessor,
+                                        const unsigned* output_bit_table,
+                                        const unsigned* output_firsts,
+                                        const unsigned* output_lengths, unsigned num_outputs,
+                                        const uint8_t* scalars) const noexcept override;
+
+  void fixed_sparse_multiexponentiation(void* res, cbnb::curve_id_t curve_id,
+                                        const mtxpp2::partition_table_accessor_base& accessor,
+                                        unsigned element_num_bytes, unsigned num_outputs,
+                                        unsigned n, const uint64_t* indexes,
+                                        const uint8_t* scalars) const noexcept override;
+
   std::unique_ptr<mtxpp2::partition_table_accessor_base>
   read_partition_table_accessor(cbnb::curve_id_t curve_id,
                                 const char* filename) const noexcept override;
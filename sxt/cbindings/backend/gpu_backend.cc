@@ -55,8 +55,11 @@
 #include "sxt/execution/schedule/scheduler.h"
 #include "sxt/memory/management/managed_array.h"
 #include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/base/sparse_sequence_utility.h"
 #include "sxt/multiexp/curve/multiexponentiation.h"
 #include "sxt/multiexp/pippenger2/in_memory_partition_table_accessor_utility.h"
+#include "sxt/multiexp/pippenger2/mapped_partition_table_accessor.h"
+#include "sxt/multiexp/pippenger2/mapping_options.h"
 #include "sxt/multiexp/pippenger2/multiexponentiation.h"
 #include "sxt/multiexp/pippenger2/multiexponentiation_serialization.h"
 #include "sxt/multiexp/pippenger2/variable_length_multiexponentiation.h"
@@ -74,6 +77,27 @@
 using sxt::rstt::operator""_rs;
 
 namespace sxt::cbnbck {
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sparse sequences are computed with the generators gathered from their indexes so that only the
+ * referenced generators are copied to the device.
+ */
+template <bascrv::element T>
+static memmg::managed_array<T>
+compute_multiexponentiation(basct::cspan<T> generators,
+                            basct::cspan<mtxb::exponent_sequence> value_sequences) noexcept {
+  return mtxb::compute_sparse_multiexponentiation<T>(
+      generators, value_sequences,
+      [](basct::cspan<T> generators_p,
+         basct::cspan<mtxb::exponent_sequence> value_sequences_p) noexcept {
+        auto fut = mtxcrv::async_compute_multiexponentiation<T>(generators_p, value_sequences_p);
+        xens::get_scheduler().run();
+        return memmg::managed_array<T>{std::move(fut.value())};
+      });
+}
+
 //--------------------------------------------------------------------------------------------------
 // pre_initialize_gpu
 //--------------------------------------------------------------------------------------------------
@@ -150,10 +174,8 @@ void gpu_backend::prove_sumcheck(void* polynomials, void* evaluation_point, unsi
 void gpu_backend::compute_commitments(basct::span<rstt::compressed_element> commitments,
                                       basct::cspan<mtxb::exponent_sequence> value_sequences,
                                       basct::cspan<c21t::element_p3> generators) const noexcept {
-  auto fut =
-      mtxcrv::async_compute_multiexponentiation<c21t::element_p3>(generators, value_sequences);
-  xens::get_scheduler().run();
-  rsto::batch_compress(commitments, fut.value());
+  auto values = compute_multiexponentiation<c21t::element_p3>(generators, value_sequences);
+  rsto::batch_compress(commitments, values);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -162,10 +184,8 @@ void gpu_backend::compute_commitments(basct::span<rstt::compressed_element> comm
 void gpu_backend::compute_commitments(basct::span<cg1t::compressed_element> commitments,
                                       basct::cspan<mtxb::exponent_sequence> value_sequences,
                                       basct::cspan<cg1t::element_p2> generators) const noexcept {
-  auto fut =
-      mtxcrv::async_compute_multiexponentiation<cg1t::element_p2>(generators, value_sequences);
-  xens::get_scheduler().run();
-  cg1o::batch_compress(commitments, fut.value());
+  auto values = compute_multiexponentiation<cg1t::element_p2>(generators, value_sequences);
+  cg1o::batch_compress(commitments, values);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -174,10 +194,8 @@ void gpu_backend::compute_commitments(basct::span<cg1t::compressed_element> comm
 void gpu_backend::compute_commitments(basct::span<cn1t::element_affine> commitments,
                                       basct::cspan<mtxb::exponent_sequence> value_sequences,
                                       basct::cspan<cn1t::element_p2> generators) const noexcept {
-  auto fut =
-      mtxcrv::async_compute_multiexponentiation<cn1t::element_p2>(generators, value_sequences);
-  xens::get_scheduler().run();
-  cn1t::batch_to_element_affine(commitments, fut.value());
+  auto values = compute_multiexponentiation<cn1t::element_p2>(generators, value_sequences);
+  cn1t::batch_to_element_affine(commitments, values);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -186,10 +204,8 @@ void gpu_backend::compute_commitments(basct::span<cn1t::element_affine> commitme
 void gpu_backend::compute_commitments(basct::span<cgkt::element_affine> commitments,
                                       basct::cspan<mtxb::exponent_sequence> value_sequences,
                                       basct::cspan<cgkt::element_p2> generators) const noexcept {
-  auto fut =
-      mtxcrv::async_compute_multiexponentiation<cgkt::element_p2>(generators, value_sequences);
-  xens::get_scheduler().run();
-  cgkt::batch_to_element_affine(commitments, fut.value());
+  auto values = compute_multiexponentiation<cgkt::element_p2>(generators, value_sequences);
+  cgkt::batch_to_element_affine(commitments, values);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -233,6 +249,24 @@ bool gpu_backend::verify_inner_product(prft::transcript& transcript,
   return fut.value();
 }
 
+//--------------------------------------------------------------------------------------------------
+// multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void gpu_backend::multiexponentiation(void* res, cbnb::curve_id_t curve_id,
+                                      const void* generators, unsigned element_num_bytes,
+                                      unsigned num_outputs, unsigned n,
+                                      const uint8_t* scalars) const noexcept {
+  cbnb::switch_curve_type(
+      curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+        basct::cspan<T> generators_span{static_cast<const T*>(generators), n};
+        memmg::managed_array<mtxb::exponent_sequence> value_sequences(num_outputs);
+        memmg::managed_array<uint8_t> data;
+        make_exponent_sequences(value_sequences, data, element_num_bytes, n, scalars);
+        auto values = compute_multiexponentiation<T>(generators_span, value_sequences);
+        std::copy(values.begin(), values.end(), static_cast<T*>(res));
+      });
+}
+
 //--------------------------------------------------------------------------------------------------
 // make_partition_table_accessor
 //--------------------------------------------------------------------------------------------------
@@ -333,6 +367,45 @@ void gpu_backend::fixed_multiexponentiation(void* res, cbnb::curve_id_t curve_id
       });
 }
 
+//--------------------------------------------------------------------------------------------------
+// fixed_offset_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void gpu_backend::fixed_offset_multiexponentiation(
+    void* res, cbnb::curve_id_t curve_id, const mtxpp2::partition_table_accessor_base& accessor,
+    const unsigned* output_bit_table, const unsigned* output_firsts,
+    const unsigned* output_lengths, unsigned num_outputs, const uint8_t* scalars) const noexcept {
+  cbnb::switch_curve_type(
+      curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+        basct::span<T> res_span{static_cast<T*>(res), num_outputs};
+        basct::cspan<unsigned> output_bit_table_span{output_bit_table, num_outputs};
+        basct::cspan<unsigned> output_firsts_span{output_firsts, num_outputs};
+        basct::cspan<unsigned> output_lengths_span{output_lengths, num_outputs};
+        auto scalars_span = make_scalars_span(scalars, output_bit_table_span, output_lengths_span);
+        auto fut = mtxpp2::async_offset_multiexponentiate<T>(
+            res_span, static_cast<const mtxpp2::partition_table_accessor<U>&>(accessor),
+            output_bit_table_span, output_firsts_span, output_lengths_span, scalars_span);
+        xens::get_scheduler().run();
+      });
+}
+
+//--------------------------------------------------------------------------------------------------
+// fixed_sparse_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+void gpu_backend::fixed_sparse_multiexponentiation(
+    void* res, cbnb::curve_id_t curve_id, const mtxpp2::partition_table_accessor_base& accessor,
+    unsigned element_num_bytes, unsigned num_outputs, unsigned n, const uint64_t* indexes,
+    const uint8_t* scalars) const noexcept {
+  cbnb::switch_curve_type(
+      curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+        memmg::managed_array<T> generators(n);
+        mtxpp2::gather_partition_table_generators<U, T>(
+            generators, static_cast<const mtxpp2::partition_table_accessor<U>&>(accessor),
+            basct::cspan<uint64_t>{indexes, n});
+        this->multiexponentiation(res, curve_id, generators.data(), element_num_bytes,
+                                  num_outputs, n, scalars);
+      });
+}
+
 //--------------------------------------------------------------------------------------------------
 // read_partition_table_accessor
 //--------------------------------------------------------------------------------------------------
@@ -340,8 +413,14 @@ std::unique_ptr<mtxpp2::partition_table_accessor_base>
 gpu_backend::read_partition_table_accessor(cbnb::curve_id_t curve_id,
                                            const char* filename) const noexcept {
   std::unique_ptr<mtxpp2::partition_table_accessor_base> res;
+  auto mapping_options = mtxpp2::get_mapping_options();
   cbnb::switch_curve_type(
       curve_id, [&]<class U, class T>(std::type_identity<U>, std::type_identity<T>) noexcept {
+        if (mapping_options) {
+          res = std::make_unique<mtxpp2::mapped_partition_table_accessor<U>>(filename,
+                                                                             *mapping_options);
+          return;
+        }
         res = std::make_unique<mtxpp2::in_memory_partition_table_accessor<U>>(filename);
       });
   return res;
@@ -0,0 +1,42 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/cbindings/backend/montgomery_sumcheck_transcript.h"
+
+#include <vector>
+
+namespace sxt::cbnbck {
+//--------------------------------------------------------------------------------------------------
+// init
+//--------------------------------------------------------------------------------------------------
+void montgomery_sumcheck_transcript::init(size_t num_variables, size_t round_degree) noexcept {
+  base_.init(num_variables, round_degree);
+}
+
+//--------------------------------------------------------------------------------------------------
+// round_challenge
+//--------------------------------------------------------------------------------------------------
+void montgomery_sumcheck_transcript::round_challenge(
+    s25t::montgomery_element& r, basct::cspan<s25t::montgomery_element> polynomial) noexcept {
+  std::vector<s25t::element> polynomial_p(polynomial.size());
+  for (size_t i = 0; i < polynomial.size(); ++i) {
+    s25o::from_montgomery(polynomial_p[i], polynomial[i]);
+  }
+  s25t::element rp;
+  base_.round_challenge(rp, polynomial_p);
+  s25o::to_montgomery(r, rp);
+}
+} // namespace sxt::cbnbck
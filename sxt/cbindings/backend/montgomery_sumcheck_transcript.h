@@ -0,0 +1,44 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "sxt/proof/sumcheck/sumcheck_transcript.h"
+#include "sxt/scalar25/realization/field.h"
+
+namespace sxt::cbnbck {
+//--------------------------------------------------------------------------------------------------
+// montgomery_sumcheck_transcript
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adapts a transcript over regular scalars so that it can be used by a sumcheck proof computed
+ * with scalars in Montgomery form.
+ */
+class montgomery_sumcheck_transcript final
+    : public prfsk::sumcheck_transcript<s25t::montgomery_element> {
+public:
+  explicit montgomery_sumcheck_transcript(prfsk::sumcheck_transcript<s25t::element>& base) noexcept
+      : base_{base} {}
+
+  void init(size_t num_variables, size_t round_degree) noexcept override;
+
+  void round_challenge(s25t::montgomery_element& r,
+                       basct::cspan<s25t::montgomery_element> polynomial) noexcept override;
+
+private:
+  prfsk::sumcheck_transcript<s25t::element>& base_;
+};
+} // namespace sxt::cbnbck
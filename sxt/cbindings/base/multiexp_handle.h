@@ -27,6 +27,9 @@ namespace sxt::cbnb {
 //--------------------------------------------------------------------------------------------------
 struct multiexp_handle {
   curve_id_t curve_id;
+  unsigned num_generators;
+  bool use_glv = false;
+  bool use_signed_table = false;
   std::unique_ptr<mtxpp2::partition_table_accessor_base> partition_table_accessor;
 };
 } // namespace sxt::cbnb
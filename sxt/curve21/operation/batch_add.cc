@@ -0,0 +1,102 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/curve21/operation/batch_add.h"
+
+#include <algorithm>
+#include <type_traits>
+
+#include "sxt/base/error/assert.h"
+#include "sxt/base/system/cpu_features.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/lane_arithmetic.h"
+#include "sxt/curve21/type/compact_element.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve21/type/lane_element.h"
+
+namespace sxt::c21o {
+//--------------------------------------------------------------------------------------------------
+// batch_add_impl
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add the points in chunks of Lanes. Lanes past the end of the last chunk are filled with the
+ * identity and discarded.
+ */
+template <unsigned Lanes, class F>
+static void batch_add_impl(basct::span<c21t::element_p3> res, F get_rhs) noexcept {
+  c21t::lane_element_p3<Lanes> lhs, rhs;
+  auto n = res.size();
+  for (size_t first = 0; first < n; first += Lanes) {
+    auto num_lanes = static_cast<unsigned>(std::min<size_t>(Lanes, n - first));
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      if (lane < num_lanes) {
+        c21t::set_lane(lhs, lane, res[first + lane]);
+        c21t::set_lane(rhs, lane, get_rhs(first + lane));
+      } else {
+        c21t::set_lane(lhs, lane, c21t::element_p3::identity());
+        c21t::set_lane(rhs, lane, c21t::compact_element::identity());
+      }
+    }
+    if constexpr (std::is_same_v<decltype(get_rhs(0)), const c21t::compact_element&>) {
+      c21t::lane_element_cached<Lanes> t;
+      to_lane_element_cached(t, rhs);
+      mixed_add(lhs, lhs, t);
+    } else {
+      add(lhs, lhs, rhs);
+    }
+    for (unsigned lane = 0; lane < num_lanes; ++lane) {
+      c21t::get_lane(res[first + lane], lhs, lane);
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_add_dispatch
+//--------------------------------------------------------------------------------------------------
+template <class F>
+static void batch_add_dispatch(basct::span<c21t::element_p3> res, F get_rhs) noexcept {
+  if (bassy::host_cpu_features_v.avx512_ifma) {
+    batch_add_impl<8>(res, get_rhs);
+    return;
+  }
+  if (bassy::host_cpu_features_v.avx2) {
+    batch_add_impl<4>(res, get_rhs);
+    return;
+  }
+  for (size_t i = 0; i < res.size(); ++i) {
+    c21t::element_p3 e{get_rhs(i)};
+    add_inplace(res[i], e);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_add_inplace
+//--------------------------------------------------------------------------------------------------
+void batch_add_inplace(basct::span<c21t::element_p3> res,
+                       basct::cspan<c21t::element_p3> e) noexcept {
+  SXT_DEBUG_ASSERT(res.size() == e.size());
+  batch_add_dispatch(res, [&](size_t i) noexcept -> const c21t::element_p3& { return e[i]; });
+}
+
+void batch_add_inplace(basct::span<c21t::element_p3> res,
+                       const c21t::compact_element* __restrict__ table,
+                       basct::cspan<unsigned> indexes) noexcept {
+  SXT_DEBUG_ASSERT(res.size() == indexes.size());
+  batch_add_dispatch(res, [&](size_t i) noexcept -> const c21t::compact_element& {
+    return table[indexes[i]];
+  });
+}
+} // namespace sxt::c21o
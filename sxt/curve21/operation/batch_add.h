@@ -0,0 +1,45 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "sxt/base/container/span.h"
+
+namespace sxt::c21t {
+struct compact_element;
+struct element_p3;
+} // namespace sxt::c21t
+
+namespace sxt::c21o {
+//--------------------------------------------------------------------------------------------------
+// batch_add_inplace
+//--------------------------------------------------------------------------------------------------
+/**
+ * res[i] = res[i] + e[i]
+ *
+ * The independent additions are computed 8 at a time with AVX-512 IFMA or 4 at a time with AVX2
+ * when the host supports them.
+ */
+void batch_add_inplace(basct::span<c21t::element_p3> res,
+                       basct::cspan<c21t::element_p3> e) noexcept;
+
+/**
+ * res[i] = res[i] + table[indexes[i]]
+ */
+void batch_add_inplace(basct::span<c21t::element_p3> res,
+                       const c21t::compact_element* __restrict__ table,
+                       basct::cspan<unsigned> indexes) noexcept;
+} // namespace sxt::c21o
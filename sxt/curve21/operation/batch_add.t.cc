@@ -0,0 +1,59 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/curve21/operation/batch_add.h"
+
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/type/compact_element.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve21/type/literal.h"
+
+using namespace sxt;
+using namespace sxt::c21o;
+using c21t::operator""_c21;
+
+TEST_CASE("we can add batches of points") {
+  for (size_t n : {0, 1, 5, 8, 13}) {
+    std::vector<c21t::element_p3> lhs(n), rhs(n);
+    for (size_t i = 0; i < n; ++i) {
+      add(lhs[i], i == 0 ? 0x123_c21 : lhs[i - 1], 0x456_c21);
+      add(rhs[i], i == 0 ? 0x789_c21 : rhs[i - 1], 0x123_c21);
+    }
+    std::vector<c21t::element_p3> expected(n);
+    for (size_t i = 0; i < n; ++i) {
+      add(expected[i], lhs[i], rhs[i]);
+    }
+
+    SECTION("we can add pairs of points for n = " + std::to_string(n)) {
+      batch_add_inplace(lhs, rhs);
+      REQUIRE(lhs == expected);
+    }
+
+    SECTION("we can add entries of a table for n = " + std::to_string(n)) {
+      std::vector<c21t::compact_element> table(n + 1, c21t::compact_element::identity());
+      std::vector<unsigned> indexes(n);
+      for (size_t i = 0; i < n; ++i) {
+        indexes[i] = static_cast<unsigned>(n - i);
+        table[n - i] = static_cast<c21t::compact_element>(rhs[i]);
+      }
+      batch_add_inplace(lhs, table.data(), indexes);
+      REQUIRE(lhs == expected);
+    }
+  }
+}
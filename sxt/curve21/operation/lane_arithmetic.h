@@ -0,0 +1,148 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "sxt/curve21/type/lane_element.h"
+#include "sxt/field51/base/lane_arithmetic.h"
+#include "sxt/field51/constant/d.h"
+
+namespace sxt::c21o {
+namespace detail {
+//--------------------------------------------------------------------------------------------------
+// to_lane_element_p3
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert the completed coordinates of a sum or double, laid out as element_p1p1 is, back into
+ * extended coordinates.
+ */
+template <unsigned Lanes>
+inline void to_lane_element_p3(c21t::lane_element_p3<Lanes>& res,
+                               const c21t::lane_element_p3<Lanes>& r) noexcept {
+  f51b::lane_element<Lanes> t;
+  f51b::mul(t, r.X, r.Y);
+  f51b::mul(res.X, r.X, r.T);
+  f51b::mul(res.Y, r.Y, r.Z);
+  f51b::mul(res.Z, r.Z, r.T);
+  res.T = t;
+}
+
+//--------------------------------------------------------------------------------------------------
+// add_impl
+//--------------------------------------------------------------------------------------------------
+template <bool UnitZ, unsigned Lanes>
+inline void add_impl(c21t::lane_element_p3<Lanes>& res, const c21t::lane_element_p3<Lanes>& p,
+                     const c21t::lane_element_cached<Lanes>& q) noexcept {
+  c21t::lane_element_p3<Lanes> r;
+  f51b::lane_element<Lanes> t0;
+
+  f51b::add(r.X, p.Y, p.X);
+  f51b::sub(r.Y, p.Y, p.X);
+  f51b::mul(r.Z, r.X, q.YplusX);
+  f51b::mul(r.Y, r.Y, q.YminusX);
+  f51b::mul(r.T, q.T2d, p.T);
+  if constexpr (UnitZ) {
+    f51b::add(t0, p.Z, p.Z);
+  } else {
+    f51b::mul(r.X, p.Z, q.Z);
+    f51b::add(t0, r.X, r.X);
+  }
+  f51b::sub(r.X, r.Z, r.Y);
+  f51b::add(r.Y, r.Z, r.Y);
+  f51b::add(r.Z, t0, r.T);
+  f51b::sub(r.T, t0, r.T);
+
+  to_lane_element_p3(res, r);
+}
+} // namespace detail
+
+//--------------------------------------------------------------------------------------------------
+// to_lane_element_cached
+//--------------------------------------------------------------------------------------------------
+template <unsigned Lanes>
+inline void to_lane_element_cached(c21t::lane_element_cached<Lanes>& res,
+                                   const c21t::lane_element_p3<Lanes>& p) noexcept {
+  f51b::lane_element<Lanes> d2;
+  for (unsigned lane = 0; lane < Lanes; ++lane) {
+    c21t::set_lane(d2, lane, f51cn::d2_v);
+  }
+  f51b::lane_element<Lanes> t;
+  f51b::sub(t, p.Y, p.X);
+  f51b::add(res.YplusX, p.Y, p.X);
+  res.YminusX = t;
+  res.Z = p.Z;
+  f51b::mul(res.T2d, p.T, d2);
+}
+
+//--------------------------------------------------------------------------------------------------
+// add
+//--------------------------------------------------------------------------------------------------
+/**
+ * res = p + q
+ */
+template <unsigned Lanes>
+inline void add(c21t::lane_element_p3<Lanes>& res, const c21t::lane_element_p3<Lanes>& p,
+                const c21t::lane_element_cached<Lanes>& q) noexcept {
+  detail::add_impl<false>(res, p, q);
+}
+
+template <unsigned Lanes>
+inline void add(c21t::lane_element_p3<Lanes>& res, const c21t::lane_element_p3<Lanes>& p,
+                const c21t::lane_element_p3<Lanes>& q) noexcept {
+  c21t::lane_element_cached<Lanes> t;
+  to_lane_element_cached(t, q);
+  detail::add_impl<false>(res, p, t);
+}
+
+//--------------------------------------------------------------------------------------------------
+// mixed_add
+//--------------------------------------------------------------------------------------------------
+/**
+ * res = p + q for a q whose Z coordinate is one in every lane, as with points loaded from
+ * compact_element, which saves a multiplication.
+ */
+template <unsigned Lanes>
+inline void mixed_add(c21t::lane_element_p3<Lanes>& res, const c21t::lane_element_p3<Lanes>& p,
+                      const c21t::lane_element_cached<Lanes>& q) noexcept {
+  detail::add_impl<true>(res, p, q);
+}
+
+//--------------------------------------------------------------------------------------------------
+// double_element
+//--------------------------------------------------------------------------------------------------
+/**
+ * res = 2 * p
+ */
+template <unsigned Lanes>
+inline void double_element(c21t::lane_element_p3<Lanes>& res,
+                           const c21t::lane_element_p3<Lanes>& p) noexcept {
+  c21t::lane_element_p3<Lanes> r;
+  f51b::lane_element<Lanes> t0;
+
+  f51b::sq(r.X, p.X);
+  f51b::sq(r.Z, p.Y);
+  f51b::sq(r.T, p.Z);
+  f51b::add(r.T, r.T, r.T);
+  f51b::add(r.Y, p.X, p.Y);
+  f51b::sq(t0, r.Y);
+  f51b::add(r.Y, r.Z, r.X);
+  f51b::sub(r.Z, r.Z, r.X);
+  f51b::sub(r.X, t0, r.Y);
+  f51b::sub(r.T, r.T, r.Z);
+
+  detail::to_lane_element_p3(res, r);
+}
+} // namespace sxt::c21o
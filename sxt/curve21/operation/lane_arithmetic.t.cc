@@ -0,0 +1,120 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/curve21/operation/lane_arithmetic.h"
+
+#include <vector>
+
+#include "sxt/base/system/cpu_features.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/double.h"
+#include "sxt/curve21/type/compact_element.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve21/type/lane_element.h"
+#include "sxt/curve21/type/literal.h"
+
+using namespace sxt;
+using namespace sxt::c21o;
+using c21t::operator""_c21;
+
+static std::vector<c21t::element_p3> make_points(unsigned n, const c21t::element_p3& p) {
+  std::vector<c21t::element_p3> res(n);
+  res[0] = p;
+  for (unsigned i = 1; i < n; ++i) {
+    add(res[i], res[i - 1], 0x456_c21);
+  }
+  return res;
+}
+
+template <unsigned Lanes> static void check_lane_operations() {
+  auto ps = make_points(Lanes, 0x123_c21);
+  auto qs = make_points(Lanes, 0x789_c21);
+  c21t::lane_element_p3<Lanes> p, q, res;
+  for (unsigned lane = 0; lane < Lanes; ++lane) {
+    c21t::set_lane(p, lane, ps[lane]);
+    c21t::set_lane(q, lane, qs[lane]);
+  }
+  c21t::element_p3 e, expected;
+
+  SECTION("we can add points") {
+    add(res, p, q);
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      c21t::get_lane(e, res, lane);
+      add(expected, ps[lane], qs[lane]);
+      REQUIRE(e == expected);
+    }
+  }
+
+  SECTION("we can add cached points") {
+    c21t::lane_element_cached<Lanes> q_cached;
+    to_lane_element_cached(q_cached, q);
+    add(p, p, q_cached);
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      c21t::get_lane(e, p, lane);
+      add(expected, ps[lane], qs[lane]);
+      REQUIRE(e == expected);
+    }
+  }
+
+  SECTION("we can add points with a Z coordinate of one") {
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      c21t::set_lane(q, lane, static_cast<c21t::compact_element>(qs[lane]));
+    }
+    c21t::lane_element_cached<Lanes> q_cached;
+    to_lane_element_cached(q_cached, q);
+    mixed_add(res, p, q_cached);
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      c21t::get_lane(e, res, lane);
+      add(expected, ps[lane], qs[lane]);
+      REQUIRE(e == expected);
+    }
+  }
+
+  SECTION("we can add the identity") {
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      c21t::set_lane(q, lane, c21t::element_p3::identity());
+    }
+    add(res, p, q);
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      c21t::get_lane(e, res, lane);
+      REQUIRE(e == ps[lane]);
+    }
+  }
+
+  SECTION("we can double points") {
+    double_element(p, p);
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      c21t::get_lane(e, p, lane);
+      double_element(expected, ps[lane]);
+      REQUIRE(e == expected);
+    }
+  }
+}
+
+TEST_CASE("we can operate on 8 lanes of points with AVX-512 IFMA") {
+  if (!bassy::host_cpu_features_v.avx512_ifma) {
+    return;
+  }
+  check_lane_operations<8>();
+}
+
+TEST_CASE("we can operate on 4 lanes of points with AVX2") {
+  if (!bassy::host_cpu_features_v.avx2) {
+    return;
+  }
+  check_lane_operations<4>();
+}
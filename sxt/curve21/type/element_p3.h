@@ -49,6 +49,9 @@ struct element_p3 : c21o::operation_adl_stub {
   f51t::element Z;
   f51t::element T;
 
+  // opts in to the batch_add_inplace overloads of sxt/curve21/operation/batch_add.h
+  static constexpr bool batch_addable = true;
+
   static constexpr element_p3 identity() noexcept {
     return element_p3{f51cn::zero_v, f51cn::one_v, f51cn::one_v, f51cn::zero_v};
   }
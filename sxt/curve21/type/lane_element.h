@@ -0,0 +1,102 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "sxt/curve21/type/compact_element.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/field51/base/lane_arithmetic.h"
+#include "sxt/field51/constant/one.h"
+#include "sxt/field51/type/element.h"
+
+namespace sxt::c21t {
+//--------------------------------------------------------------------------------------------------
+// lane_element_p3
+//--------------------------------------------------------------------------------------------------
+/**
+ * Lanes independent element_p3 points with each coordinate stored as a lane vector.
+ *
+ * The lane operations apply each field operation to the same coordinate of every lane at once.
+ * With Lanes = 8 they require bassy::host_cpu_features_v.avx512_ifma and with Lanes = 4,
+ * bassy::host_cpu_features_v.avx2.
+ */
+template <unsigned Lanes> struct lane_element_p3 {
+  f51b::lane_element<Lanes> X;
+  f51b::lane_element<Lanes> Y;
+  f51b::lane_element<Lanes> Z;
+  f51b::lane_element<Lanes> T;
+};
+
+//--------------------------------------------------------------------------------------------------
+// lane_element_cached
+//--------------------------------------------------------------------------------------------------
+/**
+ * Lanes independent element_cached points.
+ */
+template <unsigned Lanes> struct lane_element_cached {
+  f51b::lane_element<Lanes> YplusX;
+  f51b::lane_element<Lanes> YminusX;
+  f51b::lane_element<Lanes> Z;
+  f51b::lane_element<Lanes> T2d;
+};
+
+//--------------------------------------------------------------------------------------------------
+// set_lane
+//--------------------------------------------------------------------------------------------------
+template <unsigned Lanes>
+inline void set_lane(f51b::lane_element<Lanes>& res, unsigned lane,
+                     const f51t::element& e) noexcept {
+  for (int i = 0; i < 5; ++i) {
+    res.limbs[i][lane] = e[i];
+  }
+}
+
+template <unsigned Lanes>
+inline void set_lane(lane_element_p3<Lanes>& res, unsigned lane, const element_p3& e) noexcept {
+  set_lane(res.X, lane, e.X);
+  set_lane(res.Y, lane, e.Y);
+  set_lane(res.Z, lane, e.Z);
+  set_lane(res.T, lane, e.T);
+}
+
+template <unsigned Lanes>
+inline void set_lane(lane_element_p3<Lanes>& res, unsigned lane,
+                     const compact_element& e) noexcept {
+  set_lane(res.X, lane, e.X);
+  set_lane(res.Y, lane, e.Y);
+  set_lane(res.Z, lane, f51cn::one_v);
+  set_lane(res.T, lane, e.T);
+}
+
+//--------------------------------------------------------------------------------------------------
+// get_lane
+//--------------------------------------------------------------------------------------------------
+template <unsigned Lanes>
+inline void get_lane(f51t::element& res, const f51b::lane_element<Lanes>& e,
+                     unsigned lane) noexcept {
+  for (int i = 0; i < 5; ++i) {
+    res[i] = e.limbs[i][lane];
+  }
+}
+
+template <unsigned Lanes>
+inline void get_lane(element_p3& res, const lane_element_p3<Lanes>& e, unsigned lane) noexcept {
+  get_lane(res.X, e.X, lane);
+  get_lane(res.Y, e.Y, lane);
+  get_lane(res.Z, e.Z, lane);
+  get_lane(res.T, e.T, lane);
+}
+} // namespace sxt::c21t
@@ -0,0 +1,78 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/curve21/type/lane_element.h"
+
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/type/compact_element.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve21/type/literal.h"
+
+using namespace sxt;
+using namespace sxt::c21t;
+
+template <unsigned Lanes> static void check_lane_round_trip() {
+  std::vector<element_p3> ps = {0x123_c21, 0x456_c21, 0x789_c21, element_p3::identity(),
+                                0xabc_c21, 0xdef_c21, 0x111_c21, 0x222_c21};
+  ps.resize(Lanes);
+
+  SECTION("we can round trip element_p3 points through lanes") {
+    lane_element_p3<Lanes> p;
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      set_lane(p, lane, ps[lane]);
+    }
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      element_p3 e;
+      get_lane(e, p, lane);
+      REQUIRE(e.X == ps[lane].X);
+      REQUIRE(e.Y == ps[lane].Y);
+      REQUIRE(e.Z == ps[lane].Z);
+      REQUIRE(e.T == ps[lane].T);
+    }
+  }
+
+  SECTION("setting a lane leaves the other lanes unchanged") {
+    lane_element_p3<Lanes> p;
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      set_lane(p, lane, ps[lane]);
+    }
+    set_lane(p, 0, ps[Lanes - 1]);
+    element_p3 e;
+    get_lane(e, p, 0);
+    REQUIRE(e == ps[Lanes - 1]);
+    get_lane(e, p, 1);
+    REQUIRE(e == ps[1]);
+  }
+
+  SECTION("we can load compact elements into lanes") {
+    lane_element_p3<Lanes> p;
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      set_lane(p, lane, static_cast<compact_element>(ps[lane]));
+    }
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      element_p3 e;
+      get_lane(e, p, lane);
+      REQUIRE(e == ps[lane]);
+      REQUIRE(e.Z == f51cn::one_v);
+    }
+  }
+}
+
+TEST_CASE("we can move points in and out of 4 lanes") { check_lane_round_trip<4>(); }
+
+TEST_CASE("we can move points in and out of 8 lanes") { check_lane_round_trip<8>(); }
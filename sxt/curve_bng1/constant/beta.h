@@ -0,0 +1,32 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "sxt/field25/type/element.h"
+
+namespace sxt::cn1cn {
+//--------------------------------------------------------------------------------------------------
+// beta_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * A nontrivial third root of unity in Fp in Montgomery form
+ *
+ * beta = 0x59e26bcea0d48bacd4f263f1acdb5c4f5763473177fffffe
+ */
+static constexpr f25t::element beta_v{0x71930c11d782e155, 0xa6bb947cffbe3323, 0xaa303344d4741444,
+                                      0x2c3b3f0d26594943};
+} // namespace sxt::cn1cn
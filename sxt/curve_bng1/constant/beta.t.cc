@@ -0,0 +1,47 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/curve_bng1/constant/beta.h"
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/field25/base/montgomery.h"
+#include "sxt/field25/constant/one.h"
+#include "sxt/field25/operation/mul.h"
+#include "sxt/field25/type/element.h"
+
+using namespace sxt;
+using namespace sxt::cn1cn;
+
+TEST_CASE("the beta constant") {
+  SECTION("is a nontrivial third root of unity") {
+    REQUIRE(beta_v != f25cn::one_v);
+
+    f25t::element beta_squared;
+    f25o::mul(beta_squared, beta_v, beta_v);
+    REQUIRE(beta_squared != f25cn::one_v);
+
+    f25t::element beta_cubed;
+    f25o::mul(beta_cubed, beta_squared, beta_v);
+    REQUIRE(beta_cubed == f25cn::one_v);
+  }
+
+  SECTION("is in Montgomery form") {
+    constexpr std::array<uint64_t, 4> a{0x5763473177fffffe, 0xd4f263f1acdb5c4f, 0x59e26bcea0d48bac, 0x0};
+    f25t::element expected;
+    f25b::to_montgomery_form(expected.data(), a.data());
+    REQUIRE(beta_v == expected);
+  }
+}
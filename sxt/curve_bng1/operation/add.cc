@@ -65,10 +65,9 @@ void add(cn1t::element_p2& h, const cn1t::element_p2& p, const cn1t::element_aff
   f25o::mul(z3, z3, t4);
   f25o::add(z3, z3, t0);
 
-  h.X = x3;
-  h.Y = y3;
-  h.Z = z3;
-
-  cmov(h, p, cn1p::is_identity(q));
+  // h may alias p, so select the result before writing it
+  cn1t::element_p2 res{x3, y3, z3};
+  cmov(res, p, cn1p::is_identity(q));
+  h = res;
 }
 } // namespace sxt::cn1o
@@ -126,6 +126,12 @@ TEST_CASE("addition with mixed elements") {
     REQUIRE(cn1cn::generator_p2_v == ret);
   }
 
+  SECTION("can be done inplace with the identity") {
+    cn1t::element_p2 ret{cn1cn::generator_p2_v};
+    add(ret, ret, cn1t::element_affine::identity());
+    REQUIRE(ret == cn1cn::generator_p2_v);
+  }
+
   SECTION("can reproduce doubling results") {
     cn1t::element_p2 a;
     cn1t::element_p2 b;
@@ -0,0 +1,166 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/curve_bng1/operation/batch_add.h"
+
+#include "sxt/base/error/assert.h"
+#include "sxt/curve_bng1/type/element_affine.h"
+#include "sxt/curve_bng1/type/element_p2.h"
+#include "sxt/field25/constant/one.h"
+#include "sxt/field25/constant/zero.h"
+#include "sxt/field25/operation/add.h"
+#include "sxt/field25/operation/invert.h"
+#include "sxt/field25/operation/mul.h"
+#include "sxt/field25/operation/square.h"
+#include "sxt/field25/operation/sub.h"
+#include "sxt/field25/type/element.h"
+
+namespace sxt::cn1o {
+//--------------------------------------------------------------------------------------------------
+// compute_denominator
+//--------------------------------------------------------------------------------------------------
+/**
+ * The denominator of the slope of p + q, or one if the sum doesn't need a slope.
+ */
+static void compute_denominator(f25t::element& res, const cn1t::element_affine& p,
+                                const cn1t::element_affine& q) noexcept {
+  if (p.infinity || q.infinity) {
+    res = f25cn::one_v;
+    return;
+  }
+  if (p.X != q.X) {
+    f25o::sub(res, q.X, p.X);
+    return;
+  }
+  if (p.Y == q.Y && p.Y != f25cn::zero_v) {
+    // doubling
+    f25o::add(res, p.Y, p.Y);
+    return;
+  }
+  res = f25cn::one_v;
+}
+
+//--------------------------------------------------------------------------------------------------
+// add_with_inverse
+//--------------------------------------------------------------------------------------------------
+/**
+ * p = p + q given the inverse of the slope's denominator.
+ */
+static void add_with_inverse(cn1t::element_affine& p, const cn1t::element_affine& q,
+                             const f25t::element& inv) noexcept {
+  if (q.infinity) {
+    return;
+  }
+  if (p.infinity) {
+    p = q;
+    return;
+  }
+  f25t::element lambda;
+  if (p.X != q.X) {
+    f25o::sub(lambda, q.Y, p.Y);
+  } else if (p.Y == q.Y && p.Y != f25cn::zero_v) {
+    // the curve has a = 0 so the slope of the tangent is 3x^2 / 2y
+    f25t::element t;
+    f25o::square(t, p.X);
+    f25o::add(lambda, t, t);
+    f25o::add(lambda, lambda, t);
+  } else {
+    p = cn1t::element_affine::identity();
+    return;
+  }
+  f25o::mul(lambda, lambda, inv);
+
+  // x3 = lambda^2 - x1 - x2
+  // y3 = lambda (x1 - x3) - y1
+  f25t::element x3;
+  f25o::square(x3, lambda);
+  f25o::sub(x3, x3, p.X);
+  f25o::sub(x3, x3, q.X);
+  f25t::element y3;
+  f25o::sub(y3, p.X, x3);
+  f25o::mul(y3, y3, lambda);
+  f25o::sub(p.Y, y3, p.Y);
+  p.X = x3;
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_normalize
+//--------------------------------------------------------------------------------------------------
+void batch_normalize(basct::span<cn1t::element_affine> res, basct::cspan<cn1t::element_p2> points,
+                     basct::span<f25t::element> scratch) noexcept {
+  auto n = points.size();
+  SXT_DEBUG_ASSERT(res.size() == n && scratch.size() >= n);
+  if (n == 0) {
+    return;
+  }
+
+  // prefix products of the non-zero Z coordinates
+  f25t::element acc = f25cn::one_v;
+  for (size_t i = 0; i < n; ++i) {
+    scratch[i] = acc;
+    if (points[i].Z != f25cn::zero_v) {
+      f25o::mul(acc, acc, points[i].Z);
+    }
+  }
+  f25o::invert(acc, acc);
+
+  // walk back to recover each inverse
+  for (size_t i = n; i-- > 0;) {
+    auto& p = points[i];
+    if (p.Z == f25cn::zero_v) {
+      res[i] = cn1t::element_affine::identity();
+      continue;
+    }
+    f25t::element z_inv;
+    f25o::mul(z_inv, acc, scratch[i]);
+    f25o::mul(acc, acc, p.Z);
+    f25o::mul(res[i].X, p.X, z_inv);
+    f25o::mul(res[i].Y, p.Y, z_inv);
+    res[i].infinity = false;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_add
+//--------------------------------------------------------------------------------------------------
+void batch_add(basct::span<cn1t::element_affine> res, basct::cspan<cn1t::element_affine> rhs,
+               basct::span<f25t::element> scratch) noexcept {
+  auto n = res.size();
+  SXT_DEBUG_ASSERT(rhs.size() == n && scratch.size() >= n);
+  if (n == 0) {
+    return;
+  }
+
+  // prefix products of the denominators
+  f25t::element acc = f25cn::one_v;
+  f25t::element d;
+  for (size_t i = 0; i < n; ++i) {
+    scratch[i] = acc;
+    compute_denominator(d, res[i], rhs[i]);
+    f25o::mul(acc, acc, d);
+  }
+  f25o::invert(acc, acc);
+
+  // walk back to recover each inverse
+  for (size_t i = n; i-- > 0;) {
+    f25t::element inv;
+    f25o::mul(inv, acc, scratch[i]);
+    compute_denominator(d, res[i], rhs[i]);
+    f25o::mul(acc, acc, d);
+    add_with_inverse(res[i], rhs[i], inv);
+  }
+}
+} // namespace sxt::cn1o
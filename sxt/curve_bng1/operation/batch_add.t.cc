@@ -0,0 +1,79 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/curve_bng1/operation/batch_add.h"
+
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve_bng1/constant/generator.h"
+#include "sxt/curve_bng1/operation/add.h"
+#include "sxt/curve_bng1/operation/double.h"
+#include "sxt/curve_bng1/operation/neg.h"
+#include "sxt/curve_bng1/type/conversion_utility.h"
+#include "sxt/curve_bng1/type/element_affine.h"
+#include "sxt/curve_bng1/type/element_p2.h"
+#include "sxt/field25/type/element.h"
+
+using namespace sxt;
+using namespace sxt::cn1o;
+
+TEST_CASE("we can add affine elements in batches") {
+  auto g = cn1cn::generator_p2_v;
+  std::vector<cn1t::element_p2> points(6);
+  points[0] = g;
+  for (size_t i = 1; i < points.size(); ++i) {
+    add(points[i], points[i - 1], g);
+  }
+  std::vector<cn1t::element_affine> points_affine(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    cn1t::to_element_affine(points_affine[i], points[i]);
+  }
+
+  SECTION("we can normalize projective elements") {
+    std::vector<cn1t::element_p2> points_p = {points[2], cn1t::element_p2::identity(), points[4]};
+    double_element(points_p[0], points[0]);
+    std::vector<cn1t::element_affine> res(3);
+    std::vector<f25t::element> scratch(3);
+    batch_normalize(res, points_p, scratch);
+    REQUIRE(res[0] == points_affine[1]);
+    REQUIRE(res[1] == cn1t::element_affine::identity());
+    REQUIRE(res[2] == points_affine[4]);
+  }
+
+  SECTION("we handle distinct elements, doubling, inverses and the identity") {
+    cn1t::element_p2 neg_g;
+    neg(neg_g, g);
+    cn1t::element_affine neg_g_affine;
+    cn1t::to_element_affine(neg_g_affine, neg_g);
+
+    std::vector<cn1t::element_affine> res = {
+        points_affine[0], points_affine[1], points_affine[0],
+        points_affine[2], cn1t::element_affine::identity(),
+    };
+    std::vector<cn1t::element_affine> rhs = {
+        points_affine[1], points_affine[1], neg_g_affine,
+        cn1t::element_affine::identity(), points_affine[3],
+    };
+    std::vector<f25t::element> scratch(res.size());
+    batch_add(res, rhs, scratch);
+    REQUIRE(res[0] == points_affine[2]);
+    REQUIRE(res[1] == points_affine[3]);
+    REQUIRE(res[2] == cn1t::element_affine::identity());
+    REQUIRE(res[3] == points_affine[2]);
+    REQUIRE(res[4] == points_affine[3]);
+  }
+}
@@ -0,0 +1,68 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "sxt/base/curve/decomposition_parameters.h"
+#include "sxt/base/macro/cuda_callable.h"
+
+namespace sxt::cn1t {
+struct element_p2;
+}
+
+namespace sxt::cn1o {
+//--------------------------------------------------------------------------------------------------
+// endomorphism
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the endomorphism (x, y) -> (beta x, y).
+ *
+ * For an element p of the group, the result is lambda p where
+ *
+ *    lambda = 0xb3c4d79d41a917585bfc41088d8daaa78b17ea66b99c90dd
+ *
+ * is a nontrivial third root of unity in the scalar field.
+ */
+CUDA_CALLABLE
+void endomorphism(cn1t::element_p2& r, const cn1t::element_p2& p) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// endomorphism_parameters
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parameters for decomposing a scalar k into half-length scalars k1 and k2 with
+ *
+ *    k = k1 + k2 lambda (mod r)
+ *
+ * so that k p = k1 p + k2 endomorphism(p).
+ */
+constexpr bascrv::decomposition_parameters
+endomorphism_parameters(const cn1t::element_p2& /*p*/) noexcept {
+  return {
+      .r = {0x43e1f593f0000001, 0x2833e84879b97091, 0xb85045b68181585d, 0x30644e72e131a029},
+      .n1 = bascrv::make_uint128(0x0, 0x89d3256894d213e3),
+      .n2 = bascrv::make_uint128(0x6f4d8248eeb859fc, 0x8211bbeb7d4f1128),
+      .g1 = {0xd91d232ec7e0b3d7, 0x2, 0x0},
+      .g2 = {0x7a7bd9d4391eb18d, 0x4ccef014a773d2cf, 0x2},
+      .a1 = bascrv::make_uint128(0x0, 0x89d3256894d213e3),
+      .b1 = bascrv::make_uint128(0x90b27db71147a603, 0x7dee441482b0eed8),
+      .a2 = bascrv::make_uint128(0x6f4d8248eeb859fd, 0x0be4e1541221250b),
+      .b2 = bascrv::make_uint128(0x0, 0x89d3256894d213e3),
+      .w1 = bascrv::make_uint128(0x6f4d8248eeb859fc, 0x8211bbeb7d4f1128),
+      .w2 = bascrv::make_uint128(0x6f4d8248eeb859fd, 0x0be4e1541221250b),
+  };
+}
+} // namespace sxt::cn1o
@@ -0,0 +1,60 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/curve_bng1/operation/endomorphism.h"
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve_bng1/constant/generator.h"
+#include "sxt/curve_bng1/operation/add.h"
+#include "sxt/curve_bng1/operation/scalar_multiply.h"
+#include "sxt/curve_bng1/type/element_p2.h"
+
+using namespace sxt;
+using namespace sxt::cn1o;
+
+TEST_CASE("we can compute the endomorphism of a curve element") {
+  SECTION("the endomorphism of the identity is the identity") {
+    cn1t::element_p2 res;
+    endomorphism(res, cn1t::element_p2::identity());
+    REQUIRE(res == cn1t::element_p2::identity());
+  }
+
+  SECTION("the endomorphism is the same as multiplying by lambda") {
+    constexpr std::array<uint8_t, 32> lambda{0xdd, 0x90, 0x9c, 0xb9, 0x66, 0xea, 0x17, 0x8b, 0xa7,
+                                             0xaa, 0x8d, 0x8d, 0x08, 0x41, 0xfc, 0x5b, 0x58, 0x17,
+                                             0xa9, 0x41, 0x9d, 0xd7, 0xc4, 0xb3, 0x00, 0x00, 0x00,
+                                             0x00, 0x00, 0x00, 0x00, 0x00};
+    cn1t::element_p2 expected;
+    scalar_multiply255(expected, cn1cn::generator_p2_v, lambda.data());
+
+    cn1t::element_p2 res;
+    endomorphism(res, cn1cn::generator_p2_v);
+    REQUIRE(res == expected);
+  }
+
+  SECTION("the endomorphism is a homomorphism") {
+    cn1t::element_p2 g2;
+    add(g2, cn1cn::generator_p2_v, cn1cn::generator_p2_v);
+    cn1t::element_p2 expected;
+    endomorphism(expected, g2);
+
+    cn1t::element_p2 t;
+    endomorphism(t, cn1cn::generator_p2_v);
+    cn1t::element_p2 res;
+    add(res, t, t);
+    REQUIRE(res == expected);
+  }
+}
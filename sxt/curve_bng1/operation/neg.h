@@ -19,8 +19,9 @@
 #include "sxt/base/macro/cuda_callable.h"
 
 namespace sxt::cn1t {
+struct element_affine;
 struct element_p2;
-}
+} // namespace sxt::cn1t
 
 namespace sxt::cn1o {
 //--------------------------------------------------------------------------------------------------
@@ -29,6 +30,9 @@ namespace sxt::cn1o {
 CUDA_CALLABLE
 void neg(cn1t::element_p2& r, const cn1t::element_p2& p) noexcept;
 
+CUDA_CALLABLE
+void neg(cn1t::element_affine& r, const cn1t::element_affine& p) noexcept;
+
 //--------------------------------------------------------------------------------------------------
 // cneg
 //--------------------------------------------------------------------------------------------------
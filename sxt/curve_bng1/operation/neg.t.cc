@@ -19,6 +19,7 @@
 #include "sxt/base/test/unit_test.h"
 #include "sxt/curve_bng1/constant/generator.h"
 #include "sxt/curve_bng1/operation/add.h"
+#include "sxt/curve_bng1/type/element_affine.h"
 #include "sxt/curve_bng1/type/element_p2.h"
 
 using namespace sxt;
@@ -49,3 +50,23 @@ TEST_CASE("negation on projective elements") {
     REQUIRE(g == cn1cn::generator_p2_v);
   }
 }
+
+TEST_CASE("negation on affine elements") {
+  SECTION("produces the identity when summing the generator with its negation") {
+    cn1t::element_affine gen_neg;
+    neg(gen_neg, cn1cn::generator_affine_v);
+
+    cn1t::element_p2 expect_identity;
+    add(expect_identity, cn1cn::generator_p2_v, gen_neg);
+
+    REQUIRE(expect_identity == cn1t::element_p2::identity());
+  }
+
+  SECTION("preserves the identity") {
+    cn1t::element_affine e;
+    neg(e, cn1t::element_affine::identity());
+    cn1t::element_p2 sum;
+    add(sum, cn1cn::generator_p2_v, e);
+    REQUIRE(sum == cn1cn::generator_p2_v);
+  }
+}
@@ -25,6 +25,7 @@
  */
 #pragma once
 
+#include "sxt/curve_bng1/type/operation_adl_stub.h"
 #include "sxt/field25/constant/one.h"
 #include "sxt/field25/constant/zero.h"
 #include "sxt/field25/type/element.h"
@@ -39,7 +40,13 @@ namespace sxt::cn1t {
  * improve performance through the use of mixed curve model arithmetic.
  * Values of `G1Affine` are guaranteed to be in the q-order subgroup.
  */
-struct element_affine {
+struct element_affine : cn1o::operation_adl_stub {
+  element_affine() noexcept = default;
+
+  constexpr element_affine(const f25t::element& X, const f25t::element& Y,
+                           uint8_t infinity) noexcept
+      : X{X}, Y{Y}, infinity{infinity} {}
+
   f25t::element X;
   f25t::element Y;
   uint8_t infinity;
@@ -48,6 +55,8 @@ struct element_affine {
     return element_affine{f25cn::zero_v, f25cn::one_v, true};
   }
 
-  bool operator==(const element_affine& rhs) const noexcept = default;
+  bool operator==(const element_affine& rhs) const noexcept {
+    return X == rhs.X && Y == rhs.Y && infinity == rhs.infinity;
+  }
 };
 } // namespace sxt::cn1t
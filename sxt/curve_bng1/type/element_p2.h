@@ -16,8 +16,10 @@
  */
 #pragma once
 
+#include "sxt/base/container/span.h"
 #include "sxt/base/macro/cuda_callable.h"
 #include "sxt/curve_bng1/type/compact_element.h"
+#include "sxt/curve_bng1/type/element_affine.h"
 #include "sxt/curve_bng1/type/operation_adl_stub.h"
 #include "sxt/field25/constant/one.h"
 #include "sxt/field25/constant/zero.h"
@@ -33,6 +35,9 @@ namespace sxt::cn1t {
  * Homogeneous form Y^2 * Z = X^3 + (4 * Z^3).
  */
 struct element_p2 : cn1o::operation_adl_stub {
+  // Opts in to affine bucket accumulation. See mtxbk2::affine_accumulable.
+  using affine_element = element_affine;
+
   element_p2() noexcept = default;
 
   constexpr element_p2(const f25t::element& X, const f25t::element& Y,
@@ -57,6 +62,17 @@ struct element_p2 : cn1o::operation_adl_stub {
   }
 };
 
+//--------------------------------------------------------------------------------------------------
+// batch_to_compact_element
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert projective elements to compact form.
+ *
+ * Uses Montgomery's trick so that a single field inversion is shared by all the elements.
+ */
+void batch_to_compact_element(basct::span<compact_element> res,
+                              basct::cspan<element_p2> elements) noexcept;
+
 //--------------------------------------------------------------------------------------------------
 // mark
 //--------------------------------------------------------------------------------------------------
@@ -25,6 +25,8 @@
  */
 #include "sxt/curve_bng1/type/element_p2.h"
 
+#include <vector>
+
 #include "sxt/base/num/fast_random_number_generator.h"
 #include "sxt/base/test/unit_test.h"
 #include "sxt/field25/constant/one.h"
@@ -86,3 +88,24 @@ TEST_CASE("we can convert between elements") {
     REQUIRE(e == ep);
   }
 }
+
+TEST_CASE("we can batch convert elements") {
+  SECTION("we handle an empty batch") { batch_to_compact_element({}, {}); }
+
+  SECTION("we can convert a batch with identity and arbitrary elements") {
+    element_p2 e{0x30644e72e131a029b85045b63db22989a0ca93286ebbf9d9bc5fd495e1a92d47_f25,
+                 0x30644e72e131a029b85045b668f629f0d4ae64afaa9d239050df4dd8b672b147_f25,
+                 0x307084c8417aab1f9ec8866edfd3f27acc230000_f25};
+    std::vector<element_p2> elements = {element_p2::identity(), e, element_p2::identity(), e};
+    std::vector<compact_element> res(elements.size());
+    batch_to_compact_element(res, elements);
+    REQUIRE(res[0].is_identity());
+    REQUIRE(res[2].is_identity());
+    for (size_t i = 0; i < elements.size(); ++i) {
+      auto expected = static_cast<compact_element>(elements[i]);
+      REQUIRE(res[i].X == expected.X);
+      REQUIRE(res[i].Y == expected.Y);
+      REQUIRE(element_p2{res[i]} == elements[i]);
+    }
+  }
+}
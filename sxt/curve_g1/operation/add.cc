@@ -65,10 +65,9 @@ void add(cg1t::element_p2& h, const cg1t::element_p2& p, const cg1t::element_aff
   f12o::mul(z3, z3, t4);
   f12o::add(z3, z3, t0);
 
-  h.X = x3;
-  h.Y = y3;
-  h.Z = z3;
-
-  cmov(h, p, cg1p::is_identity(q));
+  // h may alias p, so select the result before writing it
+  cg1t::element_p2 res{x3, y3, z3};
+  cmov(res, p, cg1p::is_identity(q));
+  h = res;
 }
 } // namespace sxt::cg1o
@@ -120,6 +120,12 @@ TEST_CASE("addition with mixed elements") {
     REQUIRE(cg1cn::generator_p2_v == ret);
   }
 
+  SECTION("can be done inplace with the identity") {
+    cg1t::element_p2 ret{cg1cn::generator_p2_v};
+    add(ret, ret, cg1t::element_affine::identity());
+    REQUIRE(ret == cg1cn::generator_p2_v);
+  }
+
   SECTION("can reproduce doubling results") {
     cg1t::element_p2 a;
     cg1t::element_p2 b;
@@ -0,0 +1,166 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/curve_g1/operation/batch_add.h"
+
+#include "sxt/base/error/assert.h"
+#include "sxt/curve_g1/type/element_affine.h"
+#include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/field12/constant/one.h"
+#include "sxt/field12/constant/zero.h"
+#include "sxt/field12/operation/add.h"
+#include "sxt/field12/operation/invert.h"
+#include "sxt/field12/operation/mul.h"
+#include "sxt/field12/operation/square.h"
+#include "sxt/field12/operation/sub.h"
+#include "sxt/field12/type/element.h"
+
+namespace sxt::cg1o {
+//--------------------------------------------------------------------------------------------------
+// compute_denominator
+//--------------------------------------------------------------------------------------------------
+/**
+ * The denominator of the slope of p + q, or one if the sum doesn't need a slope.
+ */
+static void compute_denominator(f12t::element& res, const cg1t::element_affine& p,
+                                const cg1t::element_affine& q) noexcept {
+  if (p.infinity || q.infinity) {
+    res = f12cn::one_v;
+    return;
+  }
+  if (p.X != q.X) {
+    f12o::sub(res, q.X, p.X);
+    return;
+  }
+  if (p.Y == q.Y && p.Y != f12cn::zero_v) {
+    // doubling
+    f12o::add(res, p.Y, p.Y);
+    return;
+  }
+  res = f12cn::one_v;
+}
+
+//--------------------------------------------------------------------------------------------------
+// add_with_inverse
+//--------------------------------------------------------------------------------------------------
+/**
+ * p = p + q given the inverse of the slope's denominator.
+ */
+static void add_with_inverse(cg1t::element_affine& p, const cg1t::element_affine& q,
+                             const f12t::element& inv) noexcept {
+  if (q.infinity) {
+    return;
+  }
+  if (p.infinity) {
+    p = q;
+    return;
+  }
+  f12t::element lambda;
+  if (p.X != q.X) {
+    f12o::sub(lambda, q.Y, p.Y);
+  } else if (p.Y == q.Y && p.Y != f12cn::zero_v) {
+    // the curve has a = 0 so the slope of the tangent is 3x^2 / 2y
+    f12t::element t;
+    f12o::square(t, p.X);
+    f12o::add(lambda, t, t);
+    f12o::add(lambda, lambda, t);
+  } else {
+    p = cg1t::element_affine::identity();
+    return;
+  }
+  f12o::mul(lambda, lambda, inv);
+
+  // x3 = lambda^2 - x1 - x2
+  // y3 = lambda (x1 - x3) - y1
+  f12t::element x3;
+  f12o::square(x3, lambda);
+  f12o::sub(x3, x3, p.X);
+  f12o::sub(x3, x3, q.X);
+  f12t::element y3;
+  f12o::sub(y3, p.X, x3);
+  f12o::mul(y3, y3, lambda);
+  f12o::sub(p.Y, y3, p.Y);
+  p.X = x3;
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_normalize
+//--------------------------------------------------------------------------------------------------
+void batch_normalize(basct::span<cg1t::element_affine> res, basct::cspan<cg1t::element_p2> points,
+                     basct::span<f12t::element> scratch) noexcept {
+  auto n = points.size();
+  SXT_DEBUG_ASSERT(res.size() == n && scratch.size() >= n);
+  if (n == 0) {
+    return;
+  }
+
+  // prefix products of the non-zero Z coordinates
+  f12t::element acc = f12cn::one_v;
+  for (size_t i = 0; i < n; ++i) {
+    scratch[i] = acc;
+    if (points[i].Z != f12cn::zero_v) {
+      f12o::mul(acc, acc, points[i].Z);
+    }
+  }
+  f12o::invert(acc, acc);
+
+  // walk back to recover each inverse
+  for (size_t i = n; i-- > 0;) {
+    auto& p = points[i];
+    if (p.Z == f12cn::zero_v) {
+      res[i] = cg1t::element_affine::identity();
+      continue;
+    }
+    f12t::element z_inv;
+    f12o::mul(z_inv, acc, scratch[i]);
+    f12o::mul(acc, acc, p.Z);
+    f12o::mul(res[i].X, p.X, z_inv);
+    f12o::mul(res[i].Y, p.Y, z_inv);
+    res[i].infinity = false;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_add
+//--------------------------------------------------------------------------------------------------
+void batch_add(basct::span<cg1t::element_affine> res, basct::cspan<cg1t::element_affine> rhs,
+               basct::span<f12t::element> scratch) noexcept {
+  auto n = res.size();
+  SXT_DEBUG_ASSERT(rhs.size() == n && scratch.size() >= n);
+  if (n == 0) {
+    return;
+  }
+
+  // prefix products of the denominators
+  f12t::element acc = f12cn::one_v;
+  f12t::element d;
+  for (size_t i = 0; i < n; ++i) {
+    scratch[i] = acc;
+    compute_denominator(d, res[i], rhs[i]);
+    f12o::mul(acc, acc, d);
+  }
+  f12o::invert(acc, acc);
+
+  // walk back to recover each inverse
+  for (size_t i = n; i-- > 0;) {
+    f12t::element inv;
+    f12o::mul(inv, acc, scratch[i]);
+    compute_denominator(d, res[i], rhs[i]);
+    f12o::mul(acc, acc, d);
+    add_with_inverse(res[i], rhs[i], inv);
+  }
+}
+} // namespace sxt::cg1o
@@ -0,0 +1,55 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "sxt/base/container/span.h"
+
+namespace sxt::f12t {
+class element;
+}
+
+namespace sxt::cg1t {
+struct element_affine;
+struct element_p2;
+} // namespace sxt::cg1t
+
+namespace sxt::cg1o {
+//--------------------------------------------------------------------------------------------------
+// batch_normalize
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert projective elements to affine form using a single field inversion.
+ *
+ * scratch must have room for points.size() elements.
+ */
+void batch_normalize(basct::span<cg1t::element_affine> res, basct::cspan<cg1t::element_p2> points,
+                     basct::span<f12t::element> scratch) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// batch_add
+//--------------------------------------------------------------------------------------------------
+/**
+ * res[i] = res[i] + rhs[i]
+ *
+ * The additions are independent, so the slopes share a single field inversion using Montgomery's
+ * trick. This makes an affine addition cost about half the multiplications of a projective one.
+ *
+ * scratch must have room for res.size() elements. Not constant time.
+ */
+void batch_add(basct::span<cg1t::element_affine> res, basct::cspan<cg1t::element_affine> rhs,
+               basct::span<f12t::element> scratch) noexcept;
+} // namespace sxt::cg1o
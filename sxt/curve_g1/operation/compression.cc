@@ -16,16 +16,27 @@
  */
 #include "sxt/curve_g1/operation/compression.h"
 
+#include <algorithm>
+
 #include "sxt/base/error/assert.h"
 #include "sxt/base/num/cmov.h"
+#include "sxt/curve_g1/constant/b.h"
 #include "sxt/curve_g1/type/compressed_element.h"
 #include "sxt/curve_g1/type/conversion_utility.h"
 #include "sxt/curve_g1/type/element_affine.h"
 #include "sxt/curve_g1/type/element_p2.h"
 #include "sxt/field12/base/byte_conversion.h"
+#include "sxt/field12/constant/one.h"
 #include "sxt/field12/constant/zero.h"
+#include "sxt/field12/operation/add.h"
 #include "sxt/field12/operation/cmov.h"
+#include "sxt/field12/operation/mul.h"
+#include "sxt/field12/operation/neg.h"
+#include "sxt/field12/operation/sqrt.h"
+#include "sxt/field12/operation/square.h"
 #include "sxt/field12/property/lexicographically_largest.h"
+#include "sxt/field12/property/zero.h"
+#include "sxt/field12/type/element.h"
 
 namespace sxt::cg1o {
 //--------------------------------------------------------------------------------------------------
@@ -58,6 +69,53 @@ void compress(cg1t::compressed_element& e_c, const cg1t::element_p2& e_p) noexce
   e_c.data()[0] |= y_lx_lrg;
 }
 
+//--------------------------------------------------------------------------------------------------
+// decompress
+//--------------------------------------------------------------------------------------------------
+int decompress(cg1t::element_p2& e_p, const cg1t::compressed_element& e_c) noexcept {
+  const uint8_t flags = e_c.data()[0];
+  const bool compression_flag = (flags >> 7) & 1;
+  const bool infinity_flag = (flags >> 6) & 1;
+  const bool sort_flag = (flags >> 5) & 1;
+  if (!compression_flag) {
+    return -1;
+  }
+
+  // Mask away the flag bits to recover the x-coordinate.
+  uint8_t bytes[48];
+  std::copy_n(e_c.data(), 48, bytes);
+  bytes[0] &= 0x1f;
+  f12t::element x;
+  bool is_below_modulus;
+  f12b::from_bytes(is_below_modulus, x.data(), bytes);
+  if (!is_below_modulus) {
+    return -1;
+  }
+
+  if (infinity_flag) {
+    if (sort_flag || !f12p::is_zero(x)) {
+      return -1;
+    }
+    e_p = cg1t::element_p2::identity();
+    return 0;
+  }
+
+  // Recover y from the curve equation y^2 = x^3 + b and pick the root that matches the sort flag.
+  f12t::element y2;
+  f12o::square(y2, x);
+  f12o::mul(y2, y2, x);
+  f12o::add(y2, y2, cg1cn::b_v);
+  f12t::element y;
+  if (!f12o::sqrt(y, y2)) {
+    return -1;
+  }
+  if (f12p::lexicographically_largest(y) != sort_flag) {
+    f12o::neg(y, y);
+  }
+  e_p = cg1t::element_p2{x, y, f12cn::one_v};
+  return 0;
+}
+
 //--------------------------------------------------------------------------------------------------
 // batch_compress
 //--------------------------------------------------------------------------------------------------
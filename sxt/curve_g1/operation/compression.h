@@ -44,6 +44,17 @@ namespace sxt::cg1o {
 
 void compress(cg1t::compressed_element& e_c, const cg1t::element_p2& e_p) noexcept;
 
+//--------------------------------------------------------------------------------------------------
+// decompress
+//--------------------------------------------------------------------------------------------------
+/*
+ * Deserializes a point on the BLS12-381 curve from the compressed form written by compress.
+ *
+ * Returns 0 on success and -1 if e_c isn't the compressed encoding of a curve point. As with
+ * zkcrypto's from_compressed_unchecked, the point isn't checked to be in the prime order subgroup.
+ */
+int decompress(cg1t::element_p2& e_p, const cg1t::compressed_element& e_c) noexcept;
+
 //--------------------------------------------------------------------------------------------------
 // batch_compress
 //--------------------------------------------------------------------------------------------------
@@ -18,6 +18,9 @@
 
 #include "sxt/base/test/unit_test.h"
 #include "sxt/curve_g1/constant/generator.h"
+#include "sxt/curve_g1/operation/add.h"
+#include "sxt/curve_g1/operation/double.h"
+#include "sxt/curve_g1/operation/neg.h"
 #include "sxt/curve_g1/type/compressed_element.h"
 #include "sxt/curve_g1/type/element_p2.h"
 #include "sxt/field12/constant/one.h"
@@ -131,3 +134,46 @@ TEST_CASE("compression of two G1 curve elements that are") {
     REQUIRE(ce1 == ce2);
   }
 }
+
+TEST_CASE("we can decompress G1 curve elements") {
+  SECTION("decompression reverses compression") {
+    cg1t::element_p2 g2;
+    double_element(g2, cg1cn::generator_p2_v);
+    cg1t::element_p2 neg_g2;
+    neg(neg_g2, g2);
+    cg1t::element_p2 g3;
+    add(g3, g2, cg1cn::generator_p2_v);
+    for (auto& e : {cg1cn::generator_p2_v, g2, neg_g2, g3, cg1t::element_p2::identity()}) {
+      cg1t::compressed_element ce;
+      compress(ce, e);
+      cg1t::element_p2 e_p;
+      REQUIRE(decompress(e_p, ce) == 0);
+      REQUIRE(e_p == e);
+    }
+  }
+
+  SECTION("we fail to decompress an element without the compression flag") {
+    cg1t::compressed_element ce;
+    compress(ce, cg1cn::generator_p2_v);
+    ce.data()[0] &= 0x7f;
+    cg1t::element_p2 e_p;
+    REQUIRE(decompress(e_p, ce) == -1);
+  }
+
+  SECTION("we fail to decompress an element not on the curve") {
+    // x = 0 gives y^2 = 4 which has a root, so use x = 1 where y^2 = 5 doesn't
+    cg1t::compressed_element ce;
+    ce.data()[0] = static_cast<uint8_t>(1) << 7;
+    ce.data()[47] = 1;
+    cg1t::element_p2 e_p;
+    REQUIRE(decompress(e_p, ce) == -1);
+  }
+
+  SECTION("we fail to decompress a point at infinity with a nonzero x-coordinate") {
+    cg1t::compressed_element ce;
+    compress(ce, cg1t::element_p2::identity());
+    ce.data()[47] = 1;
+    cg1t::element_p2 e_p;
+    REQUIRE(decompress(e_p, ce) == -1);
+  }
+}
@@ -0,0 +1,34 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/curve_g1/operation/endomorphism.h"
+
+#include "sxt/curve_g1/constant/beta.h"
+#include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/field12/operation/mul.h"
+#include "sxt/field12/operation/neg.h"
+
+namespace sxt::cg1o {
+//--------------------------------------------------------------------------------------------------
+// endomorphism
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE
+void endomorphism(cg1t::element_p2& r, const cg1t::element_p2& p) noexcept {
+  f12o::mul(r.X, p.X, cg1cn::beta_v);
+  f12o::neg(r.Y, p.Y);
+  r.Z = p.Z;
+}
+} // namespace sxt::cg1o
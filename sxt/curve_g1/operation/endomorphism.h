@@ -0,0 +1,70 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "sxt/base/curve/decomposition_parameters.h"
+#include "sxt/base/macro/cuda_callable.h"
+
+namespace sxt::cg1t {
+struct element_p2;
+}
+
+namespace sxt::cg1o {
+//--------------------------------------------------------------------------------------------------
+// endomorphism
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the endomorphism (x, y) -> (beta x, -y).
+ *
+ * For an element p of G1, the result is lambda p where
+ *
+ *    lambda = z^2 = 0xac45a4010001a4020000000100000000
+ *
+ * is a primitive sixth root of unity in the scalar field and z is the curve parameter.
+ */
+CUDA_CALLABLE
+void endomorphism(cg1t::element_p2& r, const cg1t::element_p2& p) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// endomorphism_parameters
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parameters for decomposing a scalar k into half-length scalars k1 and k2 with
+ *
+ *    k = k1 + k2 lambda (mod r)
+ *
+ * so that k p = k1 p + k2 endomorphism(p).
+ */
+constexpr bascrv::decomposition_parameters
+endomorphism_parameters(const cg1t::element_p2& /*p*/) noexcept {
+  // Because lambda only has 128 bits, the decomposition is the quotient and remainder of k by
+  // lambda up to a correction of one.
+  return {
+      .r = {0xffffffff00000001, 0x53bda402fffe5bfe, 0x3339d80809a1d805, 0x73eda753299d7d48},
+      .n1 = bascrv::make_uint128(0xac45a4010001a402, 0x00000000ffffffff),
+      .n2 = bascrv::make_uint128(0x0, 0x1),
+      .g1 = {0x63f6e522f6cfee2e, 0x7c6becf1e01faadd, 0x1},
+      .g2 = {0x2, 0x0, 0x0},
+      .a1 = bascrv::make_uint128(0xac45a4010001a402, 0x0000000100000000),
+      .b1 = bascrv::make_uint128(0xffffffffffffffff, 0xffffffffffffffff),
+      .a2 = bascrv::make_uint128(0x0, 0x1),
+      .b2 = bascrv::make_uint128(0xac45a4010001a402, 0x00000000ffffffff),
+      .w1 = bascrv::make_uint128(0x0, 0x0),
+      .w2 = bascrv::make_uint128(0x0, 0x0),
+  };
+}
+} // namespace sxt::cg1o
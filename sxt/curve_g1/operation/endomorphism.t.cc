@@ -0,0 +1,60 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/curve_g1/operation/endomorphism.h"
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve_g1/constant/generator.h"
+#include "sxt/curve_g1/operation/add.h"
+#include "sxt/curve_g1/operation/scalar_multiply.h"
+#include "sxt/curve_g1/type/element_p2.h"
+
+using namespace sxt;
+using namespace sxt::cg1o;
+
+TEST_CASE("we can compute the endomorphism of a curve element") {
+  SECTION("the endomorphism of the identity is the identity") {
+    cg1t::element_p2 res;
+    endomorphism(res, cg1t::element_p2::identity());
+    REQUIRE(res == cg1t::element_p2::identity());
+  }
+
+  SECTION("the endomorphism is the same as multiplying by lambda") {
+    constexpr std::array<uint8_t, 32> lambda{0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02,
+                                             0xa4, 0x01, 0x00, 0x01, 0xa4, 0x45, 0xac, 0x00, 0x00,
+                                             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                             0x00, 0x00, 0x00, 0x00, 0x00};
+    cg1t::element_p2 expected;
+    scalar_multiply255(expected, cg1cn::generator_p2_v, lambda.data());
+
+    cg1t::element_p2 res;
+    endomorphism(res, cg1cn::generator_p2_v);
+    REQUIRE(res == expected);
+  }
+
+  SECTION("the endomorphism is a homomorphism") {
+    cg1t::element_p2 g2;
+    add(g2, cg1cn::generator_p2_v, cg1cn::generator_p2_v);
+    cg1t::element_p2 expected;
+    endomorphism(expected, g2);
+
+    cg1t::element_p2 t;
+    endomorphism(t, cg1cn::generator_p2_v);
+    cg1t::element_p2 res;
+    add(res, t, t);
+    REQUIRE(res == expected);
+  }
+}
@@ -25,6 +25,7 @@
  */
 #include "sxt/curve_g1/operation/neg.h"
 
+#include "sxt/curve_g1/type/element_affine.h"
 #include "sxt/curve_g1/type/element_p2.h"
 #include "sxt/field12/operation/cmov.h"
 #include "sxt/field12/operation/neg.h"
@@ -41,6 +42,13 @@ void neg(cg1t::element_p2& r, const cg1t::element_p2& p) noexcept {
   r.Z = p.Z;
 }
 
+CUDA_CALLABLE
+void neg(cg1t::element_affine& r, const cg1t::element_affine& p) noexcept {
+  r.X = p.X;
+  f12o::neg(r.Y, p.Y);
+  r.infinity = p.infinity;
+}
+
 //--------------------------------------------------------------------------------------------------
 // cneg
 //--------------------------------------------------------------------------------------------------
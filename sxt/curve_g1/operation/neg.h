@@ -19,8 +19,9 @@
 #include "sxt/base/macro/cuda_callable.h"
 
 namespace sxt::cg1t {
+struct element_affine;
 struct element_p2;
-}
+} // namespace sxt::cg1t
 
 namespace sxt::cg1o {
 //--------------------------------------------------------------------------------------------------
@@ -29,6 +30,9 @@ namespace sxt::cg1o {
 CUDA_CALLABLE
 void neg(cg1t::element_p2& r, const cg1t::element_p2& p) noexcept;
 
+CUDA_CALLABLE
+void neg(cg1t::element_affine& r, const cg1t::element_affine& p) noexcept;
+
 //--------------------------------------------------------------------------------------------------
 // cneg
 //--------------------------------------------------------------------------------------------------
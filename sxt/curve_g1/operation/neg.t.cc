@@ -19,6 +19,7 @@
 #include "sxt/base/test/unit_test.h"
 #include "sxt/curve_g1/constant/generator.h"
 #include "sxt/curve_g1/operation/add.h"
+#include "sxt/curve_g1/type/element_affine.h"
 #include "sxt/curve_g1/type/element_p2.h"
 
 using namespace sxt;
@@ -49,3 +50,23 @@ TEST_CASE("negation on projective elements") {
     REQUIRE(g == cg1cn::generator_p2_v);
   }
 }
+
+TEST_CASE("negation on affine elements") {
+  SECTION("produces the identity when summing the generator with its negation") {
+    cg1t::element_affine gen_neg;
+    neg(gen_neg, cg1cn::generator_affine_v);
+
+    cg1t::element_p2 expect_identity;
+    add(expect_identity, cg1cn::generator_p2_v, gen_neg);
+
+    REQUIRE(expect_identity == cg1t::element_p2::identity());
+  }
+
+  SECTION("preserves the identity") {
+    cg1t::element_affine e;
+    neg(e, cg1t::element_affine::identity());
+    cg1t::element_p2 sum;
+    add(sum, cg1cn::generator_p2_v, e);
+    REQUIRE(sum == cg1cn::generator_p2_v);
+  }
+}
@@ -25,6 +25,7 @@
  */
 #pragma once
 
+#include "sxt/curve_g1/type/operation_adl_stub.h"
 #include "sxt/field12/constant/one.h"
 #include "sxt/field12/constant/zero.h"
 #include "sxt/field12/type/element.h"
@@ -39,7 +40,13 @@ namespace sxt::cg1t {
  * improve performance through the use of mixed curve model arithmetic.
  * Values of `G1Affine` are guaranteed to be in the q-order subgroup.
  */
-struct element_affine {
+struct element_affine : cg1o::operation_adl_stub {
+  element_affine() noexcept = default;
+
+  constexpr element_affine(const f12t::element& X, const f12t::element& Y,
+                           uint8_t infinity) noexcept
+      : X{X}, Y{Y}, infinity{infinity} {}
+
   f12t::element X;
   f12t::element Y;
   uint8_t infinity;
@@ -48,6 +55,8 @@ struct element_affine {
     return element_affine{f12cn::zero_v, f12cn::one_v, true};
   }
 
-  bool operator==(const element_affine& rhs) const noexcept = default;
+  bool operator==(const element_affine& rhs) const noexcept {
+    return X == rhs.X && Y == rhs.Y && infinity == rhs.infinity;
+  }
 };
 } // namespace sxt::cg1t
@@ -25,6 +25,8 @@
  */
 #include "sxt/curve_g1/type/element_p2.h"
 
+#include <vector>
+
 #include "sxt/base/test/unit_test.h"
 #include "sxt/field12/constant/one.h"
 #include "sxt/field12/constant/zero.h"
@@ -84,3 +86,25 @@ TEST_CASE("we can convert between elements") {
     REQUIRE(e == ep);
   }
 }
+
+TEST_CASE("we can batch convert elements") {
+  SECTION("we handle an empty batch") { batch_to_compact_element({}, {}); }
+
+  SECTION("we can convert a batch with identity and arbitrary elements") {
+    element_p2 e{
+        0x17f7b262294ef7b666e940cecd80b68f5f84158fbb044c0e7f4c4fb15c4b58679609c912fd8648e9c121e09dfbc0141c_f12,
+        0x2caf9ee971b3d3212363b9b76bdb02c3ec2736aef5e37dd205099ab55cc2b3950c3a01d27db55031ffc1872a669a8c0_f12,
+        0x15ee88dd9836d9791f49e2a9702f040484db019beea103a5d68a4bce2e0fecc878970c1f2dc242111146f26916b000b6_f12};
+    std::vector<element_p2> elements = {element_p2::identity(), e, element_p2::identity(), e};
+    std::vector<compact_element> res(elements.size());
+    batch_to_compact_element(res, elements);
+    REQUIRE(res[0].is_identity());
+    REQUIRE(res[2].is_identity());
+    for (size_t i = 0; i < elements.size(); ++i) {
+      auto expected = static_cast<compact_element>(elements[i]);
+      REQUIRE(res[i].X == expected.X);
+      REQUIRE(res[i].Y == expected.Y);
+      REQUIRE(element_p2{res[i]} == elements[i]);
+    }
+  }
+}
@@ -0,0 +1,32 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "sxt/fieldgk/type/element.h"
+
+namespace sxt::cgkcn {
+//--------------------------------------------------------------------------------------------------
+// beta_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * A nontrivial third root of unity in Fp in Montgomery form
+ *
+ * beta = 0xb3c4d79d41a917585bfc41088d8daaa78b17ea66b99c90dd
+ */
+static constexpr fgkt::element beta_v{0x93e7cede4a0329b3, 0x7d4fdca77a96c167, 0x8be4ba08b19a750a,
+                                      0x1cbd5653a5661c25};
+} // namespace sxt::cgkcn
@@ -0,0 +1,47 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/curve_gk/constant/beta.h"
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/fieldgk/base/montgomery.h"
+#include "sxt/fieldgk/constant/one.h"
+#include "sxt/fieldgk/operation/mul.h"
+#include "sxt/fieldgk/type/element.h"
+
+using namespace sxt;
+using namespace sxt::cgkcn;
+
+TEST_CASE("the beta constant") {
+  SECTION("is a nontrivial third root of unity") {
+    REQUIRE(beta_v != fgkcn::one_v);
+
+    fgkt::element beta_squared;
+    fgko::mul(beta_squared, beta_v, beta_v);
+    REQUIRE(beta_squared != fgkcn::one_v);
+
+    fgkt::element beta_cubed;
+    fgko::mul(beta_cubed, beta_squared, beta_v);
+    REQUIRE(beta_cubed == fgkcn::one_v);
+  }
+
+  SECTION("is in Montgomery form") {
+    constexpr std::array<uint64_t, 4> a{0x8b17ea66b99c90dd, 0x5bfc41088d8daaa7, 0xb3c4d79d41a91758, 0x0};
+    fgkt::element expected;
+    fgkb::to_montgomery_form(expected.data(), a.data());
+    REQUIRE(beta_v == expected);
+  }
+}
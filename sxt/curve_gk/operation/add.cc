@@ -65,10 +65,9 @@ void add(cgkt::element_p2& h, const cgkt::element_p2& p, const cgkt::element_aff
   fgko::mul(z3, z3, t4);
   fgko::add(z3, z3, t0);
 
-  h.X = x3;
-  h.Y = y3;
-  h.Z = z3;
-
-  cmov(h, p, cgkp::is_identity(q));
+  // h may alias p, so select the result before writing it
+  cgkt::element_p2 res{x3, y3, z3};
+  cmov(res, p, cgkp::is_identity(q));
+  h = res;
 }
 } // namespace sxt::cgko
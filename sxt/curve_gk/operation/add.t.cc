@@ -126,6 +126,12 @@ TEST_CASE("addition with mixed elements") {
     REQUIRE(cgkcn::generator_p2_v == ret);
   }
 
+  SECTION("can be done inplace with the identity") {
+    cgkt::element_p2 ret{cgkcn::generator_p2_v};
+    add(ret, ret, cgkt::element_affine::identity());
+    REQUIRE(ret == cgkcn::generator_p2_v);
+  }
+
   SECTION("can reproduce doubling results") {
     cgkt::element_p2 a;
     cgkt::element_p2 b;
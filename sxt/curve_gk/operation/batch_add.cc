@@ -0,0 +1,166 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/curve_gk/operation/batch_add.h"
+
+#include "sxt/base/error/assert.h"
+#include "sxt/curve_gk/type/element_affine.h"
+#include "sxt/curve_gk/type/element_p2.h"
+#include "sxt/fieldgk/constant/one.h"
+#include "sxt/fieldgk/constant/zero.h"
+#include "sxt/fieldgk/operation/add.h"
+#include "sxt/fieldgk/operation/invert.h"
+#include "sxt/fieldgk/operation/mul.h"
+#include "sxt/fieldgk/operation/square.h"
+#include "sxt/fieldgk/operation/sub.h"
+#include "sxt/fieldgk/type/element.h"
+
+namespace sxt::cgko {
+//--------------------------------------------------------------------------------------------------
+// compute_denominator
+//--------------------------------------------------------------------------------------------------
+/**
+ * The denominator of the slope of p + q, or one if the sum doesn't need a slope.
+ */
+static void compute_denominator(fgkt::element& res, const cgkt::element_affine& p,
+                                const cgkt::element_affine& q) noexcept {
+  if (p.infinity || q.infinity) {
+    res = fgkcn::one_v;
+    return;
+  }
+  if (p.X != q.X) {
+    fgko::sub(res, q.X, p.X);
+    return;
+  }
+  if (p.Y == q.Y && p.Y != fgkcn::zero_v) {
+    // doubling
+    fgko::add(res, p.Y, p.Y);
+    return;
+  }
+  res = fgkcn::one_v;
+}
+
+//--------------------------------------------------------------------------------------------------
+// add_with_inverse
+//--------------------------------------------------------------------------------------------------
+/**
+ * p = p + q given the inverse of the slope's denominator.
+ */
+static void add_with_inverse(cgkt::element_affine& p, const cgkt::element_affine& q,
+                             const fgkt::element& inv) noexcept {
+  if (q.infinity) {
+    return;
+  }
+  if (p.infinity) {
+    p = q;
+    return;
+  }
+  fgkt::element lambda;
+  if (p.X != q.X) {
+    fgko::sub(lambda, q.Y, p.Y);
+  } else if (p.Y == q.Y && p.Y != fgkcn::zero_v) {
+    // the curve has a = 0 so the slope of the tangent is 3x^2 / 2y
+    fgkt::element t;
+    fgko::square(t, p.X);
+    fgko::add(lambda, t, t);
+    fgko::add(lambda, lambda, t);
+  } else {
+    p = cgkt::element_affine::identity();
+    return;
+  }
+  fgko::mul(lambda, lambda, inv);
+
+  // x3 = lambda^2 - x1 - x2
+  // y3 = lambda (x1 - x3) - y1
+  fgkt::element x3;
+  fgko::square(x3, lambda);
+  fgko::sub(x3, x3, p.X);
+  fgko::sub(x3, x3, q.X);
+  fgkt::element y3;
+  fgko::sub(y3, p.X, x3);
+  fgko::mul(y3, y3, lambda);
+  fgko::sub(p.Y, y3, p.Y);
+  p.X = x3;
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_normalize
+//--------------------------------------------------------------------------------------------------
+void batch_normalize(basct::span<cgkt::element_affine> res, basct::cspan<cgkt::element_p2> points,
+                     basct::span<fgkt::element> scratch) noexcept {
+  auto n = points.size();
+  SXT_DEBUG_ASSERT(res.size() == n && scratch.size() >= n);
+  if (n == 0) {
+    return;
+  }
+
+  // prefix products of the non-zero Z coordinates
+  fgkt::element acc = fgkcn::one_v;
+  for (size_t i = 0; i < n; ++i) {
+    scratch[i] = acc;
+    if (points[i].Z != fgkcn::zero_v) {
+      fgko::mul(acc, acc, points[i].Z);
+    }
+  }
+  fgko::invert(acc, acc);
+
+  // walk back to recover each inverse
+  for (size_t i = n; i-- > 0;) {
+    auto& p = points[i];
+    if (p.Z == fgkcn::zero_v) {
+      res[i] = cgkt::element_affine::identity();
+      continue;
+    }
+    fgkt::element z_inv;
+    fgko::mul(z_inv, acc, scratch[i]);
+    fgko::mul(acc, acc, p.Z);
+    fgko::mul(res[i].X, p.X, z_inv);
+    fgko::mul(res[i].Y, p.Y, z_inv);
+    res[i].infinity = false;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_add
+//--------------------------------------------------------------------------------------------------
+void batch_add(basct::span<cgkt::element_affine> res, basct::cspan<cgkt::element_affine> rhs,
+               basct::span<fgkt::element> scratch) noexcept {
+  auto n = res.size();
+  SXT_DEBUG_ASSERT(rhs.size() == n && scratch.size() >= n);
+  if (n == 0) {
+    return;
+  }
+
+  // prefix products of the denominators
+  fgkt::element acc = fgkcn::one_v;
+  fgkt::element d;
+  for (size_t i = 0; i < n; ++i) {
+    scratch[i] = acc;
+    compute_denominator(d, res[i], rhs[i]);
+    fgko::mul(acc, acc, d);
+  }
+  fgko::invert(acc, acc);
+
+  // walk back to recover each inverse
+  for (size_t i = n; i-- > 0;) {
+    fgkt::element inv;
+    fgko::mul(inv, acc, scratch[i]);
+    compute_denominator(d, res[i], rhs[i]);
+    fgko::mul(acc, acc, d);
+    add_with_inverse(res[i], rhs[i], inv);
+  }
+}
+} // namespace sxt::cgko
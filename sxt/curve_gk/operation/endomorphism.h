@@ -0,0 +1,68 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "sxt/base/curve/decomposition_parameters.h"
+#include "sxt/base/macro/cuda_callable.h"
+
+namespace sxt::cgkt {
+struct element_p2;
+}
+
+namespace sxt::cgko {
+//--------------------------------------------------------------------------------------------------
+// endomorphism
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the endomorphism (x, y) -> (beta x, y).
+ *
+ * For an element p of the group, the result is lambda p where
+ *
+ *    lambda = 0x59e26bcea0d48bacd4f263f1acdb5c4f5763473177fffffe
+ *
+ * is a nontrivial third root of unity in the scalar field.
+ */
+CUDA_CALLABLE
+void endomorphism(cgkt::element_p2& r, const cgkt::element_p2& p) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// endomorphism_parameters
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parameters for decomposing a scalar k into half-length scalars k1 and k2 with
+ *
+ *    k = k1 + k2 lambda (mod r)
+ *
+ * so that k p = k1 p + k2 endomorphism(p).
+ */
+constexpr bascrv::decomposition_parameters
+endomorphism_parameters(const cgkt::element_p2& /*p*/) noexcept {
+  return {
+      .r = {0x3c208c16d87cfd47, 0x97816a916871ca8d, 0xb85045b68181585d, 0x30644e72e131a029},
+      .n1 = bascrv::make_uint128(0x0, 0x89d3256894d213e2),
+      .n2 = bascrv::make_uint128(0x6f4d8248eeb859fc, 0x8211bbeb7d4f1129),
+      .g1 = {0xd91d232ec7e0b3d2, 0x2, 0x0},
+      .g2 = {0x7a7bd9d4391eb18d, 0x4ccef014a773d2cf, 0x2},
+      .a1 = bascrv::make_uint128(0x0, 0x89d3256894d213e2),
+      .b1 = bascrv::make_uint128(0x90b27db71147a603, 0x7dee441482b0eed7),
+      .a2 = bascrv::make_uint128(0x6f4d8248eeb859fd, 0x0be4e1541221250b),
+      .b2 = bascrv::make_uint128(0x0, 0x89d3256894d213e2),
+      .w1 = bascrv::make_uint128(0x6f4d8248eeb859fc, 0x8211bbeb7d4f1129),
+      .w2 = bascrv::make_uint128(0x6f4d8248eeb859fd, 0x0be4e1541221250b),
+  };
+}
+} // namespace sxt::cgko
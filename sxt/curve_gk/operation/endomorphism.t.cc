@@ -0,0 +1,60 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/curve_gk/operation/endomorphism.h"
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve_gk/constant/generator.h"
+#include "sxt/curve_gk/operation/add.h"
+#include "sxt/curve_gk/operation/scalar_multiply.h"
+#include "sxt/curve_gk/type/element_p2.h"
+
+using namespace sxt;
+using namespace sxt::cgko;
+
+TEST_CASE("we can compute the endomorphism of a curve element") {
+  SECTION("the endomorphism of the identity is the identity") {
+    cgkt::element_p2 res;
+    endomorphism(res, cgkt::element_p2::identity());
+    REQUIRE(res == cgkt::element_p2::identity());
+  }
+
+  SECTION("the endomorphism is the same as multiplying by lambda") {
+    constexpr std::array<uint8_t, 32> lambda{0xfe, 0xff, 0xff, 0x77, 0x31, 0x47, 0x63, 0x57, 0x4f,
+                                             0x5c, 0xdb, 0xac, 0xf1, 0x63, 0xf2, 0xd4, 0xac, 0x8b,
+                                             0xd4, 0xa0, 0xce, 0x6b, 0xe2, 0x59, 0x00, 0x00, 0x00,
+                                             0x00, 0x00, 0x00, 0x00, 0x00};
+    cgkt::element_p2 expected;
+    scalar_multiply255(expected, cgkcn::generator_p2_v, lambda.data());
+
+    cgkt::element_p2 res;
+    endomorphism(res, cgkcn::generator_p2_v);
+    REQUIRE(res == expected);
+  }
+
+  SECTION("the endomorphism is a homomorphism") {
+    cgkt::element_p2 g2;
+    add(g2, cgkcn::generator_p2_v, cgkcn::generator_p2_v);
+    cgkt::element_p2 expected;
+    endomorphism(expected, g2);
+
+    cgkt::element_p2 t;
+    endomorphism(t, cgkcn::generator_p2_v);
+    cgkt::element_p2 res;
+    add(res, t, t);
+    REQUIRE(res == expected);
+  }
+}
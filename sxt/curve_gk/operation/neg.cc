@@ -25,6 +25,7 @@
  */
 #include "sxt/curve_gk/operation/neg.h"
 
+#include "sxt/curve_gk/type/element_affine.h"
 #include "sxt/curve_gk/type/element_p2.h"
 #include "sxt/fieldgk/operation/cmov.h"
 #include "sxt/fieldgk/operation/neg.h"
@@ -41,6 +42,13 @@ void neg(cgkt::element_p2& r, const cgkt::element_p2& p) noexcept {
   r.Z = p.Z;
 }
 
+CUDA_CALLABLE
+void neg(cgkt::element_affine& r, const cgkt::element_affine& p) noexcept {
+  r.X = p.X;
+  fgko::neg(r.Y, p.Y);
+  r.infinity = p.infinity;
+}
+
 //--------------------------------------------------------------------------------------------------
 // cneg
 //--------------------------------------------------------------------------------------------------
@@ -19,8 +19,9 @@
 #include "sxt/base/macro/cuda_callable.h"
 
 namespace sxt::cgkt {
+struct element_affine;
 struct element_p2;
-}
+} // namespace sxt::cgkt
 
 namespace sxt::cgko {
 //--------------------------------------------------------------------------------------------------
@@ -29,6 +30,9 @@ namespace sxt::cgko {
 CUDA_CALLABLE
 void neg(cgkt::element_p2& r, const cgkt::element_p2& p) noexcept;
 
+CUDA_CALLABLE
+void neg(cgkt::element_affine& r, const cgkt::element_affine& p) noexcept;
+
 //--------------------------------------------------------------------------------------------------
 // cneg
 //--------------------------------------------------------------------------------------------------
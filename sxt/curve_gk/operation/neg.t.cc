@@ -19,6 +19,7 @@
 #include "sxt/base/test/unit_test.h"
 #include "sxt/curve_gk/constant/generator.h"
 #include "sxt/curve_gk/operation/add.h"
+#include "sxt/curve_gk/type/element_affine.h"
 #include "sxt/curve_gk/type/element_p2.h"
 
 using namespace sxt;
@@ -49,3 +50,23 @@ TEST_CASE("negation on projective elements") {
     REQUIRE(g == cgkcn::generator_p2_v);
   }
 }
+
+TEST_CASE("negation on affine elements") {
+  SECTION("produces the identity when summing the generator with its negation") {
+    cgkt::element_affine gen_neg;
+    neg(gen_neg, cgkcn::generator_affine_v);
+
+    cgkt::element_p2 expect_identity;
+    add(expect_identity, cgkcn::generator_p2_v, gen_neg);
+
+    REQUIRE(expect_identity == cgkt::element_p2::identity());
+  }
+
+  SECTION("preserves the identity") {
+    cgkt::element_affine e;
+    neg(e, cgkt::element_affine::identity());
+    cgkt::element_p2 sum;
+    add(sum, cgkcn::generator_p2_v, e);
+    REQUIRE(sum == cgkcn::generator_p2_v);
+  }
+}
@@ -25,6 +25,7 @@
  */
 #pragma once
 
+#include "sxt/curve_gk/type/operation_adl_stub.h"
 #include "sxt/fieldgk/constant/one.h"
 #include "sxt/fieldgk/constant/zero.h"
 #include "sxt/fieldgk/type/element.h"
@@ -39,7 +40,13 @@ namespace sxt::cgkt {
  * improve performance through the use of mixed curve model arithmetic.
  * Values of `G1Affine` are guaranteed to be in the q-order subgroup.
  */
-struct element_affine {
+struct element_affine : cgko::operation_adl_stub {
+  element_affine() noexcept = default;
+
+  constexpr element_affine(const fgkt::element& X, const fgkt::element& Y,
+                           uint8_t infinity) noexcept
+      : X{X}, Y{Y}, infinity{infinity} {}
+
   fgkt::element X;
   fgkt::element Y;
   uint8_t infinity;
@@ -48,6 +55,8 @@ struct element_affine {
     return element_affine{fgkcn::zero_v, fgkcn::one_v, true};
   }
 
-  bool operator==(const element_affine& rhs) const noexcept = default;
+  bool operator==(const element_affine& rhs) const noexcept {
+    return X == rhs.X && Y == rhs.Y && infinity == rhs.infinity;
+  }
 };
 } // namespace sxt::cgkt
@@ -25,6 +25,7 @@
  */
 #include "sxt/curve_gk/type/element_p2.h"
 
+#include "sxt/base/error/assert.h"
 #include "sxt/fieldgk/operation/invert.h"
 #include "sxt/fieldgk/operation/mul.h"
 #include "sxt/fieldgk/property/zero.h"
@@ -65,6 +66,49 @@ CUDA_CALLABLE element_p2::operator compact_element() const noexcept {
   return {x, y};
 }
 
+//--------------------------------------------------------------------------------------------------
+// batch_to_compact_element
+//--------------------------------------------------------------------------------------------------
+void batch_to_compact_element(basct::span<compact_element> res,
+                              basct::cspan<element_p2> elements) noexcept {
+  SXT_DEBUG_ASSERT(res.size() == elements.size());
+  auto n = elements.size();
+  if (n == 0) {
+    return;
+  }
+
+  // accumulate prefix products of the Z coordinates in res[i].X, using one in place of the Z
+  // coordinate of the identity
+  fgkt::element acc = fgkcn::one_v;
+  for (size_t i = 0; i < n; ++i) {
+    auto z = elements[i].Z;
+    fgko::cmov(z, fgkcn::one_v, fgkp::is_zero(z));
+    fgko::mul(acc, acc, z);
+    res[i].X = acc;
+  }
+
+  fgkt::element inv;
+  fgko::invert(inv, acc);
+
+  // walk backwards, peeling off one Z coordinate at a time from the inverted product
+  for (size_t i = n; i-- > 0;) {
+    auto& e = elements[i];
+    auto is_zero = fgkp::is_zero(e.Z);
+    auto z_inv = inv;
+    if (i > 0) {
+      fgko::mul(z_inv, inv, res[i - 1].X);
+    }
+    auto z = e.Z;
+    fgko::cmov(z, fgkcn::one_v, is_zero);
+    fgko::mul(inv, inv, z);
+
+    fgko::mul(res[i].X, e.X, z_inv);
+    fgko::mul(res[i].Y, e.Y, z_inv);
+    fgko::cmov(res[i].X, compact_element::identity().X, is_zero);
+    fgko::cmov(res[i].Y, compact_element::identity().Y, is_zero);
+  }
+}
+
 //--------------------------------------------------------------------------------------------------
 // operator==
 //--------------------------------------------------------------------------------------------------
@@ -25,6 +25,8 @@
  */
 #include "sxt/curve_gk/type/element_p2.h"
 
+#include <vector>
+
 #include "sxt/base/num/fast_random_number_generator.h"
 #include "sxt/base/test/unit_test.h"
 #include "sxt/fieldgk/constant/one.h"
@@ -84,3 +86,24 @@ TEST_CASE("we can convert between elements") {
     REQUIRE(e == ep);
   }
 }
+
+TEST_CASE("we can batch convert elements") {
+  SECTION("we handle an empty batch") { batch_to_compact_element({}, {}); }
+
+  SECTION("we can convert a batch with identity and arbitrary elements") {
+    element_p2 e{0x21c12e04bad4c2156ce3b4a8a3308c4fb4aacdadef62a450b495e0f6a86535ac_fgk,
+                 0x150b08bd8caf3a73f977c855a4550b9f0d2599a2a2c024609bbc45ffb56f854a_fgk,
+                 0x87110725e6d5daae7f0df824436892b177b7196fd22d9c2d59d6561cf0e2ada_fgk};
+    std::vector<element_p2> elements = {element_p2::identity(), e, element_p2::identity(), e};
+    std::vector<compact_element> res(elements.size());
+    batch_to_compact_element(res, elements);
+    REQUIRE(res[0].is_identity());
+    REQUIRE(res[2].is_identity());
+    for (size_t i = 0; i < elements.size(); ++i) {
+      auto expected = static_cast<compact_element>(elements[i]);
+      REQUIRE(res[i].X == expected.X);
+      REQUIRE(res[i].Y == expected.Y);
+      REQUIRE(element_p2{res[i]} == elements[i]);
+    }
+  }
+}
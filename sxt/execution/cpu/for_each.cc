@@ -0,0 +1,64 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/execution/cpu/for_each.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+#include "sxt/base/error/assert.h"
+
+namespace sxt::xencpu {
+//--------------------------------------------------------------------------------------------------
+// concurrent_for_each
+//--------------------------------------------------------------------------------------------------
+void concurrent_for_each(basit::index_range_iterator first, basit::index_range_iterator last,
+                         basf::function_ref<void(const basit::index_range&)> f,
+                         unsigned num_threads) noexcept {
+  SXT_DEBUG_ASSERT(num_threads > 0);
+  auto num_chunks = static_cast<size_t>(std::distance(first, last));
+  if (num_chunks == 0) {
+    return;
+  }
+  auto num_threads_used = static_cast<unsigned>(std::min<size_t>(num_threads, num_chunks));
+  if (num_threads_used == 1) {
+    for (; first != last; ++first) {
+      f(*first);
+    }
+    return;
+  }
+
+  std::atomic<size_t> chunk_counter{0};
+  auto worker = [&]() noexcept {
+    while (true) {
+      auto chunk_index = chunk_counter.fetch_add(1, std::memory_order_relaxed);
+      if (chunk_index >= num_chunks) {
+        return;
+      }
+      f(*(first + static_cast<ptrdiff_t>(chunk_index)));
+    }
+  };
+  std::vector<std::jthread> threads;
+  threads.reserve(num_threads_used - 1u);
+  for (unsigned thread_index = 1; thread_index < num_threads_used; ++thread_index) {
+    threads.emplace_back(worker);
+  }
+  worker();
+}
+} // namespace sxt::xencpu
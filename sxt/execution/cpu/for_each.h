@@ -0,0 +1,37 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "sxt/base/functional/function_ref.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/base/iterator/index_range_iterator.h"
+
+namespace sxt::xencpu {
+//--------------------------------------------------------------------------------------------------
+// concurrent_for_each
+//--------------------------------------------------------------------------------------------------
+/**
+ * Invoke the function f on the range of chunks provided, splitting the work across up to
+ * num_threads host threads.
+ *
+ * The calling thread participates in the work and the function returns after every chunk
+ * has been processed. Chunks are handed out dynamically so f must be safe to call concurrently.
+ */
+void concurrent_for_each(basit::index_range_iterator first, basit::index_range_iterator last,
+                         basf::function_ref<void(const basit::index_range&)> f,
+                         unsigned num_threads) noexcept;
+} // namespace sxt::xencpu
@@ -0,0 +1,71 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/execution/cpu/for_each.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "sxt/base/iterator/split.h"
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::xencpu;
+
+TEST_CASE("we can concurrently invoke code on host threads") {
+  std::mutex mutex;
+  std::vector<std::pair<size_t, size_t>> ranges;
+  auto f = [&](const basit::index_range& rng) noexcept {
+    std::lock_guard<std::mutex> lock{mutex};
+    ranges.emplace_back(rng.a(), rng.b());
+  };
+
+  SECTION("we handle the empty case") {
+    auto [first, last] = basit::split(basit::index_range{0, 0}, {});
+    concurrent_for_each(first, last, f, 4);
+    REQUIRE(ranges.empty());
+  }
+
+  SECTION("we handle a single chunk") {
+    auto [first, last] = basit::split(basit::index_range{1, 2}, {});
+    concurrent_for_each(first, last, f, 4);
+    std::vector<std::pair<size_t, size_t>> expected = {{1, 2}};
+    REQUIRE(ranges == expected);
+  }
+
+  SECTION("we handle a single thread") {
+    auto [first, last] = basit::split(basit::index_range{0, 10}, {.max_chunk_size = 3});
+    concurrent_for_each(first, last, f, 1);
+    std::vector<std::pair<size_t, size_t>> expected = {{0, 3}, {3, 6}, {6, 9}, {9, 10}};
+    REQUIRE(ranges == expected);
+  }
+
+  SECTION("we process every chunk exactly once when using multiple threads") {
+    auto [first, last] = basit::split(basit::index_range{1, 1001}, {.max_chunk_size = 7});
+    concurrent_for_each(first, last, f, 8);
+    std::sort(ranges.begin(), ranges.end());
+    REQUIRE(ranges.size() == static_cast<size_t>(std::distance(first, last)));
+    REQUIRE(ranges[0].first == 1);
+    size_t t = ranges[0].second;
+    for (size_t i = 1; i < ranges.size(); ++i) {
+      REQUIRE(ranges[i].first == t);
+      t = ranges[i].second;
+    }
+    REQUIRE(t == 1001);
+  }
+}
@@ -0,0 +1,59 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/execution/cpu/thread_count.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include "sxt/base/error/panic.h"
+#include "sxt/base/log/log.h"
+
+namespace sxt::xencpu {
+//--------------------------------------------------------------------------------------------------
+// get_num_threads_impl
+//--------------------------------------------------------------------------------------------------
+static unsigned get_num_threads_impl() noexcept {
+  auto s = std::getenv("BLITZAR_NUM_THREADS");
+  if (s == nullptr) {
+    return std::max(std::thread::hardware_concurrency(), 1u);
+  }
+  unsigned num_threads;
+  auto parse_result = std::from_chars(s, s + std::strlen(s), num_threads);
+  if (parse_result.ec != std::errc{}) {
+    baser::panic("failed to parse number of threads {}", s);
+  }
+  if (num_threads == 0) {
+    baser::panic("number of threads cannot be zero");
+  }
+  return num_threads;
+}
+
+//--------------------------------------------------------------------------------------------------
+// get_num_threads
+//--------------------------------------------------------------------------------------------------
+unsigned get_num_threads() noexcept {
+  static auto res = []() noexcept {
+    auto res = get_num_threads_impl();
+    basl::info("using {} threads for host computations", res);
+    return res;
+  }();
+  return res;
+}
+} // namespace sxt::xencpu
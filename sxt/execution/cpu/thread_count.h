@@ -0,0 +1,30 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+namespace sxt::xencpu {
+//--------------------------------------------------------------------------------------------------
+// get_num_threads
+//--------------------------------------------------------------------------------------------------
+/**
+ * The number of worker threads to use for host computations.
+ *
+ * Defaults to the hardware concurrency and can be overridden with the environment variable
+ * BLITZAR_NUM_THREADS.
+ */
+unsigned get_num_threads() noexcept;
+} // namespace sxt::xencpu
@@ -25,11 +25,22 @@
  */
 #include "sxt/field12/operation/invert.h"
 
+#include "sxt/base/field/safegcd.h"
+#include "sxt/field12/base/constants.h"
+#include "sxt/field12/operation/mul.h"
 #include "sxt/field12/operation/pow_vartime.h"
 #include "sxt/field12/property/zero.h"
 #include "sxt/field12/type/element.h"
 
 namespace sxt::f12o {
+//--------------------------------------------------------------------------------------------------
+// r3_v
+//--------------------------------------------------------------------------------------------------
+// safegcd inverts the Montgomery form a * R of an element to a^-1 * R^-1, which a Montgomery
+// multiplication by R^3 mod p brings back to a^-1 * R
+static constexpr f12t::element r3_v{0xed48ac6bd94ca1e0, 0x315f831e03a7adf8, 0x9a53352a615e29dd,
+                                    0x34c04e5e921e1761, 0x2512d43565724728, 0x0aa6346091755d4d};
+
 //--------------------------------------------------------------------------------------------------
 // invert
 //--------------------------------------------------------------------------------------------------
@@ -38,11 +49,26 @@ namespace sxt::f12o {
  * returning FALSE in the case that this element is zero.
  */
 CUDA_CALLABLE bool invert(f12t::element& h, const f12t::element& f) noexcept {
+#ifndef __CUDA_ARCH__
+  basfld::invert6_safegcd(h.data(), f.data(), f12b::p_v.data());
+  f12o::mul(h, h, r3_v);
+  return f12p::is_zero(h);
+#else
   constexpr f12t::element g(0xb9feffffffffaaa9, 0x1eabfffeb153ffff, 0x6730d2a0f6b0f624,
                             0x64774b84f38512bf, 0x4b1ba7b6434bacd7, 0x1a0111ea397fe69a);
 
   f12o::pow_vartime(h, f, g);
 
+  return f12p::is_zero(h);
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+// invert_vartime
+//--------------------------------------------------------------------------------------------------
+bool invert_vartime(f12t::element& h, const f12t::element& f) noexcept {
+  basfld::invert6_safegcd_vartime(h.data(), f.data(), f12b::p_v.data());
+  f12o::mul(h, h, r3_v);
   return f12p::is_zero(h);
 }
 } // namespace sxt::f12o
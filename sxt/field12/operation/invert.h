@@ -27,4 +27,12 @@ namespace sxt::f12o {
 // invert
 //--------------------------------------------------------------------------------------------------
 CUDA_CALLABLE bool invert(f12t::element& h, const f12t::element& f) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// invert_vartime
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host-only variant of invert whose running time depends on f. Only use with public data.
+ */
+bool invert_vartime(f12t::element& h, const f12t::element& f) noexcept;
 } // namespace sxt::f12o
@@ -25,9 +25,13 @@
  */
 #include "sxt/field12/operation/invert.h"
 
+#include "sxt/base/num/fast_random_number_generator.h"
 #include "sxt/base/test/unit_test.h"
 #include "sxt/field12/constant/one.h"
+#include "sxt/field12/constant/zero.h"
 #include "sxt/field12/operation/mul.h"
+#include "sxt/field12/operation/pow_vartime.h"
+#include "sxt/field12/random/element.h"
 #include "sxt/field12/type/element.h"
 
 using namespace sxt;
@@ -68,4 +72,36 @@ TEST_CASE("inversion") {
 
     REQUIRE(is_zero);
   }
+
+  SECTION("of one is one") {
+    f12t::element ret;
+    REQUIRE(!invert(ret, f12cn::one_v));
+    REQUIRE(ret == f12cn::one_v);
+    REQUIRE(!invert_vartime(ret, f12cn::one_v));
+    REQUIRE(ret == f12cn::one_v);
+  }
+
+  SECTION("of zero in variable time returns the flag indicating the value is zero") {
+    f12t::element ret;
+    REQUIRE(invert_vartime(ret, f12cn::zero_v));
+  }
+
+  SECTION("matches the inverse computed with Fermat's little theorem") {
+    constexpr f12t::element p_v_minus_2{0xb9feffffffffaaa9, 0x1eabfffeb153ffff, 0x6730d2a0f6b0f624,
+                                        0x64774b84f38512bf, 0x4b1ba7b6434bacd7, 0x1a0111ea397fe69a};
+    basn::fast_random_number_generator rng{1, 2};
+    for (int i = 0; i < 100; ++i) {
+      f12t::element a;
+      f12rn::generate_random_element(a, rng);
+
+      f12t::element expected;
+      pow_vartime(expected, a, p_v_minus_2);
+
+      f12t::element ret;
+      REQUIRE(!invert(ret, a));
+      REQUIRE(ret == expected);
+      REQUIRE(!invert_vartime(ret, a));
+      REQUIRE(ret == expected);
+    }
+  }
 }
@@ -26,6 +26,9 @@
 #include "sxt/field12/operation/mul.h"
 
 #include "sxt/base/field/arithmetic_utility.h"
+#include "sxt/base/field/montgomery_adx.h"
+#include "sxt/base/system/cpu_features.h"
+#include "sxt/field12/base/constants.h"
 #include "sxt/field12/base/reduce.h"
 #include "sxt/field12/type/element.h"
 
@@ -35,6 +38,12 @@ namespace sxt::f12o {
 //--------------------------------------------------------------------------------------------------
 CUDA_CALLABLE
 void mul(f12t::element& h, const f12t::element& f, const f12t::element& g) noexcept {
+#ifndef __CUDA_ARCH__
+  if (bassy::host_cpu_features_v.mulx_adx) {
+    basfld::montgomery_multiply6_adx(h.data(), f.data(), g.data(), f12b::p_v.data(), f12b::inv_v);
+    return;
+  }
+#endif
   uint64_t t[12] = {};
   uint64_t carry{0};
 
@@ -25,11 +25,22 @@
  */
 #include "sxt/field25/operation/invert.h"
 
+#include "sxt/base/field/safegcd.h"
+#include "sxt/field25/base/constants.h"
+#include "sxt/field25/operation/mul.h"
 #include "sxt/field25/operation/pow_vartime.h"
 #include "sxt/field25/property/zero.h"
 #include "sxt/field25/type/element.h"
 
 namespace sxt::f25o {
+//--------------------------------------------------------------------------------------------------
+// r3_v
+//--------------------------------------------------------------------------------------------------
+// safegcd inverts the Montgomery form a * R of an element to a^-1 * R^-1, which a Montgomery
+// multiplication by R^3 mod p brings back to a^-1 * R
+static constexpr f25t::element r3_v{0xb1cd6dafda1530df, 0x62f210e6a7283db6, 0xef7f0b0c0ada0afb,
+                                    0x20fd6e902d592544};
+
 //--------------------------------------------------------------------------------------------------
 // invert
 //--------------------------------------------------------------------------------------------------
@@ -40,11 +51,26 @@ namespace sxt::f25o {
  * Therefore, for any f in Fp: f^{-1} == f^{p-2}.
  */
 CUDA_CALLABLE bool invert(f25t::element& h, const f25t::element& f) noexcept {
+#ifndef __CUDA_ARCH__
+  basfld::invert4_safegcd(h.data(), f.data(), f25b::p_v.data());
+  f25o::mul(h, h, r3_v);
+  return f25p::is_zero(h);
+#else
   constexpr f25t::element p_v_minus_2{0x3c208c16d87cfd45, 0x97816a916871ca8d, 0xb85045b68181585d,
                                       0x30644e72e131a029};
 
   f25o::pow_vartime(h, f, p_v_minus_2);
 
+  return f25p::is_zero(h);
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+// invert_vartime
+//--------------------------------------------------------------------------------------------------
+bool invert_vartime(f25t::element& h, const f25t::element& f) noexcept {
+  basfld::invert4_safegcd_vartime(h.data(), f.data(), f25b::p_v.data());
+  f25o::mul(h, h, r3_v);
   return f25p::is_zero(h);
 }
 } // namespace sxt::f25o
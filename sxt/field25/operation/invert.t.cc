@@ -19,7 +19,9 @@
 #include "sxt/base/num/fast_random_number_generator.h"
 #include "sxt/base/test/unit_test.h"
 #include "sxt/field25/constant/one.h"
+#include "sxt/field25/constant/zero.h"
 #include "sxt/field25/operation/mul.h"
+#include "sxt/field25/operation/pow_vartime.h"
 #include "sxt/field25/random/element.h"
 #include "sxt/field25/type/element.h"
 
@@ -40,4 +42,36 @@ TEST_CASE("inversion") {
     mul(ret_mul, a, a_inv);
     REQUIRE(ret_mul == f25cn::one_v);
   }
+
+  SECTION("of one is one") {
+    f25t::element ret;
+    REQUIRE(!invert(ret, f25cn::one_v));
+    REQUIRE(ret == f25cn::one_v);
+    REQUIRE(!invert_vartime(ret, f25cn::one_v));
+    REQUIRE(ret == f25cn::one_v);
+  }
+
+  SECTION("of zero in variable time returns the flag indicating the value is zero") {
+    f25t::element ret;
+    REQUIRE(invert_vartime(ret, f25cn::zero_v));
+  }
+
+  SECTION("matches the inverse computed with Fermat's little theorem") {
+    constexpr f25t::element p_v_minus_2{0x3c208c16d87cfd45, 0x97816a916871ca8d, 0xb85045b68181585d,
+                                        0x30644e72e131a029};
+    basn::fast_random_number_generator rng{1, 2};
+    for (int i = 0; i < 100; ++i) {
+      f25t::element a;
+      f25rn::generate_random_element(a, rng);
+
+      f25t::element expected;
+      pow_vartime(expected, a, p_v_minus_2);
+
+      f25t::element ret;
+      REQUIRE(!invert(ret, a));
+      REQUIRE(ret == expected);
+      REQUIRE(!invert_vartime(ret, a));
+      REQUIRE(ret == expected);
+    }
+  }
 }
@@ -26,6 +26,9 @@
 #include "sxt/field25/operation/square.h"
 
 #include "sxt/base/field/arithmetic_utility.h"
+#include "sxt/base/field/montgomery_adx.h"
+#include "sxt/base/system/cpu_features.h"
+#include "sxt/field25/base/constants.h"
 #include "sxt/field25/base/reduce.h"
 #include "sxt/field25/type/element.h"
 
@@ -35,6 +38,12 @@ namespace sxt::f25o {
 //--------------------------------------------------------------------------------------------------
 CUDA_CALLABLE
 void square(f25t::element& h, const f25t::element& f) noexcept {
+#ifndef __CUDA_ARCH__
+  if (bassy::host_cpu_features_v.mulx_adx) {
+    basfld::montgomery_square4_adx(h.data(), f.data(), f25b::p_v.data(), f25b::inv_v);
+    return;
+  }
+#endif
   uint64_t t[8] = {};
   uint64_t carry{0};
 
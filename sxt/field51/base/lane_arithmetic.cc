@@ -0,0 +1,313 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/field51/base/lane_arithmetic.h"
+
+#include "sxt/base/error/panic.h"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+
+#define SXT_TARGET_IFMA __attribute__((target("avx512f,avx512ifma")))
+#define SXT_TARGET_AVX2 __attribute__((target("avx2")))
+
+// The kernels keep their limbs in arrays of vectors, which only stay in registers if every loop
+// over them is fully unrolled. GCC won't do that on its own at -O2.
+#define SXT_UNROLL _Pragma("GCC unroll 10")
+#endif
+
+namespace sxt::f51b {
+#if defined(__x86_64__)
+static constexpr uint64_t mask51_v = (1ull << 51) - 1;
+static constexpr uint64_t mask26_v = (1ull << 26) - 1;
+static constexpr uint64_t mask25_v = (1ull << 25) - 1;
+
+//--------------------------------------------------------------------------------------------------
+// times19
+//--------------------------------------------------------------------------------------------------
+SXT_TARGET_IFMA static __m512i times19(__m512i x) noexcept {
+  return _mm512_add_epi64(_mm512_add_epi64(x, _mm512_slli_epi64(x, 1)), _mm512_slli_epi64(x, 4));
+}
+
+SXT_TARGET_AVX2 static __m256i times19(__m256i x) noexcept {
+  return _mm256_add_epi64(_mm256_add_epi64(x, _mm256_slli_epi64(x, 1)), _mm256_slli_epi64(x, 4));
+}
+
+//--------------------------------------------------------------------------------------------------
+// load_normalized
+//--------------------------------------------------------------------------------------------------
+/**
+ * Load the limbs of each lane and carry them once so that every limb is below 2^52, the width of
+ * the IFMA multiplier.
+ */
+SXT_TARGET_IFMA static void load_normalized(__m512i x[5], const lane_element<8>& e) noexcept {
+  const auto mask = _mm512_set1_epi64(mask51_v);
+  SXT_UNROLL
+  for (int i = 0; i < 5; ++i) {
+    x[i] = _mm512_load_si512(e.limbs[i]);
+  }
+  SXT_UNROLL
+  for (int i = 0; i < 4; ++i) {
+    x[i + 1] = _mm512_add_epi64(x[i + 1], _mm512_srli_epi64(x[i], 51));
+    x[i] = _mm512_and_si512(x[i], mask);
+  }
+  auto carry = _mm512_srli_epi64(x[4], 51);
+  x[4] = _mm512_and_si512(x[4], mask);
+  x[0] = _mm512_add_epi64(x[0], times19(carry));
+}
+
+SXT_TARGET_AVX2 static void load_normalized(__m256i x[5], const lane_element<4>& e) noexcept {
+  const auto mask = _mm256_set1_epi64x(mask51_v);
+  SXT_UNROLL
+  for (int i = 0; i < 5; ++i) {
+    x[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(e.limbs[i]));
+  }
+  SXT_UNROLL
+  for (int i = 0; i < 4; ++i) {
+    x[i + 1] = _mm256_add_epi64(x[i + 1], _mm256_srli_epi64(x[i], 51));
+    x[i] = _mm256_and_si256(x[i], mask);
+  }
+  auto carry = _mm256_srli_epi64(x[4], 51);
+  x[4] = _mm256_and_si256(x[4], mask);
+  x[0] = _mm256_add_epi64(x[0], times19(carry));
+}
+
+//--------------------------------------------------------------------------------------------------
+// reduce_store
+//--------------------------------------------------------------------------------------------------
+/**
+ * Given the ten 51-bit-weighted columns of a product, fold the upper five with 2^255 = 19 and
+ * carry the result into h with the same carry sequence as the scalar f51o::mul.
+ */
+SXT_TARGET_IFMA static void reduce_store(lane_element<8>& h, const __m512i z[10]) noexcept {
+  const auto mask = _mm512_set1_epi64(mask51_v);
+  __m512i r[5];
+  SXT_UNROLL
+  for (int i = 0; i < 5; ++i) {
+    r[i] = _mm512_add_epi64(z[i], times19(z[i + 5]));
+  }
+  SXT_UNROLL
+  for (int i = 0; i < 4; ++i) {
+    r[i + 1] = _mm512_add_epi64(r[i + 1], _mm512_srli_epi64(r[i], 51));
+    r[i] = _mm512_and_si512(r[i], mask);
+  }
+  auto carry = _mm512_srli_epi64(r[4], 51);
+  r[4] = _mm512_and_si512(r[4], mask);
+  r[0] = _mm512_add_epi64(r[0], times19(carry));
+  r[1] = _mm512_add_epi64(r[1], _mm512_srli_epi64(r[0], 51));
+  r[0] = _mm512_and_si512(r[0], mask);
+  r[2] = _mm512_add_epi64(r[2], _mm512_srli_epi64(r[1], 51));
+  r[1] = _mm512_and_si512(r[1], mask);
+  SXT_UNROLL
+  for (int i = 0; i < 5; ++i) {
+    _mm512_store_si512(h.limbs[i], r[i]);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// mul8_ifma_impl
+//--------------------------------------------------------------------------------------------------
+SXT_TARGET_IFMA static void mul8_ifma_impl(lane_element<8>& h, const lane_element<8>& f,
+                                           const lane_element<8>& g) noexcept {
+  __m512i a[5], b[5];
+  load_normalized(a, f);
+  load_normalized(b, g);
+
+  // For limbs below 2^52, a[i] * b[j] = lo + hi * 2^52 = lo + 2 * hi * 2^51, so the high halves
+  // count twice toward the next column.
+  __m512i lo[9], hi[9];
+  SXT_UNROLL
+  for (int k = 0; k < 9; ++k) {
+    lo[k] = _mm512_setzero_si512();
+    hi[k] = _mm512_setzero_si512();
+  }
+  SXT_UNROLL
+  for (int i = 0; i < 5; ++i) {
+    SXT_UNROLL
+    for (int j = 0; j < 5; ++j) {
+      lo[i + j] = _mm512_madd52lo_epu64(lo[i + j], a[i], b[j]);
+      hi[i + j] = _mm512_madd52hi_epu64(hi[i + j], a[i], b[j]);
+    }
+  }
+  __m512i z[10];
+  z[0] = lo[0];
+  SXT_UNROLL
+  for (int k = 1; k < 9; ++k) {
+    z[k] = _mm512_add_epi64(lo[k], _mm512_slli_epi64(hi[k - 1], 1));
+  }
+  z[9] = _mm512_slli_epi64(hi[8], 1);
+  reduce_store(h, z);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sq8_ifma_impl
+//--------------------------------------------------------------------------------------------------
+SXT_TARGET_IFMA static void sq8_ifma_impl(lane_element<8>& h, const lane_element<8>& f) noexcept {
+  __m512i a[5];
+  load_normalized(a, f);
+
+  // accumulate the cross products a[i] * a[j] for i < j, which count twice, separately from the
+  // diagonal
+  __m512i lo[9], hi[9], diag_lo[9], diag_hi[9];
+  SXT_UNROLL
+  for (int k = 0; k < 9; ++k) {
+    lo[k] = _mm512_setzero_si512();
+    hi[k] = _mm512_setzero_si512();
+  }
+  SXT_UNROLL
+  for (int i = 0; i < 5; ++i) {
+    SXT_UNROLL
+    for (int j = i + 1; j < 5; ++j) {
+      lo[i + j] = _mm512_madd52lo_epu64(lo[i + j], a[i], a[j]);
+      hi[i + j] = _mm512_madd52hi_epu64(hi[i + j], a[i], a[j]);
+    }
+  }
+  SXT_UNROLL
+  for (int i = 0; i < 5; ++i) {
+    diag_lo[2 * i] = _mm512_madd52lo_epu64(_mm512_setzero_si512(), a[i], a[i]);
+    diag_hi[2 * i] = _mm512_madd52hi_epu64(_mm512_setzero_si512(), a[i], a[i]);
+  }
+  SXT_UNROLL
+  for (int k = 0; k < 9; ++k) {
+    lo[k] = _mm512_slli_epi64(lo[k], 1);
+    hi[k] = _mm512_slli_epi64(hi[k], 1);
+    if (k % 2 == 0) {
+      lo[k] = _mm512_add_epi64(lo[k], diag_lo[k]);
+      hi[k] = _mm512_add_epi64(hi[k], diag_hi[k]);
+    }
+  }
+  __m512i z[10];
+  z[0] = lo[0];
+  SXT_UNROLL
+  for (int k = 1; k < 9; ++k) {
+    z[k] = _mm512_add_epi64(lo[k], _mm512_slli_epi64(hi[k - 1], 1));
+  }
+  z[9] = _mm512_slli_epi64(hi[8], 1);
+  reduce_store(h, z);
+}
+
+//--------------------------------------------------------------------------------------------------
+// mul4_avx2_impl
+//--------------------------------------------------------------------------------------------------
+SXT_TARGET_AVX2 static void mul4_avx2_impl(lane_element<4>& h, const lane_element<4>& f,
+                                           const lane_element<4>& g) noexcept {
+  __m256i a[5], b[5];
+  load_normalized(a, f);
+  load_normalized(b, g);
+
+  // split each 51-bit limb into a 26-bit and a 25-bit limb so that limb i has weight
+  // 2^ceil(25.5 * i)
+  const auto mask26 = _mm256_set1_epi64x(mask26_v);
+  const auto nineteen = _mm256_set1_epi64x(19);
+  __m256i x[10], y[10], y19[10];
+  SXT_UNROLL
+  for (int i = 0; i < 5; ++i) {
+    x[2 * i] = _mm256_and_si256(a[i], mask26);
+    x[2 * i + 1] = _mm256_srli_epi64(a[i], 26);
+    y[2 * i] = _mm256_and_si256(b[i], mask26);
+    y[2 * i + 1] = _mm256_srli_epi64(b[i], 26);
+  }
+  SXT_UNROLL
+  for (int j = 0; j < 10; ++j) {
+    y19[j] = _mm256_mul_epu32(y[j], nineteen);
+  }
+
+  // the product of two odd limbs lands one bit above its column, and columns past 2^255 fold back
+  // with a factor of 19
+  __m256i t[10];
+  SXT_UNROLL
+  for (int k = 0; k < 10; ++k) {
+    t[k] = _mm256_setzero_si256();
+  }
+  SXT_UNROLL
+  for (int i = 0; i < 10; ++i) {
+    auto xi = (i % 2 == 1) ? _mm256_slli_epi64(x[i], 1) : x[i];
+    SXT_UNROLL
+    for (int j = 0; j < 10; ++j) {
+      auto k = (i + j) % 10;
+      auto xij = (j % 2 == 1) ? xi : x[i];
+      auto yj = (i + j >= 10) ? y19[j] : y[j];
+      t[k] = _mm256_add_epi64(t[k], _mm256_mul_epu32(xij, yj));
+    }
+  }
+
+  // carry
+  const auto mask25 = _mm256_set1_epi64x(mask25_v);
+  SXT_UNROLL
+  for (int k = 0; k < 9; ++k) {
+    auto shift = (k % 2 == 0) ? 26 : 25;
+    t[k + 1] = _mm256_add_epi64(t[k + 1], _mm256_srli_epi64(t[k], shift));
+    t[k] = _mm256_and_si256(t[k], (k % 2 == 0) ? mask26 : mask25);
+  }
+  auto carry = _mm256_srli_epi64(t[9], 25);
+  t[9] = _mm256_and_si256(t[9], mask25);
+  t[0] = _mm256_add_epi64(t[0], times19(carry));
+  t[1] = _mm256_add_epi64(t[1], _mm256_srli_epi64(t[0], 26));
+  t[0] = _mm256_and_si256(t[0], mask26);
+
+  // recombine into 51-bit limbs
+  SXT_UNROLL
+  for (int i = 0; i < 5; ++i) {
+    auto r = _mm256_add_epi64(t[2 * i], _mm256_slli_epi64(t[2 * i + 1], 26));
+    _mm256_store_si256(reinterpret_cast<__m256i*>(h.limbs[i]), r);
+  }
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------
+// mul8_ifma
+//--------------------------------------------------------------------------------------------------
+void mul8_ifma(lane_element<8>& h, const lane_element<8>& f, const lane_element<8>& g) noexcept {
+#if defined(__x86_64__)
+  mul8_ifma_impl(h, f, g);
+#else
+  baser::panic("mul8_ifma requires an x86-64 host");
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+// sq8_ifma
+//--------------------------------------------------------------------------------------------------
+void sq8_ifma(lane_element<8>& h, const lane_element<8>& f) noexcept {
+#if defined(__x86_64__)
+  sq8_ifma_impl(h, f);
+#else
+  baser::panic("sq8_ifma requires an x86-64 host");
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+// mul4_avx2
+//--------------------------------------------------------------------------------------------------
+void mul4_avx2(lane_element<4>& h, const lane_element<4>& f, const lane_element<4>& g) noexcept {
+#if defined(__x86_64__)
+  mul4_avx2_impl(h, f, g);
+#else
+  baser::panic("mul4_avx2 requires an x86-64 host");
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+// sq4_avx2
+//--------------------------------------------------------------------------------------------------
+void sq4_avx2(lane_element<4>& h, const lane_element<4>& f) noexcept {
+#if defined(__x86_64__)
+  mul4_avx2_impl(h, f, f);
+#else
+  baser::panic("sq4_avx2 requires an x86-64 host");
+#endif
+}
+} // namespace sxt::f51b
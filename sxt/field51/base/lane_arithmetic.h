@@ -0,0 +1,137 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace sxt::f51b {
+//--------------------------------------------------------------------------------------------------
+// lane_element
+//--------------------------------------------------------------------------------------------------
+/**
+ * Lanes independent field elements stored limb-major, so that a single vector register holds one
+ * limb of every lane.
+ */
+template <unsigned Lanes> struct lane_element {
+  alignas(64) uint64_t limbs[5][Lanes];
+};
+
+//--------------------------------------------------------------------------------------------------
+// mul8_ifma
+//--------------------------------------------------------------------------------------------------
+/**
+ * Multiply 8 pairs of field elements with the AVX-512 IFMA 52-bit multiply-add instructions.
+ *
+ * Inputs may have the loosely reduced limbs produced by the scalar field51 operations. Outputs have
+ * limbs below 2^52. Requires bassy::host_cpu_features_v.avx512_ifma; h may alias f or g.
+ */
+void mul8_ifma(lane_element<8>& h, const lane_element<8>& f, const lane_element<8>& g) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// sq8_ifma
+//--------------------------------------------------------------------------------------------------
+/**
+ * Square 8 field elements, computing each cross product once.
+ */
+void sq8_ifma(lane_element<8>& h, const lane_element<8>& f) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// mul4_avx2
+//--------------------------------------------------------------------------------------------------
+/**
+ * Multiply 4 pairs of field elements with AVX2.
+ *
+ * AVX2 only has a 32x32-bit multiply, so the lanes are split into ten alternating 26 and 25-bit
+ * limbs for the product. Same input and output bounds as mul8_ifma. Requires
+ * bassy::host_cpu_features_v.avx2.
+ */
+void mul4_avx2(lane_element<4>& h, const lane_element<4>& f, const lane_element<4>& g) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// sq4_avx2
+//--------------------------------------------------------------------------------------------------
+void sq4_avx2(lane_element<4>& h, const lane_element<4>& f) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// mul
+//--------------------------------------------------------------------------------------------------
+/**
+ * Overloads that pick the kernel for a lane count so that code templated on Lanes can be shared
+ * between the IFMA and AVX2 widths.
+ */
+inline void mul(lane_element<8>& h, const lane_element<8>& f, const lane_element<8>& g) noexcept {
+  mul8_ifma(h, f, g);
+}
+
+inline void mul(lane_element<4>& h, const lane_element<4>& f, const lane_element<4>& g) noexcept {
+  mul4_avx2(h, f, g);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sq
+//--------------------------------------------------------------------------------------------------
+inline void sq(lane_element<8>& h, const lane_element<8>& f) noexcept { sq8_ifma(h, f); }
+
+inline void sq(lane_element<4>& h, const lane_element<4>& f) noexcept { sq4_avx2(h, f); }
+
+//--------------------------------------------------------------------------------------------------
+// add
+//--------------------------------------------------------------------------------------------------
+/**
+ * h = f + g, lane by lane and without carrying, as with f51o::add
+ */
+template <unsigned Lanes>
+inline void add(lane_element<Lanes>& h, const lane_element<Lanes>& f,
+                const lane_element<Lanes>& g) noexcept {
+  for (int i = 0; i < 5; ++i) {
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      h.limbs[i][lane] = f.limbs[i][lane] + g.limbs[i][lane];
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// sub
+//--------------------------------------------------------------------------------------------------
+/**
+ * h = f - g, lane by lane with the same carry of g and bias of 2p as f51o::sub
+ */
+template <unsigned Lanes>
+inline void sub(lane_element<Lanes>& h, const lane_element<Lanes>& f,
+                const lane_element<Lanes>& g) noexcept {
+  constexpr uint64_t mask = (1ull << 51) - 1;
+  lane_element<Lanes> t = g;
+  for (int i = 0; i < 4; ++i) {
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      t.limbs[i + 1][lane] += t.limbs[i][lane] >> 51;
+      t.limbs[i][lane] &= mask;
+    }
+  }
+  for (unsigned lane = 0; lane < Lanes; ++lane) {
+    t.limbs[0][lane] += 19ull * (t.limbs[4][lane] >> 51);
+    t.limbs[4][lane] &= mask;
+  }
+  for (unsigned lane = 0; lane < Lanes; ++lane) {
+    h.limbs[0][lane] = (f.limbs[0][lane] + 0xfffffffffffdaull) - t.limbs[0][lane];
+  }
+  for (int i = 1; i < 5; ++i) {
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      h.limbs[i][lane] = (f.limbs[i][lane] + 0xffffffffffffeull) - t.limbs[i][lane];
+    }
+  }
+}
+} // namespace sxt::f51b
@@ -0,0 +1,122 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/field51/base/lane_arithmetic.h"
+
+#include <random>
+
+#include "sxt/base/system/cpu_features.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/field51/operation/add.h"
+#include "sxt/field51/operation/mul.h"
+#include "sxt/field51/operation/sq.h"
+#include "sxt/field51/operation/sub.h"
+#include "sxt/field51/random/element.h"
+#include "sxt/field51/type/element.h"
+
+using namespace sxt;
+using namespace sxt::f51b;
+
+//--------------------------------------------------------------------------------------------------
+// make_inputs
+//--------------------------------------------------------------------------------------------------
+/**
+ * Random elements, some with the unreduced limbs left by sums and differences.
+ */
+template <unsigned Lanes> static void make_inputs(f51t::element (&xs)[Lanes], std::mt19937& rng) {
+  for (unsigned lane = 0; lane < Lanes; ++lane) {
+    f51t::element a, b;
+    f51rn::generate_random_element(a, rng);
+    f51rn::generate_random_element(b, rng);
+    if (lane % 3 == 0) {
+      xs[lane] = a;
+    } else if (lane % 3 == 1) {
+      f51o::add(xs[lane], a, b);
+    } else {
+      f51o::sub(xs[lane], a, b);
+    }
+  }
+}
+
+template <unsigned Lanes>
+static void to_lanes(lane_element<Lanes>& res, const f51t::element (&xs)[Lanes]) noexcept {
+  for (unsigned lane = 0; lane < Lanes; ++lane) {
+    for (int i = 0; i < 5; ++i) {
+      res.limbs[i][lane] = xs[lane][i];
+    }
+  }
+}
+
+template <unsigned Lanes>
+static f51t::element from_lane(const lane_element<Lanes>& e, unsigned lane) noexcept {
+  return f51t::element{e.limbs[0][lane], e.limbs[1][lane], e.limbs[2][lane], e.limbs[3][lane],
+                       e.limbs[4][lane]};
+}
+
+template <unsigned Lanes, class Mul, class Sq> static void check_kernels(Mul mul, Sq sq) {
+  std::mt19937 rng{0};
+  for (int iteration = 0; iteration < 100; ++iteration) {
+    f51t::element fs[Lanes], gs[Lanes];
+    make_inputs(fs, rng);
+    make_inputs(gs, rng);
+    lane_element<Lanes> f, g, h;
+    to_lanes(f, fs);
+    to_lanes(g, gs);
+
+    mul(h, f, g);
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      f51t::element expected;
+      f51o::mul(expected, fs[lane], gs[lane]);
+      auto res = from_lane(h, lane);
+      REQUIRE(res == expected);
+      for (int i = 0; i < 5; ++i) {
+        REQUIRE(res[i] < (1ull << 52));
+      }
+    }
+
+    sq(h, f);
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      f51t::element expected;
+      f51o::sq(expected, fs[lane]);
+      REQUIRE(from_lane(h, lane) == expected);
+    }
+
+    // outputs can alias inputs
+    mul(f, f, g);
+    sq(g, g);
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      f51t::element expected;
+      f51o::mul(expected, fs[lane], gs[lane]);
+      REQUIRE(from_lane(f, lane) == expected);
+      f51o::sq(expected, gs[lane]);
+      REQUIRE(from_lane(g, lane) == expected);
+    }
+  }
+}
+
+TEST_CASE("we can multiply 8 lanes of field elements with AVX-512 IFMA") {
+  if (!bassy::host_cpu_features_v.avx512_ifma) {
+    return;
+  }
+  check_kernels<8>(mul8_ifma, sq8_ifma);
+}
+
+TEST_CASE("we can multiply 4 lanes of field elements with AVX2") {
+  if (!bassy::host_cpu_features_v.avx2) {
+    return;
+  }
+  check_kernels<4>(mul4_avx2, sq4_avx2);
+}
@@ -0,0 +1,265 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/field51/operation/batch_arithmetic.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "sxt/base/error/assert.h"
+#include "sxt/base/num/divide_up.h"
+#include "sxt/base/system/cpu_features.h"
+#include "sxt/field51/base/lane_arithmetic.h"
+#include "sxt/field51/constant/one.h"
+#include "sxt/field51/constant/zero.h"
+#include "sxt/field51/operation/mul.h"
+#include "sxt/field51/operation/sq.h"
+#include "sxt/field51/property/zero.h"
+#include "sxt/field51/type/element.h"
+
+namespace sxt::f51o {
+//--------------------------------------------------------------------------------------------------
+// gather
+//--------------------------------------------------------------------------------------------------
+template <unsigned Lanes>
+static void gather(f51b::lane_element<Lanes>& res, const f51t::element* xs) noexcept {
+  for (unsigned lane = 0; lane < Lanes; ++lane) {
+    for (int i = 0; i < 5; ++i) {
+      res.limbs[i][lane] = xs[lane][i];
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// scatter
+//--------------------------------------------------------------------------------------------------
+template <unsigned Lanes>
+static void scatter(f51t::element* xs, const f51b::lane_element<Lanes>& e,
+                    unsigned num_lanes = Lanes) noexcept {
+  for (unsigned lane = 0; lane < num_lanes; ++lane) {
+    for (int i = 0; i < 5; ++i) {
+      xs[lane][i] = e.limbs[i][lane];
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// mul1
+//--------------------------------------------------------------------------------------------------
+static void mul1(f51b::lane_element<1>& h, const f51b::lane_element<1>& f,
+                 const f51b::lane_element<1>& g) noexcept {
+  f51t::element fp, gp;
+  scatter(&fp, f);
+  scatter(&gp, g);
+  mul(fp, fp, gp);
+  gather(h, &fp);
+}
+
+//--------------------------------------------------------------------------------------------------
+// sq1
+//--------------------------------------------------------------------------------------------------
+static void sq1(f51b::lane_element<1>& h, const f51b::lane_element<1>& f) noexcept {
+  f51t::element fp;
+  scatter(&fp, f);
+  sq(fp, fp);
+  gather(h, &fp);
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_mul_impl
+//--------------------------------------------------------------------------------------------------
+/**
+ * Multiply the leading multiple of Lanes elements and return how many were processed.
+ */
+template <unsigned Lanes, class F>
+static size_t batch_mul_impl(basct::span<f51t::element> h, basct::cspan<f51t::element> f,
+                             basct::cspan<f51t::element> g, F mul_lanes) noexcept {
+  auto n = h.size() - h.size() % Lanes;
+  f51b::lane_element<Lanes> x, y;
+  for (size_t i = 0; i < n; i += Lanes) {
+    gather(x, f.data() + i);
+    gather(y, g.data() + i);
+    mul_lanes(x, x, y);
+    scatter(h.data() + i, x);
+  }
+  return n;
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_sq_impl
+//--------------------------------------------------------------------------------------------------
+template <unsigned Lanes, class F>
+static size_t batch_sq_impl(basct::span<f51t::element> h, basct::cspan<f51t::element> f,
+                            F sq_lanes) noexcept {
+  auto n = h.size() - h.size() % Lanes;
+  f51b::lane_element<Lanes> x;
+  for (size_t i = 0; i < n; i += Lanes) {
+    gather(x, f.data() + i);
+    sq_lanes(x, x);
+    scatter(h.data() + i, x);
+  }
+  return n;
+}
+
+//--------------------------------------------------------------------------------------------------
+// invert_lanes
+//--------------------------------------------------------------------------------------------------
+/**
+ * Raise each lane to the power p - 2 with the same addition chain as invert.
+ */
+template <unsigned Lanes, class Mul, class Sq>
+static void invert_lanes(f51b::lane_element<Lanes>& out, const f51b::lane_element<Lanes>& z,
+                         Mul mul_lanes, Sq sq_lanes) noexcept {
+  f51b::lane_element<Lanes> t0, t1, t2, t3;
+  auto sq_n = [&](f51b::lane_element<Lanes>& t, int n) noexcept {
+    for (int i = 0; i < n; ++i) {
+      sq_lanes(t, t);
+    }
+  };
+  sq_lanes(t0, z);
+  sq_lanes(t1, t0);
+  sq_lanes(t1, t1);
+  mul_lanes(t1, z, t1);
+  mul_lanes(t0, t0, t1);
+  sq_lanes(t2, t0);
+  mul_lanes(t1, t1, t2);
+  sq_lanes(t2, t1);
+  sq_n(t2, 4);
+  mul_lanes(t1, t2, t1);
+  sq_lanes(t2, t1);
+  sq_n(t2, 9);
+  mul_lanes(t2, t2, t1);
+  sq_lanes(t3, t2);
+  sq_n(t3, 19);
+  mul_lanes(t2, t3, t2);
+  sq_n(t2, 10);
+  mul_lanes(t1, t2, t1);
+  sq_lanes(t2, t1);
+  sq_n(t2, 49);
+  mul_lanes(t2, t2, t1);
+  sq_lanes(t3, t2);
+  sq_n(t3, 99);
+  mul_lanes(t2, t3, t2);
+  sq_n(t2, 50);
+  mul_lanes(t1, t2, t1);
+  sq_n(t1, 5);
+  mul_lanes(out, t1, t0);
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_invert_impl
+//--------------------------------------------------------------------------------------------------
+template <unsigned Lanes, class Mul, class Sq>
+static void batch_invert_impl(basct::span<f51t::element> h, basct::cspan<f51t::element> f,
+                              Mul mul_lanes, Sq sq_lanes) noexcept {
+  auto n = f.size();
+  auto num_chunks = basn::divide_up(n, static_cast<size_t>(Lanes));
+
+  // Element i goes to lane i % Lanes of chunk i / Lanes. Zeros, and the padding of the last
+  // chunk, are replaced by one so that they don't annihilate the products of their lanes.
+  std::vector<f51b::lane_element<Lanes>> xs(num_chunks);
+  std::vector<bool> is_zero(n);
+  for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+    f51t::element elements[Lanes];
+    for (unsigned lane = 0; lane < Lanes; ++lane) {
+      auto i = chunk * Lanes + lane;
+      elements[lane] = f51cn::one_v;
+      if (i < n) {
+        is_zero[i] = f51p::is_zero(f[i]) != 0;
+        if (!is_zero[i]) {
+          elements[lane] = f[i];
+        }
+      }
+    }
+    gather(xs[chunk], elements);
+  }
+
+  // partials[c] holds the lane-wise product of xs[0..c]
+  std::vector<f51b::lane_element<Lanes>> partials(num_chunks);
+  partials[0] = xs[0];
+  for (size_t chunk = 1; chunk < num_chunks; ++chunk) {
+    mul_lanes(partials[chunk], partials[chunk - 1], xs[chunk]);
+  }
+
+  f51b::lane_element<Lanes> inv, t;
+  invert_lanes(inv, partials[num_chunks - 1], mul_lanes, sq_lanes);
+
+  // walk back through the chunks, peeling one element off of each lane's product at a time
+  for (size_t chunk = num_chunks; chunk-- > 1;) {
+    mul_lanes(t, inv, partials[chunk - 1]);
+    mul_lanes(inv, inv, xs[chunk]);
+    auto first = chunk * Lanes;
+    scatter(h.data() + first, t, static_cast<unsigned>(std::min<size_t>(Lanes, n - first)));
+  }
+  scatter(h.data(), inv, static_cast<unsigned>(std::min<size_t>(Lanes, n)));
+
+  for (size_t i = 0; i < n; ++i) {
+    if (is_zero[i]) {
+      h[i] = f51cn::zero_v;
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_mul
+//--------------------------------------------------------------------------------------------------
+void batch_mul(basct::span<f51t::element> h, basct::cspan<f51t::element> f,
+               basct::cspan<f51t::element> g) noexcept {
+  SXT_DEBUG_ASSERT(h.size() == f.size() && h.size() == g.size());
+  size_t first = 0;
+  if (bassy::host_cpu_features_v.avx512_ifma) {
+    first = batch_mul_impl<8>(h, f, g, f51b::mul8_ifma);
+  } else if (bassy::host_cpu_features_v.avx2) {
+    first = batch_mul_impl<4>(h, f, g, f51b::mul4_avx2);
+  }
+  for (size_t i = first; i < h.size(); ++i) {
+    mul(h[i], f[i], g[i]);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_sq
+//--------------------------------------------------------------------------------------------------
+void batch_sq(basct::span<f51t::element> h, basct::cspan<f51t::element> f) noexcept {
+  SXT_DEBUG_ASSERT(h.size() == f.size());
+  size_t first = 0;
+  if (bassy::host_cpu_features_v.avx512_ifma) {
+    first = batch_sq_impl<8>(h, f, f51b::sq8_ifma);
+  } else if (bassy::host_cpu_features_v.avx2) {
+    first = batch_sq_impl<4>(h, f, f51b::sq4_avx2);
+  }
+  for (size_t i = first; i < h.size(); ++i) {
+    sq(h[i], f[i]);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// batch_invert
+//--------------------------------------------------------------------------------------------------
+void batch_invert(basct::span<f51t::element> h, basct::cspan<f51t::element> f) noexcept {
+  SXT_DEBUG_ASSERT(h.size() == f.size());
+  if (f.empty()) {
+    return;
+  }
+  if (bassy::host_cpu_features_v.avx512_ifma) {
+    batch_invert_impl<8>(h, f, f51b::mul8_ifma, f51b::sq8_ifma);
+  } else if (bassy::host_cpu_features_v.avx2) {
+    batch_invert_impl<4>(h, f, f51b::mul4_avx2, f51b::sq4_avx2);
+  } else {
+    batch_invert_impl<1>(h, f, mul1, sq1);
+  }
+}
+} // namespace sxt::f51o
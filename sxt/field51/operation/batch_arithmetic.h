@@ -0,0 +1,56 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "sxt/base/container/span.h"
+
+namespace sxt::f51t {
+class element;
+}
+
+namespace sxt::f51o {
+//--------------------------------------------------------------------------------------------------
+// batch_mul
+//--------------------------------------------------------------------------------------------------
+/**
+ * h[i] = f[i] * g[i]
+ *
+ * Computes 8 products at a time with AVX-512 IFMA or 4 at a time with AVX2 when the host supports
+ * them. h may alias f or g.
+ */
+void batch_mul(basct::span<f51t::element> h, basct::cspan<f51t::element> f,
+               basct::cspan<f51t::element> g) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// batch_sq
+//--------------------------------------------------------------------------------------------------
+/**
+ * h[i] = f[i]^2
+ */
+void batch_sq(basct::span<f51t::element> h, basct::cspan<f51t::element> f) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// batch_invert
+//--------------------------------------------------------------------------------------------------
+/**
+ * h[i] = 1 / f[i], where zero maps to zero as with invert
+ *
+ * Runs an independent chain of Montgomery's trick in each vector lane so that all the elements
+ * share a single lane-parallel inversion.
+ */
+void batch_invert(basct::span<f51t::element> h, basct::cspan<f51t::element> f) noexcept;
+} // namespace sxt::f51o
@@ -0,0 +1,92 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/field51/operation/batch_arithmetic.h"
+
+#include <random>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/field51/constant/zero.h"
+#include "sxt/field51/operation/add.h"
+#include "sxt/field51/operation/invert.h"
+#include "sxt/field51/operation/mul.h"
+#include "sxt/field51/operation/sq.h"
+#include "sxt/field51/random/element.h"
+#include "sxt/field51/type/element.h"
+
+using namespace sxt;
+using namespace sxt::f51o;
+
+static std::vector<f51t::element> make_elements(size_t n, std::mt19937& rng) {
+  std::vector<f51t::element> res(n);
+  for (auto& x : res) {
+    f51t::element a, b;
+    f51rn::generate_random_element(a, rng);
+    f51rn::generate_random_element(b, rng);
+    add(x, a, b);
+  }
+  return res;
+}
+
+TEST_CASE("we can operate on batches of elements") {
+  std::mt19937 rng{0};
+
+  for (size_t n : {0, 1, 7, 8, 13, 33}) {
+    auto f = make_elements(n, rng);
+    auto g = make_elements(n, rng);
+    std::vector<f51t::element> h(n);
+
+    SECTION("we can multiply batches of size " + std::to_string(n)) {
+      batch_mul(h, f, g);
+      for (size_t i = 0; i < n; ++i) {
+        f51t::element expected;
+        mul(expected, f[i], g[i]);
+        REQUIRE(h[i] == expected);
+      }
+    }
+
+    SECTION("we can square batches of size " + std::to_string(n)) {
+      batch_sq(h, f);
+      for (size_t i = 0; i < n; ++i) {
+        f51t::element expected;
+        sq(expected, f[i]);
+        REQUIRE(h[i] == expected);
+      }
+    }
+
+    SECTION("we can invert batches of size " + std::to_string(n)) {
+      if (n > 2) {
+        f[2] = f51cn::zero_v;
+      }
+      batch_invert(h, f);
+      for (size_t i = 0; i < n; ++i) {
+        f51t::element expected;
+        invert(expected, f[i]);
+        REQUIRE(h[i] == expected);
+      }
+    }
+
+    SECTION("outputs can alias inputs for batches of size " + std::to_string(n)) {
+      auto expected = f;
+      for (auto& x : expected) {
+        invert(x, x);
+      }
+      batch_invert(f, f);
+      REQUIRE(f == expected);
+    }
+  }
+}
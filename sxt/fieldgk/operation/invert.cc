@@ -25,11 +25,22 @@
  */
 #include "sxt/fieldgk/operation/invert.h"
 
+#include "sxt/base/field/safegcd.h"
+#include "sxt/fieldgk/base/constants.h"
+#include "sxt/fieldgk/operation/mul.h"
 #include "sxt/fieldgk/operation/pow_vartime.h"
 #include "sxt/fieldgk/property/zero.h"
 #include "sxt/fieldgk/type/element.h"
 
 namespace sxt::fgko {
+//--------------------------------------------------------------------------------------------------
+// r3_v
+//--------------------------------------------------------------------------------------------------
+// safegcd inverts the Montgomery form a * R of an element to a^-1 * R^-1, which a Montgomery
+// multiplication by R^3 mod p brings back to a^-1 * R
+static constexpr fgkt::element r3_v{0x5e94d8e1b4bf0040, 0x2a489cbe1cfbb6b8, 0x893cc664a19fcfed,
+                                    0x0cf8594b7fcc657c};
+
 //--------------------------------------------------------------------------------------------------
 // invert
 //--------------------------------------------------------------------------------------------------
@@ -40,11 +51,26 @@ namespace sxt::fgko {
  * Therefore, for any f in Fp: f^{-1} == f^{p-2}.
  */
 CUDA_CALLABLE bool invert(fgkt::element& h, const fgkt::element& f) noexcept {
+#ifndef __CUDA_ARCH__
+  basfld::invert4_safegcd(h.data(), f.data(), fgkb::p_v.data());
+  fgko::mul(h, h, r3_v);
+  return fgkp::is_zero(h);
+#else
   constexpr fgkt::element p_v_minus_2{0x43e1f593efffffff, 0x2833e84879b97091, 0xb85045b68181585d,
                                       0x30644e72e131a029};
 
   fgko::pow_vartime(h, f, p_v_minus_2);
 
+  return fgkp::is_zero(h);
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+// invert_vartime
+//--------------------------------------------------------------------------------------------------
+bool invert_vartime(fgkt::element& h, const fgkt::element& f) noexcept {
+  basfld::invert4_safegcd_vartime(h.data(), f.data(), fgkb::p_v.data());
+  fgko::mul(h, h, r3_v);
   return fgkp::is_zero(h);
 }
 } // namespace sxt::fgko
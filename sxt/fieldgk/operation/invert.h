@@ -27,4 +27,12 @@ namespace sxt::fgko {
 // invert
 //--------------------------------------------------------------------------------------------------
 CUDA_CALLABLE bool invert(fgkt::element& h, const fgkt::element& f) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// invert_vartime
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host-only variant of invert whose running time depends on f. Only use with public data.
+ */
+bool invert_vartime(fgkt::element& h, const fgkt::element& f) noexcept;
 } // namespace sxt::fgko
@@ -19,7 +19,9 @@
 #include "sxt/base/num/fast_random_number_generator.h"
 #include "sxt/base/test/unit_test.h"
 #include "sxt/fieldgk/constant/one.h"
+#include "sxt/fieldgk/constant/zero.h"
 #include "sxt/fieldgk/operation/mul.h"
+#include "sxt/fieldgk/operation/pow_vartime.h"
 #include "sxt/fieldgk/random/element.h"
 #include "sxt/fieldgk/type/element.h"
 
@@ -40,4 +42,36 @@ TEST_CASE("inversion") {
     mul(ret_mul, a, a_inv);
     REQUIRE(ret_mul == fgkcn::one_v);
   }
+
+  SECTION("of one is one") {
+    fgkt::element ret;
+    REQUIRE(!invert(ret, fgkcn::one_v));
+    REQUIRE(ret == fgkcn::one_v);
+    REQUIRE(!invert_vartime(ret, fgkcn::one_v));
+    REQUIRE(ret == fgkcn::one_v);
+  }
+
+  SECTION("of zero in variable time returns the flag indicating the value is zero") {
+    fgkt::element ret;
+    REQUIRE(invert_vartime(ret, fgkcn::zero_v));
+  }
+
+  SECTION("matches the inverse computed with Fermat's little theorem") {
+    constexpr fgkt::element p_v_minus_2{0x43e1f593efffffff, 0x2833e84879b97091, 0xb85045b68181585d,
+                                        0x30644e72e131a029};
+    basn::fast_random_number_generator rng{1, 2};
+    for (int i = 0; i < 100; ++i) {
+      fgkt::element a;
+      fgkrn::generate_random_element(a, rng);
+
+      fgkt::element expected;
+      pow_vartime(expected, a, p_v_minus_2);
+
+      fgkt::element ret;
+      REQUIRE(!invert(ret, a));
+      REQUIRE(ret == expected);
+      REQUIRE(!invert_vartime(ret, a));
+      REQUIRE(ret == expected);
+    }
+  }
 }
@@ -26,6 +26,9 @@
 #include "sxt/fieldgk/operation/square.h"
 
 #include "sxt/base/field/arithmetic_utility.h"
+#include "sxt/base/field/montgomery_adx.h"
+#include "sxt/base/system/cpu_features.h"
+#include "sxt/fieldgk/base/constants.h"
 #include "sxt/fieldgk/base/reduce.h"
 #include "sxt/fieldgk/type/element.h"
 
@@ -35,6 +38,12 @@ namespace sxt::fgko {
 //--------------------------------------------------------------------------------------------------
 CUDA_CALLABLE
 void square(fgkt::element& h, const fgkt::element& f) noexcept {
+#ifndef __CUDA_ARCH__
+  if (bassy::host_cpu_features_v.mulx_adx) {
+    basfld::montgomery_square4_adx(h.data(), f.data(), fgkb::p_v.data(), fgkb::inv_v);
+    return;
+  }
+#endif
   uint64_t t[8] = {};
   uint64_t carry{0};
 
@@ -0,0 +1,204 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/memory/resource/huge_page_resource.h"
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include "sxt/base/error/panic.h"
+#include "sxt/base/log/log.h"
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+
+namespace sxt::memr {
+//--------------------------------------------------------------------------------------------------
+// round_up_to_page
+//--------------------------------------------------------------------------------------------------
+static size_t round_up_to_page(size_t bytes, size_t page_size) noexcept {
+  return (bytes + page_size - 1u) & ~(page_size - 1u);
+}
+
+//--------------------------------------------------------------------------------------------------
+// map_transparent_huge_pages
+//--------------------------------------------------------------------------------------------------
+static void* map_transparent_huge_pages(size_t num_bytes, size_t page_size) noexcept {
+  // over-allocate so that the region can be aligned to the huge page size
+  auto num_mapped_bytes = num_bytes + page_size;
+  auto data = mmap(nullptr, num_mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                   -1, 0);
+  if (data == MAP_FAILED) {
+    baser::panic("mmap of {} bytes failed: {}", num_mapped_bytes, std::strerror(errno));
+  }
+  auto first = reinterpret_cast<uintptr_t>(data);
+  auto aligned_first = round_up_to_page(first, page_size);
+  auto last = first + num_mapped_bytes;
+  auto aligned_last = aligned_first + num_bytes;
+  if (aligned_first != first) {
+    munmap(data, aligned_first - first);
+  }
+  if (aligned_last != last) {
+    munmap(reinterpret_cast<void*>(aligned_last), last - aligned_last);
+  }
+  auto res = reinterpret_cast<void*>(aligned_first);
+  if (madvise(res, num_bytes, MADV_HUGEPAGE) != 0) {
+    basl::error("madvise(MADV_HUGEPAGE) failed: {}", std::strerror(errno));
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// constructor
+//--------------------------------------------------------------------------------------------------
+huge_page_resource::huge_page_resource(huge_page_size page_size) noexcept
+    : page_size_{static_cast<size_t>(page_size)} {}
+
+//--------------------------------------------------------------------------------------------------
+// do_allocate
+//--------------------------------------------------------------------------------------------------
+void* huge_page_resource::do_allocate(size_t bytes, size_t alignment) noexcept {
+  if (alignment > page_size_) {
+    baser::panic("huge_page_resource can't satisfy an alignment of {}", alignment);
+  }
+  auto num_bytes = round_up_to_page(std::max(bytes, size_t{1}), page_size_);
+  auto page_flag = static_cast<int>(std::countr_zero(page_size_)) << MAP_HUGE_SHIFT;
+  auto data = mmap(nullptr, num_bytes, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | page_flag, -1, 0);
+  if (data != MAP_FAILED) {
+    basl::info("allocated {} bytes with {} reserved huge pages", num_bytes,
+               num_bytes / page_size_);
+    return data;
+  }
+  basl::info("MAP_HUGETLB allocation of {} bytes failed ({}); falling back to transparent huge "
+             "pages",
+             num_bytes, std::strerror(errno));
+  ++num_transparent_allocations_;
+  return map_transparent_huge_pages(num_bytes, page_size_);
+}
+
+//--------------------------------------------------------------------------------------------------
+// do_deallocate
+//--------------------------------------------------------------------------------------------------
+void huge_page_resource::do_deallocate(void* ptr, size_t bytes, size_t /*alignment*/) noexcept {
+  // Buffers such as the sumcheck workspace are released every round, so don't scan
+  // /proc/self/smaps with count_huge_page_bytes here.
+  auto num_bytes = round_up_to_page(std::max(bytes, size_t{1}), page_size_);
+  if (munmap(ptr, num_bytes) != 0) {
+    baser::panic("munmap of {} bytes failed: {}", num_bytes, std::strerror(errno));
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// do_is_equal
+//--------------------------------------------------------------------------------------------------
+bool huge_page_resource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+//--------------------------------------------------------------------------------------------------
+// count_huge_page_bytes
+//--------------------------------------------------------------------------------------------------
+size_t count_huge_page_bytes(const void* ptr) noexcept {
+  std::ifstream in{"/proc/self/smaps"};
+  if (!in.good()) {
+    return 0;
+  }
+  auto address = reinterpret_cast<uintptr_t>(ptr);
+  bool in_mapping = false;
+  size_t res = 0;
+  std::string line;
+  while (std::getline(in, line)) {
+    // mapping headers start with the address range "first-last"
+    auto dash = line.find('-');
+    auto space = line.find(' ');
+    if (dash != std::string::npos && space != std::string::npos && dash < space &&
+        line.find(':') > space) {
+      if (in_mapping) {
+        break;
+      }
+      auto first = std::strtoull(line.c_str(), nullptr, 16);
+      auto last = std::strtoull(line.c_str() + dash + 1, nullptr, 16);
+      in_mapping = first <= address && address < last;
+      continue;
+    }
+    if (!in_mapping) {
+      continue;
+    }
+    auto colon = line.find(':');
+    auto key = std::string_view{line}.substr(0, colon);
+    if (key == "AnonHugePages" || key == "Shared_Hugetlb" || key == "Private_Hugetlb") {
+      res += std::strtoull(line.c_str() + colon + 1, nullptr, 10) * 1024u;
+    }
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// parse_huge_page_size
+//--------------------------------------------------------------------------------------------------
+std::optional<huge_page_size> parse_huge_page_size(std::string_view s) noexcept {
+  if (s.empty() || s == "0") {
+    return std::nullopt;
+  }
+  if (s == "1" || s == "2m" || s == "2M") {
+    return huge_page_size::two_megabytes;
+  }
+  if (s == "1g" || s == "1G") {
+    return huge_page_size::one_gigabyte;
+  }
+  baser::panic("invalid huge page setting {}", s);
+}
+
+//--------------------------------------------------------------------------------------------------
+// get_huge_page_resource
+//--------------------------------------------------------------------------------------------------
+huge_page_resource* get_huge_page_resource() noexcept {
+  // Use a heap allocated object that never gets deleted since we want this
+  // to be available for the program duration.
+  static huge_page_resource* resource = []() noexcept -> huge_page_resource* {
+    auto s = std::getenv("BLITZAR_HUGE_PAGES");
+    auto page_size = parse_huge_page_size(s == nullptr ? "" : s);
+    if (!page_size) {
+      return nullptr;
+    }
+    basl::info("using huge pages of {} bytes for large host buffers",
+               static_cast<size_t>(*page_size));
+    return new huge_page_resource{*page_size};
+  }();
+  return resource;
+}
+
+//--------------------------------------------------------------------------------------------------
+// get_huge_page_alloc
+//--------------------------------------------------------------------------------------------------
+basm::alloc_t get_huge_page_alloc(size_t num_bytes) noexcept {
+  auto resource = get_huge_page_resource();
+  if (resource == nullptr || num_bytes < resource->page_size()) {
+    return {};
+  }
+  return resource;
+}
+} // namespace sxt::memr
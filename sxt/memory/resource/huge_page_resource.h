@@ -0,0 +1,107 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <string_view>
+
+#include "sxt/base/memory/alloc.h"
+
+namespace sxt::memr {
+//--------------------------------------------------------------------------------------------------
+// huge_page_size
+//--------------------------------------------------------------------------------------------------
+enum class huge_page_size : size_t {
+  two_megabytes = size_t{1} << 21u,
+  one_gigabyte = size_t{1} << 30u,
+};
+
+//--------------------------------------------------------------------------------------------------
+// huge_page_resource
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host memory backed by huge pages.
+ *
+ * Allocations are first attempted with MAP_HUGETLB, which requires huge pages reserved by the
+ * system (see /proc/sys/vm/nr_hugepages). If none are available, we fall back to an anonymous
+ * mapping aligned to the huge page size and advise the kernel to back it with transparent huge
+ * pages.
+ */
+class huge_page_resource final : public std::pmr::memory_resource {
+public:
+  explicit huge_page_resource(huge_page_size page_size = huge_page_size::two_megabytes) noexcept;
+
+  size_t page_size() const noexcept { return page_size_; }
+
+  /**
+   * The number of allocations that fell back to transparent huge pages.
+   */
+  size_t num_transparent_allocations() const noexcept { return num_transparent_allocations_; }
+
+private:
+  size_t page_size_;
+  std::atomic<size_t> num_transparent_allocations_{0};
+
+  void* do_allocate(size_t bytes, size_t alignment) noexcept override;
+
+  void do_deallocate(void* ptr, size_t bytes, size_t alignment) noexcept override;
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+};
+
+//--------------------------------------------------------------------------------------------------
+// count_huge_page_bytes
+//--------------------------------------------------------------------------------------------------
+/**
+ * Count the bytes of the mapping containing ptr that are currently backed by huge pages, either
+ * reserved or transparent, as reported by /proc/self/smaps.
+ *
+ * Transparent huge pages are only assigned as memory is touched so the count can grow after
+ * allocation. The scan reads all of smaps, so keep it off hot paths.
+ */
+size_t count_huge_page_bytes(const void* ptr) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// parse_huge_page_size
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parse a huge page setting: "" or "0" disables huge pages, "1" or "2m" selects 2 MB pages and
+ * "1g" selects 1 GB pages.
+ */
+std::optional<huge_page_size> parse_huge_page_size(std::string_view s) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// get_huge_page_resource
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the huge page resource selected with the BLITZAR_HUGE_PAGES environment variable or
+ * nullptr if huge pages aren't enabled.
+ */
+huge_page_resource* get_huge_page_resource() noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// get_huge_page_alloc
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get an allocator for a host buffer of num_bytes bytes: the huge page resource if huge pages
+ * are enabled and the buffer spans at least one huge page, otherwise the default resource.
+ */
+basm::alloc_t get_huge_page_alloc(size_t num_bytes) noexcept;
+} // namespace sxt::memr
@@ -0,0 +1,83 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/memory/resource/huge_page_resource.h"
+
+#include <sys/mman.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::memr;
+
+TEST_CASE("we can allocate memory backed by huge pages") {
+  huge_page_resource resource;
+  REQUIRE(resource.page_size() == size_t{1} << 21u);
+
+  SECTION("we can allocate and write to memory") {
+    // check whether the system has reserved huge pages for us
+    auto num_bytes = 2 * resource.page_size();
+    auto probe = mmap(nullptr, num_bytes, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (21 << MAP_HUGE_SHIFT), -1, 0);
+    auto has_reserved_pages = probe != MAP_FAILED;
+    if (has_reserved_pages) {
+      munmap(probe, num_bytes);
+    }
+
+    auto n = size_t{3} << 20u;
+    auto data = static_cast<uint8_t*>(resource.allocate(n));
+    REQUIRE(reinterpret_cast<uintptr_t>(data) % resource.page_size() == 0);
+    std::memset(data, 1, n);
+    REQUIRE(data[0] == 1);
+    REQUIRE(data[n - 1] == 1);
+    if (has_reserved_pages) {
+      REQUIRE(resource.num_transparent_allocations() == 0);
+      REQUIRE(count_huge_page_bytes(data) == num_bytes);
+    } else {
+      REQUIRE(resource.num_transparent_allocations() == 1);
+      REQUIRE(count_huge_page_bytes(data) <= num_bytes);
+    }
+    resource.deallocate(data, n);
+  }
+
+  SECTION("we can make small allocations") {
+    auto data = static_cast<uint8_t*>(resource.allocate(1));
+    *data = 123;
+    REQUIRE(*data == 123);
+    resource.deallocate(data, 1);
+  }
+
+  SECTION("resources only compare equal to themselves") {
+    huge_page_resource other;
+    REQUIRE(resource.is_equal(resource));
+    REQUIRE(!resource.is_equal(other));
+  }
+}
+
+TEST_CASE("addresses outside of any mapping have no huge page bytes") {
+  REQUIRE(count_huge_page_bytes(nullptr) == 0);
+}
+
+TEST_CASE("we can parse huge page settings") {
+  REQUIRE(!parse_huge_page_size(""));
+  REQUIRE(!parse_huge_page_size("0"));
+  REQUIRE(parse_huge_page_size("1") == huge_page_size::two_megabytes);
+  REQUIRE(parse_huge_page_size("2m") == huge_page_size::two_megabytes);
+  REQUIRE(parse_huge_page_size("1g") == huge_page_size::one_gigabyte);
+}
@@ -39,5 +39,10 @@ struct exponent_sequence {
   // whether the elements are signed
   // Note: if signed, then element_nbytes must be <= 16
   int is_signed = 0;
+
+  // if not null, the sequence is sparse and indexes points to n generator indexes where
+  // element i is the exponent of generator indexes[i] and all other generators have a zero
+  // exponent
+  const uint64_t* indexes = nullptr;
 };
 } // namespace sxt::mtxb
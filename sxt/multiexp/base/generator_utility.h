@@ -17,6 +17,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 
 #include "sxt/base/container/blob_array.h"
@@ -45,4 +46,17 @@ void filter_generators(basct::span<T> dst, basct::cspan<T> src,
     dst[out_index++] = src[i];
   }
 }
+
+//--------------------------------------------------------------------------------------------------
+// gather_generators
+//--------------------------------------------------------------------------------------------------
+template <class T>
+void gather_generators(basct::span<T> dst, basct::cspan<T> src,
+                       basct::cspan<uint64_t> indexes) noexcept {
+  SXT_DEBUG_ASSERT(dst.size() == indexes.size());
+  for (size_t i = 0; i < indexes.size(); ++i) {
+    SXT_DEBUG_ASSERT(indexes[i] < src.size());
+    dst[i] = src[indexes[i]];
+  }
+}
 } // namespace sxt::mtxb
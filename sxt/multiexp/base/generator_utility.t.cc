@@ -48,3 +48,21 @@ TEST_CASE("we can copy over generators using a mask") {
     REQUIRE(res == expected);
   }
 }
+
+TEST_CASE("we can gather generators by index") {
+  std::vector<int> v = {1, 2, 3, 4};
+
+  SECTION("we handle an empty set of indexes") {
+    std::vector<int> res;
+    gather_generators<int>(res, v, {});
+    REQUIRE(res.empty());
+  }
+
+  SECTION("we gather generators in the order of the indexes") {
+    std::vector<uint64_t> indexes = {3, 0, 3};
+    std::vector<int> res(indexes.size());
+    gather_generators<int>(res, v, indexes);
+    std::vector<int> expected = {4, 1, 4};
+    REQUIRE(res == expected);
+  }
+}
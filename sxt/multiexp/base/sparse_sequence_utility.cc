@@ -0,0 +1,119 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/base/sparse_sequence_utility.h"
+
+#include <unordered_map>
+
+namespace sxt::mtxb {
+//--------------------------------------------------------------------------------------------------
+// has_sparse_sequences
+//--------------------------------------------------------------------------------------------------
+bool has_sparse_sequences(basct::cspan<exponent_sequence> sequences) noexcept {
+  return std::any_of(sequences.begin(), sequences.end(),
+                     [](const exponent_sequence& sequence) noexcept {
+                       return sequence.indexes != nullptr;
+                     });
+}
+
+//--------------------------------------------------------------------------------------------------
+// count_generators
+//--------------------------------------------------------------------------------------------------
+uint64_t count_generators(const exponent_sequence& sequence) noexcept {
+  if (sequence.indexes == nullptr) {
+    return sequence.n;
+  }
+  uint64_t res = 0;
+  for (uint64_t i = 0; i < sequence.n; ++i) {
+    res = std::max(res, sequence.indexes[i] + 1u);
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// group_sparse_sequences
+//--------------------------------------------------------------------------------------------------
+void group_sparse_sequences(std::vector<sparse_sequence_group>& groups,
+                            basct::cspan<exponent_sequence> sequences) noexcept {
+  groups.clear();
+  std::unordered_map<const uint64_t*, size_t> group_indexes;
+  for (size_t output_index = 0; output_index < sequences.size(); ++output_index) {
+    auto& sequence = sequences[output_index];
+    auto [iter, inserted] = group_indexes.try_emplace(sequence.indexes, groups.size());
+    if (inserted) {
+      groups.push_back({
+          .indexes = sequence.indexes,
+          .n = 0,
+          .output_indexes = {},
+      });
+    }
+    auto& group = groups[iter->second];
+    group.n = std::max(group.n, sequence.n);
+    group.output_indexes.push_back(output_index);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// compact_sparse_sequences
+//--------------------------------------------------------------------------------------------------
+void compact_sparse_sequences(std::vector<uint64_t>& generator_indexes,
+                              std::vector<uint64_t>& indexes_data,
+                              basct::span<exponent_sequence> sequences) noexcept {
+  std::vector<sparse_sequence_group> groups;
+  group_sparse_sequences(groups, sequences);
+
+  // dense sequences keep their generators at the front of the compacted list
+  uint64_t num_dense = 0;
+  size_t num_indexes = 0;
+  for (auto& group : groups) {
+    if (group.indexes == nullptr) {
+      num_dense = group.n;
+    } else {
+      num_indexes += group.n;
+    }
+  }
+  generator_indexes.resize(num_dense);
+  for (uint64_t i = 0; i < num_dense; ++i) {
+    generator_indexes[i] = i;
+  }
+
+  // rewrite the index arrays
+  indexes_data.resize(num_indexes);
+  std::unordered_map<uint64_t, uint64_t> positions;
+  auto out = indexes_data.data();
+  for (auto& group : groups) {
+    if (group.indexes == nullptr) {
+      continue;
+    }
+    for (uint64_t i = 0; i < group.n; ++i) {
+      auto index = group.indexes[i];
+      if (index < num_dense) {
+        out[i] = index;
+        continue;
+      }
+      auto [iter, inserted] = positions.try_emplace(index, generator_indexes.size());
+      if (inserted) {
+        generator_indexes.push_back(index);
+      }
+      out[i] = iter->second;
+    }
+    for (auto output_index : group.output_indexes) {
+      sequences[output_index].indexes = out;
+    }
+    out += group.n;
+  }
+}
+} // namespace sxt::mtxb
@@ -0,0 +1,131 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "sxt/base/container/span.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/base/generator_utility.h"
+
+namespace sxt::mtxb {
+//--------------------------------------------------------------------------------------------------
+// sparse_sequence_group
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sequences of a batch that share a set of generators.
+ *
+ * For sparse sequences, the group's generators are given by the first n entries of indexes; for
+ * dense sequences, indexes is null and the group uses the first n generators.
+ */
+struct sparse_sequence_group {
+  const uint64_t* indexes = nullptr;
+  uint64_t n = 0;
+  std::vector<size_t> output_indexes;
+};
+
+//--------------------------------------------------------------------------------------------------
+// has_sparse_sequences
+//--------------------------------------------------------------------------------------------------
+bool has_sparse_sequences(basct::cspan<exponent_sequence> sequences) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// count_generators
+//--------------------------------------------------------------------------------------------------
+/**
+ * The number of generators a sequence needs: n for a dense sequence and one more than the
+ * largest index for a sparse sequence.
+ */
+uint64_t count_generators(const exponent_sequence& sequence) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// group_sparse_sequences
+//--------------------------------------------------------------------------------------------------
+/**
+ * Group sequences by their index arrays so that each set of generators only needs to be gathered
+ * once. All dense sequences are placed in a single group.
+ */
+void group_sparse_sequences(std::vector<sparse_sequence_group>& groups,
+                            basct::cspan<exponent_sequence> sequences) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// compact_sparse_sequences
+//--------------------------------------------------------------------------------------------------
+/**
+ * Rewrite the index arrays of sparse sequences to refer to a compacted list of generators.
+ *
+ * On completion, generator j of the compacted list is generator generator_indexes[j] of the
+ * original list and the rewritten index arrays are stored in indexes_data. Dense sequences are
+ * left unchanged, so the compacted list starts with the generators they use.
+ *
+ * This lets callers that need to transform generators (e.g. convert them from affine
+ * coordinates) only touch those that are referenced.
+ */
+void compact_sparse_sequences(std::vector<uint64_t>& generator_indexes,
+                              std::vector<uint64_t>& indexes_data,
+                              basct::span<exponent_sequence> sequences) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// compute_sparse_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a multiexponentiation that can include sparse sequences by gathering the generators of
+ * each group of sparse sequences and invoking f with dense sequences.
+ *
+ * f has the signature
+ *    memmg::managed_array<T> f(basct::cspan<T> generators,
+ *                              basct::cspan<exponent_sequence> sequences)
+ * so that the work and memory of the computation scale with the number of stored elements
+ * rather than with the largest generator index.
+ */
+template <class T, class F>
+memmg::managed_array<T>
+compute_sparse_multiexponentiation(basct::cspan<T> generators,
+                                   basct::cspan<exponent_sequence> sequences, F f) noexcept {
+  if (!has_sparse_sequences(sequences)) {
+    return f(generators, sequences);
+  }
+  std::vector<sparse_sequence_group> groups;
+  group_sparse_sequences(groups, sequences);
+  memmg::managed_array<T> res(sequences.size());
+  std::vector<T> group_generators_data;
+  std::vector<exponent_sequence> group_sequences;
+  for (auto& group : groups) {
+    group_sequences.clear();
+    for (auto output_index : group.output_indexes) {
+      auto sequence = sequences[output_index];
+      sequence.indexes = nullptr;
+      group_sequences.push_back(sequence);
+    }
+    auto group_generators = generators;
+    if (group.indexes != nullptr) {
+      group_generators_data.resize(group.n);
+      gather_generators<T>(group_generators_data, generators, {group.indexes, group.n});
+      group_generators = group_generators_data;
+    }
+    auto values = f(group_generators, basct::cspan<exponent_sequence>{group_sequences});
+    for (size_t i = 0; i < values.size(); ++i) {
+      res[group.output_indexes[i]] = values[i];
+    }
+  }
+  return res;
+}
+} // namespace sxt::mtxb
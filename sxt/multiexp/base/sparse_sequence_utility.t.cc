@@ -0,0 +1,154 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/base/sparse_sequence_utility.h"
+
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::mtxb;
+
+TEST_CASE("we can count the generators used by a sequence") {
+  std::vector<uint8_t> values = {1, 2, 3};
+
+  SECTION("a dense sequence uses its first n generators") {
+    exponent_sequence seq{.element_nbytes = 1, .n = 3, .data = values.data()};
+    REQUIRE(count_generators(seq) == 3);
+  }
+
+  SECTION("a sparse sequence uses generators up to its largest index") {
+    std::vector<uint64_t> indexes = {10, 2, 7};
+    exponent_sequence seq{
+        .element_nbytes = 1, .n = 3, .data = values.data(), .indexes = indexes.data()};
+    REQUIRE(count_generators(seq) == 11);
+  }
+}
+
+TEST_CASE("we can group sequences by their index arrays") {
+  std::vector<uint8_t> values = {1, 2, 3};
+  std::vector<uint64_t> indexes1 = {5, 9, 11};
+  std::vector<uint64_t> indexes2 = {1, 4};
+  std::vector<sparse_sequence_group> groups;
+
+  SECTION("we handle a batch of dense sequences") {
+    std::vector<exponent_sequence> seqs = {
+        {.element_nbytes = 1, .n = 2, .data = values.data()},
+        {.element_nbytes = 1, .n = 3, .data = values.data()},
+    };
+    REQUIRE(!has_sparse_sequences(seqs));
+    group_sparse_sequences(groups, seqs);
+    REQUIRE(groups.size() == 1);
+    REQUIRE(groups[0].indexes == nullptr);
+    REQUIRE(groups[0].n == 3);
+    REQUIRE(groups[0].output_indexes == std::vector<size_t>{0, 1});
+  }
+
+  SECTION("sequences that share an index array are grouped together") {
+    std::vector<exponent_sequence> seqs = {
+        {.element_nbytes = 1, .n = 2, .data = values.data(), .indexes = indexes1.data()},
+        {.element_nbytes = 1, .n = 2, .data = values.data(), .indexes = indexes2.data()},
+        {.element_nbytes = 1, .n = 3, .data = values.data()},
+        {.element_nbytes = 1, .n = 3, .data = values.data(), .indexes = indexes1.data()},
+    };
+    REQUIRE(has_sparse_sequences(seqs));
+    group_sparse_sequences(groups, seqs);
+    REQUIRE(groups.size() == 3);
+    REQUIRE(groups[0].indexes == indexes1.data());
+    REQUIRE(groups[0].n == 3);
+    REQUIRE(groups[0].output_indexes == std::vector<size_t>{0, 3});
+    REQUIRE(groups[1].indexes == indexes2.data());
+    REQUIRE(groups[1].output_indexes == std::vector<size_t>{1});
+    REQUIRE(groups[2].indexes == nullptr);
+    REQUIRE(groups[2].output_indexes == std::vector<size_t>{2});
+  }
+}
+
+TEST_CASE("we can compact the generators referenced by sparse sequences") {
+  std::vector<uint8_t> values = {1, 2, 3};
+  std::vector<uint64_t> generator_indexes;
+  std::vector<uint64_t> indexes_data;
+
+  SECTION("we compact the indexes of a single sparse sequence") {
+    std::vector<uint64_t> indexes = {100, 7, 100};
+    std::vector<exponent_sequence> seqs = {
+        {.element_nbytes = 1, .n = 3, .data = values.data(), .indexes = indexes.data()},
+    };
+    compact_sparse_sequences(generator_indexes, indexes_data, seqs);
+    REQUIRE(generator_indexes == std::vector<uint64_t>{100, 7});
+    REQUIRE(seqs[0].indexes == indexes_data.data());
+    REQUIRE(indexes_data == std::vector<uint64_t>{0, 1, 0});
+  }
+
+  SECTION("the generators of dense sequences come first") {
+    std::vector<uint64_t> indexes1 = {1, 50};
+    std::vector<uint64_t> indexes2 = {60, 50};
+    std::vector<exponent_sequence> seqs = {
+        {.element_nbytes = 1, .n = 2, .data = values.data(), .indexes = indexes1.data()},
+        {.element_nbytes = 1, .n = 3, .data = values.data()},
+        {.element_nbytes = 1, .n = 2, .data = values.data(), .indexes = indexes2.data()},
+    };
+    compact_sparse_sequences(generator_indexes, indexes_data, seqs);
+    REQUIRE(generator_indexes == std::vector<uint64_t>{0, 1, 2, 50, 60});
+    REQUIRE(seqs[0].indexes == indexes_data.data());
+    REQUIRE(seqs[1].indexes == nullptr);
+    REQUIRE(seqs[2].indexes == indexes_data.data() + 2);
+    REQUIRE(indexes_data == std::vector<uint64_t>{1, 3, 4, 3});
+  }
+}
+
+TEST_CASE("we can compute multiexponentiations with sparse sequences") {
+  std::vector<int> generators = {1, 10, 100, 1000, 10000};
+  auto f = [](basct::cspan<int> gens, basct::cspan<exponent_sequence> seqs) noexcept {
+    memmg::managed_array<int> res(seqs.size());
+    for (size_t i = 0; i < seqs.size(); ++i) {
+      REQUIRE(seqs[i].indexes == nullptr);
+      res[i] = 0;
+      for (size_t j = 0; j < seqs[i].n; ++j) {
+        res[i] += gens[j] * seqs[i].data[j];
+      }
+    }
+    return res;
+  };
+  std::vector<uint8_t> values = {1, 2, 3};
+
+  SECTION("we handle dense sequences") {
+    std::vector<exponent_sequence> seqs = {
+        {.element_nbytes = 1, .n = 3, .data = values.data()},
+    };
+    auto res = compute_sparse_multiexponentiation<int>(generators, seqs, f);
+    REQUIRE(res.size() == 1);
+    REQUIRE(res[0] == 321);
+  }
+
+  SECTION("we handle a mix of sparse and dense sequences") {
+    std::vector<uint64_t> indexes1 = {4, 0};
+    std::vector<uint64_t> indexes2 = {3, 1, 2};
+    std::vector<exponent_sequence> seqs = {
+        {.element_nbytes = 1, .n = 2, .data = values.data(), .indexes = indexes1.data()},
+        {.element_nbytes = 1, .n = 2, .data = values.data()},
+        {.element_nbytes = 1, .n = 3, .data = values.data(), .indexes = indexes2.data()},
+        {.element_nbytes = 1, .n = 1, .data = values.data(), .indexes = indexes1.data()},
+    };
+    auto res = compute_sparse_multiexponentiation<int>(generators, seqs, f);
+    REQUIRE(res.size() == 4);
+    REQUIRE(res[0] == 10002);
+    REQUIRE(res[1] == 21);
+    REQUIRE(res[2] == 1320);
+    REQUIRE(res[3] == 10000);
+  }
+}
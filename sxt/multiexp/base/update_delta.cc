@@ -0,0 +1,66 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/base/update_delta.h"
+
+#include <cstring>
+
+#include "sxt/base/error/assert.h"
+
+namespace sxt::mtxb {
+//--------------------------------------------------------------------------------------------------
+// write_update_delta
+//--------------------------------------------------------------------------------------------------
+void write_update_delta(uint8_t* __restrict__ positive, uint8_t* __restrict__ negative,
+                        const uint8_t* __restrict__ new_value,
+                        const uint8_t* __restrict__ old_value, unsigned element_nbytes,
+                        bool is_signed) noexcept {
+  SXT_DEBUG_ASSERT(0 < element_nbytes && element_nbytes <= 32);
+  auto extension = [&](const uint8_t* value) noexcept -> unsigned {
+    if (value == nullptr || !is_signed || (value[element_nbytes - 1] & 0x80u) == 0) {
+      return 0;
+    }
+    return 0xffu;
+  };
+  auto new_extension = extension(new_value);
+  auto old_extension = extension(old_value);
+
+  // diff = new_value - old_value modulo 2^(8 * (element_nbytes + 1))
+  uint8_t diff[33];
+  unsigned borrow = 0;
+  for (unsigned byte_index = 0; byte_index <= element_nbytes; ++byte_index) {
+    unsigned x = byte_index < element_nbytes ? new_value[byte_index] : new_extension;
+    unsigned y = old_extension;
+    if (old_value != nullptr && byte_index < element_nbytes) {
+      y = old_value[byte_index];
+    }
+    auto d = x - y - borrow;
+    diff[byte_index] = static_cast<uint8_t>(d);
+    borrow = (d >> 8u) & 1u;
+  }
+
+  if ((diff[element_nbytes] & 0x80u) == 0) {
+    std::memcpy(positive, diff, element_nbytes);
+    return;
+  }
+  unsigned carry = 1;
+  for (unsigned byte_index = 0; byte_index < element_nbytes; ++byte_index) {
+    auto x = static_cast<unsigned>(static_cast<uint8_t>(~diff[byte_index])) + carry;
+    negative[byte_index] = static_cast<uint8_t>(x);
+    carry = x >> 8u;
+  }
+}
+} // namespace sxt::mtxb
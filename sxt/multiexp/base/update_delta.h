@@ -0,0 +1,36 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace sxt::mtxb {
+//--------------------------------------------------------------------------------------------------
+// write_update_delta
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write |new_value - old_value| to positive if the difference is non-negative and to negative
+ * otherwise, leaving the other untouched. A null old_value is taken to be zero.
+ *
+ * The values are extended to element_nbytes + 1 bytes before subtracting, so the magnitude of the
+ * difference always fits in element_nbytes bytes.
+ */
+void write_update_delta(uint8_t* __restrict__ positive, uint8_t* __restrict__ negative,
+                        const uint8_t* __restrict__ new_value,
+                        const uint8_t* __restrict__ old_value, unsigned element_nbytes,
+                        bool is_signed) noexcept;
+} // namespace sxt::mtxb
@@ -0,0 +1,71 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/base/update_delta.h"
+
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::mtxb;
+
+TEST_CASE("we can write the difference of two scalars as a magnitude and sign") {
+  std::vector<uint8_t> positive(2);
+  std::vector<uint8_t> negative(2);
+
+  SECTION("we handle non-negative unsigned differences") {
+    std::vector<uint8_t> new_value = {0x01, 0x02};
+    std::vector<uint8_t> old_value = {0x02, 0x01};
+    write_update_delta(positive.data(), negative.data(), new_value.data(), old_value.data(), 2,
+                       false);
+    REQUIRE(positive == std::vector<uint8_t>{0xff, 0x00});
+    REQUIRE(negative == std::vector<uint8_t>{0x00, 0x00});
+  }
+
+  SECTION("we handle negative unsigned differences") {
+    std::vector<uint8_t> new_value = {0x00, 0x00};
+    std::vector<uint8_t> old_value = {0xff, 0xff};
+    write_update_delta(positive.data(), negative.data(), new_value.data(), old_value.data(), 2,
+                       false);
+    REQUIRE(positive == std::vector<uint8_t>{0x00, 0x00});
+    REQUIRE(negative == std::vector<uint8_t>{0xff, 0xff});
+  }
+
+  SECTION("a null old value is treated as zero") {
+    std::vector<uint8_t> new_value = {0x03, 0x00};
+    write_update_delta(positive.data(), negative.data(), new_value.data(), nullptr, 2, false);
+    REQUIRE(positive == std::vector<uint8_t>{0x03, 0x00});
+    REQUIRE(negative == std::vector<uint8_t>{0x00, 0x00});
+  }
+
+  SECTION("we handle signed values whose difference needs an extra bit") {
+    // 127 - (-128) = 255
+    std::vector<uint8_t> new_value = {0x7f};
+    std::vector<uint8_t> old_value = {0x80};
+    write_update_delta(positive.data(), negative.data(), new_value.data(), old_value.data(), 1,
+                       true);
+    REQUIRE(positive[0] == 0xff);
+    REQUIRE(negative[0] == 0x00);
+
+    // -128 - 127 = -255
+    positive[0] = 0;
+    write_update_delta(positive.data(), negative.data(), old_value.data(), new_value.data(), 1,
+                       true);
+    REQUIRE(positive[0] == 0x00);
+    REQUIRE(negative[0] == 0xff);
+  }
+}
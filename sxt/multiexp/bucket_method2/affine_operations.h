@@ -0,0 +1,81 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "sxt/base/container/span.h"
+
+namespace sxt::mtxbk2 {
+//--------------------------------------------------------------------------------------------------
+// affine_accumulable
+//--------------------------------------------------------------------------------------------------
+/**
+ * Element types whose curve provides operations for accumulating buckets in affine form.
+ *
+ * Only short Weierstrass curves, where an affine addition with a shared inversion is cheaper than
+ * a projective addition, opt in. They do so explicitly by naming their affine type with an
+ * affine_element member in the curve's type header, so every translation unit selects the same
+ * accumulation path regardless of which headers it includes.
+ */
+template <class T>
+concept affine_accumulable = requires { typename T::affine_element; };
+
+//--------------------------------------------------------------------------------------------------
+// affine_operations_declared
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks that the operations an affine_accumulable type relies on are visible.
+ *
+ * The curve must provide batch_normalize, batch_add, neg, and mixed add overloads that participate
+ * in ADL. Code that accumulates affine buckets asserts this, so that a translation unit missing
+ * the curve's operation headers fails to compile instead of silently taking another path.
+ */
+template <class T>
+concept affine_operations_declared =
+    affine_accumulable<T> &&
+    requires(T& e, typename T::affine_element& a, basct::span<typename T::affine_element> res,
+             basct::cspan<typename T::affine_element> rhs, basct::cspan<T> points,
+             basct::span<decltype(T::X)> scratch) {
+      batch_normalize(res, points, scratch);
+      batch_add(res, rhs, scratch);
+      neg(a, a);
+      add(e, e, a);
+    };
+
+//--------------------------------------------------------------------------------------------------
+// affine_element_t
+//--------------------------------------------------------------------------------------------------
+/**
+ * The affine form of an element type, or the type itself if its curve has no affine operations.
+ */
+template <class T> struct affine_element_type {
+  using type = T;
+};
+
+template <affine_accumulable T> struct affine_element_type<T> {
+  using type = typename T::affine_element;
+};
+
+template <class T> using affine_element_t = typename affine_element_type<T>::type;
+
+//--------------------------------------------------------------------------------------------------
+// affine_field_t
+//--------------------------------------------------------------------------------------------------
+/**
+ * The field element type used as scratch space by batch_normalize and batch_add.
+ */
+template <affine_accumulable T> using affine_field_t = decltype(T::X);
+} // namespace sxt::mtxbk2
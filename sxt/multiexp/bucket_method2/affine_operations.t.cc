@@ -0,0 +1,44 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/bucket_method2/affine_operations.h"
+
+#include <type_traits>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve_bng1/type/element_p2.h"
+#include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/curve_gk/type/element_p2.h"
+
+using namespace sxt;
+using namespace sxt::mtxbk2;
+
+TEST_CASE("curves opt in to affine accumulation through their type headers") {
+  SECTION("short Weierstrass curves are accumulable without their operation headers") {
+    REQUIRE(affine_accumulable<cn1t::element_p2>);
+    REQUIRE(affine_accumulable<cg1t::element_p2>);
+    REQUIRE(affine_accumulable<cgkt::element_p2>);
+    REQUIRE(std::is_same_v<affine_element_t<cn1t::element_p2>, cn1t::element_affine>);
+    REQUIRE(std::is_same_v<affine_element_t<cg1t::element_p2>, cg1t::element_affine>);
+    REQUIRE(std::is_same_v<affine_element_t<cgkt::element_p2>, cgkt::element_affine>);
+  }
+
+  SECTION("curve21 elements are not accumulable") {
+    REQUIRE(!affine_accumulable<c21t::element_p3>);
+    REQUIRE(std::is_same_v<affine_element_t<c21t::element_p3>, c21t::element_p3>);
+  }
+}
@@ -0,0 +1,37 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/bucket_method2/cpu_multiexponentiation.h"
+
+namespace sxt::mtxbk2 {
+//--------------------------------------------------------------------------------------------------
+// prefer_cpu_bucket_method
+//--------------------------------------------------------------------------------------------------
+bool prefer_cpu_bucket_method(const mtxb::exponent_sequence& exponents) noexcept {
+  if (exponents.is_signed || exponents.n == 0) {
+    return false;
+  }
+  auto n = exponents.n;
+  auto element_num_bytes = exponents.element_nbytes;
+  auto bit_width = compute_signed_digit_bit_width(n, element_num_bytes);
+  auto bucket_cost = estimate_signed_bucket_cost(n, element_num_bytes, bit_width);
+
+  // Half the bits of a random scalar are set and the multiproduct solver roughly halves the
+  // remaining additions by sharing partial sums between the bitwise products.
+  auto bitwise_cost = n * element_num_bytes * 8u / 4u;
+  return bucket_cost < bitwise_cost;
+}
+} // namespace sxt::mtxbk2
@@ -0,0 +1,536 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/curve/batch_addable.h"
+#include "sxt/base/curve/element.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/base/iterator/split.h"
+#include "sxt/base/log/log.h"
+#include "sxt/base/num/divide_up.h"
+#include "sxt/base/system/cpu_features.h"
+#include "sxt/execution/cpu/for_each.h"
+#include "sxt/execution/cpu/thread_count.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/bucket_method2/affine_operations.h"
+#include "sxt/multiexp/bucket_method2/signed_digit.h"
+
+namespace sxt::mtxbk2 {
+//--------------------------------------------------------------------------------------------------
+// min_cpu_chunk_size_v
+//--------------------------------------------------------------------------------------------------
+static constexpr unsigned min_cpu_chunk_size_v = 1024;
+
+//--------------------------------------------------------------------------------------------------
+// min_affine_bit_width_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Affine accumulation needs enough buckets to fill a batch of independent additions so that the
+ * shared inversion is amortized.
+ */
+static constexpr unsigned min_affine_bit_width_v = 8;
+
+//--------------------------------------------------------------------------------------------------
+// min_affine_batch_size_v
+//--------------------------------------------------------------------------------------------------
+static constexpr unsigned min_affine_batch_size_v = 64;
+
+//--------------------------------------------------------------------------------------------------
+// min_batched_bit_width_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Narrower digits have too few buckets for batches of additions into distinct buckets to fill
+ * before they collide.
+ */
+static constexpr unsigned min_batched_bit_width_v = 8;
+
+//--------------------------------------------------------------------------------------------------
+// batched_add_size_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * The number of additions into distinct buckets gathered before handing them to a curve's
+ * batch_add_inplace.
+ */
+static constexpr unsigned batched_add_size_v = 64;
+
+//--------------------------------------------------------------------------------------------------
+// use_batched_buckets
+//--------------------------------------------------------------------------------------------------
+/**
+ * batch_add_inplace only computes additions in SIMD lanes when the host supports AVX2 or
+ * AVX-512 IFMA. Without them it adds one point at a time, and gathering the batches is pure
+ * overhead.
+ */
+inline bool use_batched_buckets(unsigned bit_width) noexcept {
+  return bit_width >= min_batched_bit_width_v &&
+         (bassy::host_cpu_features_v.avx2 || bassy::host_cpu_features_v.avx512_ifma);
+}
+
+//--------------------------------------------------------------------------------------------------
+// prefer_cpu_bucket_method
+//--------------------------------------------------------------------------------------------------
+/**
+ * Determine whether the signed digit bucket method is expected to take fewer curve operations
+ * than the bitwise multiproduct decomposition for an exponent sequence.
+ */
+bool prefer_cpu_bucket_method(const mtxb::exponent_sequence& exponents) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// accumulate_signed_buckets
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add each generator into the bucket of its signed digit starting at bit_index.
+ *
+ * Bucket i accumulates the generators with a digit of +(i+1) and the negated generators with a
+ * digit of -(i+1).
+ */
+template <bascrv::element T>
+void accumulate_signed_buckets(basct::span<T> buckets, basct::cspan<T> generators,
+                               const uint8_t* scalars, unsigned element_num_bytes,
+                               unsigned bit_index, unsigned bit_width) noexcept {
+  SXT_DEBUG_ASSERT(buckets.size() == 1u << (bit_width - 1u));
+  std::fill(buckets.begin(), buckets.end(), T::identity());
+  T t;
+  for (size_t i = 0; i < generators.size(); ++i) {
+    auto digit = extract_signed_digit(scalars + i * element_num_bytes, element_num_bytes,
+                                      bit_index, bit_width);
+    if (digit > 0) {
+      auto& bucket = buckets[digit - 1];
+      add(bucket, bucket, generators[i]);
+    } else if (digit < 0) {
+      auto& bucket = buckets[-digit - 1];
+      neg(t, generators[i]);
+      add(bucket, bucket, t);
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// affine_bucket_workspace
+//--------------------------------------------------------------------------------------------------
+/**
+ * Scratch memory for accumulate_affine_buckets so that a thread can reuse it across tasks.
+ */
+template <bascrv::element T> struct affine_bucket_workspace {};
+
+template <bascrv::element T>
+  requires affine_accumulable<T>
+struct affine_bucket_workspace<T> {
+  std::vector<affine_element_t<T>> sums;
+  std::vector<uint8_t> pending;
+  std::vector<unsigned> batch_buckets;
+  std::vector<affine_element_t<T>> lhs;
+  std::vector<affine_element_t<T>> rhs;
+  std::vector<affine_field_t<T>> scratch;
+};
+
+//--------------------------------------------------------------------------------------------------
+// accumulate_affine_buckets
+//--------------------------------------------------------------------------------------------------
+/**
+ * Equivalent to accumulate_signed_buckets but keeps the buckets in affine form.
+ *
+ * Additions into distinct buckets are gathered into a batch and applied together so that they
+ * share a single field inversion. A generator whose bucket already has a pending addition either
+ * flushes the batch, if it's large enough to amortize the inversion, or is added projectively into
+ * an overflow sum for the bucket.
+ */
+template <bascrv::element T>
+  requires affine_accumulable<T>
+void accumulate_affine_buckets(basct::span<T> buckets, affine_bucket_workspace<T>& workspace,
+                               basct::cspan<affine_element_t<T>> generators,
+                               const uint8_t* scalars, unsigned element_num_bytes,
+                               unsigned bit_index, unsigned bit_width) noexcept {
+  static_assert(affine_operations_declared<T>,
+                "include the curve's add, neg, and batch_add operation headers");
+  using A = affine_element_t<T>;
+  using F = affine_field_t<T>;
+  auto num_buckets = buckets.size();
+  SXT_DEBUG_ASSERT(num_buckets == 1u << (bit_width - 1u));
+  std::fill(buckets.begin(), buckets.end(), T::identity());
+  auto& sums = workspace.sums;
+  auto& pending = workspace.pending;
+  auto& batch_buckets = workspace.batch_buckets;
+  auto& lhs = workspace.lhs;
+  auto& rhs = workspace.rhs;
+  auto& scratch = workspace.scratch;
+  sums.assign(num_buckets, A::identity());
+  pending.assign(num_buckets, 0);
+  scratch.resize(num_buckets);
+  batch_buckets.clear();
+  lhs.clear();
+  rhs.clear();
+  batch_buckets.reserve(num_buckets);
+  lhs.reserve(num_buckets);
+  rhs.reserve(num_buckets);
+
+  auto flush = [&]() noexcept {
+    batch_add(basct::span<A>{lhs}, basct::cspan<A>{rhs}, basct::span<F>{scratch});
+    for (size_t i = 0; i < lhs.size(); ++i) {
+      sums[batch_buckets[i]] = lhs[i];
+      pending[batch_buckets[i]] = 0;
+    }
+    batch_buckets.clear();
+    lhs.clear();
+    rhs.clear();
+  };
+
+  auto schedule = [&](unsigned bucket_index, const A& e) noexcept {
+    if (pending[bucket_index]) {
+      if (lhs.size() < min_affine_batch_size_v) {
+        add(buckets[bucket_index], buckets[bucket_index], e);
+        return;
+      }
+      flush();
+    }
+    pending[bucket_index] = 1;
+    batch_buckets.push_back(bucket_index);
+    lhs.push_back(sums[bucket_index]);
+    rhs.push_back(e);
+    if (lhs.size() == num_buckets) {
+      flush();
+    }
+  };
+
+  A neg_e;
+  for (size_t i = 0; i < generators.size(); ++i) {
+    auto digit = extract_signed_digit(scalars + i * element_num_bytes, element_num_bytes,
+                                      bit_index, bit_width);
+    if (digit > 0) {
+      schedule(static_cast<unsigned>(digit - 1), generators[i]);
+    } else if (digit < 0) {
+      neg(neg_e, generators[i]);
+      schedule(static_cast<unsigned>(-digit - 1), neg_e);
+    }
+  }
+  flush();
+
+  // combine the affine sums with the overflow
+  for (size_t i = 0; i < num_buckets; ++i) {
+    add(buckets[i], buckets[i], sums[i]);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// batched_bucket_workspace
+//--------------------------------------------------------------------------------------------------
+/**
+ * Scratch memory for accumulate_batched_buckets so that a thread can reuse it across tasks.
+ */
+template <bascrv::element T> struct batched_bucket_workspace {};
+
+template <bascrv::element T>
+  requires bascrv::batch_addable<T>
+struct batched_bucket_workspace<T> {
+  std::vector<uint8_t> pending;
+  std::vector<unsigned> batch_buckets;
+  std::vector<T> lhs;
+  std::vector<T> rhs;
+};
+
+//--------------------------------------------------------------------------------------------------
+// accumulate_batched_buckets
+//--------------------------------------------------------------------------------------------------
+/**
+ * Equivalent to accumulate_signed_buckets for batch_addable curves.
+ *
+ * Additions into distinct buckets are gathered and applied together so that the curve can compute
+ * them in SIMD lanes. A generator whose bucket already has a pending addition flushes the batch.
+ */
+template <bascrv::element T>
+  requires bascrv::batch_addable<T>
+void accumulate_batched_buckets(basct::span<T> buckets, batched_bucket_workspace<T>& workspace,
+                                basct::cspan<T> generators, const uint8_t* scalars,
+                                unsigned element_num_bytes, unsigned bit_index,
+                                unsigned bit_width) noexcept {
+  static_assert(bascrv::batch_operations_declared<T>,
+                "include the curve's batch_add operation header");
+  auto num_buckets = buckets.size();
+  SXT_DEBUG_ASSERT(num_buckets == 1u << (bit_width - 1u));
+  std::fill(buckets.begin(), buckets.end(), T::identity());
+  auto& pending = workspace.pending;
+  auto& batch_buckets = workspace.batch_buckets;
+  auto& lhs = workspace.lhs;
+  auto& rhs = workspace.rhs;
+  pending.assign(num_buckets, 0);
+  batch_buckets.clear();
+  lhs.clear();
+  rhs.clear();
+  batch_buckets.reserve(batched_add_size_v);
+  lhs.reserve(batched_add_size_v);
+  rhs.reserve(batched_add_size_v);
+
+  auto flush = [&]() noexcept {
+    batch_add_inplace(basct::span<T>{lhs}, basct::cspan<T>{rhs});
+    for (size_t i = 0; i < lhs.size(); ++i) {
+      buckets[batch_buckets[i]] = lhs[i];
+      pending[batch_buckets[i]] = 0;
+    }
+    batch_buckets.clear();
+    lhs.clear();
+    rhs.clear();
+  };
+
+  auto schedule = [&](unsigned bucket_index, const T& e) noexcept {
+    if (pending[bucket_index]) {
+      flush();
+    }
+    pending[bucket_index] = 1;
+    batch_buckets.push_back(bucket_index);
+    lhs.push_back(buckets[bucket_index]);
+    rhs.push_back(e);
+    if (lhs.size() == batched_add_size_v) {
+      flush();
+    }
+  };
+
+  T neg_e;
+  for (size_t i = 0; i < generators.size(); ++i) {
+    auto digit = extract_signed_digit(scalars + i * element_num_bytes, element_num_bytes,
+                                      bit_index, bit_width);
+    if (digit > 0) {
+      schedule(static_cast<unsigned>(digit - 1), generators[i]);
+    } else if (digit < 0) {
+      neg(neg_e, generators[i]);
+      schedule(static_cast<unsigned>(-digit - 1), neg_e);
+    }
+  }
+  flush();
+}
+
+//--------------------------------------------------------------------------------------------------
+// reduce_signed_buckets
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute sum_i (i+1) buckets[i] using a running sum.
+ */
+template <bascrv::element T> void reduce_signed_buckets(T& res, basct::cspan<T> buckets) noexcept {
+  T sum = T::identity();
+  res = T::identity();
+  for (auto i = buckets.size(); i-- > 0;) {
+    add(sum, sum, buckets[i]);
+    add(res, res, sum);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// normalize_generators
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert generators to affine form, sharing one field inversion per chunk.
+ */
+template <bascrv::element T>
+  requires affine_accumulable<T>
+void normalize_generators(basct::span<affine_element_t<T>> res, basct::cspan<T> generators,
+                          unsigned num_threads) noexcept {
+  static_assert(affine_operations_declared<T>,
+                "include the curve's add, neg, and batch_add operation headers");
+  using F = affine_field_t<T>;
+  auto [chunk_first, chunk_last] = basit::split(basit::index_range{0, generators.size()},
+                                                {
+                                                    .min_chunk_size = min_cpu_chunk_size_v,
+                                                    .split_factor = num_threads,
+                                                });
+  xencpu::concurrent_for_each(
+      chunk_first, chunk_last,
+      [&](const basit::index_range& rng) noexcept {
+        std::vector<F> scratch(rng.size());
+        batch_normalize(res.subspan(rng.a(), rng.size()), generators.subspan(rng.a(), rng.size()),
+                        basct::span<F>{scratch});
+      },
+      num_threads);
+}
+
+//--------------------------------------------------------------------------------------------------
+// multiexponentiate_cpu
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a multi-exponentiation on the host using Pippenger's bucket method with signed digits.
+ *
+ * Each output is split into its digits and, when there are fewer digits than threads, into chunks
+ * of generators. Every (output, digit, chunk) triple is an independent task that accumulates and
+ * reduces its own buckets; the partial sums are then combined with doublings.
+ *
+ * For short Weierstrass curves, digits wide enough to fill batches accumulate their buckets in
+ * affine form with accumulate_affine_buckets. batch_addable curves, such as curve21, accumulate
+ * them with accumulate_batched_buckets instead when the host has the SIMD extensions that
+ * batch_add_inplace uses.
+ *
+ * A nonzero digit_bit_width overrides the digit width that compute_signed_digit_bit_width would
+ * choose for each output.
+ */
+template <bascrv::element T>
+void multiexponentiate_cpu(basct::span<T> res, basct::cspan<T> generators,
+                           basct::cspan<mtxb::exponent_sequence> exponents, unsigned num_threads,
+                           unsigned digit_bit_width = 0) noexcept {
+  auto num_outputs = res.size();
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+      exponents.size() == num_outputs &&
+      num_threads > 0 &&
+      digit_bit_width <= max_signed_digit_bit_width_v
+      // clang-format on
+  );
+  if (num_outputs == 0) {
+    return;
+  }
+
+  // plan the tasks for each output
+  size_t num_digits_total = 0;
+  std::vector<unsigned> bit_widths(num_outputs);
+  std::vector<unsigned> digit_counts(num_outputs);
+  for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+    auto& seq = exponents[output_index];
+    SXT_DEBUG_ASSERT(!seq.is_signed && seq.n <= generators.size());
+    bit_widths[output_index] = digit_bit_width > 0
+                                   ? digit_bit_width
+                                   : compute_signed_digit_bit_width(seq.n, seq.element_nbytes);
+    digit_counts[output_index] =
+        count_signed_digits(seq.element_nbytes, bit_widths[output_index]);
+    num_digits_total += digit_counts[output_index];
+  }
+  auto max_num_chunks = basn::divide_up<size_t>(num_threads, num_digits_total);
+  std::vector<size_t> chunk_counts(num_outputs);
+  std::vector<size_t> task_offsets(num_outputs + 1);
+  for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+    auto n = exponents[output_index].n;
+    chunk_counts[output_index] = std::clamp<size_t>(
+        basn::divide_up<size_t>(n, min_cpu_chunk_size_v), 1, max_num_chunks);
+    task_offsets[output_index + 1] =
+        task_offsets[output_index] + digit_counts[output_index] * chunk_counts[output_index];
+  }
+  auto num_tasks = task_offsets[num_outputs];
+  basl::info("computing a signed bucket multiexponentiation with {} outputs using {} tasks",
+             num_outputs, num_tasks);
+
+  // convert the generators to affine form if any output accumulates affine buckets
+  std::vector<affine_element_t<T>> affine_generators;
+  if constexpr (affine_accumulable<T>) {
+    size_t n = 0;
+    for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+      if (bit_widths[output_index] >= min_affine_bit_width_v) {
+        n = std::max<size_t>(n, exponents[output_index].n);
+      }
+    }
+    affine_generators.resize(n);
+    normalize_generators<T>(affine_generators, generators.subspan(0, n), num_threads);
+  }
+
+  // compute the partial sum of every task
+  memmg::managed_array<T> partial_sums(num_tasks);
+  auto [task_first, task_last] =
+      basit::split(basit::index_range{0, num_tasks}, {.split_factor = num_tasks});
+  xencpu::concurrent_for_each(
+      task_first, task_last,
+      [&](const basit::index_range& rng) noexcept {
+        memmg::managed_array<T> buckets;
+        [[maybe_unused]] affine_bucket_workspace<T> affine_workspace;
+        [[maybe_unused]] batched_bucket_workspace<T> batched_workspace;
+        for (auto task_index = rng.a(); task_index < rng.b(); ++task_index) {
+          auto output_index = static_cast<size_t>(
+              std::distance(task_offsets.begin(),
+                            std::upper_bound(task_offsets.begin(), task_offsets.end(),
+                                             task_index)) -
+              1);
+          auto& seq = exponents[output_index];
+          auto bit_width = bit_widths[output_index];
+          auto num_chunks = chunk_counts[output_index];
+          auto local_index = task_index - task_offsets[output_index];
+          auto digit_index = static_cast<unsigned>(local_index / num_chunks);
+          auto chunk_size = basn::divide_up<size_t>(seq.n, num_chunks);
+          auto first = std::min<size_t>(seq.n, (local_index % num_chunks) * chunk_size);
+          auto last = std::min<size_t>(seq.n, first + chunk_size);
+          buckets.resize(1u << (bit_width - 1u));
+          auto scalars = seq.data + first * seq.element_nbytes;
+          auto bit_index = digit_index * bit_width;
+          if constexpr (affine_accumulable<T>) {
+            if (bit_width >= min_affine_bit_width_v) {
+              accumulate_affine_buckets<T>(
+                  buckets, affine_workspace,
+                  basct::cspan<affine_element_t<T>>{affine_generators.data() + first, last - first},
+                  scalars, seq.element_nbytes, bit_index, bit_width);
+              reduce_signed_buckets<T>(partial_sums[task_index], buckets);
+              continue;
+            }
+          }
+          if constexpr (bascrv::batch_addable<T>) {
+            if (use_batched_buckets(bit_width)) {
+              accumulate_batched_buckets<T>(buckets, batched_workspace,
+                                            generators.subspan(first, last - first), scalars,
+                                            seq.element_nbytes, bit_index, bit_width);
+              reduce_signed_buckets<T>(partial_sums[task_index], buckets);
+              continue;
+            }
+          }
+          accumulate_signed_buckets<T>(buckets, generators.subspan(first, last - first), scalars,
+                                       seq.element_nbytes, bit_index, bit_width);
+          reduce_signed_buckets<T>(partial_sums[task_index], buckets);
+        }
+      },
+      num_threads);
+
+  // combine the digits of each output
+  for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+    auto bit_width = bit_widths[output_index];
+    auto num_chunks = chunk_counts[output_index];
+    auto sums = partial_sums.data() + task_offsets[output_index];
+    T reduction = T::identity();
+    for (auto digit_index = digit_counts[output_index]; digit_index-- > 0;) {
+      for (unsigned i = 0; i < bit_width; ++i) {
+        double_element(reduction, reduction);
+      }
+      for (size_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index) {
+        add(reduction, reduction, sums[digit_index * num_chunks + chunk_index]);
+      }
+    }
+    res[output_index] = reduction;
+  }
+  basl::info("completed signed bucket multiexponentiation with {} outputs", num_outputs);
+}
+
+//--------------------------------------------------------------------------------------------------
+// try_multiexponentiate_cpu
+//--------------------------------------------------------------------------------------------------
+/**
+ * Attempt to compute a multi-exponentiation on the host using the signed digit bucket method if
+ * the cost model suggests it will beat the bitwise multiproduct decomposition for every output;
+ * otherwise, return an empty array.
+ */
+template <bascrv::element T>
+memmg::managed_array<T>
+try_multiexponentiate_cpu(basct::cspan<T> generators,
+                          basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+  memmg::managed_array<T> res;
+  if (exponents.empty()) {
+    return res;
+  }
+  for (auto& seq : exponents) {
+    if (!prefer_cpu_bucket_method(seq)) {
+      return res;
+    }
+  }
+  res.resize(exponents.size());
+  multiexponentiate_cpu<T>(res, generators, exponents, xencpu::get_num_threads());
+  return res;
+}
+} // namespace sxt::mtxbk2
@@ -0,0 +1,259 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/bucket_method2/cpu_multiexponentiation.h"
+
+#include <random>
+#include <vector>
+
+#include "sxt/base/curve/example_element.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/batch_add.h"
+#include "sxt/curve21/operation/double.h"
+#include "sxt/curve21/operation/neg.h"
+#include "sxt/curve21/operation/overload.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve21/type/literal.h"
+#include "sxt/curve_bng1/constant/generator.h"
+#include "sxt/curve_bng1/operation/add.h"
+#include "sxt/curve_bng1/operation/batch_add.h"
+#include "sxt/curve_bng1/operation/double.h"
+#include "sxt/curve_bng1/operation/neg.h"
+#include "sxt/curve_bng1/type/element_affine.h"
+#include "sxt/curve_bng1/type/element_p2.h"
+
+using namespace sxt;
+using namespace sxt::mtxbk2;
+using c21t::operator""_c21;
+
+namespace {
+using E = bascrv::element97;
+
+E compute_expected(basct::cspan<E> generators, const mtxb::exponent_sequence& seq) noexcept {
+  unsigned res = 0;
+  for (size_t i = 0; i < seq.n; ++i) {
+    // reduce the little endian scalar modulo 97
+    unsigned x = 0;
+    for (unsigned byte_index = seq.element_nbytes; byte_index-- > 0;) {
+      x = (x * 256u + seq.data[i * seq.element_nbytes + byte_index]) % 97u;
+    }
+    res = (res + x * generators[i].value) % 97u;
+  }
+  return res;
+}
+} // namespace
+
+TEST_CASE("we can accumulate and reduce signed buckets") {
+  std::vector<E> generators = {3u, 5u, 7u};
+  std::vector<uint8_t> scalars = {1u, 3u, 2u};
+  std::vector<E> buckets(2);
+
+  // the digits are 1, -1 and -2
+
+  accumulate_signed_buckets<E>(buckets, generators, scalars.data(), 1, 0, 2);
+  REQUIRE(buckets[0] == 3u + (97u - 5u));
+  REQUIRE(buckets[1] == 97u - 7u);
+
+  E res;
+  reduce_signed_buckets<E>(res, buckets);
+  REQUIRE(res == 3u + (97u - 5u) + 2u * (97u - 7u));
+}
+
+TEST_CASE("we can compute multiexponentiations with the signed bucket method") {
+  std::mt19937 rng{0};
+  std::vector<E> generators(5000);
+  for (auto& g : generators) {
+    g = std::uniform_int_distribution<unsigned>{0, 96}(rng);
+  }
+  auto make_scalars = [&](unsigned element_num_bytes, size_t n) noexcept {
+    std::vector<uint8_t> res(element_num_bytes * n);
+    for (auto& x : res) {
+      x = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 255}(rng));
+    }
+    return res;
+  };
+
+  SECTION("we handle no outputs") {
+    std::vector<E> res;
+    multiexponentiate_cpu<E>(res, generators, {}, 4);
+  }
+
+  SECTION("we handle a single scalar") {
+    std::vector<uint8_t> scalars = {0xff, 0xff};
+    mtxb::exponent_sequence seq{.element_nbytes = 2, .n = 1, .data = scalars.data()};
+    std::vector<E> res(1);
+    multiexponentiate_cpu<E>(res, generators, {&seq, 1}, 1);
+    REQUIRE(res[0] == compute_expected(generators, seq));
+  }
+
+  SECTION("we handle outputs of different lengths and sizes") {
+    auto scalars1 = make_scalars(32, 100);
+    auto scalars2 = make_scalars(1, 3000);
+    auto scalars3 = make_scalars(8, 5000);
+    std::vector<mtxb::exponent_sequence> exponents = {
+        {.element_nbytes = 32, .n = 100, .data = scalars1.data()},
+        {.element_nbytes = 1, .n = 3000, .data = scalars2.data()},
+        {.element_nbytes = 8, .n = 5000, .data = scalars3.data()},
+    };
+    for (unsigned num_threads : {1u, 4u, 64u}) {
+      std::vector<E> res(3);
+      multiexponentiate_cpu<E>(res, generators, exponents, num_threads);
+      for (unsigned i = 0; i < 3; ++i) {
+        REQUIRE(res[i] == compute_expected(generators, exponents[i]));
+      }
+    }
+  }
+
+  SECTION("we only use the bucket method when the cost model prefers it") {
+    auto scalars = make_scalars(32, 5000);
+    mtxb::exponent_sequence seq{.element_nbytes = 32, .n = 5000, .data = scalars.data()};
+    REQUIRE(prefer_cpu_bucket_method(seq));
+    auto res = try_multiexponentiate_cpu<E>(generators, {&seq, 1});
+    REQUIRE(res.size() == 1);
+    REQUIRE(res[0] == compute_expected(generators, seq));
+
+    seq.n = 1;
+    REQUIRE(!prefer_cpu_bucket_method(seq));
+    REQUIRE(try_multiexponentiate_cpu<E>(generators, {&seq, 1}).empty());
+
+    seq.n = 5000;
+    seq.element_nbytes = 16;
+    seq.is_signed = 1;
+    REQUIRE(!prefer_cpu_bucket_method(seq));
+  }
+}
+
+TEST_CASE("we can compute multiexponentiations with curve-21") {
+  std::vector<c21t::element_p3> generators = {0x123_c21, 0x456_c21};
+  std::vector<uint64_t> scalars = {0xfedcba9876543210ull, 0x8000000000000001ull};
+  mtxb::exponent_sequence seq{
+      .element_nbytes = 8,
+      .n = 2,
+      .data = reinterpret_cast<const uint8_t*>(scalars.data()),
+  };
+  std::vector<c21t::element_p3> res(1);
+  multiexponentiate_cpu<c21t::element_p3>(res, generators, {&seq, 1}, 2);
+  REQUIRE(res[0] == scalars[0] * generators[0] + scalars[1] * generators[1]);
+
+  SECTION("we can compute multiexponentiations with digits wide enough to batch additions") {
+    multiexponentiate_cpu<c21t::element_p3>(res, generators, {&seq, 1}, 2, 8);
+    REQUIRE(res[0] == scalars[0] * generators[0] + scalars[1] * generators[1]);
+  }
+}
+
+TEST_CASE("we can accumulate curve-21 buckets in batches") {
+  using T = c21t::element_p3;
+  std::mt19937 rng{0};
+  const size_t n = 300;
+  std::vector<T> generators(n);
+  generators[0] = 0x123_c21;
+  for (size_t i = 1; i < n; ++i) {
+    add(generators[i], generators[i - 1], 0x456_c21);
+  }
+
+  auto check = [&](const std::vector<uint8_t>& scalars, unsigned bit_width) noexcept {
+    auto num_buckets = 1u << (bit_width - 1u);
+    std::vector<T> expected(num_buckets);
+    std::vector<T> buckets(num_buckets);
+    batched_bucket_workspace<T> workspace;
+    for (unsigned digit_index = 0; digit_index < count_signed_digits(2, bit_width);
+         ++digit_index) {
+      auto bit_index = digit_index * bit_width;
+      accumulate_signed_buckets<T>(expected, generators, scalars.data(), 2, bit_index, bit_width);
+      accumulate_batched_buckets<T>(buckets, workspace, generators, scalars.data(), 2, bit_index,
+                                    bit_width);
+      REQUIRE(buckets == expected);
+    }
+  };
+
+  SECTION("we handle random scalars") {
+    std::vector<uint8_t> scalars(2 * n);
+    for (auto& x : scalars) {
+      x = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 255}(rng));
+    }
+    check(scalars, 8);
+    check(scalars, 10);
+  }
+
+  SECTION("we handle scalars that collide in the same bucket") {
+    std::vector<uint8_t> scalars(2 * n);
+    for (size_t i = 0; i < n; ++i) {
+      scalars[2 * i] = static_cast<uint8_t>(i % 3 == 0 ? 5 : i);
+    }
+    check(scalars, 8);
+  }
+}
+
+TEST_CASE("we can accumulate buckets in affine form") {
+  using T = cn1t::element_p2;
+  using A = cn1t::element_affine;
+  std::mt19937 rng{0};
+  const size_t n = 600;
+  std::vector<T> generators(n);
+  generators[0] = cn1cn::generator_p2_v;
+  for (size_t i = 1; i < n; ++i) {
+    double_element(generators[i], generators[i - 1]);
+    add(generators[i], generators[i], cn1cn::generator_p2_v);
+  }
+  std::vector<A> affine_generators(n);
+  normalize_generators<T>(affine_generators, generators, 4);
+
+  auto check = [&](const std::vector<uint8_t>& scalars, unsigned bit_width) noexcept {
+    auto num_buckets = 1u << (bit_width - 1u);
+    std::vector<T> expected(num_buckets);
+    std::vector<T> buckets(num_buckets);
+    affine_bucket_workspace<T> workspace;
+    for (unsigned digit_index = 0; digit_index < count_signed_digits(2, bit_width);
+         ++digit_index) {
+      auto bit_index = digit_index * bit_width;
+      accumulate_signed_buckets<T>(expected, generators, scalars.data(), 2, bit_index, bit_width);
+      accumulate_affine_buckets<T>(buckets, workspace, affine_generators, scalars.data(), 2,
+                                   bit_index, bit_width);
+      T lhs, rhs;
+      reduce_signed_buckets<T>(lhs, buckets);
+      reduce_signed_buckets<T>(rhs, expected);
+      REQUIRE(lhs == rhs);
+    }
+  };
+
+  SECTION("we handle random scalars") {
+    std::vector<uint8_t> scalars(2 * n);
+    for (auto& x : scalars) {
+      x = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 255}(rng));
+    }
+    check(scalars, 8);
+    check(scalars, 10);
+  }
+
+  SECTION("we handle scalars that collide in the same bucket") {
+    std::vector<uint8_t> scalars(2 * n);
+    for (size_t i = 0; i < n; ++i) {
+      scalars[2 * i] = static_cast<uint8_t>(i % 3 == 0 ? 5 : i);
+    }
+    check(scalars, 8);
+  }
+
+  SECTION("we handle repeated generators that double a bucket") {
+    std::fill(generators.begin(), generators.end(), cn1cn::generator_p2_v);
+    normalize_generators<T>(affine_generators, generators, 4);
+    std::vector<uint8_t> scalars(2 * n);
+    for (size_t i = 0; i < n; ++i) {
+      scalars[2 * i] = static_cast<uint8_t>(i % 200);
+    }
+    check(scalars, 8);
+  }
+}
@@ -0,0 +1,219 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/bucket_method2/histogram_multiexponentiation.h"
+
+#include <atomic>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+
+namespace sxt::mtxbk2 {
+//--------------------------------------------------------------------------------------------------
+// max_flat_num_bytes_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Magnitudes of at most this many bytes are indexed with a flat table instead of a hash map.
+ */
+static constexpr unsigned max_flat_num_bytes_v = 2;
+
+//--------------------------------------------------------------------------------------------------
+// value_index_table
+//--------------------------------------------------------------------------------------------------
+/**
+ * Assign consecutive indexes to distinct magnitudes in the order they're first inserted.
+ */
+class value_index_table {
+public:
+  explicit value_index_table(unsigned element_num_bytes) noexcept
+      : element_num_bytes_{element_num_bytes} {
+    if (element_num_bytes_ <= max_flat_num_bytes_v) {
+      flat_.resize(size_t{1} << (8u * element_num_bytes_), histogram_zero_index_v);
+    }
+  }
+
+  size_t size() const noexcept { return size_; }
+
+  /**
+   * Return the index of a magnitude and whether it was newly inserted.
+   */
+  std::pair<uint32_t, bool> insert(const uint8_t* magnitude) noexcept {
+    if (!flat_.empty()) {
+      size_t key = 0;
+      for (unsigned byte_index = element_num_bytes_; byte_index-- > 0;) {
+        key = (key << 8u) | magnitude[byte_index];
+      }
+      auto& index = flat_[key];
+      if (index != histogram_zero_index_v) {
+        return {index, false};
+      }
+      index = size_++;
+      return {index, true};
+    }
+    auto [iter, inserted] = hashed_.try_emplace(
+        std::string{reinterpret_cast<const char*>(magnitude), element_num_bytes_}, size_);
+    size_ += inserted;
+    return {iter->second, inserted};
+  }
+
+private:
+  unsigned element_num_bytes_;
+  uint32_t size_ = 0;
+  std::vector<uint32_t> flat_;
+  std::unordered_map<std::string, uint32_t> hashed_;
+};
+
+//--------------------------------------------------------------------------------------------------
+// index_values
+//--------------------------------------------------------------------------------------------------
+/**
+ * Index the distinct nonzero magnitudes of the rows in rng, stopping once there are more than
+ * max_num_values or stop is set.
+ *
+ * The magnitudes are appended to values in the order they're first seen, and if indexes isn't
+ * empty, it's filled with each row's index into values, tagged as in value_histogram.
+ */
+static size_t index_values(std::vector<uint8_t>& values, basct::span<uint32_t> indexes,
+                           const mtxb::exponent_sequence& exponents, basit::index_range rng,
+                           size_t max_num_values, const std::atomic<bool>* stop) noexcept {
+  auto element_num_bytes = exponents.element_nbytes;
+  value_index_table table{element_num_bytes};
+  std::vector<uint8_t> magnitude(element_num_bytes);
+  for (size_t i = rng.a(); i < rng.b(); ++i) {
+    auto value = exponents.data + i * element_num_bytes;
+    bool is_negative = exponents.is_signed != 0 && (value[element_num_bytes - 1] & 0x80u) != 0;
+    bool is_zero = true;
+    unsigned carry = 1;
+    for (unsigned byte_index = 0; byte_index < element_num_bytes; ++byte_index) {
+      unsigned byte = value[byte_index];
+      if (is_negative) {
+        byte = (~byte & 0xffu) + carry;
+        carry = byte >> 8u;
+        byte &= 0xffu;
+      }
+      magnitude[byte_index] = static_cast<uint8_t>(byte);
+      is_zero = is_zero && byte == 0;
+    }
+    if (is_zero) {
+      if (!indexes.empty()) {
+        indexes[i - rng.a()] = histogram_zero_index_v;
+      }
+      continue;
+    }
+    auto [index, inserted] = table.insert(magnitude.data());
+    if (inserted) {
+      if (table.size() > max_num_values ||
+          (stop != nullptr && stop->load(std::memory_order_relaxed))) {
+        return table.size();
+      }
+      values.insert(values.end(), magnitude.begin(), magnitude.end());
+    }
+    if (!indexes.empty()) {
+      indexes[i - rng.a()] = index | (is_negative ? histogram_sign_bit_v : 0u);
+    }
+  }
+  return table.size();
+}
+
+//--------------------------------------------------------------------------------------------------
+// make_value_histogram
+//--------------------------------------------------------------------------------------------------
+bool make_value_histogram(value_histogram& histogram, const mtxb::exponent_sequence& exponents,
+                          size_t max_num_values, unsigned num_threads) noexcept {
+  SXT_DEBUG_ASSERT(num_threads > 0);
+  auto element_num_bytes = exponents.element_nbytes;
+  histogram.values.clear();
+  histogram.indexes.resize(exponents.n);
+  if (exponents.n == 0) {
+    return true;
+  }
+
+  // index each chunk of rows on its own
+  auto [chunk_first, chunk_last] = basit::split(basit::index_range{0, exponents.n},
+                                                {
+                                                    .min_chunk_size = min_cpu_chunk_size_v,
+                                                    .split_factor = num_threads,
+                                                });
+  auto num_chunks = static_cast<size_t>(std::distance(chunk_first, chunk_last));
+  auto chunk_size = std::max<size_t>((*chunk_first).size(), 1);
+  std::vector<std::vector<uint8_t>> chunk_values(num_chunks);
+  std::atomic<bool> stop{false};
+  xencpu::concurrent_for_each(
+      chunk_first, chunk_last,
+      [&](const basit::index_range& rng) noexcept {
+        auto chunk_index = rng.a() / chunk_size;
+        auto num_values =
+            index_values(chunk_values[chunk_index],
+                         basct::span<uint32_t>{histogram.indexes.data() + rng.a(), rng.size()},
+                         exponents, rng, max_num_values, &stop);
+        if (num_values > max_num_values) {
+          stop.store(true, std::memory_order_relaxed);
+        }
+      },
+      num_threads);
+  if (stop.load()) {
+    return false;
+  }
+  if (num_chunks == 1) {
+    histogram.values = std::move(chunk_values[0]);
+    return true;
+  }
+
+  // merge the values of the chunks and remap the chunk indexes to the merged values
+  value_index_table table{element_num_bytes};
+  std::vector<std::vector<uint32_t>> chunk_remaps(num_chunks);
+  for (size_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index) {
+    auto& values = chunk_values[chunk_index];
+    auto& remap = chunk_remaps[chunk_index];
+    remap.resize(values.size() / element_num_bytes);
+    for (size_t value_index = 0; value_index < remap.size(); ++value_index) {
+      auto magnitude = values.data() + value_index * element_num_bytes;
+      auto [index, inserted] = table.insert(magnitude);
+      if (inserted) {
+        if (table.size() > max_num_values) {
+          return false;
+        }
+        histogram.values.insert(histogram.values.end(), magnitude,
+                                magnitude + element_num_bytes);
+      }
+      remap[value_index] = index;
+    }
+  }
+  xencpu::concurrent_for_each(
+      chunk_first, chunk_last,
+      [&](const basit::index_range& rng) noexcept {
+        auto& remap = chunk_remaps[rng.a() / chunk_size];
+        for (size_t i = rng.a(); i < rng.b(); ++i) {
+          auto& index = histogram.indexes[i];
+          if (index != histogram_zero_index_v) {
+            index = remap[index & ~histogram_sign_bit_v] | (index & histogram_sign_bit_v);
+          }
+        }
+      },
+      num_threads);
+  return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// count_distinct_values
+//--------------------------------------------------------------------------------------------------
+size_t count_distinct_values(const mtxb::exponent_sequence& exponents,
+                             size_t max_num_values) noexcept {
+  std::vector<uint8_t> values;
+  return index_values(values, {}, exponents, basit::index_range{0, exponents.n}, max_num_values,
+                      nullptr);
+}
+} // namespace sxt::mtxbk2
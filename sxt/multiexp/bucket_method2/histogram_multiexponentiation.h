@@ -0,0 +1,203 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/curve/element.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/base/iterator/split.h"
+#include "sxt/base/log/log.h"
+#include "sxt/execution/cpu/for_each.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/bucket_method2/cpu_multiexponentiation.h"
+
+namespace sxt::mtxbk2 {
+//--------------------------------------------------------------------------------------------------
+// max_histogram_num_values_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Columns with at most this many distinct nonzero magnitudes are considered low cardinality.
+ */
+static constexpr size_t max_histogram_num_values_v = 1024;
+
+//--------------------------------------------------------------------------------------------------
+// histogram_zero_index_v
+//--------------------------------------------------------------------------------------------------
+static constexpr uint32_t histogram_zero_index_v = std::numeric_limits<uint32_t>::max();
+
+//--------------------------------------------------------------------------------------------------
+// histogram_sign_bit_v
+//--------------------------------------------------------------------------------------------------
+static constexpr uint32_t histogram_sign_bit_v = 1u << 31u;
+
+//--------------------------------------------------------------------------------------------------
+// value_histogram
+//--------------------------------------------------------------------------------------------------
+/**
+ * The distinct nonzero magnitudes of a column together with the magnitude of each row.
+ *
+ * values packs the magnitudes as element_nbytes-byte little endian integers. indexes gives, for
+ * each row, either histogram_zero_index_v or the position of the row's magnitude in values with
+ * histogram_sign_bit_v set if the row is negative.
+ */
+struct value_histogram {
+  std::vector<uint8_t> values;
+  std::vector<uint32_t> indexes;
+};
+
+//--------------------------------------------------------------------------------------------------
+// make_value_histogram
+//--------------------------------------------------------------------------------------------------
+/**
+ * Build the histogram of a column, stopping and returning false once more than max_num_values
+ * distinct nonzero magnitudes are found.
+ *
+ * Chunks of rows are indexed on up to num_threads threads and then merged. Magnitudes of 1 or 2
+ * bytes are looked up in a flat table and wider ones in a hash map.
+ */
+bool make_value_histogram(value_histogram& histogram, const mtxb::exponent_sequence& exponents,
+                          size_t max_num_values = std::numeric_limits<size_t>::max(),
+                          unsigned num_threads = 1) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// count_distinct_values
+//--------------------------------------------------------------------------------------------------
+/**
+ * Count the distinct nonzero magnitudes of a column, stopping once the count exceeds
+ * max_num_values.
+ */
+size_t count_distinct_values(const mtxb::exponent_sequence& exponents,
+                             size_t max_num_values) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// accumulate_histogram_buckets
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add each generator into the bucket of its row's magnitude, negating it for negative rows.
+ */
+template <bascrv::element T>
+void accumulate_histogram_buckets(basct::span<T> buckets, basct::cspan<T> generators,
+                                  basct::cspan<uint32_t> indexes) noexcept {
+  SXT_DEBUG_ASSERT(generators.size() == indexes.size());
+  std::fill(buckets.begin(), buckets.end(), T::identity());
+  T t;
+  for (size_t i = 0; i < generators.size(); ++i) {
+    auto index = indexes[i];
+    if (index == histogram_zero_index_v) {
+      continue;
+    }
+    if (index & histogram_sign_bit_v) {
+      auto& bucket = buckets[index ^ histogram_sign_bit_v];
+      neg(t, generators[i]);
+      add(bucket, bucket, t);
+    } else {
+      auto& bucket = buckets[index];
+      add(bucket, bucket, generators[i]);
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// multiexponentiate_histogram_cpu
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a multi-exponentiation on the host by grouping generators by the value of their
+ * exponents.
+ *
+ * For each column, the generators of rows sharing a magnitude are summed in chunks across threads,
+ * which takes about one addition per row, and the column's commitment is then a multi-
+ * exponentiation of only the distinct magnitudes against those sums. This is efficient for low
+ * cardinality columns such as enums or status codes.
+ *
+ * histograms optionally holds the already built histogram of each column.
+ */
+template <bascrv::element T>
+void multiexponentiate_histogram_cpu(basct::span<T> res, basct::cspan<T> generators,
+                                     basct::cspan<mtxb::exponent_sequence> exponents,
+                                     unsigned num_threads,
+                                     basct::cspan<value_histogram> histograms = {}) noexcept {
+  auto num_outputs = res.size();
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+      exponents.size() == num_outputs && num_threads > 0 &&
+      (histograms.empty() || histograms.size() == num_outputs)
+      // clang-format on
+  );
+  basl::info("computing a histogram multiexponentiation with {} outputs", num_outputs);
+  value_histogram histogram_p;
+  std::vector<T> sums;
+  for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+    auto& seq = exponents[output_index];
+    SXT_DEBUG_ASSERT(seq.n <= generators.size());
+    const value_histogram* histogram = &histogram_p;
+    if (histograms.empty()) {
+      make_value_histogram(histogram_p, seq, std::numeric_limits<size_t>::max(), num_threads);
+    } else {
+      histogram = &histograms[output_index];
+      SXT_DEBUG_ASSERT(histogram->indexes.size() == seq.n);
+    }
+    size_t num_values = histogram->values.size() / seq.element_nbytes;
+    if (num_values == 0) {
+      res[output_index] = T::identity();
+      continue;
+    }
+
+    // sum the generators of each value
+    auto [chunk_first, chunk_last] = basit::split(basit::index_range{0, seq.n},
+                                                  {
+                                                      .min_chunk_size = min_cpu_chunk_size_v,
+                                                      .split_factor = num_threads,
+                                                  });
+    auto num_chunks = static_cast<size_t>(std::distance(chunk_first, chunk_last));
+    auto chunk_size = (*chunk_first).size();
+    std::vector<T> chunk_sums(num_chunks * num_values);
+    xencpu::concurrent_for_each(
+        chunk_first, chunk_last,
+        [&](const basit::index_range& rng) noexcept {
+          auto chunk_index = rng.a() / chunk_size;
+          accumulate_histogram_buckets<T>(
+              basct::span<T>{chunk_sums.data() + chunk_index * num_values, num_values},
+              generators.subspan(rng.a(), rng.size()),
+              basct::cspan<uint32_t>{histogram->indexes.data() + rng.a(), rng.size()});
+        },
+        num_threads);
+    sums.assign(chunk_sums.begin(), chunk_sums.begin() + num_values);
+    for (size_t chunk_index = 1; chunk_index < num_chunks; ++chunk_index) {
+      for (size_t value_index = 0; value_index < num_values; ++value_index) {
+        auto& sum = sums[value_index];
+        add(sum, sum, chunk_sums[chunk_index * num_values + value_index]);
+      }
+    }
+
+    // combine the sums with their values
+    mtxb::exponent_sequence values{
+        .element_nbytes = seq.element_nbytes,
+        .n = num_values,
+        .data = histogram->values.data(),
+    };
+    multiexponentiate_cpu<T>(res.subspan(output_index, 1), sums, {&values, 1}, num_threads);
+  }
+  basl::info("completed histogram multiexponentiation with {} outputs", num_outputs);
+}
+} // namespace sxt::mtxbk2
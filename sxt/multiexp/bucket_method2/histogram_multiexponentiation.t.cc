@@ -0,0 +1,205 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/bucket_method2/histogram_multiexponentiation.h"
+
+#include <random>
+#include <vector>
+
+#include "sxt/base/curve/example_element.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/batch_add.h"
+#include "sxt/curve21/operation/double.h"
+#include "sxt/curve21/operation/neg.h"
+#include "sxt/curve21/operation/overload.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve21/type/literal.h"
+
+using namespace sxt;
+using namespace sxt::mtxbk2;
+using c21t::operator""_c21;
+
+namespace {
+using E = bascrv::element97;
+
+E compute_expected(basct::cspan<E> generators, const mtxb::exponent_sequence& seq) noexcept {
+  int res = 0;
+  for (size_t i = 0; i < seq.n; ++i) {
+    // reduce the little endian two's complement scalar modulo 97
+    auto data = seq.data + i * seq.element_nbytes;
+    bool is_negative = seq.is_signed != 0 && (data[seq.element_nbytes - 1] & 0x80u) != 0;
+    int x = 0;
+    for (unsigned byte_index = seq.element_nbytes; byte_index-- > 0;) {
+      auto byte = is_negative ? (~data[byte_index] & 0xffu) : data[byte_index];
+      x = (x * 256 + static_cast<int>(byte)) % 97;
+    }
+    if (is_negative) {
+      x = -(x + 1);
+    }
+    res = (res + x * static_cast<int>(generators[i].value)) % 97;
+  }
+  return static_cast<unsigned>((res + 97) % 97);
+}
+} // namespace
+
+TEST_CASE("we can build value histograms") {
+  value_histogram histogram;
+
+  SECTION("we handle an empty column") {
+    mtxb::exponent_sequence seq{.element_nbytes = 4, .n = 0, .data = nullptr};
+    REQUIRE(make_value_histogram(histogram, seq));
+    REQUIRE(histogram.values.empty());
+    REQUIRE(histogram.indexes.empty());
+  }
+
+  SECTION("we group rows by value") {
+    std::vector<uint8_t> data = {3, 0, 0, 7, 3, 0};
+    mtxb::exponent_sequence seq{.element_nbytes = 2, .n = 3, .data = data.data()};
+    REQUIRE(make_value_histogram(histogram, seq));
+    REQUIRE(histogram.values == std::vector<uint8_t>{3, 0, 0, 7});
+    REQUIRE(histogram.indexes == std::vector<uint32_t>{0, 1, 0});
+    REQUIRE(count_distinct_values(seq, 10) == 2);
+  }
+
+  SECTION("we group rows by magnitude and sign") {
+    std::vector<uint8_t> data = {5, 0xfb, 0, 0x80};
+    mtxb::exponent_sequence seq{.element_nbytes = 1, .n = 4, .data = data.data(), .is_signed = 1};
+    REQUIRE(make_value_histogram(histogram, seq));
+    REQUIRE(histogram.values == std::vector<uint8_t>{5, 0x80});
+    REQUIRE(histogram.indexes ==
+            std::vector<uint32_t>{0, histogram_sign_bit_v, histogram_zero_index_v,
+                                  1 | histogram_sign_bit_v});
+  }
+
+  SECTION("we stop once there are too many values") {
+    std::vector<uint8_t> data = {1, 2, 3, 1};
+    mtxb::exponent_sequence seq{.element_nbytes = 1, .n = 4, .data = data.data()};
+    REQUIRE(!make_value_histogram(histogram, seq, 2));
+    REQUIRE(count_distinct_values(seq, 2) == 3);
+    REQUIRE(count_distinct_values(seq, 3) == 3);
+  }
+
+  SECTION("we get the same histogram with multiple threads") {
+    std::mt19937 rng{0};
+    for (unsigned element_num_bytes : {1u, 2u, 8u}) {
+      std::vector<uint8_t> data(element_num_bytes * 10'000);
+      for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = i % element_num_bytes == 0
+                      ? static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 20}(rng))
+                      : 0;
+      }
+      mtxb::exponent_sequence seq{
+          .element_nbytes = static_cast<uint8_t>(element_num_bytes),
+          .n = 10'000,
+          .data = data.data(),
+          .is_signed = 1,
+      };
+      REQUIRE(make_value_histogram(histogram, seq));
+      value_histogram histogram_p;
+      REQUIRE(make_value_histogram(histogram_p, seq, 100, 8));
+      REQUIRE(histogram_p.values == histogram.values);
+      REQUIRE(histogram_p.indexes == histogram.indexes);
+      REQUIRE(!make_value_histogram(histogram_p, seq, 10, 8));
+    }
+  }
+}
+
+TEST_CASE("we can compute multiexponentiations by grouping generators by value") {
+  std::mt19937 rng{0};
+  std::vector<E> generators(5000);
+  for (auto& g : generators) {
+    g = std::uniform_int_distribution<unsigned>{0, 96}(rng);
+  }
+  auto make_scalars = [&](unsigned element_num_bytes, size_t n, unsigned num_values) noexcept {
+    std::vector<uint8_t> values(element_num_bytes * num_values);
+    for (auto& x : values) {
+      x = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 255}(rng));
+    }
+    std::vector<uint8_t> res(element_num_bytes * n);
+    for (size_t i = 0; i < n; ++i) {
+      auto value_index = std::uniform_int_distribution<unsigned>{0, num_values - 1}(rng);
+      std::copy_n(values.data() + value_index * element_num_bytes, element_num_bytes,
+                  res.data() + i * element_num_bytes);
+    }
+    return res;
+  };
+
+  SECTION("we handle no outputs") {
+    std::vector<E> res;
+    multiexponentiate_histogram_cpu<E>(res, generators, {}, 4);
+  }
+
+  SECTION("we handle columns of zeros") {
+    std::vector<uint8_t> scalars(32 * 10);
+    mtxb::exponent_sequence seq{.element_nbytes = 32, .n = 10, .data = scalars.data()};
+    std::vector<E> res = {1u};
+    multiexponentiate_histogram_cpu<E>(res, generators, {&seq, 1}, 2);
+    REQUIRE(res[0] == 0u);
+  }
+
+  SECTION("we handle columns of different widths, signs, and lengths") {
+    auto scalars1 = make_scalars(32, 5000, 10);
+    auto scalars2 = make_scalars(8, 3000, 100);
+    auto scalars3 = make_scalars(16, 4500, 3);
+    auto scalars4 = make_scalars(1, 100, 2);
+    std::vector<mtxb::exponent_sequence> exponents = {
+        {.element_nbytes = 32, .n = 5000, .data = scalars1.data()},
+        {.element_nbytes = 8, .n = 3000, .data = scalars2.data(), .is_signed = 1},
+        {.element_nbytes = 16, .n = 4500, .data = scalars3.data(), .is_signed = 1},
+        {.element_nbytes = 1, .n = 100, .data = scalars4.data()},
+    };
+    for (unsigned num_threads : {1u, 4u, 64u}) {
+      std::vector<E> res(exponents.size());
+      multiexponentiate_histogram_cpu<E>(res, generators, exponents, num_threads);
+      for (size_t i = 0; i < exponents.size(); ++i) {
+        REQUIRE(res[i] == compute_expected(generators, exponents[i]));
+      }
+    }
+  }
+
+  SECTION("we can use histograms that are already built") {
+    auto scalars1 = make_scalars(32, 5000, 10);
+    auto scalars2 = make_scalars(2, 3000, 100);
+    std::vector<mtxb::exponent_sequence> exponents = {
+        {.element_nbytes = 32, .n = 5000, .data = scalars1.data()},
+        {.element_nbytes = 2, .n = 3000, .data = scalars2.data(), .is_signed = 1},
+    };
+    std::vector<value_histogram> histograms(exponents.size());
+    for (size_t i = 0; i < exponents.size(); ++i) {
+      REQUIRE(make_value_histogram(histograms[i], exponents[i], max_histogram_num_values_v, 4));
+    }
+    std::vector<E> res(exponents.size());
+    multiexponentiate_histogram_cpu<E>(res, generators, exponents, 4, histograms);
+    for (size_t i = 0; i < exponents.size(); ++i) {
+      REQUIRE(res[i] == compute_expected(generators, exponents[i]));
+    }
+  }
+}
+
+TEST_CASE("we can compute histogram multiexponentiations with curve-21") {
+  std::vector<c21t::element_p3> generators = {0x123_c21, 0x456_c21, 0x789_c21};
+  std::vector<int64_t> scalars = {-1000, 1000, -1000};
+  mtxb::exponent_sequence seq{
+      .element_nbytes = 8,
+      .n = 3,
+      .data = reinterpret_cast<const uint8_t*>(scalars.data()),
+      .is_signed = 1,
+  };
+  std::vector<c21t::element_p3> res(1);
+  multiexponentiate_histogram_cpu<c21t::element_p3>(res, generators, {&seq, 1}, 2);
+  REQUIRE(res[0] == 1000 * generators[1] - 1000 * (generators[0] + generators[2]));
+}
@@ -0,0 +1,44 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/bucket_method2/signed_digit.h"
+
+namespace sxt::mtxbk2 {
+//--------------------------------------------------------------------------------------------------
+// compute_signed_digit_bit_width
+//--------------------------------------------------------------------------------------------------
+unsigned compute_signed_digit_bit_width(uint64_t n, unsigned element_num_bytes) noexcept {
+  unsigned res = 1;
+  auto best_cost = estimate_signed_bucket_cost(n, element_num_bytes, 1);
+  for (unsigned bit_width = 2; bit_width <= max_signed_digit_bit_width_v; ++bit_width) {
+    auto cost = estimate_signed_bucket_cost(n, element_num_bytes, bit_width);
+    if (cost < best_cost) {
+      best_cost = cost;
+      res = bit_width;
+    }
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// estimate_signed_bucket_cost
+//--------------------------------------------------------------------------------------------------
+uint64_t estimate_signed_bucket_cost(uint64_t n, unsigned element_num_bytes,
+                                     unsigned bit_width) noexcept {
+  uint64_t num_digits = count_signed_digits(element_num_bytes, bit_width);
+  return num_digits * (n + (1ull << bit_width) + bit_width);
+}
+} // namespace sxt::mtxbk2
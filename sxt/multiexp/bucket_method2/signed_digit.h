@@ -0,0 +1,102 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace sxt::mtxbk2 {
+//--------------------------------------------------------------------------------------------------
+// max_signed_digit_bit_width_v
+//--------------------------------------------------------------------------------------------------
+static constexpr unsigned max_signed_digit_bit_width_v = 16;
+
+//--------------------------------------------------------------------------------------------------
+// count_signed_digits
+//--------------------------------------------------------------------------------------------------
+/**
+ * The number of signed digits of width bit_width needed to represent an unsigned scalar of
+ * element_num_bytes bytes.
+ *
+ * Because a digit can borrow from the digit above it, one more bit is needed than for the unsigned
+ * representation.
+ */
+inline unsigned count_signed_digits(unsigned element_num_bytes, unsigned bit_width) noexcept {
+  return element_num_bytes * 8u / bit_width + 1u;
+}
+
+//--------------------------------------------------------------------------------------------------
+// extract_signed_digit
+//--------------------------------------------------------------------------------------------------
+/**
+ * Extract the signed digit of width bit_width starting at bit_index from a little endian scalar.
+ *
+ * The digits d_j satisfy
+ *    scalar = sum_j d_j 2^{j * bit_width}    with    -2^{bit_width-1} <= d_j <= 2^{bit_width-1}
+ *
+ * A digit whose top bit is set borrows 2^bit_width from the digit above it, which in turn receives
+ * a carry of 1. Since the carry into a digit is just the top bit of the digit below it, each digit
+ * can be computed independently of the others.
+ */
+inline int extract_signed_digit(const uint8_t* scalar, unsigned element_num_bytes,
+                                unsigned bit_index, unsigned bit_width) noexcept {
+  auto num_bits = element_num_bytes * 8u;
+  auto get_bit = [&](unsigned i) noexcept -> unsigned {
+    if (i >= num_bits) {
+      return 0;
+    }
+    return (scalar[i / 8u] >> (i % 8u)) & 1u;
+  };
+
+  // raw bits
+  unsigned raw = 0;
+  auto byte_index = bit_index / 8u;
+  auto bit_offset = bit_index % 8u;
+  unsigned num_read_bits = 0;
+  while (num_read_bits < bit_width + bit_offset && byte_index < element_num_bytes) {
+    raw |= static_cast<unsigned>(scalar[byte_index++]) << num_read_bits;
+    num_read_bits += 8u;
+  }
+  raw = (raw >> bit_offset) & ((1u << bit_width) - 1u);
+
+  // carry and borrow
+  unsigned carry = bit_index > 0 ? get_bit(bit_index - 1u) : 0u;
+  unsigned borrow = get_bit(bit_index + bit_width - 1u);
+  return static_cast<int>(raw + carry) - static_cast<int>(borrow << bit_width);
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_signed_digit_bit_width
+//--------------------------------------------------------------------------------------------------
+/**
+ * Choose the digit width that minimizes the estimated number of curve additions for a signed
+ * digit bucket method of length n with scalars of element_num_bytes bytes.
+ */
+unsigned compute_signed_digit_bit_width(uint64_t n, unsigned element_num_bytes) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// estimate_signed_bucket_cost
+//--------------------------------------------------------------------------------------------------
+/**
+ * Estimate the number of curve operations a signed digit bucket method of length n with the
+ * given digit width performs.
+ *
+ * Each digit costs an addition per generator to accumulate plus two additions per bucket for the
+ * running sum reduction, and combining the digits takes bit_width doublings each.
+ */
+uint64_t estimate_signed_bucket_cost(uint64_t n, unsigned element_num_bytes,
+                                     unsigned bit_width) noexcept;
+} // namespace sxt::mtxbk2
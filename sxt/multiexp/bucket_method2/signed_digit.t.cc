@@ -0,0 +1,92 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/bucket_method2/signed_digit.h"
+
+#include <random>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::mtxbk2;
+
+TEST_CASE("we can extract signed digits from a scalar") {
+  std::vector<uint8_t> scalar(4);
+
+  SECTION("we handle zero") {
+    REQUIRE(extract_signed_digit(scalar.data(), 4, 0, 4) == 0);
+    REQUIRE(extract_signed_digit(scalar.data(), 4, 28, 4) == 0);
+  }
+
+  SECTION("we handle a digit without its top bit set") {
+    scalar[0] = 7;
+    REQUIRE(extract_signed_digit(scalar.data(), 4, 0, 4) == 7);
+    REQUIRE(extract_signed_digit(scalar.data(), 4, 4, 4) == 0);
+  }
+
+  SECTION("a digit with its top bit set borrows from the next digit") {
+    scalar[0] = 9;
+    REQUIRE(extract_signed_digit(scalar.data(), 4, 0, 4) == -7);
+    REQUIRE(extract_signed_digit(scalar.data(), 4, 4, 4) == 1);
+  }
+
+  SECTION("we handle digits that straddle bytes") {
+    scalar[0] = 0b11000000;
+    scalar[1] = 0b11;
+    REQUIRE(extract_signed_digit(scalar.data(), 4, 5, 5) == 0b11110 - 32);
+    REQUIRE(extract_signed_digit(scalar.data(), 4, 10, 5) == 1);
+  }
+
+  SECTION("the last digit absorbs the final carry") {
+    scalar = {0xff, 0xff, 0xff, 0xff};
+    auto n = count_signed_digits(4, 8);
+    REQUIRE(n == 5);
+    REQUIRE(extract_signed_digit(scalar.data(), 4, 0, 8) == -1);
+    REQUIRE(extract_signed_digit(scalar.data(), 4, 8, 8) == 0);
+    REQUIRE(extract_signed_digit(scalar.data(), 4, 32, 8) == 1);
+  }
+
+  SECTION("the digits recompose the scalar") {
+    std::mt19937 rng{0};
+    for (unsigned bit_width = 1; bit_width <= max_signed_digit_bit_width_v; ++bit_width) {
+      for (auto& x : scalar) {
+        x = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 255}(rng));
+      }
+      int64_t expected = scalar[0] | (scalar[1] << 8) | (scalar[2] << 16) |
+                         (static_cast<int64_t>(scalar[3]) << 24);
+      int64_t sum = 0;
+      auto num_digits = count_signed_digits(4, bit_width);
+      for (unsigned j = num_digits; j-- > 0;) {
+        auto d = extract_signed_digit(scalar.data(), 4, j * bit_width, bit_width);
+        REQUIRE(std::abs(d) <= (1 << (bit_width - 1)));
+        sum = sum * (int64_t{1} << bit_width) + d;
+      }
+      REQUIRE(sum == expected);
+    }
+  }
+}
+
+TEST_CASE("we can choose the width of signed digits") {
+  REQUIRE(compute_signed_digit_bit_width(1, 32) <= 2);
+  REQUIRE(compute_signed_digit_bit_width(1u << 20u, 32) >= 12);
+  REQUIRE(compute_signed_digit_bit_width(1u << 30u, 32) == max_signed_digit_bit_width_v);
+  for (unsigned bit_width = 1; bit_width <= max_signed_digit_bit_width_v; ++bit_width) {
+    auto n = 1000u;
+    REQUIRE(estimate_signed_bucket_cost(n, 32, compute_signed_digit_bit_width(n, 32)) <=
+            estimate_signed_bucket_cost(n, 32, bit_width));
+  }
+}
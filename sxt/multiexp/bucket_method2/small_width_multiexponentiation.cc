@@ -0,0 +1,50 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/bucket_method2/small_width_multiexponentiation.h"
+
+#include <cstdlib>
+
+namespace sxt::mtxbk2 {
+//--------------------------------------------------------------------------------------------------
+// compute_max_small_magnitude
+//--------------------------------------------------------------------------------------------------
+unsigned compute_max_small_magnitude(const mtxb::exponent_sequence& exponents) noexcept {
+  SXT_DEBUG_ASSERT(exponents.element_nbytes <= max_small_width_num_bytes_v);
+  unsigned res = 0;
+  for (size_t i = 0; i < exponents.n; ++i) {
+    auto value = read_small_value(exponents.data + i * exponents.element_nbytes,
+                                  exponents.element_nbytes, exponents.is_signed != 0);
+    res = std::max(res, static_cast<unsigned>(std::abs(value)));
+  }
+  return res;
+}
+
+unsigned compute_max_small_magnitude(basct::cspan<uint8_t> magnitudes,
+                                     unsigned element_num_bytes) noexcept {
+  SXT_DEBUG_ASSERT(element_num_bytes <= max_small_width_num_bytes_v &&
+                   magnitudes.size() % element_num_bytes == 0);
+  unsigned res = 0;
+  for (size_t i = 0; i < magnitudes.size(); i += element_num_bytes) {
+    unsigned magnitude = magnitudes[i];
+    if (element_num_bytes == 2) {
+      magnitude |= static_cast<unsigned>(magnitudes[i + 1]) << 8u;
+    }
+    res = std::max(res, magnitude);
+  }
+  return res;
+}
+} // namespace sxt::mtxbk2
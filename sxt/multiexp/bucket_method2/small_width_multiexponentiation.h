@@ -0,0 +1,262 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/curve/element.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/base/iterator/split.h"
+#include "sxt/base/log/log.h"
+#include "sxt/base/num/divide_up.h"
+#include "sxt/execution/cpu/for_each.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/bucket_method2/cpu_multiexponentiation.h"
+
+namespace sxt::mtxbk2 {
+//--------------------------------------------------------------------------------------------------
+// max_small_width_num_bytes_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Exponents of at most this many bytes are bucketed by their full value.
+ */
+static constexpr unsigned max_small_width_num_bytes_v = 2;
+
+//--------------------------------------------------------------------------------------------------
+// max_small_width_group_buckets_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Columns are batched into groups that share a pass over the generators for as long as their
+ * combined buckets stay within this bound.
+ */
+static constexpr size_t max_small_width_group_buckets_v = size_t{1} << 16;
+
+//--------------------------------------------------------------------------------------------------
+// read_small_value
+//--------------------------------------------------------------------------------------------------
+inline int32_t read_small_value(const uint8_t* data, unsigned element_num_bytes,
+                                bool is_signed) noexcept {
+  if (element_num_bytes == 1) {
+    return is_signed ? static_cast<int8_t>(data[0]) : data[0];
+  }
+  auto x = static_cast<uint16_t>(data[0] | (data[1] << 8u));
+  return is_signed ? static_cast<int16_t>(x) : x;
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_max_small_magnitude
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the largest absolute value of a sequence of small width exponents.
+ */
+unsigned compute_max_small_magnitude(const mtxb::exponent_sequence& exponents) noexcept;
+
+/**
+ * Compute the largest of a packed array of small width unsigned little endian magnitudes, such as
+ * the values of a mtxbk2::value_histogram, without scanning the exponents they came from.
+ */
+unsigned compute_max_small_magnitude(basct::cspan<uint8_t> magnitudes,
+                                     unsigned element_num_bytes) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// accumulate_small_width_buckets
+//--------------------------------------------------------------------------------------------------
+/**
+ * In a single pass over the generators, add each generator into the bucket of its exponent's value
+ * for every column of a group. Column j's buckets begin at bucket_offsets[j] and bucket i of a
+ * column accumulates the generators with an exponent of +(i+1) and the negated generators with an
+ * exponent of -(i+1).
+ *
+ * The generators start at index first of the exponent sequences.
+ */
+template <bascrv::element T>
+void accumulate_small_width_buckets(basct::span<T> buckets, basct::cspan<T> generators,
+                                    basct::cspan<mtxb::exponent_sequence> columns,
+                                    basct::cspan<size_t> bucket_offsets, size_t first) noexcept {
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+      bucket_offsets.size() == columns.size() + 1 &&
+      buckets.size() == bucket_offsets[columns.size()]
+      // clang-format on
+  );
+  std::fill(buckets.begin(), buckets.end(), T::identity());
+  T t;
+  for (size_t i = 0; i < generators.size(); ++i) {
+    auto index = first + i;
+    auto& g = generators[i];
+    for (size_t column_index = 0; column_index < columns.size(); ++column_index) {
+      auto& seq = columns[column_index];
+      if (index >= seq.n) {
+        continue;
+      }
+      auto value = read_small_value(seq.data + index * seq.element_nbytes, seq.element_nbytes,
+                                    seq.is_signed != 0);
+      if (value > 0) {
+        auto& bucket = buckets[bucket_offsets[column_index] + static_cast<size_t>(value - 1)];
+        add(bucket, bucket, g);
+      } else if (value < 0) {
+        auto& bucket = buckets[bucket_offsets[column_index] + static_cast<size_t>(-value - 1)];
+        neg(t, g);
+        add(bucket, bucket, t);
+      }
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// multiexponentiate_small_width_cpu
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a multi-exponentiation on the host for exponents of at most max_small_width_num_bytes_v
+ * bytes by bucketing generators by the full value of their exponents.
+ *
+ * Each column gets one bucket per possible magnitude up to its largest, so boolean columns reduce
+ * to a masked sum of the generators. Columns are batched into groups that share a single pass over
+ * the generators and each group is split into chunks of generators across threads. Every chunk's
+ * buckets are reduced with one running sum per column.
+ *
+ * max_magnitudes optionally holds the already computed compute_max_small_magnitude of each column.
+ */
+template <bascrv::element T>
+void multiexponentiate_small_width_cpu(basct::span<T> res, basct::cspan<T> generators,
+                                       basct::cspan<mtxb::exponent_sequence> exponents,
+                                       unsigned num_threads,
+                                       basct::cspan<unsigned> max_magnitudes = {}) noexcept {
+  auto num_outputs = res.size();
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+      exponents.size() == num_outputs && num_threads > 0 &&
+      (max_magnitudes.empty() || max_magnitudes.size() == num_outputs)
+      // clang-format on
+  );
+  if (num_outputs == 0) {
+    return;
+  }
+
+  // group the columns
+  std::vector<size_t> bucket_offsets(num_outputs + 1);
+  std::vector<size_t> group_offsets = {0};
+  for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+    auto& seq = exponents[output_index];
+    SXT_DEBUG_ASSERT(seq.element_nbytes <= max_small_width_num_bytes_v &&
+                     seq.n <= generators.size());
+    auto num_buckets = max_magnitudes.empty() ? compute_max_small_magnitude(seq)
+                                              : max_magnitudes[output_index];
+    auto group_first = group_offsets.back();
+    if (output_index > group_first &&
+        bucket_offsets[output_index] - bucket_offsets[group_first] + num_buckets >
+            max_small_width_group_buckets_v) {
+      group_offsets.push_back(output_index);
+    }
+    bucket_offsets[output_index + 1] = bucket_offsets[output_index] + num_buckets;
+  }
+  group_offsets.push_back(num_outputs);
+  auto num_groups = group_offsets.size() - 1;
+
+  // split each group into chunks of generators
+  std::vector<size_t> group_lengths(num_groups);
+  std::vector<size_t> chunk_sizes(num_groups);
+  std::vector<size_t> task_offsets(num_groups + 1);
+  std::vector<size_t> partial_offsets(num_groups + 1);
+  auto max_num_chunks = basn::divide_up<size_t>(num_threads, num_groups);
+  for (size_t group_index = 0; group_index < num_groups; ++group_index) {
+    auto column_first = group_offsets[group_index];
+    auto column_last = group_offsets[group_index + 1];
+    size_t n = 0;
+    for (auto i = column_first; i < column_last; ++i) {
+      n = std::max<size_t>(n, exponents[i].n);
+    }
+    auto num_buckets = bucket_offsets[column_last] - bucket_offsets[column_first];
+
+    // keep chunks large enough that reducing the buckets doesn't dominate accumulating them
+    auto min_chunk_size = std::max<size_t>(min_cpu_chunk_size_v, 2 * num_buckets);
+    auto num_chunks =
+        std::clamp<size_t>(basn::divide_up<size_t>(n, min_chunk_size), 1, max_num_chunks);
+    auto chunk_size = std::max<size_t>(basn::divide_up<size_t>(n, num_chunks), 1);
+    num_chunks = basn::divide_up<size_t>(n, chunk_size);
+    group_lengths[group_index] = n;
+    chunk_sizes[group_index] = chunk_size;
+    task_offsets[group_index + 1] = task_offsets[group_index] + num_chunks;
+    partial_offsets[group_index + 1] =
+        partial_offsets[group_index] + num_chunks * (column_last - column_first);
+  }
+  auto num_tasks = task_offsets[num_groups];
+  basl::info("computing a small width multiexponentiation with {} outputs in {} groups using {} "
+             "tasks",
+             num_outputs, num_groups, num_tasks);
+
+  // accumulate and reduce the buckets of every (group, chunk) task
+  std::vector<T> partial_sums(partial_offsets[num_groups]);
+  auto [task_first, task_last] =
+      basit::split(basit::index_range{0, num_tasks}, {.split_factor = num_tasks});
+  xencpu::concurrent_for_each(
+      task_first, task_last,
+      [&](const basit::index_range& rng) noexcept {
+        std::vector<T> buckets;
+        std::vector<size_t> offsets;
+        for (auto task_index = rng.a(); task_index < rng.b(); ++task_index) {
+          auto group_index = static_cast<size_t>(
+              std::distance(task_offsets.begin(),
+                            std::upper_bound(task_offsets.begin(), task_offsets.end(),
+                                             task_index)) -
+              1);
+          auto column_first = group_offsets[group_index];
+          auto num_columns = group_offsets[group_index + 1] - column_first;
+          auto chunk_index = task_index - task_offsets[group_index];
+          auto first = chunk_index * chunk_sizes[group_index];
+          auto last = std::min(first + chunk_sizes[group_index], group_lengths[group_index]);
+
+          // shift the bucket offsets to the start of the group
+          offsets.resize(num_columns + 1);
+          for (size_t i = 0; i <= num_columns; ++i) {
+            offsets[i] = bucket_offsets[column_first + i] - bucket_offsets[column_first];
+          }
+          buckets.resize(offsets.back());
+          accumulate_small_width_buckets<T>(buckets, generators.subspan(first, last - first),
+                                            exponents.subspan(column_first, num_columns), offsets,
+                                            first);
+          auto sums =
+              partial_sums.data() + partial_offsets[group_index] + chunk_index * num_columns;
+          for (size_t i = 0; i < num_columns; ++i) {
+            reduce_signed_buckets<T>(
+                sums[i], basct::cspan<T>{buckets.data() + offsets[i], offsets[i + 1] - offsets[i]});
+          }
+        }
+      },
+      num_threads);
+
+  // combine the chunks of each output
+  for (size_t group_index = 0; group_index < num_groups; ++group_index) {
+    auto column_first = group_offsets[group_index];
+    auto num_columns = group_offsets[group_index + 1] - column_first;
+    auto num_chunks = task_offsets[group_index + 1] - task_offsets[group_index];
+    auto sums = partial_sums.data() + partial_offsets[group_index];
+    for (size_t i = 0; i < num_columns; ++i) {
+      T sum = T::identity();
+      for (size_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index) {
+        add(sum, sum, sums[chunk_index * num_columns + i]);
+      }
+      res[column_first + i] = sum;
+    }
+  }
+  basl::info("completed small width multiexponentiation with {} outputs", num_outputs);
+}
+} // namespace sxt::mtxbk2
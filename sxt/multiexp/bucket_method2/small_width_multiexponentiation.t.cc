@@ -0,0 +1,190 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/bucket_method2/small_width_multiexponentiation.h"
+
+#include <random>
+#include <vector>
+
+#include "sxt/base/curve/example_element.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/double.h"
+#include "sxt/curve21/operation/neg.h"
+#include "sxt/curve21/operation/overload.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve21/type/literal.h"
+
+using namespace sxt;
+using namespace sxt::mtxbk2;
+using c21t::operator""_c21;
+
+namespace {
+using E = bascrv::element97;
+
+E compute_expected(basct::cspan<E> generators, const mtxb::exponent_sequence& seq) noexcept {
+  int res = 0;
+  for (size_t i = 0; i < seq.n; ++i) {
+    auto x = read_small_value(seq.data + i * seq.element_nbytes, seq.element_nbytes,
+                              seq.is_signed != 0);
+    res = (res + (x % 97) * static_cast<int>(generators[i].value)) % 97;
+  }
+  return static_cast<unsigned>((res + 97) % 97);
+}
+} // namespace
+
+TEST_CASE("we can read small width values") {
+  std::vector<uint8_t> data = {0xff, 0x80};
+  REQUIRE(read_small_value(data.data(), 1, false) == 255);
+  REQUIRE(read_small_value(data.data(), 1, true) == -1);
+  REQUIRE(read_small_value(data.data(), 2, false) == 0x80ff);
+  REQUIRE(read_small_value(data.data(), 2, true) == -0x7f01);
+
+  mtxb::exponent_sequence seq{.element_nbytes = 1, .n = 2, .data = data.data()};
+  REQUIRE(compute_max_small_magnitude(seq) == 255);
+  seq.is_signed = 1;
+  REQUIRE(compute_max_small_magnitude(seq) == 128);
+}
+
+TEST_CASE("we can compute the largest of packed small width magnitudes") {
+  std::vector<uint8_t> magnitudes;
+  REQUIRE(compute_max_small_magnitude(magnitudes, 1) == 0);
+  magnitudes = {3, 128, 7};
+  REQUIRE(compute_max_small_magnitude(magnitudes, 1) == 128);
+  magnitudes = {0xff, 0x00, 0x01, 0x80, 0x02, 0x00};
+  REQUIRE(compute_max_small_magnitude(magnitudes, 2) == 0x8001);
+}
+
+TEST_CASE("we can accumulate small width buckets for a group of columns") {
+  std::vector<E> generators = {3u, 5u, 7u};
+  std::vector<uint8_t> column1 = {1u, 0u, 1u};
+  std::vector<uint8_t> column2 = {2u, 0xffu};
+  std::vector<mtxb::exponent_sequence> columns = {
+      {.element_nbytes = 1, .n = 3, .data = column1.data()},
+      {.element_nbytes = 1, .n = 2, .data = column2.data(), .is_signed = 1},
+  };
+  std::vector<size_t> offsets = {0, 1, 3};
+  std::vector<E> buckets(3);
+  accumulate_small_width_buckets<E>(buckets, generators, columns, offsets, 0);
+  REQUIRE(buckets[0] == 3u + 7u);
+  REQUIRE(buckets[1] == 97u - 5u);
+  REQUIRE(buckets[2] == 3u);
+
+  // we can start part way through the sequences
+  buckets.resize(3);
+  accumulate_small_width_buckets<E>(buckets, basct::cspan<E>{generators}.subspan(1), columns,
+                                    offsets, 1);
+  REQUIRE(buckets[0] == 7u);
+  REQUIRE(buckets[1] == 97u - 5u);
+  REQUIRE(buckets[2] == 0u);
+}
+
+TEST_CASE("we can compute multiexponentiations of small width exponents") {
+  std::mt19937 rng{0};
+  std::vector<E> generators(5000);
+  for (auto& g : generators) {
+    g = std::uniform_int_distribution<unsigned>{0, 96}(rng);
+  }
+  auto make_scalars = [&](unsigned element_num_bytes, size_t n, unsigned max_byte) noexcept {
+    std::vector<uint8_t> res(element_num_bytes * n);
+    for (auto& x : res) {
+      x = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, max_byte}(rng));
+    }
+    return res;
+  };
+
+  SECTION("we handle no outputs") {
+    std::vector<E> res;
+    multiexponentiate_small_width_cpu<E>(res, generators, {}, 4);
+  }
+
+  SECTION("we handle columns of zeros and empty columns") {
+    std::vector<uint8_t> scalars(10);
+    std::vector<mtxb::exponent_sequence> exponents = {
+        {.element_nbytes = 1, .n = 10, .data = scalars.data()},
+        {.element_nbytes = 2, .n = 0, .data = scalars.data()},
+    };
+    std::vector<E> res = {1u, 1u};
+    multiexponentiate_small_width_cpu<E>(res, generators, exponents, 2);
+    REQUIRE(res[0] == 0u);
+    REQUIRE(res[1] == 0u);
+  }
+
+  SECTION("we handle boolean columns") {
+    auto scalars1 = make_scalars(1, 5000, 1);
+    auto scalars2 = make_scalars(1, 4000, 1);
+    std::vector<mtxb::exponent_sequence> exponents = {
+        {.element_nbytes = 1, .n = 5000, .data = scalars1.data()},
+        {.element_nbytes = 1, .n = 4000, .data = scalars2.data()},
+    };
+    for (unsigned num_threads : {1u, 3u, 16u}) {
+      std::vector<E> res(2);
+      multiexponentiate_small_width_cpu<E>(res, generators, exponents, num_threads);
+      REQUIRE(res[0] == compute_expected(generators, exponents[0]));
+      REQUIRE(res[1] == compute_expected(generators, exponents[1]));
+    }
+  }
+
+  SECTION("we handle a mix of widths, signs, and lengths") {
+    auto scalars1 = make_scalars(1, 5000, 255);
+    auto scalars2 = make_scalars(2, 3000, 255);
+    auto scalars3 = make_scalars(2, 4500, 255);
+    auto scalars4 = make_scalars(1, 100, 3);
+    auto scalars5 = make_scalars(2, 5000, 255);
+    std::vector<mtxb::exponent_sequence> exponents = {
+        {.element_nbytes = 1, .n = 5000, .data = scalars1.data(), .is_signed = 1},
+        {.element_nbytes = 2, .n = 3000, .data = scalars2.data()},
+        {.element_nbytes = 2, .n = 4500, .data = scalars3.data(), .is_signed = 1},
+        {.element_nbytes = 1, .n = 100, .data = scalars4.data()},
+        {.element_nbytes = 2, .n = 5000, .data = scalars5.data()},
+    };
+    for (unsigned num_threads : {1u, 4u, 64u}) {
+      std::vector<E> res(exponents.size());
+      multiexponentiate_small_width_cpu<E>(res, generators, exponents, num_threads);
+      for (size_t i = 0; i < exponents.size(); ++i) {
+        REQUIRE(res[i] == compute_expected(generators, exponents[i]));
+      }
+    }
+    std::vector<unsigned> max_magnitudes;
+    for (auto& seq : exponents) {
+      max_magnitudes.push_back(compute_max_small_magnitude(seq));
+    }
+    std::vector<E> res(exponents.size());
+    multiexponentiate_small_width_cpu<E>(res, generators, exponents, 4, max_magnitudes);
+    for (size_t i = 0; i < exponents.size(); ++i) {
+      REQUIRE(res[i] == compute_expected(generators, exponents[i]));
+    }
+  }
+}
+
+TEST_CASE("we can compute small width multiexponentiations with curve-21") {
+  std::vector<c21t::element_p3> generators = {0x123_c21, 0x456_c21, 0x789_c21};
+  std::vector<uint8_t> scalars = {1, 0, 1};
+  std::vector<int16_t> signed_scalars = {-300, 7, 0};
+  std::vector<mtxb::exponent_sequence> exponents = {
+      {.element_nbytes = 1, .n = 3, .data = scalars.data()},
+      {
+          .element_nbytes = 2,
+          .n = 3,
+          .data = reinterpret_cast<const uint8_t*>(signed_scalars.data()),
+          .is_signed = 1,
+      },
+  };
+  std::vector<c21t::element_p3> res(2);
+  multiexponentiate_small_width_cpu<c21t::element_p3>(res, generators, exponents, 2);
+  REQUIRE(res[0] == generators[0] + generators[2]);
+  REQUIRE(res[1] == 7 * generators[1] - 300 * generators[0]);
+}
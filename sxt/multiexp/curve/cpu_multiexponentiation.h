@@ -0,0 +1,141 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/curve/element.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/base/iterator/split.h"
+#include "sxt/execution/async/future.h"
+#include "sxt/execution/cpu/for_each.h"
+#include "sxt/execution/cpu/thread_count.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/curve/multiexponentiation_cpu_driver.h"
+#include "sxt/multiexp/curve/pippenger_multiproduct_solver.h"
+#include "sxt/multiexp/curve/straus_multiexponentiation.h"
+#include "sxt/multiexp/pippenger/multiexponentiation.h"
+
+namespace sxt::mtxcrv {
+//--------------------------------------------------------------------------------------------------
+// min_cpu_chunk_size_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Don't split a multiexponentiation into chunks of fewer generators than this as the per-chunk
+ * combination work would start to dominate.
+ */
+static constexpr size_t min_cpu_chunk_size_v = 1024;
+
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation_chunk
+//--------------------------------------------------------------------------------------------------
+template <bascrv::element Element>
+memmg::managed_array<Element>
+compute_multiexponentiation_chunk(basct::cspan<Element> generators,
+                                  basct::cspan<mtxb::exponent_sequence> exponents,
+                                  basit::index_range rng) noexcept {
+  std::vector<mtxb::exponent_sequence> chunk_exponents(exponents.begin(), exponents.end());
+  for (auto& seq : chunk_exponents) {
+    auto first = std::min(static_cast<size_t>(rng.a()), seq.n);
+    seq.data += seq.element_nbytes * first;
+    seq.n = std::min(static_cast<size_t>(rng.b()), seq.n) - first;
+  }
+  pippenger_multiproduct_solver<Element> solver;
+  multiexponentiation_cpu_driver<Element> driver{&solver};
+  auto chunk_generators = generators.subspan(rng.a(), rng.size());
+  return mtxpi::compute_multiexponentiation(driver,
+                                            {static_cast<const void*>(chunk_generators.data()),
+                                             chunk_generators.size(), sizeof(Element)},
+                                            chunk_exponents)
+      .value()
+      .template as_array<Element>();
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation_cpu
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a multiexponentiation on the host with multiple threads.
+ *
+ * Like async_compute_multiexponentiation does across GPUs, the generators are split into chunks
+ * and each chunk runs the Pippenger multiproduct pipeline on one of num_threads threads. The
+ * per-chunk outputs are then summed.
+ */
+template <bascrv::element Element>
+memmg::managed_array<Element>
+compute_multiexponentiation_cpu(basct::cspan<Element> generators,
+                                basct::cspan<mtxb::exponent_sequence> exponents,
+                                const basit::split_options& split_options,
+                                unsigned num_threads = xencpu::get_num_threads()) noexcept {
+  auto num_outputs = exponents.size();
+  size_t n = 0;
+  for (auto& seq : exponents) {
+    n = std::max(n, seq.n);
+  }
+  n = std::min(n, generators.size());
+  auto [chunk_first, chunk_last] = basit::split(basit::index_range{0, n}, split_options);
+  auto num_chunks = static_cast<size_t>(std::distance(chunk_first, chunk_last));
+  if (num_chunks <= 1) {
+    return compute_multiexponentiation_chunk<Element>(generators, exponents, {0, n});
+  }
+
+  // compute chunks
+  std::vector<memmg::managed_array<Element>> chunk_products(num_chunks);
+  auto [task_first, task_last] =
+      basit::split(basit::index_range{0, num_chunks}, {.max_chunk_size = 1});
+  xencpu::concurrent_for_each(
+      task_first, task_last,
+      [&](const basit::index_range& task) noexcept {
+        auto rng = *(chunk_first + static_cast<ptrdiff_t>(task.a()));
+        chunk_products[task.a()] =
+            compute_multiexponentiation_chunk<Element>(generators, exponents, rng);
+      },
+      num_threads);
+
+  // combine
+  auto res = std::move(chunk_products[0]);
+  for (size_t chunk_index = 1; chunk_index < num_chunks; ++chunk_index) {
+    auto& products = chunk_products[chunk_index];
+    for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+      add_inplace(res[output_index], products[output_index]);
+    }
+  }
+  return res;
+}
+
+/**
+ * Tiny multiexponentiations are computed with Straus's method instead.
+ */
+template <bascrv::element Element>
+memmg::managed_array<Element>
+compute_multiexponentiation_cpu(basct::cspan<Element> generators,
+                                basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+  auto res = try_multiexponentiate_straus<Element>(generators, exponents);
+  if (!res.empty()) {
+    return res;
+  }
+  return compute_multiexponentiation_cpu<Element>(generators, exponents,
+                                                  {
+                                                      .min_chunk_size = min_cpu_chunk_size_v,
+                                                      .split_factor = xencpu::get_num_threads(),
+                                                  });
+}
+} // namespace sxt::mtxcrv
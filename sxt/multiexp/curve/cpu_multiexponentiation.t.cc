@@ -0,0 +1,74 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/curve/cpu_multiexponentiation.h"
+
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/double.h"
+#include "sxt/curve21/operation/neg.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/multiexp/curve/multiexponentiation.h"
+#include "sxt/multiexp/test/multiexponentiation.h"
+#include "sxt/ristretto/random/element.h"
+
+using namespace sxt;
+using namespace sxt::mtxcrv;
+
+TEST_CASE("we can compute multiexponentiations on the host with multiple threads") {
+  std::mt19937 rng{97834978};
+
+  SECTION("we handle the general cases") {
+    auto f = [](basct::cspan<c21t::element_p3> generators,
+                basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+      return compute_multiexponentiation_cpu<c21t::element_p3>(generators, exponents);
+    };
+    mtxtst::exercise_multiexponentiation_fn(rng, f);
+  }
+
+  SECTION("we handle the general cases when split into small chunks") {
+    auto f = [](basct::cspan<c21t::element_p3> generators,
+                basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+      return compute_multiexponentiation_cpu<c21t::element_p3>(generators, exponents,
+                                                               {.split_factor = 3});
+    };
+    mtxtst::exercise_multiexponentiation_fn(rng, f);
+  }
+
+  SECTION("we match the single threaded computation for outputs of varying length") {
+    std::vector<c21t::element_p3> generators(5000);
+    rstrn::generate_random_elements(generators, rng);
+    std::vector<uint8_t> data1(2 * generators.size());
+    std::vector<uint8_t> data2(32 * 2000);
+    std::vector<uint8_t> data3(700);
+    for (auto data : {&data1, &data2, &data3}) {
+      for (auto& x : *data) {
+        x = static_cast<uint8_t>(rng());
+      }
+    }
+    std::vector<mtxb::exponent_sequence> exponents = {
+        {.element_nbytes = 2, .n = generators.size(), .data = data1.data()},
+        {.element_nbytes = 32, .n = 2000, .data = data2.data()},
+        {.element_nbytes = 1, .n = 700, .data = data3.data(), .is_signed = 1},
+    };
+    auto res = compute_multiexponentiation_cpu<c21t::element_p3>(
+        generators, exponents, {.min_chunk_size = 256, .split_factor = 8});
+    auto expected = compute_multiexponentiation<c21t::element_p3>(generators, exponents);
+    REQUIRE(res == expected);
+  }
+}
@@ -43,6 +43,7 @@
 #include "sxt/multiexp/curve/multiproduct.h"
 #include "sxt/multiexp/curve/multiproducts_combination.h"
 #include "sxt/multiexp/curve/pippenger_multiproduct_solver.h"
+#include "sxt/multiexp/curve/straus_multiexponentiation.h"
 #include "sxt/multiexp/pippenger/multiexponentiation.h"
 #include "sxt/multiexp/pippenger/multiproduct_decomposition_gpu.h"
 
@@ -129,6 +130,12 @@ template <bascrv::element Element>
 memmg::managed_array<Element>
 compute_multiexponentiation(basct::cspan<Element> generators,
                             basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+  // tiny multiexponentiations don't need a multiproduct table
+  auto res = try_multiexponentiate_straus<Element>(generators, exponents);
+  if (!res.empty()) {
+    return res;
+  }
+
   pippenger_multiproduct_solver<Element> solver;
   multiexponentiation_cpu_driver<Element> driver{&solver};
   // Note: the cpu driver is non-blocking so that the future upon return the future is
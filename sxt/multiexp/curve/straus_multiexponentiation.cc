@@ -0,0 +1,78 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/curve/straus_multiexponentiation.h"
+
+#include <algorithm>
+
+namespace sxt::mtxcrv {
+//--------------------------------------------------------------------------------------------------
+// read_bits
+//--------------------------------------------------------------------------------------------------
+static unsigned read_bits(const uint8_t* scalar, unsigned num_bytes, unsigned bit_index,
+                          unsigned num_bits) noexcept {
+  unsigned res = 0;
+  for (unsigned i = 0; i < num_bits; ++i) {
+    auto byte_index = (bit_index + i) / 8u;
+    if (byte_index >= num_bytes) {
+      break;
+    }
+    res |= static_cast<unsigned>((scalar[byte_index] >> ((bit_index + i) % 8u)) & 1u) << i;
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_wnaf
+//--------------------------------------------------------------------------------------------------
+unsigned compute_wnaf(basct::span<int8_t> digits, const uint8_t* scalar, unsigned num_bytes,
+                      bool is_signed) noexcept {
+  constexpr unsigned w = straus_window_width_v;
+  auto num_bits = num_bytes * 8u;
+  SXT_DEBUG_ASSERT(num_bytes <= 32 && digits.size() >= num_bits + 1u);
+
+  // signed scalars are converted to their magnitude
+  uint8_t magnitude[32];
+  bool is_negative = is_signed && (scalar[num_bytes - 1u] & 0x80u) != 0;
+  if (is_negative) {
+    unsigned carry = 1;
+    for (unsigned i = 0; i < num_bytes; ++i) {
+      carry += static_cast<uint8_t>(~scalar[i]);
+      magnitude[i] = static_cast<uint8_t>(carry);
+      carry >>= 8u;
+    }
+    scalar = magnitude;
+  }
+
+  std::fill_n(digits.begin(), num_bits + 1u, 0);
+  unsigned num_digits = 0;
+  unsigned carry = 0;
+  unsigned bit_index = 0;
+  while (bit_index <= num_bits) {
+    if (read_bits(scalar, num_bytes, bit_index, 1) == carry) {
+      ++bit_index;
+      continue;
+    }
+    auto window = static_cast<int>(read_bits(scalar, num_bytes, bit_index, w) + carry);
+    carry = static_cast<unsigned>(window >> (w - 1u)) & 1u;
+    auto digit = window - static_cast<int>(carry << w);
+    digits[bit_index] = static_cast<int8_t>(is_negative ? -digit : digit);
+    num_digits = bit_index + 1u;
+    bit_index += w;
+  }
+  return num_digits;
+}
+} // namespace sxt::mtxcrv
@@ -0,0 +1,156 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/container/stack_array.h"
+#include "sxt/base/curve/element.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+
+namespace sxt::mtxcrv {
+//--------------------------------------------------------------------------------------------------
+// straus_window_width_v
+//--------------------------------------------------------------------------------------------------
+static constexpr unsigned straus_window_width_v = 4;
+
+//--------------------------------------------------------------------------------------------------
+// straus_max_num_generators_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Multiexponentiations with at most this many generators are cheaper to compute with Straus's
+ * method than by building a multiproduct table.
+ */
+static constexpr size_t straus_max_num_generators_v = 16;
+
+//--------------------------------------------------------------------------------------------------
+// straus_max_num_digits_v
+//--------------------------------------------------------------------------------------------------
+static constexpr unsigned straus_max_num_digits_v = 32u * 8u + 1u;
+
+//--------------------------------------------------------------------------------------------------
+// compute_wnaf
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the width-straus_window_width_v non-adjacent form of a little endian scalar into digits
+ * and return the number of digits up to the last non-zero digit.
+ *
+ * Every non-zero digit is odd and lies in the range (-2^(w-1), 2^(w-1)). If is_signed is true,
+ * the scalar is interpreted as a two's complement integer.
+ */
+unsigned compute_wnaf(basct::span<int8_t> digits, const uint8_t* scalar, unsigned num_bytes,
+                      bool is_signed) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// multiexponentiate_straus
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a multiexponentiation with Straus's interleaved double-and-add over wNAF digits.
+ *
+ * Odd multiples of each generator are precomputed once and shared by every output. All of the
+ * scratch memory lives on the stack so no heap allocation is made.
+ */
+template <bascrv::element Element>
+void multiexponentiate_straus(basct::span<Element> res, basct::cspan<Element> generators,
+                              basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+  constexpr size_t table_size = 1u << (straus_window_width_v - 2u);
+  auto num_outputs = exponents.size();
+  size_t n = 0;
+  for (auto& seq : exponents) {
+    n = std::max<size_t>(n, seq.n);
+  }
+  // clang-format off
+  SXT_DEBUG_ASSERT(
+      res.size() == num_outputs &&
+      n <= generators.size() &&
+      n <= straus_max_num_generators_v
+  );
+  // clang-format on
+  if (n == 0) {
+    std::fill(res.begin(), res.end(), Element::identity());
+    return;
+  }
+
+  // precompute g, 3g, 5g, ...
+  SXT_STACK_ARRAY(table, n * table_size, Element);
+  for (size_t generator_index = 0; generator_index < n; ++generator_index) {
+    auto multiples = table.subspan(generator_index * table_size, table_size);
+    Element g2;
+    double_element(g2, generators[generator_index]);
+    multiples[0] = generators[generator_index];
+    for (size_t i = 1; i < table_size; ++i) {
+      add(multiples[i], multiples[i - 1], g2);
+    }
+  }
+
+  // compute outputs
+  SXT_STACK_ARRAY(digits, n * straus_max_num_digits_v, int8_t);
+  for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+    auto& seq = exponents[output_index];
+    unsigned num_digits = 0;
+    for (size_t generator_index = 0; generator_index < seq.n; ++generator_index) {
+      auto generator_digits =
+          digits.subspan(generator_index * straus_max_num_digits_v, straus_max_num_digits_v);
+      num_digits = std::max(
+          num_digits, compute_wnaf(generator_digits, seq.data + generator_index * seq.element_nbytes,
+                                   seq.element_nbytes, static_cast<bool>(seq.is_signed)));
+    }
+    auto sum = Element::identity();
+    Element e;
+    for (unsigned digit_index = num_digits; digit_index-- > 0;) {
+      double_element(sum, sum);
+      for (size_t generator_index = 0; generator_index < seq.n; ++generator_index) {
+        auto digit = digits[generator_index * straus_max_num_digits_v + digit_index];
+        // Note: add_inplace can clobber its second argument so we add a copy
+        if (digit > 0) {
+          e = table[generator_index * table_size + digit / 2];
+          add_inplace(sum, e);
+        } else if (digit < 0) {
+          neg(e, table[generator_index * table_size + (-digit) / 2]);
+          add_inplace(sum, e);
+        }
+      }
+    }
+    res[output_index] = sum;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// try_multiexponentiate_straus
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a multiexponentiation with Straus's method if it has few enough generators; otherwise,
+ * return an empty array.
+ */
+template <bascrv::element Element>
+memmg::managed_array<Element>
+try_multiexponentiate_straus(basct::cspan<Element> generators,
+                             basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+  for (auto& seq : exponents) {
+    if (seq.n > straus_max_num_generators_v) {
+      return {};
+    }
+  }
+  memmg::managed_array<Element> res(exponents.size());
+  multiexponentiate_straus<Element>(res, generators, exponents);
+  return res;
+}
+} // namespace sxt::mtxcrv
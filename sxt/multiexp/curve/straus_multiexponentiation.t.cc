@@ -0,0 +1,180 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/curve/straus_multiexponentiation.h"
+
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/double.h"
+#include "sxt/curve21/operation/neg.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/execution/async/future.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/curve/multiexponentiation_cpu_driver.h"
+#include "sxt/multiexp/curve/pippenger_multiproduct_solver.h"
+#include "sxt/multiexp/pippenger/multiexponentiation.h"
+#include "sxt/multiexp/test/multiexponentiation.h"
+#include "sxt/ristretto/random/element.h"
+
+using namespace sxt;
+using namespace sxt::mtxcrv;
+
+//--------------------------------------------------------------------------------------------------
+// compute_multiproduct_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+static memmg::managed_array<c21t::element_p3>
+compute_multiproduct_multiexponentiation(basct::cspan<c21t::element_p3> generators,
+                                         basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+  pippenger_multiproduct_solver<c21t::element_p3> solver;
+  multiexponentiation_cpu_driver<c21t::element_p3> drv{&solver};
+  return mtxpi::compute_multiexponentiation(drv, generators, exponents)
+      .value()
+      .as_array<c21t::element_p3>();
+}
+
+//--------------------------------------------------------------------------------------------------
+// evaluate_wnaf
+//--------------------------------------------------------------------------------------------------
+static std::vector<int> evaluate_wnaf(basct::cspan<int8_t> digits, unsigned num_bytes) noexcept {
+  // evaluate sum_i digits[i] 2^i in base 2^8
+  std::vector<int> res(num_bytes + 2);
+  for (size_t i = 0; i < digits.size(); ++i) {
+    res[i / 8] += digits[i] * (1 << (i % 8));
+  }
+  for (size_t i = 0; i + 1 < res.size(); ++i) {
+    auto r = ((res[i] % 256) + 256) % 256;
+    res[i + 1] += (res[i] - r) / 256;
+    res[i] = r;
+  }
+  return res;
+}
+
+TEST_CASE("we can compute the non-adjacent form of a scalar") {
+  std::vector<int8_t> digits(straus_max_num_digits_v);
+  std::mt19937 rng{2023};
+
+  SECTION("we handle zero") {
+    uint8_t scalar[] = {0};
+    REQUIRE(compute_wnaf(digits, scalar, 1, false) == 0);
+  }
+
+  SECTION("we handle small scalars") {
+    uint8_t scalar[] = {15};
+    REQUIRE(compute_wnaf(digits, scalar, 1, false) == 5);
+    REQUIRE(digits[0] == -1);
+    REQUIRE(digits[1] == 0);
+    REQUIRE(digits[4] == 1);
+  }
+
+  SECTION("we handle negative scalars") {
+    uint8_t scalar[] = {0xff};
+    REQUIRE(compute_wnaf(digits, scalar, 1, true) == 1);
+    REQUIRE(digits[0] == -1);
+    scalar[0] = 0x80;
+    REQUIRE(compute_wnaf(digits, scalar, 1, true) == 8);
+    REQUIRE(digits[7] == -1);
+  }
+
+  SECTION("the digits of random scalars reconstruct the scalar") {
+    for (int trial = 0; trial < 100; ++trial) {
+      uint8_t scalar[32];
+      for (auto& x : scalar) {
+        x = static_cast<uint8_t>(rng());
+      }
+      auto num_digits = compute_wnaf(digits, scalar, 32, false);
+      REQUIRE(num_digits <= straus_max_num_digits_v);
+      unsigned last_nonzero = 0;
+      bool has_nonzero = false;
+      for (unsigned i = 0; i < num_digits; ++i) {
+        auto digit = digits[i];
+        if (digit == 0) {
+          continue;
+        }
+        REQUIRE(digit % 2 != 0);
+        REQUIRE(std::abs(digit) < (1 << (straus_window_width_v - 1)));
+        if (has_nonzero) {
+          REQUIRE(i - last_nonzero >= straus_window_width_v);
+        }
+        last_nonzero = i;
+        has_nonzero = true;
+      }
+      auto value = evaluate_wnaf({digits.data(), num_digits}, 32);
+      for (unsigned i = 0; i < 32; ++i) {
+        REQUIRE(value[i] == scalar[i]);
+      }
+      REQUIRE(value[32] == 0);
+      REQUIRE(value[33] == 0);
+    }
+  }
+}
+
+TEST_CASE("we can compute small multiexponentiations with Straus's method") {
+  std::mt19937 rng{97834978};
+
+  SECTION("we handle the general cases") {
+    auto f = [](basct::cspan<c21t::element_p3> generators,
+                basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+      size_t n = 0;
+      for (auto& seq : exponents) {
+        n = std::max<size_t>(n, seq.n);
+      }
+      if (n > straus_max_num_generators_v) {
+        return compute_multiproduct_multiexponentiation(generators, exponents);
+      }
+      memmg::managed_array<c21t::element_p3> res(exponents.size());
+      multiexponentiate_straus<c21t::element_p3>(res, generators, exponents);
+      return res;
+    };
+    mtxtst::exercise_multiexponentiation_fn(rng, f);
+  }
+
+  SECTION("we match the multiproduct computation on random inputs") {
+    std::vector<c21t::element_p3> generators(straus_max_num_generators_v);
+    rstrn::generate_random_elements(generators, rng);
+    std::vector<uint8_t> data1(32 * generators.size());
+    std::vector<uint8_t> data2(16 * 5);
+    std::vector<uint8_t> data3(generators.size());
+    for (auto data : {&data1, &data2, &data3}) {
+      for (auto& x : *data) {
+        x = static_cast<uint8_t>(rng());
+      }
+    }
+    std::vector<mtxb::exponent_sequence> exponents = {
+        {.element_nbytes = 32, .n = generators.size(), .data = data1.data()},
+        {.element_nbytes = 16, .n = 5, .data = data2.data(), .is_signed = 1},
+        {.element_nbytes = 1, .n = generators.size(), .data = data3.data(), .is_signed = 1},
+    };
+    memmg::managed_array<c21t::element_p3> res(exponents.size());
+    multiexponentiate_straus<c21t::element_p3>(res, generators, exponents);
+    auto expected = compute_multiproduct_multiexponentiation(generators, exponents);
+    REQUIRE(res == expected);
+  }
+
+  SECTION("we only use Straus's method for small multiexponentiations") {
+    std::vector<c21t::element_p3> generators(straus_max_num_generators_v + 1);
+    rstrn::generate_random_elements(generators, rng);
+    std::vector<uint8_t> data(generators.size(), 1);
+    mtxb::exponent_sequence seq{.element_nbytes = 1, .n = generators.size(), .data = data.data()};
+    auto res = try_multiexponentiate_straus<c21t::element_p3>(generators, {&seq, 1});
+    REQUIRE(res.empty());
+    seq.n = straus_max_num_generators_v;
+    basct::cspan<c21t::element_p3> generators_p{generators.data(), seq.n};
+    res = try_multiexponentiate_straus<c21t::element_p3>(generators_p, {&seq, 1});
+    REQUIRE(res == compute_multiproduct_multiexponentiation(generators_p, {&seq, 1}));
+  }
+}
@@ -0,0 +1,46 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <concepts>
+
+#include "sxt/base/curve/decomposition_parameters.h"
+
+namespace sxt::mtxglv {
+//--------------------------------------------------------------------------------------------------
+// curve_endomorphism
+//--------------------------------------------------------------------------------------------------
+/**
+ * Element types whose curve provides an efficiently computable endomorphism and the parameters
+ * for decomposing scalars with it.
+ *
+ * Curves expose them as endomorphism and endomorphism_parameters overloads that participate in
+ * ADL.
+ */
+template <class T>
+concept curve_endomorphism = requires(T& res, const T& p) {
+  endomorphism(res, p);
+  { endomorphism_parameters(p) } noexcept -> std::same_as<bascrv::decomposition_parameters>;
+};
+
+//--------------------------------------------------------------------------------------------------
+// decomposition_parameters_v
+//--------------------------------------------------------------------------------------------------
+template <curve_endomorphism T>
+constexpr bascrv::decomposition_parameters decomposition_parameters_v =
+    endomorphism_parameters(T::identity());
+} // namespace sxt::mtxglv
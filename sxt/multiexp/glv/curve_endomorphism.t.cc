@@ -0,0 +1,82 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/glv/curve_endomorphism.h"
+
+#include <random>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve_bng1/constant/generator.h"
+#include "sxt/curve_bng1/operation/add.h"
+#include "sxt/curve_bng1/operation/endomorphism.h"
+#include "sxt/curve_bng1/operation/scalar_multiply.h"
+#include "sxt/curve_g1/constant/generator.h"
+#include "sxt/curve_g1/operation/add.h"
+#include "sxt/curve_g1/operation/endomorphism.h"
+#include "sxt/curve_g1/operation/scalar_multiply.h"
+#include "sxt/curve_gk/constant/generator.h"
+#include "sxt/curve_gk/operation/add.h"
+#include "sxt/curve_gk/operation/endomorphism.h"
+#include "sxt/curve_gk/operation/scalar_multiply.h"
+#include "sxt/multiexp/glv/scalar_decomposition.h"
+
+using namespace sxt;
+using namespace sxt::mtxglv;
+
+template <class T, auto ScalarMultiply>
+static void check_decomposition(const T& g, std::mt19937& rng) noexcept {
+  static_assert(curve_endomorphism<T>);
+  auto& params = decomposition_parameters_v<T>;
+  T phi_g;
+  endomorphism(phi_g, g);
+  for (int i = 0; i < 10; ++i) {
+    std::array<uint8_t, 32> k;
+    for (auto& x : k) {
+      x = static_cast<uint8_t>(rng());
+    }
+    k[31] &= 0x1f;
+    std::array<uint8_t, 32> k1{}, k2{};
+    decompose_scalar(k1.data(), k2.data(), k.data(), 32, params);
+
+    T expected;
+    ScalarMultiply(expected, g, k.data());
+    T t1, t2, res;
+    ScalarMultiply(t1, g, k1.data());
+    ScalarMultiply(t2, phi_g, k2.data());
+    add(res, t1, t2);
+    REQUIRE(res == expected);
+  }
+}
+
+TEST_CASE("we can decompose scalar multiplication using a curve endomorphism") {
+  std::mt19937 rng{0};
+
+  SECTION("curves without an endomorphism are disabled") {
+    REQUIRE(!curve_endomorphism<int>);
+  }
+
+  SECTION("we can decompose bn254 scalars") {
+    check_decomposition<cn1t::element_p2, cn1o::scalar_multiply255>(cn1cn::generator_p2_v, rng);
+  }
+
+  SECTION("we can decompose bls12-381 scalars") {
+    check_decomposition<cg1t::element_p2, cg1o::scalar_multiply255>(cg1cn::generator_p2_v, rng);
+  }
+
+  SECTION("we can decompose grumpkin scalars") {
+    check_decomposition<cgkt::element_p2, cgko::scalar_multiply255>(cgkcn::generator_p2_v, rng);
+  }
+}
@@ -0,0 +1,57 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/glv/decomposition_option.h"
+
+#include <cstdlib>
+#include <string_view>
+
+#include "sxt/base/error/panic.h"
+#include "sxt/base/log/log.h"
+
+namespace sxt::mtxglv {
+//--------------------------------------------------------------------------------------------------
+// use_decomposition_impl
+//--------------------------------------------------------------------------------------------------
+static bool use_decomposition_impl() noexcept {
+  auto s = std::getenv("BLITZAR_GLV");
+  if (s == nullptr) {
+    return false;
+  }
+  std::string_view value{s};
+  if (value == "1") {
+    return true;
+  }
+  if (value == "0") {
+    return false;
+  }
+  baser::panic("invalid value for BLITZAR_GLV: {}", s);
+}
+
+//--------------------------------------------------------------------------------------------------
+// use_decomposition
+//--------------------------------------------------------------------------------------------------
+bool use_decomposition() noexcept {
+  static auto res = []() noexcept {
+    auto res = use_decomposition_impl();
+    if (res) {
+      basl::info("decomposing multiexponentiation scalars with curve endomorphisms");
+    }
+    return res;
+  }();
+  return res;
+}
+} // namespace sxt::mtxglv
@@ -0,0 +1,155 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/glv/expansion.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "sxt/base/num/divide_up.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/glv/scalar_decomposition.h"
+
+namespace sxt::mtxglv {
+//--------------------------------------------------------------------------------------------------
+// read_bits
+//--------------------------------------------------------------------------------------------------
+static void read_bits(uint8_t* dst, const uint8_t* src, unsigned bit_offset,
+                      unsigned num_bits) noexcept {
+  if (bit_offset % 8u == 0 && num_bits % 8u == 0) {
+    std::memcpy(dst, src + bit_offset / 8u, num_bits / 8u);
+    return;
+  }
+  for (unsigned i = 0; i < num_bits; ++i) {
+    auto pos = bit_offset + i;
+    auto bit = (src[pos / 8u] >> (pos % 8u)) & 1u;
+    dst[i / 8u] |= static_cast<uint8_t>(bit << (i % 8u));
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// write_bits
+//--------------------------------------------------------------------------------------------------
+static void write_bits(uint8_t* dst, unsigned bit_offset, const uint8_t* src,
+                       unsigned num_bits) noexcept {
+  if (bit_offset % 8u == 0 && num_bits % 8u == 0) {
+    std::memcpy(dst + bit_offset / 8u, src, num_bits / 8u);
+    return;
+  }
+  for (unsigned i = 0; i < num_bits; ++i) {
+    auto pos = bit_offset + i;
+    auto bit = (src[i / 8u] >> (i % 8u)) & 1u;
+    dst[pos / 8u] |= static_cast<uint8_t>(bit << (pos % 8u));
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// expand_exponents
+//--------------------------------------------------------------------------------------------------
+void expand_exponents(basct::span<mtxb::exponent_sequence> res, memmg::managed_array<uint8_t>& data,
+                      basct::cspan<mtxb::exponent_sequence> exponents,
+                      const bascrv::decomposition_parameters& params) noexcept {
+  SXT_DEBUG_ASSERT(res.size() == exponents.size());
+  size_t num_bytes = 0;
+  for (auto& seq : exponents) {
+    auto element_nbytes = seq.is_signed ? seq.element_nbytes
+                                        : std::min<unsigned>(seq.element_nbytes,
+                                                             decomposition_num_bytes_v);
+    num_bytes += 2 * seq.n * element_nbytes;
+  }
+  data = memmg::managed_array<uint8_t>(num_bytes);
+  std::fill(data.begin(), data.end(), 0);
+  auto out = data.data();
+  for (size_t output_index = 0; output_index < exponents.size(); ++output_index) {
+    auto& seq = exponents[output_index];
+    auto element_nbytes = seq.element_nbytes;
+    auto& seq_p = res[output_index];
+    seq_p.n = 2 * seq.n;
+    seq_p.data = out;
+    seq_p.is_signed = seq.is_signed;
+    if (seq.is_signed || element_nbytes <= decomposition_num_bytes_v) {
+      seq_p.element_nbytes = element_nbytes;
+      for (size_t i = 0; i < seq.n; ++i) {
+        std::memcpy(out, seq.data + i * element_nbytes, element_nbytes);
+        out += 2 * element_nbytes;
+      }
+      continue;
+    }
+    seq_p.element_nbytes = decomposition_num_bytes_v;
+    for (size_t i = 0; i < seq.n; ++i) {
+      decompose_scalar(out, out + decomposition_num_bytes_v, seq.data + i * element_nbytes,
+                       element_nbytes, params);
+      out += 2 * decomposition_num_bytes_v;
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// expand_packed_scalars
+//--------------------------------------------------------------------------------------------------
+void expand_packed_scalars(memmg::managed_array<uint8_t>& res, basct::span<unsigned> res_bit_table,
+                           basct::cspan<unsigned> bit_table, basct::cspan<uint8_t> scalars,
+                           unsigned n, const bascrv::decomposition_parameters& params) noexcept {
+  constexpr unsigned decomposition_num_bits = decomposition_num_bytes_v * 8u;
+  auto num_outputs = bit_table.size();
+  SXT_DEBUG_ASSERT(res_bit_table.size() == num_outputs);
+  unsigned bit_sum = 0;
+  unsigned res_bit_sum = 0;
+  for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+    auto width = bit_table[output_index];
+    // clang-format off
+    SXT_RELEASE_ASSERT(
+        width <= 256, "scalars can have at most 256 bits"
+    );
+    // clang-format on
+    res_bit_table[output_index] = std::min(width, decomposition_num_bits);
+    bit_sum += width;
+    res_bit_sum += res_bit_table[output_index];
+  }
+  auto num_bytes = basn::divide_up(bit_sum, 8u);
+  auto res_num_bytes = basn::divide_up(res_bit_sum, 8u);
+  SXT_DEBUG_ASSERT(scalars.size() == num_bytes * n);
+
+  res = memmg::managed_array<uint8_t>(2u * n * res_num_bytes);
+  std::fill(res.begin(), res.end(), 0);
+  std::array<uint8_t, 32> k;
+  std::array<uint8_t, decomposition_num_bytes_v> k1;
+  std::array<uint8_t, decomposition_num_bytes_v> k2;
+  for (unsigned row_index = 0; row_index < n; ++row_index) {
+    auto row = scalars.data() + row_index * num_bytes;
+    auto out1 = res.data() + 2u * row_index * res_num_bytes;
+    auto out2 = out1 + res_num_bytes;
+    unsigned bit_offset = 0;
+    unsigned res_bit_offset = 0;
+    for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+      auto width = bit_table[output_index];
+      k.fill(0);
+      read_bits(k.data(), row, bit_offset, width);
+      if (width <= decomposition_num_bits) {
+        write_bits(out1, res_bit_offset, k.data(), width);
+      } else {
+        decompose_scalar(k1.data(), k2.data(), k.data(), k.size(), params);
+        write_bits(out1, res_bit_offset, k1.data(), decomposition_num_bits);
+        write_bits(out2, res_bit_offset, k2.data(), decomposition_num_bits);
+      }
+      bit_offset += width;
+      res_bit_offset += res_bit_table[output_index];
+    }
+  }
+}
+} // namespace sxt::mtxglv
@@ -0,0 +1,76 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/memory/management/managed_array_fwd.h"
+#include "sxt/base/curve/decomposition_parameters.h"
+
+namespace sxt::mtxb {
+struct exponent_sequence;
+}
+
+namespace sxt::mtxglv {
+//--------------------------------------------------------------------------------------------------
+// expand_generators
+//--------------------------------------------------------------------------------------------------
+/**
+ * Expand generators g_1, ..., g_n into g_1, phi(g_1), ..., g_n, phi(g_n) where phi is the
+ * curve's endomorphism.
+ */
+template <class T>
+void expand_generators(basct::span<T> res, basct::cspan<T> generators) noexcept {
+  SXT_DEBUG_ASSERT(res.size() == 2 * generators.size());
+  for (size_t i = 0; i < generators.size(); ++i) {
+    res[2 * i] = generators[i];
+    endomorphism(res[2 * i + 1], generators[i]);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// expand_exponents
+//--------------------------------------------------------------------------------------------------
+/**
+ * Expand exponent sequences to pair with generators expanded by expand_generators.
+ *
+ * A sequence k_1, ..., k_n of unsigned scalars wider than decomposition_num_bytes_v bytes becomes
+ * the sequence of decomposed scalars k_11, k_12, ..., k_n1, k_n2. Narrower and signed sequences
+ * are already short, so they become k_1, 0, ..., k_n, 0.
+ *
+ * The expanded scalars are written into data.
+ */
+void expand_exponents(basct::span<mtxb::exponent_sequence> res, memmg::managed_array<uint8_t>& data,
+                      basct::cspan<mtxb::exponent_sequence> exponents,
+                      const bascrv::decomposition_parameters& params) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// expand_packed_scalars
+//--------------------------------------------------------------------------------------------------
+/**
+ * Expand n rows of scalars in the packed format used by partition table multiexponentiations so
+ * that they pair with generators expanded by expand_generators.
+ *
+ * Row i expands into rows 2i and 2i + 1. Outputs wider than 128 bits are decomposed into two
+ * 128-bit scalars; narrower outputs keep their width and pair with zero.
+ */
+void expand_packed_scalars(memmg::managed_array<uint8_t>& res, basct::span<unsigned> res_bit_table,
+                           basct::cspan<unsigned> bit_table, basct::cspan<uint8_t> scalars,
+                           unsigned n, const bascrv::decomposition_parameters& params) noexcept;
+} // namespace sxt::mtxglv
@@ -0,0 +1,137 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/glv/expansion.h"
+
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve_bng1/constant/generator.h"
+#include "sxt/curve_bng1/operation/endomorphism.h"
+#include "sxt/curve_bng1/type/element_p2.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/glv/curve_endomorphism.h"
+#include "sxt/multiexp/glv/scalar_decomposition.h"
+
+using namespace sxt;
+using namespace sxt::mtxglv;
+
+TEST_CASE("we can expand generators") {
+  std::vector<cn1t::element_p2> generators = {cn1cn::generator_p2_v,
+                                              cn1t::element_p2::identity()};
+  std::vector<cn1t::element_p2> res(4);
+  expand_generators<cn1t::element_p2>(res, generators);
+  cn1t::element_p2 phi_g;
+  cn1o::endomorphism(phi_g, cn1cn::generator_p2_v);
+  REQUIRE(res[0] == cn1cn::generator_p2_v);
+  REQUIRE(res[1] == phi_g);
+  REQUIRE(res[2] == cn1t::element_p2::identity());
+  REQUIRE(res[3] == cn1t::element_p2::identity());
+}
+
+TEST_CASE("we can expand exponent sequences") {
+  auto& params = decomposition_parameters_v<cn1t::element_p2>;
+  memmg::managed_array<uint8_t> data;
+  std::vector<mtxb::exponent_sequence> res(1);
+
+  SECTION("short sequences are paired with zero") {
+    std::vector<uint8_t> scalars = {3, 4};
+    mtxb::exponent_sequence seq{.element_nbytes = 1, .n = 2, .data = scalars.data()};
+    expand_exponents(res, data, {&seq, 1}, params);
+    REQUIRE(res[0].element_nbytes == 1);
+    REQUIRE(res[0].n == 4);
+    REQUIRE(res[0].is_signed == 0);
+    std::vector<uint8_t> expected = {3, 0, 4, 0};
+    REQUIRE(std::vector<uint8_t>(res[0].data, res[0].data + 4) == expected);
+  }
+
+  SECTION("signed sequences are paired with zero") {
+    std::vector<int16_t> scalars = {-3};
+    mtxb::exponent_sequence seq{
+        .element_nbytes = 2,
+        .n = 1,
+        .data = reinterpret_cast<const uint8_t*>(scalars.data()),
+        .is_signed = 1,
+    };
+    expand_exponents(res, data, {&seq, 1}, params);
+    REQUIRE(res[0].element_nbytes == 2);
+    REQUIRE(res[0].n == 2);
+    REQUIRE(res[0].is_signed == 1);
+    auto values = reinterpret_cast<const int16_t*>(res[0].data);
+    REQUIRE(values[0] == -3);
+    REQUIRE(values[1] == 0);
+  }
+
+  SECTION("wide sequences are decomposed") {
+    std::vector<uint8_t> scalars(32);
+    scalars[0] = 7;
+    scalars[31] = 1;
+    mtxb::exponent_sequence seq{.element_nbytes = 32, .n = 1, .data = scalars.data()};
+    expand_exponents(res, data, {&seq, 1}, params);
+    REQUIRE(res[0].element_nbytes == 16);
+    REQUIRE(res[0].n == 2);
+    std::vector<uint8_t> expected(32);
+    decompose_scalar(expected.data(), expected.data() + 16, scalars.data(), 32, params);
+    REQUIRE(std::vector<uint8_t>(res[0].data, res[0].data + 32) == expected);
+  }
+}
+
+TEST_CASE("we can expand packed scalars") {
+  auto& params = decomposition_parameters_v<cn1t::element_p2>;
+  memmg::managed_array<uint8_t> res;
+  std::vector<unsigned> res_bit_table(2);
+
+  SECTION("we can expand narrow scalars") {
+    std::vector<unsigned> bit_table = {4, 4};
+    std::vector<uint8_t> scalars = {0x35, 0x12};
+    expand_packed_scalars(res, res_bit_table, bit_table, scalars, 2, params);
+    REQUIRE(res_bit_table == bit_table);
+    std::vector<uint8_t> expected = {0x35, 0x0, 0x12, 0x0};
+    REQUIRE(std::vector<uint8_t>(res.begin(), res.end()) == expected);
+  }
+
+  SECTION("we can expand wide scalars") {
+    std::vector<unsigned> bit_table = {4, 256};
+    std::vector<uint8_t> k(32);
+    k[0] = 7;
+    k[31] = 1;
+    std::vector<uint8_t> scalars(33);
+    scalars[0] = 0x5 | static_cast<uint8_t>(k[0] << 4u);
+    scalars[32] = static_cast<uint8_t>(k[31] >> 4u);
+    for (unsigned i = 1; i < 32; ++i) {
+      scalars[i] = static_cast<uint8_t>((k[i - 1] >> 4u) | (k[i] << 4u));
+    }
+    expand_packed_scalars(res, res_bit_table, bit_table, scalars, 1, params);
+    REQUIRE(res_bit_table == std::vector<unsigned>{4, 128});
+    REQUIRE(res.size() == 34);
+
+    std::vector<uint8_t> k12(32);
+    decompose_scalar(k12.data(), k12.data() + 16, k.data(), 32, params);
+    std::vector<uint8_t> expected(34);
+    expected[0] = 0x5 | static_cast<uint8_t>(k12[0] << 4u);
+    expected[17] = static_cast<uint8_t>(k12[16] << 4u);
+    for (unsigned i = 1; i < 17; ++i) {
+      expected[i] = static_cast<uint8_t>(k12[i - 1] >> 4u);
+      expected[17 + i] = static_cast<uint8_t>(k12[16 + i - 1] >> 4u);
+      if (i < 16) {
+        expected[i] |= static_cast<uint8_t>(k12[i] << 4u);
+        expected[17 + i] |= static_cast<uint8_t>(k12[16 + i] << 4u);
+      }
+    }
+    REQUIRE(std::vector<uint8_t>(res.begin(), res.end()) == expected);
+  }
+}
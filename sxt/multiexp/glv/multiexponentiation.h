@@ -0,0 +1,98 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/curve/element.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/bucket_method2/cpu_multiexponentiation.h"
+#include "sxt/multiexp/curve/cpu_multiexponentiation.h"
+#include "sxt/multiexp/glv/curve_endomorphism.h"
+#include "sxt/multiexp/glv/expansion.h"
+
+namespace sxt::mtxglv {
+//--------------------------------------------------------------------------------------------------
+// expand_problem
+//--------------------------------------------------------------------------------------------------
+template <bascrv::element T>
+void expand_problem(memmg::managed_array<T>& generators_p,
+                    std::vector<mtxb::exponent_sequence>& exponents_p,
+                    memmg::managed_array<uint8_t>& data, basct::cspan<T> generators,
+                    basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+  static_assert(curve_endomorphism<T>);
+  size_t n = 0;
+  for (auto& seq : exponents) {
+    n = std::max<size_t>(n, seq.n);
+  }
+  SXT_DEBUG_ASSERT(n <= generators.size());
+  generators_p.resize(2 * n);
+  expand_generators<T>(generators_p, generators.subspan(0, n));
+  exponents_p.resize(exponents.size());
+  expand_exponents(exponents_p, data, exponents, decomposition_parameters_v<T>);
+}
+
+//--------------------------------------------------------------------------------------------------
+// multiexponentiate_cpu
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a multi-exponentiation of unsigned exponents on the host by decomposing each scalar
+ * into two half-length scalars with the curve's endomorphism and running the signed digit bucket
+ * method over the expanded problem with the given thread count and digit width.
+ */
+template <bascrv::element T>
+void multiexponentiate_cpu(basct::span<T> res, basct::cspan<T> generators,
+                           basct::cspan<mtxb::exponent_sequence> exponents, unsigned num_threads,
+                           unsigned digit_bit_width = 0) noexcept {
+  SXT_DEBUG_ASSERT(res.size() == exponents.size());
+  memmg::managed_array<T> generators_p;
+  std::vector<mtxb::exponent_sequence> exponents_p;
+  memmg::managed_array<uint8_t> data;
+  expand_problem<T>(generators_p, exponents_p, data, generators, exponents);
+  mtxbk2::multiexponentiate_cpu<T>(res, generators_p, exponents_p, num_threads, digit_bit_width);
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a multi-exponentiation on the host by decomposing each scalar into two half-length
+ * scalars with the curve's endomorphism.
+ *
+ * The expanded problem has twice as many generators but half as many bits per scalar, so the
+ * bucket method needs half as many windows and the bitwise multiproduct decomposition half as
+ * many bit positions.
+ */
+template <bascrv::element T>
+memmg::managed_array<T>
+compute_multiexponentiation(basct::cspan<T> generators,
+                            basct::cspan<mtxb::exponent_sequence> exponents) noexcept {
+  memmg::managed_array<T> generators_p;
+  std::vector<mtxb::exponent_sequence> exponents_p;
+  memmg::managed_array<uint8_t> data;
+  expand_problem<T>(generators_p, exponents_p, data, generators, exponents);
+  auto res = mtxbk2::try_multiexponentiate_cpu<T>(generators_p, exponents_p);
+  if (!res.empty()) {
+    return res;
+  }
+  return mtxcrv::compute_multiexponentiation_cpu<T>(generators_p, exponents_p);
+}
+} // namespace sxt::mtxglv
@@ -0,0 +1,93 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/glv/multiexponentiation.h"
+
+#include <random>
+#include <vector>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve_bng1/constant/generator.h"
+#include "sxt/curve_bng1/operation/add.h"
+#include "sxt/curve_bng1/operation/batch_add.h"
+#include "sxt/curve_bng1/operation/double.h"
+#include "sxt/curve_bng1/operation/endomorphism.h"
+#include "sxt/curve_bng1/operation/neg.h"
+#include "sxt/curve_bng1/type/element_p2.h"
+#include "sxt/curve_g1/constant/generator.h"
+#include "sxt/curve_g1/operation/add.h"
+#include "sxt/curve_g1/operation/batch_add.h"
+#include "sxt/curve_g1/operation/double.h"
+#include "sxt/curve_g1/operation/endomorphism.h"
+#include "sxt/curve_g1/operation/neg.h"
+#include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/curve_gk/constant/generator.h"
+#include "sxt/curve_gk/operation/add.h"
+#include "sxt/curve_gk/operation/batch_add.h"
+#include "sxt/curve_gk/operation/double.h"
+#include "sxt/curve_gk/operation/endomorphism.h"
+#include "sxt/curve_gk/operation/neg.h"
+#include "sxt/curve_gk/type/element_p2.h"
+#include "sxt/multiexp/curve/multiexponentiation.h"
+
+using namespace sxt;
+using namespace sxt::mtxglv;
+
+template <bascrv::element T> static void check_multiexponentiation(const T& g, unsigned n) {
+  std::mt19937 rng{0};
+  std::vector<T> generators(n);
+  generators[0] = g;
+  for (unsigned i = 1; i < n; ++i) {
+    add(generators[i], generators[i - 1], g);
+  }
+  std::vector<uint8_t> scalars1(n * 32);
+  std::vector<uint8_t> scalars2(n);
+  for (auto& x : scalars1) {
+    x = static_cast<uint8_t>(rng());
+  }
+  for (auto& x : scalars2) {
+    x = static_cast<uint8_t>(rng());
+  }
+  std::vector<mtxb::exponent_sequence> exponents = {
+      {.element_nbytes = 32, .n = n, .data = scalars1.data()},
+      {.element_nbytes = 1, .n = n - 1, .data = scalars2.data()},
+  };
+  auto res = compute_multiexponentiation<T>(generators, exponents);
+  auto expected = mtxcrv::compute_multiexponentiation<T>(generators, exponents);
+  REQUIRE(res.size() == 2);
+  REQUIRE(res[0] == expected[0]);
+  REQUIRE(res[1] == expected[1]);
+
+  std::vector<T> res_p(2);
+  multiexponentiate_cpu<T>(res_p, generators, exponents, 2);
+  REQUIRE(res_p[0] == expected[0]);
+  REQUIRE(res_p[1] == expected[1]);
+}
+
+TEST_CASE("we can compute multiexponentiations using scalar decomposition") {
+  SECTION("we handle bn254") {
+    check_multiexponentiation<cn1t::element_p2>(cn1cn::generator_p2_v, 5);
+    check_multiexponentiation<cn1t::element_p2>(cn1cn::generator_p2_v, 1000);
+  }
+
+  SECTION("we handle bls12-381") {
+    check_multiexponentiation<cg1t::element_p2>(cg1cn::generator_p2_v, 5);
+  }
+
+  SECTION("we handle grumpkin") {
+    check_multiexponentiation<cgkt::element_p2>(cgkcn::generator_p2_v, 5);
+  }
+}
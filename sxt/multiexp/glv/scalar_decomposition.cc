@@ -0,0 +1,136 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/glv/scalar_decomposition.h"
+
+#include <cstring>
+
+#include "sxt/base/error/assert.h"
+#include "sxt/base/field/arithmetic_utility.h"
+
+namespace sxt::mtxglv {
+//--------------------------------------------------------------------------------------------------
+// to_limbs
+//--------------------------------------------------------------------------------------------------
+static std::array<uint64_t, 2> to_limbs(uint128_t x) noexcept {
+  return {static_cast<uint64_t>(x), static_cast<uint64_t>(x >> 64u)};
+}
+
+//--------------------------------------------------------------------------------------------------
+// multiply
+//--------------------------------------------------------------------------------------------------
+template <size_t N, size_t M>
+static std::array<uint64_t, N + M> multiply(const std::array<uint64_t, N>& a,
+                                            const std::array<uint64_t, M>& b) noexcept {
+  std::array<uint64_t, N + M> res{};
+  for (size_t i = 0; i < N; ++i) {
+    uint64_t carry = 0;
+    for (size_t j = 0; j < M; ++j) {
+      basfld::mac(res[i + j], carry, res[i + j], a[i], b[j]);
+    }
+    res[i + M] = carry;
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// multiply_low
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a * b mod 2^256
+ */
+static std::array<uint64_t, 4> multiply_low(const std::array<uint64_t, 4>& a,
+                                            uint128_t b) noexcept {
+  auto t = multiply(a, to_limbs(b));
+  return {t[0], t[1], t[2], t[3]};
+}
+
+//--------------------------------------------------------------------------------------------------
+// is_less
+//--------------------------------------------------------------------------------------------------
+static bool is_less(const std::array<uint64_t, 4>& a, const std::array<uint64_t, 4>& b) noexcept {
+  for (size_t i = 4; i-- > 0;) {
+    if (a[i] != b[i]) {
+      return a[i] < b[i];
+    }
+  }
+  return false;
+}
+
+//--------------------------------------------------------------------------------------------------
+// subtract
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a - b mod 2^256
+ */
+static void subtract(std::array<uint64_t, 4>& a, const std::array<uint64_t, 4>& b) noexcept {
+  uint64_t borrow = 0;
+  for (size_t i = 0; i < 4; ++i) {
+    basfld::sbb(a[i], borrow, a[i], b[i]);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_quotient
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute floor(k n / r) for k < r.
+ *
+ * The estimate floor(k g / 2^256) with g = floor(2^256 n / r) is either exact or one less than the
+ * quotient. Since the remainder for the estimate is less than 2r < 2^256, we can check and correct
+ * it using arithmetic modulo 2^256.
+ */
+static uint128_t compute_quotient(const std::array<uint64_t, 4>& k, uint128_t n,
+                                  const std::array<uint64_t, 3>& g,
+                                  const std::array<uint64_t, 4>& r) noexcept {
+  auto t = multiply(k, g);
+  auto res = static_cast<uint128_t>(t[4]) | (static_cast<uint128_t>(t[5]) << 64u);
+  auto remainder = multiply_low(k, n);
+  subtract(remainder, multiply_low(r, res));
+  if (!is_less(remainder, r)) {
+    ++res;
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// decompose_scalar
+//--------------------------------------------------------------------------------------------------
+void decompose_scalar(uint8_t* k1, uint8_t* k2, const uint8_t* k, unsigned num_bytes,
+                      const bascrv::decomposition_parameters& params) noexcept {
+  SXT_DEBUG_ASSERT(num_bytes <= 32);
+  std::array<uint8_t, 32> bytes{};
+  std::memcpy(bytes.data(), k, num_bytes);
+  std::array<uint64_t, 4> x;
+  std::memcpy(x.data(), bytes.data(), 32);
+
+  // reduce
+  while (!is_less(x, params.r)) {
+    subtract(x, params.r);
+  }
+
+  // round down the coordinates of (k, 0) in the lattice basis
+  auto c1 = compute_quotient(x, params.n1, params.g1, params.r);
+  auto c2 = compute_quotient(x, params.n2, params.g2, params.r);
+
+  // Note: both halves are known to be less than 2^128 so we only need to compute the low bits
+  auto x_low = static_cast<uint128_t>(x[0]) | (static_cast<uint128_t>(x[1]) << 64u);
+  uint128_t t1 = x_low - c1 * params.a1 - c2 * params.a2 + params.w1;
+  uint128_t t2 = params.w2 - c1 * params.b1 - c2 * params.b2;
+  std::memcpy(k1, &t1, decomposition_num_bytes_v);
+  std::memcpy(k2, &t2, decomposition_num_bytes_v);
+}
+} // namespace sxt::mtxglv
@@ -0,0 +1,41 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "sxt/base/curve/decomposition_parameters.h"
+
+namespace sxt::mtxglv {
+//--------------------------------------------------------------------------------------------------
+// decomposition_num_bytes_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * The number of bytes in each half of a decomposed scalar
+ */
+constexpr unsigned decomposition_num_bytes_v = 16;
+
+//--------------------------------------------------------------------------------------------------
+// decompose_scalar
+//--------------------------------------------------------------------------------------------------
+/**
+ * Decompose the little-endian scalar k of num_bytes <= 32 bytes into the little-endian scalars
+ * k1 and k2 of decomposition_num_bytes_v bytes.
+ */
+void decompose_scalar(uint8_t* k1, uint8_t* k2, const uint8_t* k, unsigned num_bytes,
+                      const bascrv::decomposition_parameters& params) noexcept;
+} // namespace sxt::mtxglv
@@ -0,0 +1,112 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/glv/scalar_decomposition.h"
+
+#include <cstring>
+#include <utility>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve_bng1/operation/endomorphism.h"
+#include "sxt/curve_bng1/type/element_p2.h"
+#include "sxt/curve_g1/operation/endomorphism.h"
+#include "sxt/curve_g1/type/element_p2.h"
+#include "sxt/curve_gk/operation/endomorphism.h"
+#include "sxt/curve_gk/type/element_p2.h"
+#include "sxt/multiexp/glv/curve_endomorphism.h"
+
+using namespace sxt;
+using namespace sxt::mtxglv;
+using bascrv::make_uint128;
+
+static std::pair<uint128_t, uint128_t> decompose(const std::array<uint64_t, 4>& k,
+                                                 const bascrv::decomposition_parameters& params) {
+  uint128_t k1, k2;
+  decompose_scalar(reinterpret_cast<uint8_t*>(&k1), reinterpret_cast<uint8_t*>(&k2),
+                   reinterpret_cast<const uint8_t*>(k.data()), 32, params);
+  return {k1, k2};
+}
+
+TEST_CASE("we can decompose scalars into two half-length scalars") {
+  SECTION("we can decompose bn254 scalars") {
+    auto& params = decomposition_parameters_v<cn1t::element_p2>;
+
+    std::array<uint64_t, 4> k = {0x43e1f593f0000000, 0x2833e84879b97091, 0xb85045b68181585d,
+                                 0x30644e72e131a029};
+    std::pair<uint128_t, uint128_t> expected{make_uint128(0xde9b0491dd70b3fa, 0x17c9c2a824424a15),
+                                             make_uint128(0x1, 0x13a64ad129a427c6)};
+    REQUIRE(decompose(k, params) == expected);
+
+    k = {0x44dcda6a797d76de, 0x87751d4ca8501e2c, 0x598b88dbaa99e079, 0x186cce7f248174e5};
+    expected = {make_uint128(0xbb767a2a0f6bf0ad, 0x5da71c4e5d601f8d),
+                make_uint128(0x1a71cddc60c7aa8b, 0x543f5ba4e8b8b3f3)};
+    REQUIRE(decompose(k, params) == expected);
+  }
+
+  SECTION("we can decompose scalars that aren't reduced") {
+    auto& params = decomposition_parameters_v<cn1t::element_p2>;
+    std::array<uint64_t, 4> k = {0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+                                 0xffffffffffffffff};
+    std::pair<uint128_t, uint128_t> expected{make_uint128(0xb76d664824a7e9b6, 0xe25452e21030a273),
+                                             make_uint128(0x3f296ebc4b455179, 0xba4901e69c789e9c)};
+    REQUIRE(decompose(k, params) == expected);
+  }
+
+  SECTION("we can decompose scalars with fewer than 32 bytes") {
+    auto& params = decomposition_parameters_v<cn1t::element_p2>;
+    uint8_t k = 5;
+    uint128_t k1, k2;
+    decompose_scalar(reinterpret_cast<uint8_t*>(&k1), reinterpret_cast<uint8_t*>(&k2), &k, 1,
+                     params);
+    REQUIRE(k1 == make_uint128(0x6f4d8248eeb859fc, 0x8211bbeb7d4f112d));
+    REQUIRE(k2 == make_uint128(0x6f4d8248eeb859fd, 0x0be4e1541221250b));
+  }
+
+  SECTION("we can decompose bls12-381 scalars") {
+    auto& params = decomposition_parameters_v<cg1t::element_p2>;
+
+    std::array<uint64_t, 4> k = {0xffffffff00000000, 0x53bda402fffe5bfe, 0x3339d80809a1d805,
+                                 0x73eda753299d7d48};
+    std::pair<uint128_t, uint128_t> expected{make_uint128(0xac45a4010001a402, 0x100000000),
+                                             make_uint128(0xac45a4010001a402, 0xfffffffe)};
+    REQUIRE(decompose(k, params) == expected);
+
+    k = {0x781ef86f5c8cc1ab, 0x48f165d57b00c7f4, 0x3a0562d56abd685a, 0xbfcf73725ed09d};
+    expected = {make_uint128(0x58661d9b627f6bfa, 0x932adc195c8cc1ab),
+                make_uint128(0x11d08cc9b7e31a7, 0xd01c0b4de4f41c56)};
+    REQUIRE(decompose(k, params) == expected);
+
+    k = {0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff};
+    expected = {make_uint128(0x239c7c18ba5c681, 0x93011d1fffffffd),
+                make_uint128(0x23e0a4efe01c62d9, 0x63f6e520f6cfee30)};
+    REQUIRE(decompose(k, params) == expected);
+  }
+
+  SECTION("we can decompose grumpkin scalars") {
+    auto& params = decomposition_parameters_v<cgkt::element_p2>;
+
+    std::array<uint64_t, 4> k = {0x3c208c16d87cfd46, 0x97816a916871ca8d, 0xb85045b68181585d,
+                                 0x30644e72e131a029};
+    std::pair<uint128_t, uint128_t> expected{make_uint128(0xde9b0491dd70b3fa, 0x17c9c2a824424a15),
+                                             make_uint128(0x1, 0x13a64ad129a427c4)};
+    REQUIRE(decompose(k, params) == expected);
+
+    k = {0x3d2bd371fc80be13, 0xe11160004524a7c, 0xce0c3f08e12656f1, 0x96c845aae6cff55};
+    expected = {make_uint128(0x8f246f0e5db90cac, 0xf295c34628e28d07),
+                make_uint128(0x3ffef8cb08005546, 0x58ab2eb50fbbba1e)};
+    REQUIRE(decompose(k, params) == expected);
+  }
+}
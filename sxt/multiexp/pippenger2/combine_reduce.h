@@ -28,8 +28,10 @@
 #include "sxt/base/device/stream.h"
 #include "sxt/base/error/assert.h"
 #include "sxt/base/iterator/split.h"
+#include "sxt/base/macro/cuda_callable.h"
 #include "sxt/execution/async/coroutine.h"
 #include "sxt/execution/async/future.h"
+#include "sxt/execution/cpu/for_each.h"
 #include "sxt/execution/device/copy.h"
 #include "sxt/execution/device/for_each.h"
 #include "sxt/memory/management/managed_array.h"
@@ -40,9 +42,9 @@ namespace sxt::mtxpp2 {
 // combine_reduce_output
 //--------------------------------------------------------------------------------------------------
 template <bascrv::element T>
-__device__ void combine_reduce_output(T* __restrict__ res, const T* __restrict__ partials,
-                                      unsigned num_partials, unsigned reduction_size,
-                                      unsigned bit_width) noexcept {
+CUDA_CALLABLE void combine_reduce_output(T* __restrict__ res, const T* __restrict__ partials,
+                                         unsigned num_partials, unsigned reduction_size,
+                                         unsigned bit_width) noexcept {
   unsigned bit_index = bit_width - 1u;
   --partials;
   T e = *partials;
@@ -312,4 +314,69 @@ xena::future<> combine_reduce(basct::span<T> res, unsigned element_num_bytes,
   };
   co_await combine_reduce(res, split_options, element_num_bytes, partial_products);
 }
+//--------------------------------------------------------------------------------------------------
+// combine_reduce
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host version of combine_reduce that splits the outputs across num_threads threads.
+ */
+template <bascrv::element T>
+void combine_reduce(basct::span<T> res, basct::cspan<unsigned> output_bit_table,
+                    basct::cspan<T> partial_products, unsigned num_threads) noexcept {
+  auto num_outputs = output_bit_table.size();
+  SXT_RELEASE_ASSERT(
+      // clang-format off
+      res.size() == num_outputs &&
+      output_bit_table.size() == num_outputs
+      // clang-format on
+  );
+  if (res.empty()) {
+    return;
+  }
+  memmg::managed_array<unsigned> bit_table_partial_sums(num_outputs);
+  std::partial_sum(output_bit_table.begin(), output_bit_table.end(),
+                   bit_table_partial_sums.begin());
+  auto num_partials = bit_table_partial_sums[num_outputs - 1];
+  auto reduction_size = static_cast<unsigned>(partial_products.size() / num_partials);
+  SXT_DEBUG_ASSERT(partial_products.size() == num_partials * reduction_size);
+  auto [chunk_first, chunk_last] =
+      basit::split(basit::index_range{0, num_outputs}, {.split_factor = num_threads});
+  xencpu::concurrent_for_each(
+      chunk_first, chunk_last,
+      [&](const basit::index_range& rng) noexcept {
+        for (auto output_index = rng.a(); output_index < rng.b(); ++output_index) {
+          SXT_RELEASE_ASSERT(output_bit_table[output_index] > 0);
+          combine_reduce_output(res.data() + output_index,
+                                partial_products.data() + bit_table_partial_sums[output_index],
+                                num_partials, reduction_size, output_bit_table[output_index]);
+        }
+      },
+      num_threads);
+}
+
+template <bascrv::element T>
+void combine_reduce(basct::span<T> res, unsigned element_num_bytes,
+                    basct::cspan<T> partial_products, unsigned num_threads) noexcept {
+  auto num_outputs = res.size();
+  if (res.empty()) {
+    return;
+  }
+  SXT_RELEASE_ASSERT(element_num_bytes > 0);
+  auto bit_width = element_num_bytes * 8u;
+  auto num_partials = static_cast<unsigned>(num_outputs * bit_width);
+  auto reduction_size = static_cast<unsigned>(partial_products.size() / num_partials);
+  SXT_DEBUG_ASSERT(partial_products.size() == num_partials * reduction_size);
+  auto [chunk_first, chunk_last] =
+      basit::split(basit::index_range{0, num_outputs}, {.split_factor = num_threads});
+  xencpu::concurrent_for_each(
+      chunk_first, chunk_last,
+      [&](const basit::index_range& rng) noexcept {
+        for (auto output_index = rng.a(); output_index < rng.b(); ++output_index) {
+          combine_reduce_output(res.data() + output_index,
+                                partial_products.data() + bit_width * (output_index + 1u),
+                                num_partials, reduction_size, bit_width);
+        }
+      },
+      num_threads);
+}
 } // namespace sxt::mtxpp2
@@ -117,6 +117,18 @@ TEST_CASE("we can combine and reduce partial products with outputs of fixed size
     REQUIRE(res[0] == 3u);
     REQUIRE(res[1] == 4u);
   }
+
+  SECTION("we can combine and reduce on the host") {
+    partial_products.resize(32);
+    partial_products[0] = 3u;
+    partial_products[1] = 4u;
+    partial_products[8] = 5u;
+    partial_products[16] = 6u;
+    res.resize(2);
+    combine_reduce<E>(res, element_num_bytes, partial_products, 2);
+    REQUIRE(res[0] == 3u + 2u * 4u + 6u);
+    REQUIRE(res[1] == 5u);
+  }
 }
 
 TEST_CASE("we can combine and reduce partial products with outputs of varying size") {
@@ -195,4 +207,13 @@ TEST_CASE("we can combine and reduce partial products with outputs of varying si
     REQUIRE(res[0] == 3u);
     REQUIRE(res[1] == 4u);
   }
+
+  SECTION("we can combine and reduce on the host") {
+    output_bit_table = {2, 1};
+    partial_products = {3u, 4u, 5u, 6u, 7u, 8u};
+    res.resize(2);
+    combine_reduce<E>(res, output_bit_table, partial_products, 2);
+    REQUIRE(res[0] == 3u + 2u * 4u + 6u + 2u * 7u);
+    REQUIRE(res[1] == 5u + 8u);
+  }
 }
@@ -16,9 +16,12 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
 #include <fstream>
+#include <optional>
+#include <string>
 #include <string_view>
 
 #include "sxt/base/container/span_utility.h"
@@ -41,7 +44,7 @@ class in_memory_partition_table_accessor final : public partition_table_accessor
 public:
   explicit in_memory_partition_table_accessor(
       std::string_view filename, basm::alloc_t alloc = memr::get_pinned_resource()) noexcept
-      : table_{alloc} {
+      : filename_{filename}, table_{alloc} {
     std::ifstream in{std::string{filename}, std::ios::binary};
     if (!in.good()) {
       baser::panic("failed to open {}: {}", filename, std::strerror(errno));
@@ -50,18 +53,24 @@ public:
     in.seekg(0, std::ios::end);
     auto size = in.tellg() - pos;
     in.seekg(pos);
-    in.read(reinterpret_cast<char*>(&window_width_), sizeof(unsigned));
-    size -= sizeof(unsigned);
+    auto header = read_partition_table_header(filename, in);
+    if (header.is_signed) {
+      baser::panic("{} holds a signed partition table", filename);
+    }
+    window_width_ = header.window_width;
+    num_generators_ = header.num_generators;
+    size -= header.size();
     SXT_RELEASE_ASSERT(size % sizeof(T) == 0);
     table_.resize(size / sizeof(T));
     in.read(reinterpret_cast<char*>(table_.data()), size);
     partition_table_size_ = 1u << window_width_;
   }
 
-  explicit in_memory_partition_table_accessor(memmg::managed_array<T>&& table,
-                                              unsigned window_width) noexcept
+  explicit in_memory_partition_table_accessor(
+      memmg::managed_array<T>&& table, unsigned window_width,
+      std::optional<unsigned> num_generators = std::nullopt) noexcept
       : window_width_{window_width}, partition_table_size_{1u << window_width},
-        table_{std::move(table)} {}
+        num_generators_{num_generators}, table_{std::move(table)} {}
 
   // partition_table_accessor
   unsigned window_width() const noexcept override { return window_width_; }
@@ -81,6 +90,18 @@ public:
     }
   }
 
+  void gather_generators(basct::span<T> generators,
+                         basct::cspan<uint64_t> indexes) const noexcept override {
+    SXT_DEBUG_ASSERT(generators.size() == indexes.size());
+    for (size_t i = 0; i < indexes.size(); ++i) {
+      auto group_index = indexes[i] / window_width_;
+      auto offset = 1u << (indexes[i] % window_width_);
+      auto pos = group_index * partition_table_size_ + offset;
+      SXT_RELEASE_ASSERT(pos < table_.size());
+      generators[i] = table_[pos];
+    }
+  }
+
   void async_copy_to_device(basct::span<T> dest, bast::raw_stream_t stream,
                             unsigned first) const noexcept override {
     SXT_RELEASE_ASSERT(table_.size() >= dest.size() + first * partition_table_size_);
@@ -100,13 +121,48 @@ public:
     if (!out.good()) {
       baser::panic("failed to open {}: {}", filename, std::strerror(errno));
     }
-    out.write(reinterpret_cast<const char*>(&window_width_), sizeof(unsigned));
+    write_partition_table_header(out, {
+                                          .window_width = window_width_,
+                                          .version = partition_table_version_v,
+                                          .is_signed = false,
+                                          .is_glv = false,
+                                          .num_generators = num_generators_,
+                                      });
     out.write(reinterpret_cast<const char*>(table_.data()), table_.size() * sizeof(T));
   }
 
+  size_t num_entries() const noexcept override { return table_.size(); }
+
+  std::optional<unsigned> num_generators() const noexcept override { return num_generators_; }
+
+  void extend(basct::cspan<T> sums, unsigned first, unsigned num_generators) noexcept override {
+    auto offset = size_t{first} * partition_table_size_;
+    SXT_RELEASE_ASSERT(
+        // clang-format off
+        offset <= table_.size() &&
+        sums.size() % partition_table_size_ == 0
+        // clang-format on
+    );
+    if (offset + sums.size() > table_.size()) {
+      memmg::managed_array<T> table{offset + sums.size(), table_.get_allocator()};
+      std::copy_n(table_.data(), offset, table.data());
+      table_ = std::move(table);
+    }
+    std::copy(sums.begin(), sums.end(), table_.data() + offset);
+    num_generators_ = num_generators;
+    if (!filename_.empty()) {
+      write_partition_table_entries(
+          filename_, num_generators, offset * sizeof(T),
+          {reinterpret_cast<const uint8_t*>(sums.data()), sums.size() * sizeof(T)});
+    }
+  }
+
 private:
+  // set if the table was read from a file, in which case extensions are written through to it
+  std::string filename_;
   unsigned window_width_;
   unsigned partition_table_size_;
+  std::optional<unsigned> num_generators_;
   memmg::managed_array<T> table_;
 };
 } // namespace sxt::mtxpp2
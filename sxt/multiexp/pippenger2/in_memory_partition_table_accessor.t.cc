@@ -16,6 +16,7 @@
  */
 #include "sxt/multiexp/pippenger2/in_memory_partition_table_accessor.h"
 
+#include <fstream>
 #include <memory_resource>
 #include <vector>
 
@@ -85,6 +86,18 @@ TEST_CASE("we can provide access to precomputed partition sums stored on disk")
     REQUIRE(v[0] == 12);
   }
 
+  SECTION("we can gather generators by index") {
+    memmg::managed_array<E> data(partition_table_size * 2);
+    data[2] = 3u;
+    data[partition_table_size + (1u << 15u)] = 5u;
+    in_memory_partition_table_accessor<E> accessor{std::move(data), 16};
+    std::vector<uint64_t> indexes = {31, 1, 31};
+    std::vector<E> generators(indexes.size());
+    accessor.gather_generators(generators, indexes);
+    std::vector<E> expected = {5u, 3u, 5u};
+    REQUIRE(generators == expected);
+  }
+
   SECTION("we can write an accessor to a file") {
     memmg::managed_array<E> data(partition_table_size * 2);
     unsigned cnt = 0;
@@ -102,4 +115,96 @@ TEST_CASE("we can provide access to precomputed partition sums stored on disk")
     basdv::synchronize_stream(stream);
     REQUIRE(data == data_p);
   }
+
+  SECTION("files are written with a versioned header") {
+    memmg::managed_array<E> data(partition_table_size, basm::alloc_t{});
+    in_memory_partition_table_accessor<E> accessor{memmg::managed_array<E>{data}, 16, 10};
+    temp_file.stream().close();
+    accessor.write_to_file(temp_file.name());
+    std::ifstream in{temp_file.name(), std::ios::binary};
+    auto header = read_partition_table_header(temp_file.name(), in);
+    REQUIRE(header.version == partition_table_version_v);
+    REQUIRE(header.window_width == 16);
+    REQUIRE(!header.is_signed);
+    REQUIRE(header.num_generators == 10);
+    REQUIRE(header.size() % 64 == 0);
+    REQUIRE(in.tellg() == static_cast<std::streamoff>(header.size()));
+    in_memory_partition_table_accessor<E> accessor_p{temp_file.name(), basm::alloc_t{}};
+    REQUIRE(accessor_p.num_entries() == partition_table_size);
+    REQUIRE(accessor_p.num_generators() == 10);
+  }
+
+  SECTION("we can mark a file as holding a GLV table") {
+    memmg::managed_array<E> data(partition_table_size, basm::alloc_t{});
+    in_memory_partition_table_accessor<E> accessor{memmg::managed_array<E>{data}, 16, 10};
+    temp_file.stream().close();
+    accessor.write_to_file(temp_file.name());
+    REQUIRE(!is_glv_partition_table_file(temp_file.name()));
+    mark_glv_partition_table_file(temp_file.name());
+    REQUIRE(is_glv_partition_table_file(temp_file.name()));
+    REQUIRE(!is_signed_partition_table_file(temp_file.name()));
+    in_memory_partition_table_accessor<E> accessor_p{temp_file.name(), basm::alloc_t{}};
+    REQUIRE(accessor_p.window_width() == 16);
+    REQUIRE(accessor_p.num_entries() == partition_table_size);
+    REQUIRE(accessor_p.num_generators() == 10);
+  }
+
+  SECTION("files without a known generator count are written with a versioned header") {
+    memmg::managed_array<E> data(partition_table_size, basm::alloc_t{});
+    in_memory_partition_table_accessor<E> accessor{memmg::managed_array<E>{data}, 16};
+    temp_file.stream().close();
+    accessor.write_to_file(temp_file.name());
+    in_memory_partition_table_accessor<E> accessor_p{temp_file.name(), basm::alloc_t{}};
+    REQUIRE(accessor_p.window_width() == 16);
+    REQUIRE(!accessor_p.num_generators());
+  }
+
+  SECTION("we can extend an accessor") {
+    memmg::managed_array<E> data(partition_table_size, basm::alloc_t{});
+    for (auto& val : data) {
+      val = 1u;
+    }
+    in_memory_partition_table_accessor<E> accessor{memmg::managed_array<E>{data}, 16};
+    std::vector<E> sums(partition_table_size * 2);
+    sums[0] = 2u;
+    sums[partition_table_size] = 3u;
+    accessor.extend(sums, 1, 48);
+    REQUIRE(accessor.num_entries() == 3 * partition_table_size);
+    REQUIRE(accessor.num_generators() == 48);
+    std::pmr::monotonic_buffer_resource alloc;
+    auto v = accessor.host_view(&alloc, 0, 3 * partition_table_size);
+    REQUIRE(v[0] == 1u);
+    REQUIRE(v[partition_table_size] == 2u);
+    REQUIRE(v[2 * partition_table_size] == 3u);
+
+    sums.resize(partition_table_size);
+    sums[0] = 4u;
+    accessor.extend(sums, 0, 48);
+    v = accessor.host_view(&alloc, 0, 3 * partition_table_size);
+    REQUIRE(accessor.num_entries() == 3 * partition_table_size);
+    REQUIRE(v[0] == 4u);
+    REQUIRE(v[partition_table_size] == 2u);
+  }
+
+  SECTION("extending an accessor read from a file updates the file") {
+    std::vector<E> data(partition_table_size);
+    unsigned window_width = 16;
+    temp_file.stream().write(reinterpret_cast<const char*>(&window_width), sizeof(unsigned));
+    temp_file.stream().write(reinterpret_cast<const char*>(data.data()), sizeof(E) * data.size());
+    temp_file.stream().close();
+    in_memory_partition_table_accessor<E> accessor{temp_file.name(), basm::alloc_t{}};
+    std::vector<E> sums(partition_table_size);
+    sums[1] = 5u;
+    REQUIRE(!accessor.num_generators());
+    accessor.extend(sums, 1, 20);
+    in_memory_partition_table_accessor<E> accessor_p{temp_file.name(), basm::alloc_t{}};
+    REQUIRE(accessor_p.num_entries() == 2 * partition_table_size);
+    REQUIRE(accessor_p.num_generators() == 20);
+    std::pmr::monotonic_buffer_resource alloc;
+    auto v = accessor_p.host_view(&alloc, 1, 2);
+    REQUIRE(v[1] == 5u);
+    std::ifstream in{temp_file.name(), std::ios::binary};
+    REQUIRE(read_partition_table_header(temp_file.name(), in).version ==
+            partition_table_version_v);
+  }
 }
@@ -16,12 +16,17 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <concepts>
+#include <cstdint>
 #include <memory>
+#include <memory_resource>
+#include <type_traits>
 #include <vector>
 
 #include "sxt/base/container/span.h"
 #include "sxt/base/curve/element.h"
+#include "sxt/base/error/assert.h"
 #include "sxt/base/memory/alloc.h"
 #include "sxt/base/num/divide_up.h"
 #include "sxt/memory/resource/pinned_resource.h"
@@ -42,6 +47,7 @@ std::unique_ptr<partition_table_accessor<U>> make_in_memory_partition_table_acce
     basct::cspan<T> generators, basm::alloc_t alloc,
     unsigned window_width = get_default_window_width()) noexcept {
   auto n = generators.size();
+  auto num_generators = static_cast<unsigned>(n);
   auto partition_table_size = 1u << window_width;
   std::vector<T> generators_data;
   auto num_partitions = basn::divide_up(n, size_t{window_width});
@@ -54,7 +60,8 @@ std::unique_ptr<partition_table_accessor<U>> make_in_memory_partition_table_acce
   }
   memmg::managed_array<U> sums{partition_table_size * num_partitions, alloc};
   compute_partition_table<U, T>(sums, window_width, generators);
-  return std::make_unique<in_memory_partition_table_accessor<U>>(std::move(sums), window_width);
+  return std::make_unique<in_memory_partition_table_accessor<U>>(std::move(sums), window_width,
+                                                                 num_generators);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -77,4 +84,101 @@ std::unique_ptr<partition_table_accessor<T>> make_in_memory_partition_table_acce
     unsigned window_width = get_default_window_width()) noexcept {
   return make_in_memory_partition_table_accessor_impl<T, T>(generators, alloc, window_width);
 }
+
+//--------------------------------------------------------------------------------------------------
+// count_partition_table_generators
+//--------------------------------------------------------------------------------------------------
+/**
+ * Count the generators of a partition table.
+ *
+ * Tables read from files written before the generator count was stored fall back to treating
+ * identity generators at the end of the last group as padding.
+ */
+template <class U, bascrv::element T>
+  requires std::constructible_from<T, U>
+unsigned count_partition_table_generators(const partition_table_accessor<U>& accessor) noexcept {
+  if (auto num_generators = accessor.num_generators()) {
+    return *num_generators;
+  }
+  auto window_width = accessor.window_width();
+  auto partition_table_size = 1u << window_width;
+  auto num_groups = static_cast<unsigned>(accessor.num_entries() / partition_table_size);
+  if (num_groups == 0) {
+    return 0;
+  }
+  std::pmr::monotonic_buffer_resource alloc;
+  auto slice = accessor.host_view(&alloc, num_groups - 1u, partition_table_size);
+  auto res = num_groups * window_width;
+  for (unsigned j = window_width; j-- > 0;) {
+    if (!(T{slice[1u << j]} == T::identity())) {
+      break;
+    }
+    --res;
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// gather_partition_table_generators
+//--------------------------------------------------------------------------------------------------
+/**
+ * Copy the generators at the given indexes out of a partition table, converting them to T.
+ */
+template <class U, bascrv::element T>
+  requires std::constructible_from<T, U>
+void gather_partition_table_generators(basct::span<T> generators,
+                                       const partition_table_accessor<U>& accessor,
+                                       basct::cspan<uint64_t> indexes) noexcept {
+  SXT_DEBUG_ASSERT(generators.size() == indexes.size());
+  if constexpr (std::is_same_v<U, T>) {
+    accessor.gather_generators(generators, indexes);
+  } else {
+    std::vector<U> generators_p(indexes.size());
+    accessor.gather_generators(generators_p, indexes);
+    std::transform(generators_p.begin(), generators_p.end(), generators.begin(),
+                   [](const U& u) noexcept { return T{u}; });
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// extend_partition_table_accessor
+//--------------------------------------------------------------------------------------------------
+/**
+ * Append generators to a partition table that currently holds num_generators generators.
+ *
+ * Only the groups containing the new generators are computed. If the last group is partial, its
+ * generators are recovered from the table and the group is recomputed with the new generators in
+ * place of the identity padding.
+ */
+template <class U, bascrv::element T>
+  requires requires(const U& u, const T& e) {
+    static_cast<U>(e);
+    T{u};
+  }
+void extend_partition_table_accessor(partition_table_accessor<U>& accessor,
+                                     unsigned num_generators,
+                                     basct::cspan<T> generators) noexcept {
+  auto window_width = accessor.window_width();
+  auto partition_table_size = 1u << window_width;
+  auto first = num_generators / window_width;
+  auto num_existing = num_generators % window_width;
+  SXT_RELEASE_ASSERT(size_t{basn::divide_up(num_generators, window_width)} * partition_table_size <=
+                     accessor.num_entries());
+  if (generators.empty()) {
+    return;
+  }
+  auto n = basn::divide_up(num_existing + generators.size(), size_t{window_width}) * window_width;
+  std::vector<T> group_generators(n, T::identity());
+  if (num_existing > 0) {
+    std::pmr::monotonic_buffer_resource alloc;
+    auto slice = accessor.host_view(&alloc, first, partition_table_size);
+    for (unsigned j = 0; j < num_existing; ++j) {
+      group_generators[j] = T{slice[1u << j]};
+    }
+  }
+  std::copy(generators.begin(), generators.end(), group_generators.begin() + num_existing);
+  std::vector<U> sums(n / window_width * partition_table_size);
+  compute_partition_table<U, T>(sums, window_width, group_generators);
+  accessor.extend(sums, first, num_generators + static_cast<unsigned>(generators.size()));
+}
 } // namespace sxt::mtxpp2
@@ -16,6 +16,7 @@
  */
 #include "sxt/multiexp/pippenger2/in_memory_partition_table_accessor_utility.h"
 
+#include <memory_resource>
 #include <random>
 #include <vector>
 
@@ -23,6 +24,7 @@
 #include "sxt/base/curve/example_element.h"
 #include "sxt/base/device/stream.h"
 #include "sxt/base/device/synchronization.h"
+#include "sxt/base/test/temp_file.h"
 #include "sxt/base/test/unit_test.h"
 #include "sxt/memory/management/managed_array.h"
 #include "sxt/memory/resource/device_resource.h"
@@ -63,3 +65,90 @@ TEST_CASE("we can create a partition table accessor from given generators") {
     REQUIRE(table[3] == generators[0].value + generators[1].value);
   }
 }
+
+TEST_CASE("we can extend a partition table accessor with new generators") {
+  using E = bascrv::element97;
+  std::vector<E> generators(13);
+  std::mt19937 rng{0};
+  for (auto& g : generators) {
+    g = std::uniform_int_distribution<unsigned>{1, 96}(rng);
+  }
+  unsigned window_width = 4;
+  auto partition_table_size = 1u << window_width;
+  auto expected_accessor = make_in_memory_partition_table_accessor<E>(generators, {}, window_width);
+  std::pmr::monotonic_buffer_resource alloc;
+  auto expected = expected_accessor->host_view(&alloc, 0, 4 * partition_table_size);
+
+  SECTION("we can count the generators of a table") {
+    REQUIRE(count_partition_table_generators<E, E>(*expected_accessor) == 13);
+    auto accessor =
+        make_in_memory_partition_table_accessor<E>(basct::subspan(generators, 0, 8), {}, 4);
+    REQUIRE(count_partition_table_generators<E, E>(*accessor) == 8);
+  }
+
+  SECTION("we can gather generators from a table") {
+    std::vector<uint64_t> indexes = {12, 0, 5};
+    std::vector<E> res(indexes.size());
+    gather_partition_table_generators<E, E>(res, *expected_accessor, indexes);
+    std::vector<E> expected_generators = {generators[12], generators[0], generators[5]};
+    REQUIRE(res == expected_generators);
+  }
+
+  SECTION("we can extend a table with a partial last group") {
+    auto accessor =
+        make_in_memory_partition_table_accessor<E>(basct::subspan(generators, 0, 5), {}, 4);
+    extend_partition_table_accessor<E, E>(*accessor, 5, basct::subspan(generators, 5));
+    REQUIRE(accessor->num_entries() == 4 * partition_table_size);
+    auto v = accessor->host_view(&alloc, 0, 4 * partition_table_size);
+    REQUIRE(std::vector<E>(v.begin(), v.end()) == std::vector<E>(expected.begin(), expected.end()));
+  }
+
+  SECTION("we can extend a table with full groups") {
+    auto accessor =
+        make_in_memory_partition_table_accessor<E>(basct::subspan(generators, 0, 8), {}, 4);
+    extend_partition_table_accessor<E, E>(*accessor, 8, basct::subspan(generators, 8, 2));
+    extend_partition_table_accessor<E, E>(*accessor, 10, basct::subspan(generators, 10));
+    auto v = accessor->host_view(&alloc, 0, 4 * partition_table_size);
+    REQUIRE(std::vector<E>(v.begin(), v.end()) == std::vector<E>(expected.begin(), expected.end()));
+  }
+
+  SECTION("extending with no generators leaves the table unchanged") {
+    auto accessor =
+        make_in_memory_partition_table_accessor<E>(basct::subspan(generators, 0, 5), {}, 4);
+    extend_partition_table_accessor<E, E>(*accessor, 5, basct::cspan<E>{});
+    REQUIRE(accessor->num_entries() == 2 * partition_table_size);
+  }
+}
+
+TEST_CASE("we can extend a table read from a file when the generators end with the identity") {
+  using E = bascrv::element97;
+  std::vector<E> generators(9);
+  std::mt19937 rng{0};
+  for (auto& g : generators) {
+    g = std::uniform_int_distribution<unsigned>{1, 96}(rng);
+  }
+  generators[5] = E::identity();
+  unsigned window_width = 4;
+  auto partition_table_size = 1u << window_width;
+  auto expected_accessor = make_in_memory_partition_table_accessor<E>(generators, {}, window_width);
+  std::pmr::monotonic_buffer_resource alloc;
+  auto expected = expected_accessor->host_view(&alloc, 0, 3 * partition_table_size);
+
+  bastst::temp_file temp_file{std::ios::binary};
+  temp_file.stream().close();
+  auto accessor = make_in_memory_partition_table_accessor<E>(basct::subspan(generators, 0, 6), {},
+                                                             window_width);
+  accessor->write_to_file(temp_file.name());
+
+  in_memory_partition_table_accessor<E> accessor_p{temp_file.name(), basm::alloc_t{}};
+  REQUIRE(count_partition_table_generators<E, E>(accessor_p) == 6);
+  extend_partition_table_accessor<E, E>(accessor_p, 6, basct::subspan(generators, 6));
+  REQUIRE(count_partition_table_generators<E, E>(accessor_p) == 9);
+  auto v = accessor_p.host_view(&alloc, 0, 3 * partition_table_size);
+  REQUIRE(std::vector<E>(v.begin(), v.end()) == std::vector<E>(expected.begin(), expected.end()));
+
+  in_memory_partition_table_accessor<E> accessor_pp{temp_file.name(), basm::alloc_t{}};
+  REQUIRE(count_partition_table_generators<E, E>(accessor_pp) == 9);
+  v = accessor_pp.host_view(&alloc, 0, 3 * partition_table_size);
+  REQUIRE(std::vector<E>(v.begin(), v.end()) == std::vector<E>(expected.begin(), expected.end()));
+}
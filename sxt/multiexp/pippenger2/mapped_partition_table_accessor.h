@@ -0,0 +1,183 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "sxt/base/device/memory_utility.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/base/error/panic.h"
+#include "sxt/base/num/divide_up.h"
+#include "sxt/base/system/mapped_file.h"
+#include "sxt/multiexp/pippenger2/partition_table_accessor.h"
+
+namespace sxt::mtxpp2 {
+//--------------------------------------------------------------------------------------------------
+// mapped_partition_table_accessor
+//--------------------------------------------------------------------------------------------------
+/**
+ * Access precomputed partition sums directly from a memory-mapped file.
+ *
+ * The file uses the same format as in_memory_partition_table_accessor, but nothing is read up
+ * front: copies to device and host views are served from the mapping so that processes using
+ * the same file share its pages.
+ *
+ * Table entries start after the file header, which is padded so that host views of current
+ * format files point directly into the mapping. Only the entries of files in the unpadded legacy
+ * format are copied into memory from the provided allocator.
+ *
+ * Extending the table writes the new sums into the file and remaps it, so views obtained before
+ * an extension are invalidated.
+ */
+template <class T>
+class mapped_partition_table_accessor final : public partition_table_accessor<T> {
+  static_assert(std::is_trivially_copyable_v<T>);
+
+public:
+  explicit mapped_partition_table_accessor(std::string_view filename,
+                                           const bassy::mapped_file_options& options = {}) noexcept
+      : filename_{filename}, options_{options} {
+    this->map_file();
+  }
+
+  // partition_table_accessor
+  unsigned window_width() const noexcept override { return window_width_; }
+
+  void copy_generators(basct::span<T> generators) const noexcept override {
+    auto num_groups = basn::divide_up<size_t>(generators.size(), window_width_);
+    SXT_RELEASE_ASSERT(num_groups * partition_table_size_ <= table_size_);
+    size_t out = 0;
+    for (size_t group_index = 0; group_index < num_groups; ++group_index) {
+      for (size_t j = 0; j < window_width_; ++j) {
+        if (out == generators.size()) {
+          return;
+        }
+        auto offset = 1u << j;
+        std::memcpy(static_cast<void*>(&generators[out++]),
+                    this->table_data() + (group_index * partition_table_size_ + offset) * sizeof(T),
+                    sizeof(T));
+      }
+    }
+  }
+
+  void gather_generators(basct::span<T> generators,
+                         basct::cspan<uint64_t> indexes) const noexcept override {
+    SXT_DEBUG_ASSERT(generators.size() == indexes.size());
+    for (size_t i = 0; i < indexes.size(); ++i) {
+      auto group_index = indexes[i] / window_width_;
+      auto offset = 1u << (indexes[i] % window_width_);
+      auto pos = group_index * partition_table_size_ + offset;
+      SXT_RELEASE_ASSERT(pos < table_size_);
+      std::memcpy(static_cast<void*>(&generators[i]), this->table_data() + pos * sizeof(T),
+                  sizeof(T));
+    }
+  }
+
+  void async_copy_to_device(basct::span<T> dest, bast::raw_stream_t stream,
+                            unsigned first) const noexcept override {
+    SXT_RELEASE_ASSERT(table_size_ >= dest.size() + first * partition_table_size_);
+    SXT_DEBUG_ASSERT(basdv::is_active_device_pointer(dest.data()));
+    basdv::async_memcpy_host_to_device(
+        static_cast<void*>(dest.data()),
+        this->table_data() + size_t{first} * partition_table_size_ * sizeof(T),
+        dest.size() * sizeof(T), stream);
+  }
+
+  basct::cspan<T> host_view(std::pmr::polymorphic_allocator<> alloc, unsigned first,
+                            unsigned size) const noexcept override {
+    SXT_RELEASE_ASSERT(table_size_ >= size + first * partition_table_size_);
+    auto src = this->table_data() + size_t{first} * partition_table_size_ * sizeof(T);
+    if (reinterpret_cast<uintptr_t>(src) % alignof(T) == 0) {
+      return {reinterpret_cast<const T*>(src), size};
+    }
+    auto data = alloc.allocate_object<T>(size);
+    std::memcpy(static_cast<void*>(data), src, size * sizeof(T));
+    return {data, size};
+  }
+
+  void write_to_file(std::string_view filename) const noexcept override {
+    std::ofstream out{std::string{filename}, std::ios::binary};
+    if (!out.good()) {
+      baser::panic("failed to open {}: {}", filename, std::strerror(errno));
+    }
+    write_partition_table_header(out, {
+                                          .window_width = window_width_,
+                                          .version = partition_table_version_v,
+                                          .is_signed = false,
+                                          .is_glv = false,
+                                          .num_generators = num_generators_,
+                                      });
+    out.write(reinterpret_cast<const char*>(this->table_data()), table_size_ * sizeof(T));
+  }
+
+  size_t num_entries() const noexcept override { return table_size_; }
+
+  std::optional<unsigned> num_generators() const noexcept override { return num_generators_; }
+
+  void extend(basct::cspan<T> sums, unsigned first, unsigned num_generators) noexcept override {
+    auto offset = size_t{first} * partition_table_size_;
+    SXT_RELEASE_ASSERT(
+        // clang-format off
+        offset <= table_size_ &&
+        sums.size() % partition_table_size_ == 0
+        // clang-format on
+    );
+    write_partition_table_entries(
+        filename_, num_generators, offset * sizeof(T),
+        {reinterpret_cast<const uint8_t*>(sums.data()), sums.size() * sizeof(T)});
+    this->map_file();
+  }
+
+private:
+  std::string filename_;
+  bassy::mapped_file_options options_;
+  bassy::mapped_file file_;
+  unsigned window_width_;
+  unsigned partition_table_size_;
+  std::optional<unsigned> num_generators_;
+  size_t header_size_;
+  size_t table_size_;
+
+  const uint8_t* table_data() const noexcept { return file_.data() + header_size_; }
+
+  void map_file() noexcept {
+    file_ = bassy::mapped_file{filename_.c_str(), options_};
+    auto header = read_partition_table_header(filename_, {file_.data(), file_.size()});
+    if (header.is_signed) {
+      baser::panic("{} holds a signed partition table", filename_);
+    }
+    header_size_ = header.size();
+    window_width_ = header.window_width;
+    num_generators_ = header.num_generators;
+    auto size = file_.size() - header_size_;
+    if (size % sizeof(T) != 0) {
+      baser::panic("{} table size {} is not a multiple of element size {}", filename_, size,
+                   sizeof(T));
+    }
+    table_size_ = size / sizeof(T);
+    partition_table_size_ = 1u << window_width_;
+  }
+};
+} // namespace sxt::mtxpp2
@@ -0,0 +1,170 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/pippenger2/mapped_partition_table_accessor.h"
+
+#include <sys/stat.h>
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "sxt/base/curve/example_element.h"
+#include "sxt/base/device/stream.h"
+#include "sxt/base/device/synchronization.h"
+#include "sxt/base/test/temp_file.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve_bng1/type/compact_element.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/memory/resource/device_resource.h"
+#include "sxt/multiexp/pippenger2/in_memory_partition_table_accessor.h"
+
+using namespace sxt;
+using namespace sxt::mtxpp2;
+
+TEST_CASE("we can access precomputed partition sums from a mapped file") {
+  bastst::temp_file temp_file{std::ios::binary};
+  temp_file.stream().close();
+
+  using E = bascrv::element97;
+  basdv::stream stream;
+
+  const auto partition_table_size = 1u << 16u;
+
+  memmg::managed_array<E> data(partition_table_size * 2);
+  unsigned cnt = 0;
+  for (auto& val : data) {
+    val = cnt++ % 97u;
+  }
+  in_memory_partition_table_accessor<E>{memmg::managed_array<E>{data}, 16}.write_to_file(
+      temp_file.name());
+
+  SECTION("we can copy elements to device") {
+    mapped_partition_table_accessor<E> accessor{temp_file.name()};
+    REQUIRE(accessor.window_width() == 16);
+    memmg::managed_array<E> v_dev{2, memr::get_device_resource()};
+    accessor.async_copy_to_device(v_dev, stream, 1);
+    std::vector<E> v(2);
+    basdv::async_copy_device_to_host(v, v_dev, stream);
+    basdv::synchronize_stream(stream);
+    std::vector<E> expected = {data[partition_table_size], data[partition_table_size + 1]};
+    REQUIRE(v == expected);
+  }
+
+  SECTION("we can access elements from the host") {
+    mapped_partition_table_accessor<E> accessor{temp_file.name(), {.will_need = true}};
+    std::pmr::monotonic_buffer_resource alloc;
+    auto v = accessor.host_view(&alloc, 1, 3);
+    REQUIRE(v.size() == 3);
+    REQUIRE(v[0] == data[partition_table_size]);
+    REQUIRE(v[2] == data[partition_table_size + 2]);
+  }
+
+  SECTION("we can copy generators") {
+    mapped_partition_table_accessor<E> accessor{temp_file.name()};
+    std::vector<E> generators(17);
+    accessor.copy_generators(generators);
+    REQUIRE(generators[0] == data[1]);
+    REQUIRE(generators[1] == data[2]);
+    REQUIRE(generators[16] == data[partition_table_size + 1]);
+  }
+
+  SECTION("we can gather generators by index") {
+    mapped_partition_table_accessor<E> accessor{temp_file.name()};
+    std::vector<uint64_t> indexes = {16, 0, 17};
+    std::vector<E> generators(indexes.size());
+    accessor.gather_generators(generators, indexes);
+    REQUIRE(generators[0] == data[partition_table_size + 1]);
+    REQUIRE(generators[1] == data[1]);
+    REQUIRE(generators[2] == data[partition_table_size + 2]);
+  }
+
+  SECTION("we can write a mapped accessor back to a file") {
+    mapped_partition_table_accessor<E> accessor{temp_file.name()};
+    bastst::temp_file temp_file_p{std::ios::binary};
+    temp_file_p.stream().close();
+    accessor.write_to_file(temp_file_p.name());
+    in_memory_partition_table_accessor<E> accessor_p{temp_file_p.name(), basm::alloc_t{}};
+    std::pmr::monotonic_buffer_resource alloc;
+    auto v = accessor_p.host_view(&alloc, 0, data.size());
+    REQUIRE(std::vector<E>(v.begin(), v.end()) == std::vector<E>(data.begin(), data.end()));
+  }
+
+  SECTION("we can extend a mapped accessor") {
+    mapped_partition_table_accessor<E> accessor{temp_file.name()};
+    std::vector<E> sums(partition_table_size * 2);
+    sums[0] = 7u;
+    sums[partition_table_size] = 8u;
+    struct stat st;
+    REQUIRE(stat(temp_file.name().c_str(), &st) == 0);
+    auto inode = st.st_ino;
+    accessor.extend(sums, 1, 48);
+    REQUIRE(stat(temp_file.name().c_str(), &st) == 0);
+    REQUIRE(st.st_ino == inode);
+    REQUIRE(accessor.num_entries() == 3 * partition_table_size);
+    REQUIRE(accessor.num_generators() == 48);
+    std::pmr::monotonic_buffer_resource alloc;
+    auto v = accessor.host_view(&alloc, 0, 3 * partition_table_size);
+    REQUIRE(v[1] == data[1]);
+    REQUIRE(v[partition_table_size] == 7u);
+    REQUIRE(v[2 * partition_table_size] == 8u);
+
+    mapped_partition_table_accessor<E> accessor_p{temp_file.name()};
+    REQUIRE(accessor_p.num_entries() == 3 * partition_table_size);
+    REQUIRE(accessor_p.num_generators() == 48);
+    v = accessor_p.host_view(&alloc, 0, 3 * partition_table_size);
+    REQUIRE(v[1] == data[1]);
+    REQUIRE(v[2 * partition_table_size] == 8u);
+  }
+}
+
+TEST_CASE("we can view a mapped table of curve elements without copying") {
+  bastst::temp_file temp_file{std::ios::binary};
+
+  using E = cn1t::compact_element;
+  const unsigned window_width = 4;
+  const auto partition_table_size = 1u << window_width;
+
+  memmg::managed_array<E> data(partition_table_size * 2);
+  for (unsigned i = 0; i < data.size(); ++i) {
+    data[i] = E{{i, 0, 0, 0}, {0, 0, 0, 0}};
+  }
+
+  SECTION("host views point into the mapping") {
+    temp_file.stream().close();
+    in_memory_partition_table_accessor<E>{memmg::managed_array<E>{data}, window_width}
+        .write_to_file(temp_file.name());
+    mapped_partition_table_accessor<E> accessor{temp_file.name()};
+    std::pmr::monotonic_buffer_resource alloc;
+    auto v = accessor.host_view(&alloc, 1, partition_table_size);
+    REQUIRE(reinterpret_cast<uintptr_t>(v.data()) % alignof(E) == 0);
+    REQUIRE(accessor.host_view(&alloc, 1, partition_table_size).data() == v.data());
+    REQUIRE(v[0].X[0] == partition_table_size);
+    REQUIRE(v[partition_table_size - 1].X[0] == 2 * partition_table_size - 1);
+  }
+
+  SECTION("host views of legacy files are copied") {
+    temp_file.stream().write(reinterpret_cast<const char*>(&window_width), sizeof(unsigned));
+    temp_file.stream().write(reinterpret_cast<const char*>(data.data()), sizeof(E) * data.size());
+    temp_file.stream().close();
+    mapped_partition_table_accessor<E> accessor{temp_file.name()};
+    std::pmr::monotonic_buffer_resource alloc;
+    auto v = accessor.host_view(&alloc, 1, partition_table_size);
+    REQUIRE(reinterpret_cast<uintptr_t>(v.data()) % alignof(E) == 0);
+    REQUIRE(v[0].X[0] == partition_table_size);
+    REQUIRE(v[partition_table_size - 1].X[0] == 2 * partition_table_size - 1);
+  }
+}
@@ -0,0 +1,69 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/pippenger2/mapping_options.h"
+
+#include <cstdlib>
+
+#include "sxt/base/error/panic.h"
+#include "sxt/base/log/log.h"
+
+namespace sxt::mtxpp2 {
+//--------------------------------------------------------------------------------------------------
+// parse_mapping_options
+//--------------------------------------------------------------------------------------------------
+std::optional<bassy::mapped_file_options> parse_mapping_options(std::string_view s) noexcept {
+  if (s.empty() || s == "0") {
+    return std::nullopt;
+  }
+  bassy::mapped_file_options res;
+  if (s == "1") {
+    return res;
+  }
+  while (!s.empty()) {
+    auto pos = s.find(',');
+    auto flag = s.substr(0, pos);
+    if (flag == "willneed") {
+      res.will_need = true;
+    } else if (flag == "lock") {
+      res.lock = true;
+    } else {
+      baser::panic("invalid partition table mapping flag {}", flag);
+    }
+    if (pos == std::string_view::npos) {
+      break;
+    }
+    s = s.substr(pos + 1);
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// get_mapping_options
+//--------------------------------------------------------------------------------------------------
+std::optional<bassy::mapped_file_options> get_mapping_options() noexcept {
+  static auto res = []() noexcept {
+    auto s = std::getenv("BLITZAR_PARTITION_TABLE_MMAP");
+    auto res = parse_mapping_options(s == nullptr ? "" : s);
+    if (res) {
+      basl::info("mapping partition tables from files (willneed={}, lock={})", res->will_need,
+                 res->lock);
+    }
+    return res;
+  }();
+  return res;
+}
+} // namespace sxt::mtxpp2
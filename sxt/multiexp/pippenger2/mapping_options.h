@@ -0,0 +1,45 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <optional>
+#include <string_view>
+
+#include "sxt/base/system/mapped_file.h"
+
+namespace sxt::mtxpp2 {
+//--------------------------------------------------------------------------------------------------
+// parse_mapping_options
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parse how partition tables read from files should be mapped into memory.
+ *
+ * An empty string or "0" means tables are read into memory. Otherwise, s is either "1" or a
+ * comma-separated list of the flags "willneed" and "lock" and tables are mapped using the given
+ * flags.
+ */
+std::optional<bassy::mapped_file_options> parse_mapping_options(std::string_view s) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// get_mapping_options
+//--------------------------------------------------------------------------------------------------
+/**
+ * Mapping options for partition tables read from files, as specified by the environmental
+ * variable BLITZAR_PARTITION_TABLE_MMAP.
+ */
+std::optional<bassy::mapped_file_options> get_mapping_options() noexcept;
+} // namespace sxt::mtxpp2
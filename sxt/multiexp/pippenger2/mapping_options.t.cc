@@ -0,0 +1,50 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/pippenger2/mapping_options.h"
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::mtxpp2;
+
+TEST_CASE("we can parse the options for mapping partition tables") {
+  SECTION("tables aren't mapped by default") {
+    REQUIRE(!parse_mapping_options(""));
+    REQUIRE(!parse_mapping_options("0"));
+  }
+
+  SECTION("we can map tables without any flags") {
+    auto options = parse_mapping_options("1");
+    REQUIRE(options);
+    REQUIRE(!options->will_need);
+    REQUIRE(!options->lock);
+  }
+
+  SECTION("we can parse a single flag") {
+    auto options = parse_mapping_options("willneed");
+    REQUIRE(options);
+    REQUIRE(options->will_need);
+    REQUIRE(!options->lock);
+  }
+
+  SECTION("we can parse multiple flags") {
+    auto options = parse_mapping_options("lock,willneed");
+    REQUIRE(options);
+    REQUIRE(options->will_need);
+    REQUIRE(options->lock);
+  }
+}
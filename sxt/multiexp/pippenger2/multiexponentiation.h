@@ -30,6 +30,7 @@
 #include "sxt/base/iterator/split.h"
 #include "sxt/base/log/log.h"
 #include "sxt/execution/async/coroutine.h"
+#include "sxt/execution/cpu/thread_count.h"
 #include "sxt/execution/device/for_each.h"
 #include "sxt/execution/device/synchronization.h"
 #include "sxt/memory/management/managed_array.h"
@@ -236,54 +237,104 @@ xena::future<> async_multiexponentiate(basct::span<T> res,
 //--------------------------------------------------------------------------------------------------
 /**
  * Host version of async_multiexponentiate.
+ *
+ * The work is split across num_threads threads. With a single thread, the products are
+ * computed and reduced serially; otherwise, the partition products are split by product index
+ * and by chunks of generator groups and the partial products are then combined.
  */
 template <bascrv::element T, class U>
   requires std::constructible_from<T, U>
 void multiexponentiate(basct::span<T> res, const partition_table_accessor<U>& accessor,
-                       unsigned element_num_bytes, basct::cspan<uint8_t> scalars) noexcept {
+                       unsigned element_num_bytes, basct::cspan<uint8_t> scalars,
+                       unsigned num_threads) noexcept {
   auto num_outputs = res.size();
+  if (num_outputs == 0) {
+    return;
+  }
   auto n = scalars.size() / (num_outputs * element_num_bytes);
   auto num_products = num_outputs * element_num_bytes * 8u;
   SXT_DEBUG_ASSERT(
       // clang-format off
+      num_threads > 0 &&
       scalars.size() % (num_outputs * element_num_bytes) == 0
       // clang-format on
   );
 
   // compute bitwise products
-  basl::info("computing {} bitwise multiexponentiation products of length {}", num_products, n);
-  memmg::managed_array<T> products(num_products);
-  partition_product<T>(products, accessor, scalars, 0);
+  basl::info("computing {} bitwise multiexponentiation products of length {} using {} threads",
+             num_products, n, num_threads);
+  if (num_threads == 1) {
+    memmg::managed_array<T> products(num_products);
+    partition_product<T>(products, accessor, scalars, 0);
 
-  // reduce products
-  basl::info("reducing {} products to {} outputs", num_products, num_outputs);
-  reduce_products<T>(res, products);
+    // reduce products
+    basl::info("reducing {} products to {} outputs", num_products, num_outputs);
+    reduce_products<T>(res, products);
+    basl::info("completed {} reductions", num_outputs);
+    return;
+  }
+  auto partial_products =
+      concurrent_partition_product<T>(num_products, accessor, scalars, num_threads);
+
+  // combine the partial products
+  basl::info("combining {} partial product chunks", partial_products.size() / num_products);
+  combine_reduce<T>(res, element_num_bytes, partial_products, num_threads);
   basl::info("completed {} reductions", num_outputs);
 }
 
 template <bascrv::element T, class U>
   requires std::constructible_from<T, U>
 void multiexponentiate(basct::span<T> res, const partition_table_accessor<U>& accessor,
-                       basct::cspan<unsigned> output_bit_table,
-                       basct::cspan<uint8_t> scalars) noexcept {
+                       unsigned element_num_bytes, basct::cspan<uint8_t> scalars) noexcept {
+  multiexponentiate(res, accessor, element_num_bytes, scalars, xencpu::get_num_threads());
+}
+
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+void multiexponentiate(basct::span<T> res, const partition_table_accessor<U>& accessor,
+                       basct::cspan<unsigned> output_bit_table, basct::cspan<uint8_t> scalars,
+                       unsigned num_threads) noexcept {
   auto num_outputs = res.size();
+  if (num_outputs == 0) {
+    return;
+  }
   auto num_products = std::accumulate(output_bit_table.begin(), output_bit_table.end(), 0u);
   auto num_output_bytes = basn::divide_up<size_t>(num_products, 8);
   auto n = scalars.size() / num_output_bytes;
   SXT_DEBUG_ASSERT(
       // clang-format off
+      num_threads > 0 &&
       scalars.size() % num_output_bytes == 0
       // clang-format on
   );
 
   // compute bitwise products
-  basl::info("computing {} bitwise multiexponentiation products of length {}", num_products, n);
-  memmg::managed_array<T> products(num_products);
-  partition_product<T>(products, accessor, scalars, 0);
+  basl::info("computing {} bitwise multiexponentiation products of length {} using {} threads",
+             num_products, n, num_threads);
+  if (num_threads == 1) {
+    memmg::managed_array<T> products(num_products);
+    partition_product<T>(products, accessor, scalars, 0);
 
-  // reduce products
-  basl::info("reducing {} products to {} outputs", num_products, num_outputs);
-  reduce_products<T>(res, output_bit_table, products);
+    // reduce products
+    basl::info("reducing {} products to {} outputs", num_products, num_outputs);
+    reduce_products<T>(res, output_bit_table, products);
+    basl::info("completed {} reductions", num_outputs);
+    return;
+  }
+  auto partial_products =
+      concurrent_partition_product<T>(num_products, accessor, scalars, num_threads);
+
+  // combine the partial products
+  basl::info("combining {} partial product chunks", partial_products.size() / num_products);
+  combine_reduce<T>(res, output_bit_table, partial_products, num_threads);
   basl::info("completed {} reductions", num_outputs);
 }
+
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+void multiexponentiate(basct::span<T> res, const partition_table_accessor<U>& accessor,
+                       basct::cspan<unsigned> output_bit_table,
+                       basct::cspan<uint8_t> scalars) noexcept {
+  multiexponentiate(res, accessor, output_bit_table, scalars, xencpu::get_num_threads());
+}
 } // namespace sxt::mtxpp2
@@ -147,6 +147,18 @@ TEST_CASE("we can compute multiexponentiations using a precomputed table of part
     REQUIRE(res[1] == 2u * generators[0].value);
   }
 
+  SECTION("we can compute a multiexponentiation on the host using multiple threads") {
+    res.resize(3);
+    scalars.resize(3 * 32);
+    for (auto& x : scalars) {
+      x = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 255}(rng));
+    }
+    std::vector<E> expected(3);
+    multiexponentiate<E>(expected, *accessor, 1, scalars, 1);
+    multiexponentiate<E>(res, *accessor, 1, scalars, 4);
+    REQUIRE(res == expected);
+  }
+
   SECTION("we can split a multi-exponentiation") {
     basit::split_options options{
         .min_chunk_size = 16u,
@@ -266,6 +278,16 @@ TEST_CASE("we can compute multiexponentiations with packed scalars") {
     REQUIRE(res[1] == generators[1].value);
     REQUIRE(res[2] == 6u * generators[0].value + 5u * generators[1].value);
   }
+
+  SECTION("we can compute packed multiexponentiations on the host using multiple threads") {
+    output_bit_table = {2, 1, 3};
+    scalars = {0b110011, 0b101101};
+    res.resize(3);
+    multiexponentiate<E>(res, *accessor, output_bit_table, scalars, 3);
+    REQUIRE(res[0] == 3u * generators[0].value + generators[1].value);
+    REQUIRE(res[1] == generators[1].value);
+    REQUIRE(res[2] == 6u * generators[0].value + 5u * generators[1].value);
+  }
 }
 
 TEST_CASE("we can compute multiexponentiations with curve-21") {
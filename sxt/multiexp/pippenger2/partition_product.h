@@ -19,18 +19,28 @@
 #include <algorithm>
 #include <concepts>
 #include <cstdint>
+#include <iterator>
 #include <memory_resource>
+#include <utility>
+#include <vector>
 
 #include "sxt/algorithm/iteration/for_each.h"
+#include "sxt/base/bit/transpose.h"
 #include "sxt/base/container/span.h"
+#include "sxt/base/container/span_utility.h"
+#include "sxt/base/curve/batch_addable.h"
 #include "sxt/base/curve/element.h"
 #include "sxt/base/device/memory_utility.h"
 #include "sxt/base/device/stream.h"
 #include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/base/iterator/split.h"
 #include "sxt/base/macro/cuda_callable.h"
+#include "sxt/base/memory/prefetch.h"
 #include "sxt/base/num/divide_up.h"
 #include "sxt/base/num/round_up.h"
 #include "sxt/execution/async/coroutine.h"
+#include "sxt/execution/cpu/for_each.h"
 #include "sxt/execution/device/synchronization.h"
 #include "sxt/memory/management/managed_array.h"
 #include "sxt/memory/resource/async_device_resource.h"
@@ -38,11 +48,31 @@
 #include "sxt/multiexp/pippenger2/partition_table_accessor.h"
 
 namespace sxt::mtxpp2 {
+//--------------------------------------------------------------------------------------------------
+// pack_scalar_bytes
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pack the bytes of block_size <= 8 consecutive generators' scalars into a 64-bit word with the
+ * byte of generator j in byte j, ready to be transposed into bit planes.
+ */
+CUDA_CALLABLE inline uint64_t pack_scalar_bytes(const uint8_t* __restrict__ scalars, unsigned step,
+                                                unsigned block_size) noexcept {
+  uint64_t res = 0;
+  for (unsigned j = 0; j < block_size; ++j) {
+    res |= static_cast<uint64_t>(scalars[j * step]) << (8u * j);
+  }
+  return res;
+}
+
 //--------------------------------------------------------------------------------------------------
 // compute_partition_index
 //--------------------------------------------------------------------------------------------------
 /**
  * Compute the index in the partition table of the product for a group of 16 scalars.
+ *
+ * Only one bit plane is needed here, so the bits are tested directly; transposing a block of 8
+ * scalar bytes only pays off when all 8 of its planes are used, as in
+ * compute_byte_partition_indexes.
  */
 CUDA_CALLABLE inline unsigned compute_partition_index(const uint8_t* __restrict__ scalars,
                                                       unsigned step, unsigned window_width,
@@ -93,6 +123,275 @@ CUDA_CALLABLE void partition_product_kernel(T& product, const U* __restrict__ pa
   product = res;
 }
 
+//--------------------------------------------------------------------------------------------------
+// offset_partition_product_kernel
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a product for n scalars paired with the generators [first, first + n).
+ *
+ * partition_table points to the slice of the group containing generator first. Groups before it
+ * are skipped entirely; if first isn't aligned to the window width, the entries of the first
+ * group below first are masked out of its index.
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+CUDA_CALLABLE void offset_partition_product_kernel(T& product, const U* __restrict__ partition_table,
+                                                   const uint8_t* __restrict__ scalars,
+                                                   unsigned byte_index, unsigned bit_offset,
+                                                   unsigned window_width, unsigned num_products,
+                                                   unsigned first, unsigned n) noexcept {
+  auto num_partition_entries = 1u << window_width;
+  auto step = num_products / 8u;
+  auto shift = first % window_width;
+
+  scalars += byte_index;
+
+  // lookup the entry of the first, possibly partial, group
+  auto num_group_elements = window_width - shift;
+  auto partition_index = compute_partition_index(scalars, step, num_group_elements, n, bit_offset);
+  T res{partition_table[partition_index << shift]};
+
+  // sum remaining entries
+  while (n > num_group_elements) {
+    n -= num_group_elements;
+    partition_table += num_partition_entries;
+    scalars += num_group_elements * step;
+    num_group_elements = window_width;
+
+    partition_index = compute_partition_index(scalars, step, window_width, n, bit_offset);
+    T e{partition_table[partition_index]};
+    add_inplace(res, e);
+  }
+
+  // write result
+  product = res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_byte_partition_indexes
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the partition indexes of a group of num_elements generators for the 8 products whose
+ * bits are stored in a single byte of each scalar.
+ *
+ * Rather than testing one bit at a time, the scalar bytes are transposed into bit planes in
+ * blocks of 8 generators so that each block contributes a full byte of every index.
+ */
+CUDA_CALLABLE inline void compute_byte_partition_indexes(unsigned* __restrict__ indexes,
+                                                         const uint8_t* __restrict__ scalars,
+                                                         unsigned step,
+                                                         unsigned num_elements) noexcept {
+  for (unsigned k = 0; k < 8u; ++k) {
+    indexes[k] = 0;
+  }
+  for (unsigned block_first = 0; block_first < num_elements; block_first += 8u) {
+    auto block_size = std::min(8u, num_elements - block_first);
+    auto x = basbt::transpose8x8(pack_scalar_bytes(scalars + block_first * step, step, block_size));
+    for (unsigned k = 0; k < 8u; ++k) {
+      indexes[k] |= static_cast<unsigned>((x >> (8u * k)) & 0xffu) << block_first;
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_partition_index_table_entries
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the partition indexes of generator group group_index for the 8 products whose bits are
+ * stored in byte byte_index of each scalar and write them to
+ *
+ *    indexes[group_index * num_products_round_8 + 8 * byte_index + k] for k in [0, 8)
+ *
+ * This is the transpose stage of async_partition_product: a device thread transposes the scalar
+ * bytes of a group once so that the product threads only need to look up table entries.
+ */
+CUDA_CALLABLE inline void compute_partition_index_table_entries(
+    unsigned* __restrict__ indexes, const uint8_t* __restrict__ scalars,
+    unsigned num_products_round_8, unsigned window_width, unsigned n, unsigned group_index,
+    unsigned byte_index) noexcept {
+  auto num_product_bytes = num_products_round_8 / 8u;
+  auto first = group_index * window_width;
+  compute_byte_partition_indexes(indexes + group_index * num_products_round_8 + 8u * byte_index,
+                                 scalars + first * num_product_bytes + byte_index,
+                                 num_product_bytes, std::min(window_width, n - first));
+}
+
+//--------------------------------------------------------------------------------------------------
+// indexed_partition_product_kernel
+//--------------------------------------------------------------------------------------------------
+/**
+ * Equivalent to partition_product_kernel but with the partition indexes of every group computed
+ * ahead of time by compute_partition_index_table_entries.
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+CUDA_CALLABLE void indexed_partition_product_kernel(T& product,
+                                                    const U* __restrict__ partition_table,
+                                                    const unsigned* __restrict__ indexes,
+                                                    unsigned product_index, unsigned window_width,
+                                                    unsigned num_products_round_8,
+                                                    unsigned num_partitions) noexcept {
+  if (num_partitions == 0) {
+    product = T::identity();
+    return;
+  }
+  auto num_partition_entries = 1u << window_width;
+  indexes += product_index;
+
+  // lookup the first entry
+  T res{partition_table[*indexes]};
+
+  // sum remaining entries
+  for (unsigned partition_index = 1; partition_index < num_partitions; ++partition_index) {
+    partition_table += num_partition_entries;
+    indexes += num_products_round_8;
+    T e{partition_table[*indexes]};
+    add_inplace(res, e);
+  }
+
+  // write result
+  product = res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_partition_indexes
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the partition indexes of a single group of generators for the products
+ * [product_first, product_first + indexes.size()).
+ *
+ * Scalars are laid out with num_product_bytes bytes per generator.
+ */
+inline void compute_partition_indexes(basct::span<unsigned> indexes,
+                                      const uint8_t* __restrict__ scalars,
+                                      unsigned num_product_bytes, unsigned product_first,
+                                      unsigned num_elements) noexcept {
+  auto product_last = product_first + static_cast<unsigned>(indexes.size());
+  unsigned byte_indexes[8];
+  for (auto byte_index = product_first / 8u; byte_index * 8u < product_last; ++byte_index) {
+    compute_byte_partition_indexes(byte_indexes, scalars + byte_index, num_product_bytes,
+                                   num_elements);
+    auto first = std::max(byte_index * 8u, product_first);
+    auto last = std::min(byte_index * 8u + 8u, product_last);
+    for (auto product_index = first; product_index < last; ++product_index) {
+      indexes[product_index - product_first] = byte_indexes[product_index % 8u];
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// accumulate_partition_entries
+//--------------------------------------------------------------------------------------------------
+/**
+ * products[i] = products[i] + partition_table[indexes[i]]
+ *
+ * The additions are independent, so batch_addable curves with a batch_add_inplace overload for the
+ * table's entry type, such as curve21 with its SIMD lane kernels, can compute them together.
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+void accumulate_partition_entries(basct::span<T> products, const U* __restrict__ partition_table,
+                                  basct::cspan<unsigned> indexes) noexcept {
+  static_assert(!bascrv::batch_addable<T> || bascrv::batch_operations_declared<T>,
+                "include the curve's batch_add operation header");
+  if constexpr (requires { batch_add_inplace(products, partition_table, indexes); }) {
+    batch_add_inplace(products, partition_table, indexes);
+  } else {
+    for (size_t i = 0; i < products.size(); ++i) {
+      T e{partition_table[indexes[i]]};
+      add_inplace(products[i], e);
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// offset_partition_product_host_kernel
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host kernel for the products [product_first, product_first + products.size()) where each
+ * product pairs n scalars with the generators [first, first + n) and shift = first % window_width.
+ *
+ * partition_table points to the slice of the group containing generator first. Rather than
+ * walking every table slice once per product as offset_partition_product_kernel does, we process
+ * all the products for one group of generators at a time so that the group's slice stays resident
+ * in cache. The partition indexes of the next group are computed ahead of time and their entries
+ * prefetched while the current group is summed.
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+void offset_partition_product_host_kernel(basct::span<T> products, unsigned num_products,
+                                          unsigned product_first,
+                                          const U* __restrict__ partition_table,
+                                          unsigned window_width,
+                                          const uint8_t* __restrict__ scalars, unsigned shift,
+                                          unsigned n) noexcept {
+  SXT_DEBUG_ASSERT(shift < window_width);
+  auto num_slice_products = static_cast<unsigned>(products.size());
+  auto num_partition_entries = 1u << window_width;
+  auto num_product_bytes = basn::round_up(num_products, 8u) / 8u;
+  if (n == 0) {
+    std::fill(products.begin(), products.end(), T::identity());
+    return;
+  }
+  auto num_groups = basn::divide_up(n + shift, window_width);
+
+  // the first, possibly partial, group holds the scalars [0, window_width - shift) and
+  // group g > 0 the scalars starting at g * window_width - shift
+  std::vector<unsigned> indexes(num_slice_products);
+  std::vector<unsigned> next_indexes(num_slice_products);
+  compute_partition_indexes(indexes, scalars, num_product_bytes, product_first,
+                            std::min(window_width - shift, n));
+  if (shift != 0) {
+    for (auto& index : indexes) {
+      index <<= shift;
+    }
+  }
+  for (unsigned group_index = 0; group_index < num_groups; ++group_index) {
+    auto table = partition_table + group_index * num_partition_entries;
+
+    // look ahead to the next group
+    auto next_group_index = group_index + 1u;
+    if (next_group_index < num_groups) {
+      auto next_first = next_group_index * window_width - shift;
+      compute_partition_indexes(next_indexes, scalars + next_first * num_product_bytes,
+                                num_product_bytes, product_first,
+                                std::min(window_width, n - next_first));
+      auto next_table = table + num_partition_entries;
+      for (auto index : next_indexes) {
+        // entries of projective curves such as bls12-381 span several cache lines
+        basm::prefetch(next_table + index, sizeof(U));
+      }
+    }
+
+    // accumulate the current group
+    if (group_index == 0) {
+      for (unsigned i = 0; i < num_slice_products; ++i) {
+        products[i] = T{table[indexes[i]]};
+      }
+    } else {
+      accumulate_partition_entries<T>(products, table, indexes);
+    }
+    std::swap(indexes, next_indexes);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// partition_product_host_kernel
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host kernel for the products [product_first, product_first + products.size()) of n scalars
+ * paired with the generators starting at the first group of partition_table.
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+void partition_product_host_kernel(basct::span<T> products, unsigned num_products,
+                                   unsigned product_first, const U* __restrict__ partition_table,
+                                   unsigned window_width, const uint8_t* __restrict__ scalars,
+                                   unsigned n) noexcept {
+  offset_partition_product_host_kernel<T>(products, num_products, product_first, partition_table,
+                                          window_width, scalars, 0, n);
+}
+
 //--------------------------------------------------------------------------------------------------
 // async_partition_product
 //--------------------------------------------------------------------------------------------------
@@ -135,23 +434,43 @@ xena::future<> async_partition_product(basct::span<T> products,
   accessor.async_copy_to_device(partition_table, stream, offset / window_width);
   co_await std::move(scalars_fut);
 
+  // partition indexes
+  auto num_product_bytes = static_cast<unsigned>(num_products_round_8 / 8u);
+  memmg::managed_array<unsigned> indexes{num_partitions * num_products_round_8, &resource};
+  auto f_indexes = [
+                       // clang-format off
+    indexes = indexes.data(),
+    scalars = scalars_dev.data(),
+    num_products_round_8 = static_cast<unsigned>(num_products_round_8),
+    num_product_bytes = num_product_bytes,
+    window_width = window_width,
+    n = n
+                       // clang-format on
+  ] __device__
+                   __host__(unsigned /*num_tasks*/, unsigned task_index) noexcept {
+                     compute_partition_index_table_entries(
+                         indexes, scalars, num_products_round_8, window_width, n,
+                         task_index / num_product_bytes, task_index % num_product_bytes);
+                   };
+  if (num_partitions > 0) {
+    algi::launch_for_each_kernel(stream, f_indexes, num_partitions * num_product_bytes);
+  }
+
   // product
   auto f = [
                // clang-format off
     products = products.data(),
-    scalars = scalars_dev.data(),
     partition_table = partition_table.data(),
+    indexes = indexes.data(),
     window_width = window_width,
-    n = n
+    num_partitions = num_partitions
                // clang-format on
   ] __device__
            __host__(unsigned num_products, unsigned product_index) noexcept {
-             auto byte_index = product_index / 8u;
-             auto bit_offset = product_index % 8u;
              auto num_products_round_8 = basn::round_up(num_products, 8u);
-             partition_product_kernel<T>(products[product_index], partition_table, scalars,
-                                         byte_index, bit_offset, window_width, num_products_round_8,
-                                         n);
+             indexed_partition_product_kernel<T>(products[product_index], partition_table,
+                                                 indexes, product_index, window_width,
+                                                 num_products_round_8, num_partitions);
            };
   algi::launch_for_each_kernel(stream, f, num_products);
   co_await xendv::await_stream(stream);
@@ -160,6 +479,48 @@ xena::future<> async_partition_product(basct::span<T> products,
 //--------------------------------------------------------------------------------------------------
 // partition_product
 //--------------------------------------------------------------------------------------------------
+/**
+ * Compute the slice of products [product_first, product_first + products.size()) of a
+ * multiproduct with num_products total products using a host view of the partition table.
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+void partition_product(basct::span<T> products, unsigned num_products, unsigned product_first,
+                       basct::cspan<U> partition_table, unsigned window_width,
+                       basct::cspan<uint8_t> scalars, unsigned n) noexcept {
+  partition_product_host_kernel<T>(products, num_products, product_first, partition_table.data(),
+                                   window_width, scalars.data(), n);
+}
+
+/**
+ * Compute the slice of products [product_first, product_first + products.size()) of a
+ * multiproduct with num_products total products.
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+void partition_product(basct::span<T> products, unsigned num_products, unsigned product_first,
+                       const partition_table_accessor<U>& accessor, basct::cspan<uint8_t> scalars,
+                       unsigned offset) noexcept {
+  auto num_products_round_8 = basn::round_up<size_t>(num_products, 8u);
+  auto n = static_cast<unsigned>(scalars.size() * 8u / num_products_round_8);
+  auto window_width = accessor.window_width();
+  auto partition_table_size = 1u << window_width;
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+      product_first + products.size() <= num_products &&
+      scalars.size() * 8u % num_products_round_8 == 0 &&
+      offset % window_width == 0
+      // clang-format on
+  );
+  std::pmr::monotonic_buffer_resource alloc;
+
+  auto partition_table = accessor.host_view(&alloc, offset / window_width,
+                                            basn::divide_up(n, window_width) * partition_table_size);
+
+  partition_product<T>(products, num_products, product_first, partition_table, window_width,
+                       scalars, n);
+}
+
 /**
  * Compute the multiproduct for the bits of an array of scalars using an accessor to
  * precomputed sums for each group of generators.
@@ -168,28 +529,86 @@ template <bascrv::element T, class U>
   requires std::constructible_from<T, U>
 void partition_product(basct::span<T> products, const partition_table_accessor<U>& accessor,
                        basct::cspan<uint8_t> scalars, unsigned offset) noexcept {
-  auto num_products = products.size();
+  partition_product<T>(products, products.size(), 0, accessor, scalars, offset);
+}
+
+//--------------------------------------------------------------------------------------------------
+// concurrent_partition_product
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host version of partition_product that splits the work across num_threads threads.
+ *
+ * Work is split both by product index and by chunks of generator groups. The products for
+ * the i-th chunk of generator groups are written to
+ *
+ *    partial_products[i * num_products, (i + 1) * num_products)
+ *
+ * so that the chunks can be summed with combine_reduce.
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+memmg::managed_array<T> concurrent_partition_product(unsigned num_products,
+                                                     const partition_table_accessor<U>& accessor,
+                                                     basct::cspan<uint8_t> scalars,
+                                                     unsigned num_threads) noexcept {
   auto num_products_round_8 = basn::round_up<size_t>(num_products, 8u);
-  auto n = static_cast<unsigned>(scalars.size() * 8u / num_products_round_8);
+  auto num_product_bytes = num_products_round_8 / 8u;
+  auto n = static_cast<unsigned>(scalars.size() / num_product_bytes);
   auto window_width = accessor.window_width();
   auto partition_table_size = 1u << window_width;
+  auto num_groups = basn::divide_up(n, window_width);
   SXT_DEBUG_ASSERT(
       // clang-format off
-      scalars.size() * 8u % num_products_round_8 == 0 &&
-      offset % window_width == 0
+      num_products > 0 &&
+      num_threads > 0 &&
+      scalars.size() % num_product_bytes == 0
       // clang-format on
   );
   std::pmr::monotonic_buffer_resource alloc;
+  auto partition_table = accessor.host_view(&alloc, 0, num_groups * partition_table_size);
 
-  auto partition_table =
-      accessor.host_view(&alloc, offset, basn::divide_up(n, window_width) * partition_table_size);
+  // Split by product index first as the chunks are independent. Only split the generator
+  // groups if there aren't enough products to keep every thread busy.
+  auto [product_first, product_last] =
+      basit::split(basit::index_range{0, num_products}, {.split_factor = num_threads});
+  auto num_product_chunks = static_cast<unsigned>(std::distance(product_first, product_last));
+  auto num_group_chunks =
+      std::max(std::min(basn::divide_up(num_threads, num_product_chunks), num_groups), 1u);
+  auto [group_first, group_last] =
+      basit::split(basit::index_range{0, num_groups}, {.split_factor = num_group_chunks});
+  num_group_chunks = std::max(static_cast<unsigned>(std::distance(group_first, group_last)), 1u);
 
-  for (unsigned product_index = 0; product_index < num_products; ++product_index) {
-    auto byte_index = product_index / 8u;
-    auto bit_offset = product_index % 8u;
-    auto num_products_round_8 = basn::round_up<size_t>(num_products, 8u);
-    partition_product_kernel<T>(products[product_index], partition_table.data(), scalars.data(),
-                                byte_index, bit_offset, window_width, num_products_round_8, n);
+  memmg::managed_array<T> partial_products(num_products * num_group_chunks);
+  if (num_groups == 0) {
+    std::fill(partial_products.begin(), partial_products.end(), T::identity());
+    return partial_products;
   }
+
+  // compute products
+  auto num_tasks = num_product_chunks * num_group_chunks;
+  auto [task_first, task_last] =
+      basit::split(basit::index_range{0, num_tasks}, {.max_chunk_size = 1});
+  xencpu::concurrent_for_each(
+      task_first, task_last,
+      [&](const basit::index_range& rng) noexcept {
+        auto group_chunk_index = rng.a() / num_product_chunks;
+        auto product_chunk_index = rng.a() % num_product_chunks;
+        auto groups = *(group_first + static_cast<ptrdiff_t>(group_chunk_index));
+        auto products = *(product_first + static_cast<ptrdiff_t>(product_chunk_index));
+        auto generator_first = groups.a() * window_width;
+        auto generator_last = std::min<size_t>(groups.b() * window_width, n);
+        partition_product<T>(
+            basct::subspan(partial_products, group_chunk_index * num_products + products.a(),
+                           products.size()),
+            num_products, products.a(),
+            partition_table.subspan(groups.a() * partition_table_size,
+                                    groups.size() * partition_table_size),
+            window_width,
+            scalars.subspan(generator_first * num_product_bytes,
+                            (generator_last - generator_first) * num_product_bytes),
+            static_cast<unsigned>(generator_last - generator_first));
+      },
+      num_threads);
+  return partial_products;
 }
 } // namespace sxt::mtxpp2
@@ -16,12 +16,20 @@
  */
 #include "sxt/multiexp/pippenger2/partition_product.h"
 
+#include <algorithm>
 #include <random>
 #include <vector>
 
 #include "sxt/base/curve/example_element.h"
 #include "sxt/base/device/synchronization.h"
 #include "sxt/base/test/unit_test.h"
+#include "sxt/curve21/operation/add.h"
+#include "sxt/curve21/operation/batch_add.h"
+#include "sxt/curve21/operation/double.h"
+#include "sxt/curve21/operation/neg.h"
+#include "sxt/curve21/type/compact_element.h"
+#include "sxt/curve21/type/element_p3.h"
+#include "sxt/curve21/type/literal.h"
 #include "sxt/execution/schedule/scheduler.h"
 #include "sxt/memory/management/managed_array.h"
 #include "sxt/memory/resource/managed_device_resource.h"
@@ -29,6 +37,7 @@
 
 using namespace sxt;
 using namespace sxt::mtxpp2;
+using c21t::operator""_c21;
 
 TEST_CASE("we can compute the index used to lookup the precomputed sum for a partition") {
   uint8_t scalars[32] = {};
@@ -77,6 +86,15 @@ TEST_CASE("we can compute the index used to lookup the precomputed sum for a par
     auto index = compute_partition_index(scalars, 1, 2, 16, 0);
     REQUIRE(index == 2);
   }
+
+  SECTION("we handle high bit indexes across blocks of 8 scalars") {
+    scalars[1] = 0x80;
+    scalars[9] = 0x81;
+    scalars[11] = 0x80;
+    scalars[12] = 0x80;
+    auto index = compute_partition_index(scalars, 1, 16, 12, 7);
+    REQUIRE(index == ((1u << 1u) | (1u << 9u) | (1u << 11u)));
+  }
 }
 
 TEST_CASE("we can compute the product of partitions") {
@@ -177,6 +195,43 @@ TEST_CASE("we can compute the product of partitions") {
     expected[0] = partition_table[1].value + partition_table[partition_table_size + 1].value;
     REQUIRE(products == expected);
   }
+
+  SECTION("we can compute products with an offset on the host") {
+    scalars.resize(32);
+    scalars[0] = 1u;
+    scalars[16] = 1u;
+    partition_product<E>(products, accessor, scalars, 16);
+    expected[0] = partition_table[partition_table_size + 1].value +
+                  partition_table[2 * partition_table_size + 1].value;
+    REQUIRE(products == expected);
+  }
+
+  SECTION("we can compute a slice of the products on the host") {
+    scalars = {1u, 3u};
+    products.resize(1);
+    partition_product<E>(products, 8, 1, accessor, scalars, 0);
+    REQUIRE(products[0] == partition_table[2]);
+  }
+
+  SECTION("we can compute products on the host using multiple threads") {
+    scalars.resize(64);
+    scalars[0] = 1u;
+    scalars[16] = 3u;
+    scalars[33] = 2u;
+    auto partial_products = concurrent_partition_product<E>(8, accessor, scalars, 4);
+    REQUIRE(partial_products.size() % 8 == 0);
+    memmg::managed_array<E> sums(8);
+    for (auto& e : sums) {
+      e = 0u;
+    }
+    for (unsigned i = 0; i < partial_products.size(); ++i) {
+      add_inplace(sums[i % 8], partial_products[i]);
+    }
+    expected[0] = partition_table[1].value + partition_table[partition_table_size + 1].value;
+    expected[1] = partition_table[partition_table_size + 1].value +
+                  partition_table[2 * partition_table_size + 2].value;
+    REQUIRE(sums == expected);
+  }
 }
 
 TEST_CASE("we can compute the product of partitions with different bit widths") {
@@ -223,3 +278,213 @@ TEST_CASE("we can compute the product of partitions with different bit widths")
     REQUIRE(products == expected);
   }
 }
+
+TEST_CASE("we can compute the partition indexes of a group of generators") {
+  std::vector<unsigned> indexes(3);
+
+  SECTION("we handle a single generator") {
+    std::vector<uint8_t> scalars = {0b101u};
+    compute_partition_indexes(indexes, scalars.data(), 1, 0, 1);
+    REQUIRE(indexes == std::vector<unsigned>{1, 0, 1});
+  }
+
+  SECTION("we handle multiple generators and an offset") {
+    std::vector<uint8_t> scalars = {0b1010u, 0b0110u};
+    compute_partition_indexes(indexes, scalars.data(), 1, 1, 2);
+    REQUIRE(indexes == std::vector<unsigned>{3, 2, 1});
+  }
+}
+
+TEST_CASE("the host kernel matches the per-product kernel") {
+  using E = bascrv::element97;
+  const unsigned window_width = 4;
+  const unsigned num_products = 10;
+  const unsigned n = 45;
+  const unsigned num_product_bytes = 2;
+  const auto num_groups = basn::divide_up(n, window_width);
+
+  std::mt19937 rng{0};
+  std::vector<E> partition_table(num_groups << window_width);
+  for (auto& e : partition_table) {
+    e = std::uniform_int_distribution<unsigned>{0, 96}(rng);
+  }
+  std::vector<uint8_t> scalars(n * num_product_bytes);
+  for (auto& x : scalars) {
+    x = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 255}(rng));
+  }
+
+  std::vector<E> expected(num_products);
+  for (unsigned i = 0; i < num_products; ++i) {
+    partition_product_kernel<E>(expected[i], partition_table.data(), scalars.data(), i / 8u,
+                                i % 8u, window_width, 16, n);
+  }
+
+  SECTION("we can compute all the products") {
+    std::vector<E> products(num_products);
+    partition_product_host_kernel<E>(products, num_products, 0, partition_table.data(),
+                                     window_width, scalars.data(), n);
+    REQUIRE(products == expected);
+  }
+
+  SECTION("we can compute a slice of the products") {
+    std::vector<E> products(6);
+    partition_product_host_kernel<E>(products, num_products, 3, partition_table.data(),
+                                     window_width, scalars.data(), n);
+    REQUIRE(products == std::vector<E>(expected.begin() + 3, expected.begin() + 9));
+  }
+}
+
+TEST_CASE("the host kernel matches the per-product kernel for curve-21") {
+  using T = c21t::element_p3;
+  using U = c21t::compact_element;
+  const unsigned window_width = 4;
+  const unsigned num_products = 13;
+  const unsigned n = 21;
+  const unsigned num_product_bytes = 2;
+  const auto num_groups = basn::divide_up(n, window_width);
+
+  std::mt19937 rng{0};
+  std::vector<U> partition_table(num_groups << window_width);
+  T e = 0x123_c21;
+  for (auto& entry : partition_table) {
+    c21o::add(e, e, 0x456_c21);
+    entry = static_cast<U>(e);
+  }
+  std::vector<uint8_t> scalars(n * num_product_bytes);
+  for (auto& x : scalars) {
+    x = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 255}(rng));
+  }
+
+  std::vector<T> expected(num_products);
+  for (unsigned i = 0; i < num_products; ++i) {
+    partition_product_kernel<T>(expected[i], partition_table.data(), scalars.data(), i / 8u,
+                                i % 8u, window_width, 16, n);
+  }
+
+  std::vector<T> products(num_products);
+  partition_product_host_kernel<T>(products, num_products, 0, partition_table.data(),
+                                   window_width, scalars.data(), n);
+  REQUIRE(products == expected);
+}
+
+TEST_CASE("we can compute products for generators with an offset") {
+  using E = bascrv::element97;
+  const unsigned window_width = 4;
+  const unsigned num_products = 16;
+  const unsigned num_product_bytes = 2;
+
+  std::mt19937 rng{0};
+  std::vector<E> partition_table(8u << window_width);
+  for (auto& e : partition_table) {
+    e = std::uniform_int_distribution<unsigned>{0, 96}(rng);
+  }
+  std::vector<uint8_t> scalars(20 * num_product_bytes);
+  for (auto& x : scalars) {
+    x = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 255}(rng));
+  }
+
+  // An offset product is equivalent to an aligned product whose scalars are preceded by zeros
+  // for the generators before first in its group.
+  auto check = [&](unsigned first, unsigned n) noexcept {
+    auto shift = first % window_width;
+    std::vector<uint8_t> padded_scalars((shift + n) * num_product_bytes);
+    std::copy_n(scalars.begin(), n * num_product_bytes,
+                padded_scalars.begin() + shift * num_product_bytes);
+    auto table = partition_table.data() + (first / window_width) * (1u << window_width);
+    std::vector<E> expected(num_products);
+    for (unsigned i = 0; i < num_products; ++i) {
+      E product;
+      partition_product_kernel<E>(expected[i], table, padded_scalars.data(), i / 8u, i % 8u,
+                                  window_width, num_products, shift + n);
+      offset_partition_product_kernel<E>(product, table, scalars.data(), i / 8u, i % 8u,
+                                         window_width, num_products, first, n);
+      REQUIRE(product == expected[i]);
+    }
+    std::vector<E> products(num_products - 3);
+    offset_partition_product_host_kernel<E>(products, num_products, 3, table, window_width,
+                                            scalars.data(), shift, n);
+    REQUIRE(products == std::vector<E>(expected.begin() + 3, expected.end()));
+  };
+
+  SECTION("we handle an aligned offset") { check(8, 11); }
+
+  SECTION("we handle a misaligned offset within a single group") {
+    check(5, 2);
+    check(6, 2);
+  }
+
+  SECTION("we handle a misaligned offset spanning multiple groups") {
+    check(3, 1);
+    check(3, 20);
+    check(13, 15);
+  }
+}
+
+TEST_CASE("we can compute the partition indexes for a byte of products") {
+  unsigned indexes[8];
+  std::vector<uint8_t> scalars(20);
+
+  SECTION("we handle a single generator") {
+    scalars[0] = 0b10000101u;
+    compute_byte_partition_indexes(indexes, scalars.data(), 1, 1);
+    REQUIRE(std::vector<unsigned>(indexes, indexes + 8) ==
+            std::vector<unsigned>{1, 0, 1, 0, 0, 0, 0, 1});
+  }
+
+  SECTION("we match compute_partition_index for more than 8 generators") {
+    std::mt19937 rng{0};
+    for (auto& x : scalars) {
+      x = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 255}(rng));
+    }
+    compute_byte_partition_indexes(indexes, scalars.data() + 1, 2, 10);
+    for (unsigned k = 0; k < 8; ++k) {
+      REQUIRE(indexes[k] == compute_partition_index(scalars.data() + 1, 2, 16, 10, k));
+    }
+  }
+}
+
+TEST_CASE("we can compute products from a table of partition indexes") {
+  using E = bascrv::element97;
+  const unsigned window_width = 4;
+  const unsigned num_products = 10;
+  const unsigned num_products_round_8 = 16;
+  const unsigned num_product_bytes = 2;
+
+  std::mt19937 rng{0};
+  auto check = [&](unsigned n) noexcept {
+    auto num_partitions = basn::divide_up(n, window_width);
+    std::vector<E> partition_table(std::max(num_partitions, 1u) << window_width);
+    for (auto& e : partition_table) {
+      e = std::uniform_int_distribution<unsigned>{0, 96}(rng);
+    }
+    partition_table[0] = E::identity();
+    std::vector<uint8_t> scalars(n * num_product_bytes);
+    for (auto& x : scalars) {
+      x = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 255}(rng));
+    }
+    std::vector<unsigned> indexes(num_partitions * num_products_round_8);
+    for (unsigned group_index = 0; group_index < num_partitions; ++group_index) {
+      for (unsigned byte_index = 0; byte_index < num_product_bytes; ++byte_index) {
+        compute_partition_index_table_entries(indexes.data(), scalars.data(), num_products_round_8,
+                                              window_width, n, group_index, byte_index);
+      }
+    }
+    for (unsigned i = 0; i < num_products; ++i) {
+      E expected, product;
+      partition_product_kernel<E>(expected, partition_table.data(), scalars.data(), i / 8u, i % 8u,
+                                  window_width, num_products_round_8, n);
+      indexed_partition_product_kernel<E>(product, partition_table.data(), indexes.data(), i,
+                                          window_width, num_products_round_8, num_partitions);
+      REQUIRE(product == expected);
+    }
+  };
+
+  SECTION("we handle no generators") { check(0); }
+
+  SECTION("we handle a partial group") { check(3); }
+
+  SECTION("we handle multiple groups") {
+    check(4);
+    check(45);
+  }
+}
@@ -16,7 +16,9 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <limits>
+#include <vector>
 
 #include "sxt/base/bit/permutation.h"
 #include "sxt/base/container/span.h"
@@ -67,6 +69,17 @@ CUDA_CALLABLE void compute_partition_table_slice(U* __restrict__ sums, unsigned
   }
 }
 
+//--------------------------------------------------------------------------------------------------
+// batch_compactable
+//--------------------------------------------------------------------------------------------------
+/**
+ * Element types that provide a batch conversion to their compact form.
+ */
+template <class U, class T>
+concept batch_compactable = requires(basct::span<U> res, basct::cspan<T> elements) {
+  batch_to_compact_element(res, elements);
+};
+
 //--------------------------------------------------------------------------------------------------
 // compute_partition_table
 //--------------------------------------------------------------------------------------------------
@@ -90,6 +103,22 @@ void compute_partition_table(basct::span<U> sums, unsigned window_width,
       // clang-format on
   );
   auto n = generators.size() / window_width;
+  if constexpr (batch_compactable<U, T>) {
+    // Converting each sum to U individually costs a field inversion per entry. Instead, compute
+    // blocks of slices in projective form and convert each block with a single batch inversion.
+    size_t slices_per_block = std::max(1u, (1u << 16u) >> window_width);
+    std::vector<T> block(std::min(slices_per_block, n) * table_size);
+    for (size_t first = 0; first < n; first += slices_per_block) {
+      auto num_slices = std::min(slices_per_block, n - first);
+      for (size_t i = 0; i < num_slices; ++i) {
+        compute_partition_table_slice<T, T>(block.data() + i * table_size, window_width,
+                                            generators.data() + (first + i) * window_width);
+      }
+      batch_to_compact_element(sums.subspan(first * table_size, num_slices * table_size),
+                               basct::cspan<T>{block.data(), num_slices * table_size});
+    }
+    return;
+  }
   for (unsigned i = 0; i < n; ++i) {
     auto sums_slice = sums.subspan(i * table_size, table_size);
     auto generators_slice = generators.subspan(i * window_width, window_width);
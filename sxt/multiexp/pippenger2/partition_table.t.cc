@@ -19,8 +19,15 @@
 #include <vector>
 
 #include "sxt/base/bit/iteration.h"
+#include "sxt/base/curve/element.h"
 #include "sxt/base/curve/example_element.h"
 #include "sxt/base/test/unit_test.h"
+#include "sxt/curve_bng1/constant/generator.h"
+#include "sxt/curve_bng1/operation/add.h"
+#include "sxt/curve_bng1/operation/double.h"
+#include "sxt/curve_bng1/operation/neg.h"
+#include "sxt/curve_bng1/type/compact_element.h"
+#include "sxt/curve_bng1/type/element_p2.h"
 
 using namespace sxt;
 using namespace sxt::mtxpp2;
@@ -78,3 +85,28 @@ TEST_CASE("we can compute a slice of the partition table with a width of 2") {
   };
   REQUIRE(sums == expected);
 }
+
+TEST_CASE("we can compute a partition table of compact elements") {
+  using E = cn1t::element_p2;
+  using U = cn1t::compact_element;
+  // the double and neg operation headers are what make E satisfy bascrv::element
+  static_assert(bascrv::element<E>);
+  std::vector<E> generators(8);
+  generators[0] = cn1cn::generator_p2_v;
+  for (unsigned i = 1; i < generators.size(); ++i) {
+    generators[i] = generators[i - 1];
+    add_inplace(generators[i], cn1cn::generator_p2_v);
+  }
+  generators[3] = E::identity();
+  std::vector<U> sums(2u << 4u);
+  compute_partition_table<U, E>(sums, 4u, generators);
+
+  std::vector<U> expected(sums.size());
+  compute_partition_table_slice(expected.data(), 4u, generators.data());
+  compute_partition_table_slice(expected.data() + 16, 4u, generators.data() + 4);
+  for (unsigned i = 0; i < sums.size(); ++i) {
+    REQUIRE(E{sums[i]} == E{expected[i]});
+  }
+  REQUIRE(sums[0].is_identity());
+  REQUIRE(sums[8].is_identity());
+}
@@ -15,3 +15,250 @@
  * limitations under the License.
  */
 #include "sxt/multiexp/pippenger2/partition_table_accessor.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "sxt/base/error/panic.h"
+
+namespace sxt::mtxpp2 {
+//--------------------------------------------------------------------------------------------------
+// copy_bytes
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stream `n` bytes from `in` to `out` in blocks so that large tables aren't held in memory.
+ */
+static void copy_bytes(std::ostream& out, std::istream& in, size_t n,
+                       std::string_view filename) noexcept {
+  static constexpr size_t block_num_bytes = 1u << 20u;
+  std::vector<char> block(std::min(n, block_num_bytes));
+  while (n > 0) {
+    auto m = std::min(n, block.size());
+    in.read(block.data(), static_cast<std::streamsize>(m));
+    if (static_cast<size_t>(in.gcount()) != m) {
+      baser::panic("{} is truncated", filename);
+    }
+    out.write(block.data(), static_cast<std::streamsize>(m));
+    n -= m;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// read_partition_table_header
+//--------------------------------------------------------------------------------------------------
+partition_table_header read_partition_table_header(std::string_view filename,
+                                                   basct::cspan<uint8_t> data) noexcept {
+  if (data.size() < sizeof(unsigned)) {
+    baser::panic("{} is not a valid partition table file", filename);
+  }
+  unsigned word = 0;
+  std::memcpy(&word, data.data(), sizeof(unsigned));
+  partition_table_header res{
+      .window_width = word & ~(signed_partition_table_flag_v | partition_table_versioned_flag_v |
+                               glv_partition_table_flag_v),
+      .version = 0,
+      .is_signed = (word & signed_partition_table_flag_v) != 0,
+      .is_glv = (word & glv_partition_table_flag_v) != 0,
+      .num_generators = std::nullopt,
+  };
+  if ((word & partition_table_versioned_flag_v) == 0) {
+    return res;
+  }
+  if (data.size() < partition_table_header_size_v) {
+    baser::panic("{} is not a valid partition table file", filename);
+  }
+  std::memcpy(&res.version, data.data() + sizeof(unsigned), sizeof(unsigned));
+  if (res.version == 0 || res.version > partition_table_version_v) {
+    baser::panic("{} has unsupported partition table format version {}", filename, res.version);
+  }
+  uint64_t num_generators = 0;
+  std::memcpy(&num_generators, data.data() + 2 * sizeof(unsigned), sizeof(uint64_t));
+  if (num_generators != partition_table_unknown_generator_count_v) {
+    res.num_generators = static_cast<unsigned>(num_generators);
+  }
+  return res;
+}
+
+partition_table_header read_partition_table_header(std::string_view filename,
+                                                   std::istream& in) noexcept {
+  std::array<uint8_t, partition_table_header_size_v> data;
+  in.read(reinterpret_cast<char*>(data.data()), data.size());
+  auto res = read_partition_table_header(
+      filename, basct::cspan<uint8_t>{data.data(), static_cast<size_t>(in.gcount())});
+  in.clear();
+  in.seekg(static_cast<std::streamoff>(res.size()));
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// write_partition_table_header
+//--------------------------------------------------------------------------------------------------
+void write_partition_table_header(std::ostream& out,
+                                  const partition_table_header& header) noexcept {
+  std::array<uint8_t, partition_table_header_size_v> data{};
+  auto word = header.window_width | partition_table_versioned_flag_v;
+  if (header.is_signed) {
+    word |= signed_partition_table_flag_v;
+  }
+  if (header.is_glv) {
+    word |= glv_partition_table_flag_v;
+  }
+  auto version = partition_table_version_v;
+  auto num_generators = partition_table_unknown_generator_count_v;
+  if (header.num_generators) {
+    num_generators = *header.num_generators;
+  }
+  std::memcpy(data.data(), &word, sizeof(unsigned));
+  std::memcpy(data.data() + sizeof(unsigned), &version, sizeof(unsigned));
+  std::memcpy(data.data() + 2 * sizeof(unsigned), &num_generators, sizeof(uint64_t));
+  out.write(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
+//--------------------------------------------------------------------------------------------------
+// replace_partition_table_file
+//--------------------------------------------------------------------------------------------------
+void replace_partition_table_file(std::string_view filename,
+                                  basf::function_ref<void(std::ostream&)> writer) noexcept {
+  std::string path{filename};
+
+  // write a new file next to the old one
+  auto tmp_path = path + ".XXXXXX";
+  auto fd = mkstemp(tmp_path.data());
+  if (fd == -1) {
+    baser::panic("failed to create a file next to {}: {}", filename, std::strerror(errno));
+  }
+  struct stat st;
+  if (stat(path.c_str(), &st) == 0) {
+    fchmod(fd, st.st_mode & 07777);
+  }
+  close(fd);
+  std::ofstream out{tmp_path, std::ios::binary | std::ios::trunc};
+  writer(out);
+  out.close();
+  if (!out.good()) {
+    std::remove(tmp_path.c_str());
+    baser::panic("failed to write {}", tmp_path);
+  }
+
+  // replace the old file
+  if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    std::remove(tmp_path.c_str());
+    baser::panic("failed to replace {}: {}", filename, std::strerror(errno));
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// upgrade_partition_table_file
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stream the entries of a version 0 file into a new file with a header of the current version,
+ * replacing `data.size()` bytes at `offset` with `data`.
+ */
+static void upgrade_partition_table_file(std::string_view filename, std::istream& in,
+                                         partition_table_header header, size_t old_size,
+                                         size_t offset, basct::cspan<uint8_t> data) noexcept {
+  replace_partition_table_file(filename, [&](std::ostream& out) noexcept {
+    write_partition_table_header(out, header);
+    copy_bytes(out, in, offset, filename);
+    out.write(reinterpret_cast<const char*>(data.data()),
+              static_cast<std::streamsize>(data.size()));
+    if (offset + data.size() < old_size) {
+      in.seekg(static_cast<std::streamoff>(header.size() + offset + data.size()));
+      copy_bytes(out, in, old_size - offset - data.size(), filename);
+    }
+  });
+}
+
+//--------------------------------------------------------------------------------------------------
+// write_partition_table_entries
+//--------------------------------------------------------------------------------------------------
+void write_partition_table_entries(std::string_view filename, unsigned num_generators,
+                                   size_t offset, basct::cspan<uint8_t> data) noexcept {
+  std::fstream file{std::string{filename}, std::ios::binary | std::ios::in | std::ios::out};
+  if (!file.good()) {
+    baser::panic("failed to open {}: {}", filename, std::strerror(errno));
+  }
+  file.seekg(0, std::ios::end);
+  auto file_size = static_cast<size_t>(file.tellg());
+  file.seekg(0);
+  auto header = read_partition_table_header(filename, file);
+  auto old_size = file_size - header.size();
+  if (offset > old_size) {
+    baser::panic("offset {} is past the end of the entries of {}", offset, filename);
+  }
+  header.num_generators = num_generators;
+  if (header.version == 0) {
+    upgrade_partition_table_file(filename, file, header, old_size, offset, data);
+    return;
+  }
+
+  // write the entries before the generator count so that the count never covers missing entries
+  file.seekp(static_cast<std::streamoff>(header.size() + offset));
+  file.write(reinterpret_cast<const char*>(data.data()),
+             static_cast<std::streamsize>(data.size()));
+  file.flush();
+  uint64_t count = num_generators;
+  file.seekp(static_cast<std::streamoff>(2 * sizeof(unsigned)));
+  file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+  file.close();
+  if (!file.good()) {
+    baser::panic("failed to write {}", filename);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// read_partition_table_file_header
+//--------------------------------------------------------------------------------------------------
+static partition_table_header read_partition_table_file_header(std::string_view filename) noexcept {
+  std::ifstream in{std::string{filename}, std::ios::binary};
+  if (!in.good()) {
+    baser::panic("failed to open {}: {}", filename, std::strerror(errno));
+  }
+  return read_partition_table_header(filename, in);
+}
+
+//--------------------------------------------------------------------------------------------------
+// mark_glv_partition_table_file
+//--------------------------------------------------------------------------------------------------
+void mark_glv_partition_table_file(std::string_view filename) noexcept {
+  std::fstream file{std::string{filename}, std::ios::binary | std::ios::in | std::ios::out};
+  if (!file.good()) {
+    baser::panic("failed to open {}: {}", filename, std::strerror(errno));
+  }
+  auto header = read_partition_table_header(filename, file);
+  if (header.version == 0) {
+    baser::panic("{} is a legacy partition table file that can't be marked as GLV", filename);
+  }
+  header.is_glv = true;
+  file.seekp(0);
+  write_partition_table_header(file, header);
+  file.close();
+  if (!file.good()) {
+    baser::panic("failed to write {}", filename);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// is_signed_partition_table_file
+//--------------------------------------------------------------------------------------------------
+bool is_signed_partition_table_file(std::string_view filename) noexcept {
+  return read_partition_table_file_header(filename).is_signed;
+}
+
+//--------------------------------------------------------------------------------------------------
+// is_glv_partition_table_file
+//--------------------------------------------------------------------------------------------------
+bool is_glv_partition_table_file(std::string_view filename) noexcept {
+  return read_partition_table_file_header(filename).is_glv;
+}
+} // namespace sxt::mtxpp2
@@ -16,14 +16,127 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
 #include <memory>
+#include <optional>
 #include <string_view>
 
 #include "sxt/base/container/span.h"
+#include "sxt/base/functional/function_ref.h"
 #include "sxt/base/type/raw_stream.h"
 #include "sxt/multiexp/pippenger2/partition_table_accessor_base.h"
 
 namespace sxt::mtxpp2 {
+//--------------------------------------------------------------------------------------------------
+// signed_partition_table_flag_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set in the window width word at the start of a partition table file when the file holds a
+ * signed partition table (see signed_partition_table_accessor).
+ */
+constexpr unsigned signed_partition_table_flag_v = 1u << 31u;
+
+//--------------------------------------------------------------------------------------------------
+// partition_table_versioned_flag_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set in the window width word at the start of a partition table file when the word begins a
+ * versioned header. Files written before the format was versioned don't set the flag.
+ */
+constexpr unsigned partition_table_versioned_flag_v = 1u << 30u;
+
+//--------------------------------------------------------------------------------------------------
+// glv_partition_table_flag_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set in the window width word at the start of a versioned partition table file when the table
+ * was built from generators interleaved with their images under the curve's endomorphism (see
+ * mtxglv::expand_generators).
+ */
+constexpr unsigned glv_partition_table_flag_v = 1u << 29u;
+
+//--------------------------------------------------------------------------------------------------
+// partition_table_version_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * The version of the partition table file format written by this library.
+ *
+ * Version 0 files start with the window width followed directly by the table entries. Version 1
+ * files start with a header of partition_table_header_size_v bytes
+ *
+ *    [window_width | flags : 4][version : 4][num_generators : 8][zero padding]
+ *
+ * where num_generators is partition_table_unknown_generator_count_v if the count isn't known.
+ *
+ * Readers predating version 1 reject version 1 files of curve elements since the table size they
+ * compute isn't a multiple of the element size.
+ */
+constexpr unsigned partition_table_version_v = 1;
+
+//--------------------------------------------------------------------------------------------------
+// partition_table_header_size_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * The size of a versioned header. It's a multiple of the cache line size so that the entries of a
+ * memory-mapped file are aligned for any element type.
+ */
+constexpr size_t partition_table_header_size_v = 64;
+
+//--------------------------------------------------------------------------------------------------
+// partition_table_unknown_generator_count_v
+//--------------------------------------------------------------------------------------------------
+constexpr uint64_t partition_table_unknown_generator_count_v = ~uint64_t{0};
+
+//--------------------------------------------------------------------------------------------------
+// partition_table_header
+//--------------------------------------------------------------------------------------------------
+/**
+ * The fields of a partition table file header.
+ */
+struct partition_table_header {
+  unsigned window_width = 0;
+  unsigned version = partition_table_version_v;
+  bool is_signed = false;
+  bool is_glv = false;
+
+  // unknown for version 0 files
+  std::optional<unsigned> num_generators;
+
+  /**
+   * The number of bytes preceding the table entries.
+   */
+  size_t size() const noexcept {
+    return version == 0 ? sizeof(unsigned) : partition_table_header_size_v;
+  }
+};
+
+//--------------------------------------------------------------------------------------------------
+// read_partition_table_header
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read the header of a partition table file from `data`, the start of the file.
+ */
+partition_table_header read_partition_table_header(std::string_view filename,
+                                                   basct::cspan<uint8_t> data) noexcept;
+
+/**
+ * Read the header of a partition table file and position `in` at the table entries.
+ */
+partition_table_header read_partition_table_header(std::string_view filename,
+                                                   std::istream& in) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// write_partition_table_header
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a header of the current version with the window width, flags and generator count of
+ * `header`.
+ */
+void write_partition_table_header(std::ostream& out,
+                                  const partition_table_header& header) noexcept;
+
 //--------------------------------------------------------------------------------------------------
 // partition_table_accessor
 //--------------------------------------------------------------------------------------------------
@@ -46,6 +159,12 @@ public:
    */
   virtual void copy_generators(basct::span<T> generators) const noexcept = 0;
 
+  /**
+   * Copy the generators at the given indexes
+   */
+  virtual void gather_generators(basct::span<T> generators,
+                                 basct::cspan<uint64_t> indexes) const noexcept = 0;
+
   /**
    * Asynchronously copy precomputed sums of partitions to device.
    *
@@ -65,5 +184,73 @@ public:
                                     unsigned size) const noexcept = 0;
 
   virtual void write_to_file(std::string_view filename) const noexcept = 0;
+
+  /**
+   * The total number of precomputed sums.
+   */
+  virtual size_t num_entries() const noexcept = 0;
+
+  /**
+   * The number of generators the table was computed from, if known.
+   *
+   * Tables read from files written before the generator count was stored don't know it.
+   */
+  virtual std::optional<unsigned> num_generators() const noexcept = 0;
+
+  /**
+   * Replace the precomputed sums starting at partition group `first` with `sums`, growing the
+   * table as needed, and record that the table now holds `num_generators` generators.
+   *
+   * Accessors backed by a file also write the sums and the generator count through to the file.
+   */
+  virtual void extend(basct::cspan<T> sums, unsigned first, unsigned num_generators) noexcept = 0;
 };
+
+//--------------------------------------------------------------------------------------------------
+// replace_partition_table_file
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a new file next to `filename` with `writer` and then rename it over `filename`.
+ *
+ * Processes that have the old file open or mapped keep seeing its contents, and the file is
+ * never left partially written.
+ */
+void replace_partition_table_file(std::string_view filename,
+                                  basf::function_ref<void(std::ostream&)> writer) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// write_partition_table_entries
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write `data` at byte `offset` of the entries of a partition table file and store
+ * `num_generators` in its header.
+ *
+ * Files of the current version are written in place, so the cost is proportional to the size of
+ * `data`. The generator count is updated after the entries are written. The write isn't atomic:
+ * processes that have the file mapped see the entries change, and a failure partway through can
+ * leave the file damaged.
+ *
+ * Version 0 files are upgraded by streaming their entries into a new file with a header of the
+ * current version which then replaces the old file.
+ */
+void write_partition_table_entries(std::string_view filename, unsigned num_generators,
+                                   size_t offset, basct::cspan<uint8_t> data) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// mark_glv_partition_table_file
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the GLV flag in the header of a versioned partition table file.
+ */
+void mark_glv_partition_table_file(std::string_view filename) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// is_signed_partition_table_file
+//--------------------------------------------------------------------------------------------------
+bool is_signed_partition_table_file(std::string_view filename) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// is_glv_partition_table_file
+//--------------------------------------------------------------------------------------------------
+bool is_glv_partition_table_file(std::string_view filename) noexcept;
 } // namespace sxt::mtxpp2
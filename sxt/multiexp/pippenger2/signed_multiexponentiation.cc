@@ -0,0 +1,72 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/pippenger2/signed_multiexponentiation.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "sxt/base/num/divide_up.h"
+
+namespace sxt::mtxpp2 {
+//--------------------------------------------------------------------------------------------------
+// unpack_offset_scalars
+//--------------------------------------------------------------------------------------------------
+void unpack_offset_scalars(basct::span<uint8_t> res, unsigned element_num_bytes, unsigned first,
+                           basct::cspan<unsigned> output_bit_table,
+                           basct::cspan<unsigned> output_firsts,
+                           basct::cspan<unsigned> output_lengths,
+                           basct::cspan<uint8_t> scalars) noexcept {
+  auto num_outputs = output_bit_table.size();
+  size_t bit_sum = 0;
+  for (auto width : output_bit_table) {
+    SXT_RELEASE_ASSERT(width <= 8u * element_num_bytes);
+    bit_sum += width;
+  }
+  auto num_bytes = basn::divide_up<size_t>(bit_sum, 8u);
+  std::fill(res.begin(), res.end(), 0);
+  size_t bit_offset = 0;
+  for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+    auto width = output_bit_table[output_index];
+    auto output_first = output_firsts[output_index];
+    auto length = output_lengths[output_index];
+    SXT_RELEASE_ASSERT(
+        // clang-format off
+        length == 0 ||
+        (first <= output_first &&
+         ((output_first - first) + size_t{length}) * num_outputs * element_num_bytes <=
+             res.size() &&
+         length * num_bytes <= scalars.size())
+        // clang-format on
+    );
+    for (unsigned j = 0; j < length; ++j) {
+      auto src = scalars.data() + j * num_bytes;
+      auto row = output_first - first + j;
+      auto dst = res.data() + (row * num_outputs + output_index) * element_num_bytes;
+      if (bit_offset % 8u == 0 && width % 8u == 0) {
+        std::memcpy(dst, src + bit_offset / 8u, width / 8u);
+        continue;
+      }
+      for (unsigned bit_index = 0; bit_index < width; ++bit_index) {
+        auto pos = bit_offset + bit_index;
+        auto bit = (src[pos / 8u] >> (pos % 8u)) & 1u;
+        dst[bit_index / 8u] |= static_cast<uint8_t>(bit << (bit_index % 8u));
+      }
+    }
+    bit_offset += width;
+  }
+}
+} // namespace sxt::mtxpp2
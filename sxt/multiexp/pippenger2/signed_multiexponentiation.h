@@ -0,0 +1,244 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <iterator>
+#include <limits>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/container/span_utility.h"
+#include "sxt/base/curve/element.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/base/iterator/split.h"
+#include "sxt/base/log/log.h"
+#include "sxt/base/num/divide_up.h"
+#include "sxt/execution/cpu/for_each.h"
+#include "sxt/execution/cpu/thread_count.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/multiexp/pippenger2/reduce.h"
+#include "sxt/multiexp/pippenger2/signed_partition_product.h"
+#include "sxt/multiexp/pippenger2/signed_partition_table_accessor.h"
+
+namespace sxt::mtxpp2 {
+//--------------------------------------------------------------------------------------------------
+// unpack_offset_scalars
+//--------------------------------------------------------------------------------------------------
+/**
+ * Unpack scalars in the packed format of sxt_fixed_offset_multiexponentiation into rows of
+ * element_num_bytes bytes per output.
+ *
+ * Scalar j of output i is written to row output_firsts[i] + j - first. Entries not covered by an
+ * output are zero.
+ */
+void unpack_offset_scalars(basct::span<uint8_t> res, unsigned element_num_bytes, unsigned first,
+                           basct::cspan<unsigned> output_bit_table,
+                           basct::cspan<unsigned> output_firsts,
+                           basct::cspan<unsigned> output_lengths,
+                           basct::cspan<uint8_t> scalars) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// signed_correction_min_chunk_size_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * The fewest generators that signed_multiexponentiate gives a thread when splitting the
+ * corrections for even scalars.
+ */
+constexpr unsigned signed_correction_min_chunk_size_v = 256;
+
+//--------------------------------------------------------------------------------------------------
+// signed_multiexponentiate
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host multiexponentiation using a signed partition table computed with
+ * compute_signed_partition_table.
+ *
+ * generators holds the generators the table was computed from, padded to a multiple of the
+ * window width. They are needed to correct for the scalars that signed_partition_product_kernel
+ * makes odd. The table has half as many entries as an unsigned partition table at the cost of
+ * the correction, which adds about n / 2 additions per output.
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+void signed_multiexponentiate(basct::span<T> res, basct::cspan<U> partition_table,
+                              basct::cspan<U> generators, unsigned window_width,
+                              unsigned element_num_bytes, basct::cspan<uint8_t> scalars,
+                              unsigned num_threads) noexcept {
+  auto num_outputs = static_cast<unsigned>(res.size());
+  if (num_outputs == 0) {
+    return;
+  }
+  auto n = static_cast<unsigned>(scalars.size() / (num_outputs * element_num_bytes));
+  auto element_num_bits = element_num_bytes * 8u;
+  auto num_products = num_outputs * element_num_bits;
+  auto num_groups = basn::divide_up(n, window_width);
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+      1u < window_width &&
+      num_threads > 0 &&
+      scalars.size() % (num_outputs * element_num_bytes) == 0 &&
+      partition_table.size() >= num_groups * (1u << (window_width - 1u)) &&
+      generators.size() >= num_groups * window_width
+      // clang-format on
+  );
+
+  // compute bitwise products
+  basl::info("computing {} signed bitwise multiexponentiation products of length {} using {} "
+             "threads",
+             num_products, n, num_threads);
+  memmg::managed_array<T> products(num_products);
+  auto [product_first, product_last] =
+      basit::split(basit::index_range{0, num_products}, {.split_factor = num_threads});
+  xencpu::concurrent_for_each(
+      product_first, product_last,
+      [&](const basit::index_range& rng) noexcept {
+        signed_partition_product_host_kernel<T>(
+            basct::subspan(products, rng.a(), rng.size()), num_products, rng.a(),
+            partition_table.data(), window_width, element_num_bits, scalars.data(), n);
+      },
+      num_threads);
+
+  // reduce products
+  basl::info("reducing {} products to {} outputs", num_products, num_outputs);
+  reduce_products<T>(res, products);
+
+  // correct for the even scalars
+  //
+  // Like the products, the corrections are split over chunks of generators as well as outputs
+  // so that a few outputs still use every thread. Each chunk writes partial sums that are then
+  // added up.
+  auto num_generators = num_groups * window_width;
+  auto stride = num_outputs * element_num_bytes;
+  auto num_output_chunks = std::min(num_outputs, num_threads);
+  auto output_chunk_size = basn::divide_up(num_outputs, num_output_chunks);
+  num_output_chunks = basn::divide_up(num_outputs, output_chunk_size);
+  auto num_generator_chunks =
+      std::min(basn::divide_up(num_threads, num_output_chunks),
+               basn::divide_up(num_generators, signed_correction_min_chunk_size_v));
+  num_generator_chunks = std::max(num_generator_chunks, 1u);
+  auto generator_chunk_size = std::max(basn::divide_up(num_generators, num_generator_chunks), 1u);
+  num_generator_chunks = std::max(basn::divide_up(num_generators, generator_chunk_size), 1u);
+  auto num_chunks = num_generator_chunks * num_output_chunks;
+  memmg::managed_array<T> corrections(num_generator_chunks * num_outputs);
+  auto [chunk_first, chunk_last] = basit::split(basit::index_range{0, num_chunks},
+                                                {.max_chunk_size = 1, .split_factor = num_chunks});
+  xencpu::concurrent_for_each(
+      chunk_first, chunk_last,
+      [&](const basit::index_range& rng) noexcept {
+        auto generator_chunk_index = static_cast<unsigned>(rng.a()) / num_output_chunks;
+        auto output_first = static_cast<unsigned>(rng.a()) % num_output_chunks * output_chunk_size;
+        auto output_last = std::min(output_first + output_chunk_size, num_outputs);
+        auto generator_first = generator_chunk_index * generator_chunk_size;
+        auto generator_last = std::min(generator_first + generator_chunk_size, num_generators);
+        auto scalar_first = std::min(generator_first, n);
+        compute_signed_partition_corrections<T>(
+            basct::subspan(corrections, generator_chunk_index * num_outputs + output_first,
+                           output_last - output_first),
+            num_outputs, output_first,
+            generators.subspan(generator_first, generator_last - generator_first),
+            element_num_bytes, scalars.subspan(size_t{scalar_first} * stride),
+            std::min(generator_last, n) - scalar_first, generator_last - generator_first);
+      },
+      num_threads);
+  for (unsigned output_index = 0; output_index < num_outputs; ++output_index) {
+    auto correction = corrections[output_index];
+    for (unsigned chunk_index = 1; chunk_index < num_generator_chunks; ++chunk_index) {
+      add_inplace(correction, corrections[chunk_index * num_outputs + output_index]);
+    }
+    T e;
+    neg(e, correction);
+    add_inplace(res[output_index], e);
+  }
+  basl::info("completed {} reductions", num_outputs);
+}
+
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+void signed_multiexponentiate(basct::span<T> res, basct::cspan<U> partition_table,
+                              basct::cspan<U> generators, unsigned window_width,
+                              unsigned element_num_bytes, basct::cspan<uint8_t> scalars) noexcept {
+  signed_multiexponentiate(res, partition_table, generators, window_width, element_num_bytes,
+                           scalars, xencpu::get_num_threads());
+}
+
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+void signed_multiexponentiate(basct::span<T> res,
+                              const signed_partition_table_accessor<U>& accessor,
+                              unsigned element_num_bytes, basct::cspan<uint8_t> scalars) noexcept {
+  SXT_RELEASE_ASSERT(res.empty() || scalars.size() / (res.size() * element_num_bytes) <=
+                                        accessor.num_generators());
+  signed_multiexponentiate(res, accessor.table(), accessor.generators(), accessor.window_width(),
+                           element_num_bytes, scalars, xencpu::get_num_threads());
+}
+
+/**
+ * Multiexponentiation of scalars in packed format where output i pairs its first
+ * output_lengths[i] scalars with the generators starting at output_firsts[i].
+ *
+ * The scalars are unpacked to whole bytes over the partition groups that the outputs touch, so
+ * the cost is that of a multiexponentiation with the widest output's scalars over those groups.
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+void signed_multiexponentiate(basct::span<T> res,
+                              const signed_partition_table_accessor<U>& accessor,
+                              basct::cspan<unsigned> output_bit_table,
+                              basct::cspan<unsigned> output_firsts,
+                              basct::cspan<unsigned> output_lengths,
+                              basct::cspan<uint8_t> scalars) noexcept {
+  auto num_outputs = static_cast<unsigned>(res.size());
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+      output_bit_table.size() == num_outputs &&
+      output_firsts.size() == num_outputs &&
+      output_lengths.size() == num_outputs
+      // clang-format on
+  );
+  unsigned max_bit_width = 0;
+  auto first = std::numeric_limits<unsigned>::max();
+  size_t last = 0;
+  for (unsigned output_index = 0; output_index < num_outputs; ++output_index) {
+    auto length = output_lengths[output_index];
+    max_bit_width = std::max(max_bit_width, output_bit_table[output_index]);
+    if (length > 0) {
+      first = std::min(first, output_firsts[output_index]);
+      last = std::max(last, size_t{output_firsts[output_index]} + length);
+    }
+  }
+  if (last == 0) {
+    std::fill(res.begin(), res.end(), T::identity());
+    return;
+  }
+  SXT_RELEASE_ASSERT(last <= accessor.num_generators());
+  auto window_width = accessor.window_width();
+  first -= first % window_width;
+  auto n = static_cast<unsigned>(last) - first;
+  auto element_num_bytes = std::max(basn::divide_up(max_bit_width, 8u), 1u);
+  memmg::managed_array<uint8_t> scalars_p(size_t{element_num_bytes} * num_outputs * n);
+  unpack_offset_scalars(scalars_p, element_num_bytes, first, output_bit_table, output_firsts,
+                        output_lengths, scalars);
+  auto num_groups = basn::divide_up(n, window_width);
+  auto table = accessor.table().subspan(size_t{first / window_width} << (window_width - 1u),
+                                        size_t{num_groups} << (window_width - 1u));
+  auto generators = accessor.generators().subspan(first, size_t{num_groups} * window_width);
+  signed_multiexponentiate(res, table, generators, window_width, element_num_bytes, scalars_p,
+                           xencpu::get_num_threads());
+}
+} // namespace sxt::mtxpp2
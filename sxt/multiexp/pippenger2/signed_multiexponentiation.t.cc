@@ -0,0 +1,258 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/pippenger2/signed_multiexponentiation.h"
+
+#include <random>
+#include <vector>
+
+#include "sxt/base/curve/example_element.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/multiexp/pippenger2/signed_partition_table.h"
+#include "sxt/multiexp/pippenger2/signed_partition_table_accessor_utility.h"
+
+using namespace sxt;
+using namespace sxt::mtxpp2;
+
+TEST_CASE("we can compute multiexponentiations using a signed partition table") {
+  using E = bascrv::element97;
+
+  std::mt19937 rng{0};
+  unsigned window_width = 4;
+  std::vector<E> generators(32);
+  for (auto& g : generators) {
+    g = std::uniform_int_distribution<unsigned>{0, 96}(rng);
+  }
+  std::vector<E> table(generators.size() / window_width * (1u << (window_width - 1u)));
+  compute_signed_partition_table<E>(table, window_width, generators);
+
+  auto compute_expected = [&](unsigned num_outputs, unsigned element_num_bytes,
+                              basct::cspan<uint8_t> scalars) noexcept {
+    auto n = scalars.size() / (num_outputs * element_num_bytes);
+    std::vector<E> res(num_outputs, E::identity());
+    for (unsigned output_index = 0; output_index < num_outputs; ++output_index) {
+      for (unsigned i = 0; i < n; ++i) {
+        auto data = scalars.data() + (i * num_outputs + output_index) * element_num_bytes;
+        auto term = E::identity();
+        for (unsigned byte_index = element_num_bytes; byte_index-- > 0;) {
+          for (unsigned bit_index = 8; bit_index-- > 0;) {
+            double_element(term, term);
+            if ((data[byte_index] & (1u << bit_index)) != 0) {
+              auto e = generators[i];
+              add_inplace(term, e);
+            }
+          }
+        }
+        add_inplace(res[output_index], term);
+      }
+    }
+    return res;
+  };
+
+  SECTION("we can compute a multiexponentiation with a zero scalar") {
+    std::vector<uint8_t> scalars = {0};
+    std::vector<E> res(1);
+    signed_multiexponentiate<E, E>(res, table, generators, window_width, 1, scalars);
+    REQUIRE(res[0] == E::identity());
+  }
+
+  SECTION("we can compute a multiexponentiation with a scalar of one") {
+    std::vector<uint8_t> scalars = {1};
+    std::vector<E> res(1);
+    signed_multiexponentiate<E, E>(res, table, generators, window_width, 1, scalars);
+    REQUIRE(res[0] == generators[0]);
+  }
+
+  SECTION("we can compute a multiexponentiation with a scalar of two") {
+    std::vector<uint8_t> scalars = {2};
+    std::vector<E> res(1);
+    signed_multiexponentiate<E, E>(res, table, generators, window_width, 1, scalars);
+    E expected;
+    double_element(expected, generators[0]);
+    REQUIRE(res[0] == expected);
+  }
+
+  SECTION("we can compute multiexponentiations with random scalars") {
+    for (unsigned num_outputs : {1u, 3u}) {
+      for (unsigned element_num_bytes : {1u, 2u}) {
+        for (unsigned n : {3u, 4u, 21u, 32u}) {
+          std::vector<uint8_t> scalars(n * num_outputs * element_num_bytes);
+          for (auto& s : scalars) {
+            s = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 255}(rng));
+          }
+          std::vector<E> res(num_outputs);
+          signed_multiexponentiate<E, E>(res, table, generators, window_width, element_num_bytes,
+                                         scalars, 1);
+          auto expected = compute_expected(num_outputs, element_num_bytes, scalars);
+          REQUIRE(res == expected);
+
+          signed_multiexponentiate<E, E>(res, table, generators, window_width, element_num_bytes,
+                                         scalars, 4);
+          REQUIRE(res == expected);
+        }
+      }
+    }
+  }
+
+  SECTION("we can split the corrections over chunks of generators") {
+    std::vector<E> chunked_generators(4 * signed_correction_min_chunk_size_v);
+    for (auto& g : chunked_generators) {
+      g = std::uniform_int_distribution<unsigned>{0, 96}(rng);
+    }
+    std::vector<E> chunked_table(chunked_generators.size() / window_width *
+                                 (1u << (window_width - 1u)));
+    compute_signed_partition_table<E>(chunked_table, window_width, chunked_generators);
+    for (unsigned num_outputs : {1u, 3u}) {
+      for (unsigned n : {3u * signed_correction_min_chunk_size_v + 5u,
+                         static_cast<unsigned>(chunked_generators.size())}) {
+        std::vector<uint8_t> scalars(n * num_outputs);
+        for (auto& s : scalars) {
+          s = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 255}(rng));
+        }
+        std::vector<E> expected(num_outputs);
+        signed_multiexponentiate<E, E>(expected, chunked_table, chunked_generators, window_width,
+                                       1, scalars, 1);
+        for (unsigned num_threads : {2u, 4u, 16u}) {
+          std::vector<E> res(num_outputs);
+          signed_multiexponentiate<E, E>(res, chunked_table, chunked_generators, window_width, 1,
+                                         scalars, num_threads);
+          REQUIRE(res == expected);
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("we can compute multiexponentiations using a signed partition table accessor") {
+  using E = bascrv::element97;
+
+  std::mt19937 rng{0};
+  unsigned window_width = 4;
+  std::vector<E> generators(10);
+  for (auto& g : generators) {
+    g = std::uniform_int_distribution<unsigned>{0, 96}(rng);
+  }
+  auto accessor = make_signed_partition_table_accessor<E>(generators, {}, window_width);
+  REQUIRE(accessor->num_generators() == 10);
+  REQUIRE(accessor->generators().size() == 12);
+
+  std::vector<uint8_t> scalars(generators.size());
+  for (auto& s : scalars) {
+    s = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 255}(rng));
+  }
+  auto expected = E::identity();
+  for (unsigned i = 0; i < generators.size(); ++i) {
+    auto term = E::identity();
+    for (unsigned j = 0; j < scalars[i]; ++j) {
+      auto e = generators[i];
+      add_inplace(term, e);
+    }
+    add_inplace(expected, term);
+  }
+  std::vector<E> res(1);
+  signed_multiexponentiate<E>(res, *accessor, 1, scalars);
+  REQUIRE(res[0] == expected);
+}
+
+TEST_CASE("we can compute multiexponentiations of packed scalars with offsets using a signed "
+          "partition table accessor") {
+  using E = bascrv::element97;
+
+  std::mt19937 rng{0};
+  unsigned window_width = 4;
+  std::vector<E> generators(10);
+  for (auto& g : generators) {
+    g = std::uniform_int_distribution<unsigned>{0, 96}(rng);
+  }
+  auto accessor = make_signed_partition_table_accessor<E>(generators, {}, window_width);
+
+  // res = res + k * g
+  auto add_multiple = [](E& res, const E& g, unsigned k) noexcept {
+    for (unsigned i = 0; i < k; ++i) {
+      auto e = g;
+      add_inplace(res, e);
+    }
+  };
+
+  std::vector<E> res(2);
+
+  SECTION("we handle outputs with no scalars") {
+    std::vector<unsigned> output_bit_table = {8, 3};
+    std::vector<unsigned> output_firsts = {2, 0};
+    std::vector<unsigned> output_lengths = {0, 0};
+    res[0] = generators[0];
+    signed_multiexponentiate<E>(res, *accessor, output_bit_table, output_firsts, output_lengths,
+                                {});
+    REQUIRE(res[0] == E::identity());
+    REQUIRE(res[1] == E::identity());
+  }
+
+  SECTION("we handle byte-aligned outputs") {
+    std::vector<unsigned> output_bit_table = {8, 16};
+    std::vector<unsigned> output_firsts = {0, 0};
+    std::vector<unsigned> output_lengths = {2, 2};
+    std::vector<uint8_t> scalars = {3, 5, 1, 7, 0, 1};
+    signed_multiexponentiate<E>(res, *accessor, output_bit_table, output_firsts, output_lengths,
+                                scalars);
+    auto expected_0 = E::identity();
+    add_multiple(expected_0, generators[0], 3);
+    add_multiple(expected_0, generators[1], 7);
+    auto expected_1 = E::identity();
+    add_multiple(expected_1, generators[0], 5 + 256);
+    add_multiple(expected_1, generators[1], 256);
+    REQUIRE(res[0] == expected_0);
+    REQUIRE(res[1] == expected_1);
+  }
+
+  SECTION("we handle outputs packed within a byte at different offsets") {
+    std::vector<unsigned> output_bit_table = {3, 5};
+    std::vector<unsigned> output_firsts = {5, 2};
+    std::vector<unsigned> output_lengths = {2, 3};
+    std::vector<uint8_t> scalars = {
+        0b10110'101,
+        0b00011'011,
+        0b11111'000,
+    };
+    signed_multiexponentiate<E>(res, *accessor, output_bit_table, output_firsts, output_lengths,
+                                scalars);
+    auto expected_0 = E::identity();
+    add_multiple(expected_0, generators[5], 5);
+    add_multiple(expected_0, generators[6], 3);
+    auto expected_1 = E::identity();
+    add_multiple(expected_1, generators[2], 22);
+    add_multiple(expected_1, generators[3], 3);
+    add_multiple(expected_1, generators[4], 31);
+    REQUIRE(res[0] == expected_0);
+    REQUIRE(res[1] == expected_1);
+  }
+
+  SECTION("we handle outputs that end at the last generator") {
+    std::vector<unsigned> output_bit_table = {8, 8};
+    std::vector<unsigned> output_firsts = {9, 6};
+    std::vector<unsigned> output_lengths = {1, 4};
+    std::vector<uint8_t> scalars = {2, 1, 0, 2, 0, 3, 0, 4};
+    signed_multiexponentiate<E>(res, *accessor, output_bit_table, output_firsts, output_lengths,
+                                scalars);
+    auto expected_0 = E::identity();
+    add_multiple(expected_0, generators[9], 2);
+    auto expected_1 = E::identity();
+    for (unsigned j = 0; j < 4; ++j) {
+      add_multiple(expected_1, generators[6 + j], j + 1);
+    }
+    REQUIRE(res[0] == expected_0);
+    REQUIRE(res[1] == expected_1);
+  }
+}
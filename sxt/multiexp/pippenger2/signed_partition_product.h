@@ -0,0 +1,228 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <vector>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/curve/element.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/base/macro/cuda_callable.h"
+#include "sxt/base/memory/prefetch.h"
+#include "sxt/base/num/divide_up.h"
+#include "sxt/multiexp/pippenger2/partition_product.h"
+
+namespace sxt::mtxpp2 {
+//--------------------------------------------------------------------------------------------------
+// signed_partition_lookup
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look up the sum for a group of generators in a signed partition table slice.
+ *
+ * Bit i of partition_index selects the sign of generator i (+1 if set, -1 otherwise). Entries
+ * where generator 0 has a negative sign aren't stored; they are recovered by negating the entry
+ * with every sign flipped.
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+CUDA_CALLABLE inline void signed_partition_lookup(T& res, const U* __restrict__ partition_table,
+                                                  unsigned partition_index,
+                                                  unsigned window_width) noexcept {
+  auto is_negative = ~partition_index & 1u;
+  partition_index ^= 0u - is_negative;
+  auto mask = (1u << (window_width - 1u)) - 1u;
+  res = T{partition_table[(partition_index >> 1u) & mask]};
+  cneg(res, is_negative);
+}
+
+//--------------------------------------------------------------------------------------------------
+// signed_partition_product_kernel
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a product using a signed partition table.
+ *
+ * A scalar s with element_num_bits bits is first made odd, s' = s | 1, and then written with
+ * digits d_k in {-1, +1} as
+ *
+ *    s' = sum_k d_k 2^k,  d_k = 2 * bit_{k+1}(s') - 1 for k < element_num_bits - 1
+ *                         d_k = 1                     for k = element_num_bits - 1
+ *
+ * so the signs of product k are given by bit k + 1 of the scalars. The even scalars are
+ * corrected for afterwards with compute_signed_partition_corrections.
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+CUDA_CALLABLE void signed_partition_product_kernel(
+    T& product, const U* __restrict__ partition_table, const uint8_t* __restrict__ scalars,
+    unsigned product_index, unsigned element_num_bits, unsigned window_width,
+    unsigned num_products, unsigned n) noexcept {
+  auto num_partition_entries = 1u << (window_width - 1u);
+  auto step = num_products / 8u;
+  auto is_top = product_index % element_num_bits == element_num_bits - 1u;
+  auto sign_index = product_index + 1u;
+  scalars += sign_index / 8u;
+
+  auto compute_index = [&](unsigned m) noexcept {
+    if (is_top) {
+      return ~0u;
+    }
+    return compute_partition_index(scalars, step, window_width, m, sign_index % 8u);
+  };
+
+  // lookup the first entry
+  T res;
+  signed_partition_lookup(res, partition_table, compute_index(n), window_width);
+
+  // sum remaining entries
+  while (n > window_width) {
+    n -= window_width;
+    partition_table += num_partition_entries;
+    scalars += window_width * step;
+    T e;
+    signed_partition_lookup(e, partition_table, compute_index(n), window_width);
+    add_inplace(res, e);
+  }
+
+  // write result
+  product = res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// signed_partition_product_host_kernel
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host version of signed_partition_product_kernel for the products
+ * [product_first, product_first + products.size()).
+ *
+ * Like partition_product_host_kernel, all the products for a group of generators are computed
+ * together and the entries of the next group are prefetched.
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+void signed_partition_product_host_kernel(basct::span<T> products, unsigned num_products,
+                                          unsigned product_first,
+                                          const U* __restrict__ partition_table,
+                                          unsigned window_width, unsigned element_num_bits,
+                                          const uint8_t* __restrict__ scalars,
+                                          unsigned n) noexcept {
+  auto num_slice_products = static_cast<unsigned>(products.size());
+  auto num_partition_entries = 1u << (window_width - 1u);
+  auto num_product_bytes = num_products / 8u;
+  auto num_groups = basn::divide_up(n, window_width);
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+      num_products % 8u == 0 &&
+      num_products % element_num_bits == 0 &&
+      product_first + num_slice_products <= num_products
+      // clang-format on
+  );
+  if (num_groups == 0) {
+    std::fill(products.begin(), products.end(), T::identity());
+    return;
+  }
+
+  // the signs of product k are the bits of product k + 1
+  auto sign_first = product_first + 1u;
+  auto num_signs = std::min(num_slice_products, num_products - sign_first);
+  auto compute_indexes = [&](basct::span<unsigned> indexes, unsigned group_index) noexcept {
+    auto first = group_index * window_width;
+    compute_partition_indexes(indexes.subspan(0, num_signs), scalars + first * num_product_bytes,
+                              num_product_bytes, sign_first, std::min(window_width, n - first));
+    for (unsigned i = 0; i < num_slice_products; ++i) {
+      if ((product_first + i) % element_num_bits == element_num_bits - 1u) {
+        indexes[i] = ~0u;
+      }
+    }
+  };
+
+  std::vector<unsigned> indexes(num_slice_products);
+  std::vector<unsigned> next_indexes(num_slice_products);
+  compute_indexes(indexes, 0);
+  for (unsigned group_index = 0; group_index < num_groups; ++group_index) {
+    auto table = partition_table + group_index * num_partition_entries;
+
+    // look ahead to the next group
+    auto next_group_index = group_index + 1u;
+    if (next_group_index < num_groups) {
+      compute_indexes(next_indexes, next_group_index);
+      auto next_table = table + num_partition_entries;
+      auto mask = num_partition_entries - 1u;
+      for (auto index : next_indexes) {
+        index ^= 0u - (~index & 1u);
+        basm::prefetch(next_table + ((index >> 1u) & mask), sizeof(U));
+      }
+    }
+
+    // accumulate the current group
+    for (unsigned i = 0; i < num_slice_products; ++i) {
+      T e;
+      signed_partition_lookup(e, table, indexes[i], window_width);
+      if (group_index == 0) {
+        products[i] = e;
+      } else {
+        add_inplace(products[i], e);
+      }
+    }
+    std::swap(indexes, next_indexes);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_signed_partition_corrections
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute for the outputs [output_first, output_first + corrections.size()) of a
+ * multiexponentiation with num_outputs outputs the sum of the generators whose scalars were made
+ * odd by signed_partition_product_kernel.
+ *
+ * Generators in [n, num_generators) belong to the last group of the table but have no scalar;
+ * they are treated as having a zero scalar.
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+void compute_signed_partition_corrections(basct::span<T> corrections, unsigned num_outputs,
+                                          unsigned output_first, basct::cspan<U> generators,
+                                          unsigned element_num_bytes,
+                                          basct::cspan<uint8_t> scalars, unsigned n,
+                                          unsigned num_generators) noexcept {
+  auto num_slice_outputs = static_cast<unsigned>(corrections.size());
+  auto stride = num_outputs * element_num_bytes;
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+      output_first + num_slice_outputs <= num_outputs &&
+      n <= num_generators &&
+      generators.size() >= num_generators &&
+      scalars.size() >= n * stride
+      // clang-format on
+  );
+  std::fill(corrections.begin(), corrections.end(), T::identity());
+  for (unsigned i = 0; i < num_generators; ++i) {
+    T g{generators[i]};
+    for (unsigned output_index = 0; output_index < num_slice_outputs; ++output_index) {
+      auto byte_index = i * stride + (output_first + output_index) * element_num_bytes;
+      if (i < n && (scalars[byte_index] & 1u) != 0) {
+        continue;
+      }
+      auto e = g;
+      add_inplace(corrections[output_index], e);
+    }
+  }
+}
+} // namespace sxt::mtxpp2
@@ -0,0 +1,129 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/pippenger2/signed_partition_product.h"
+
+#include <random>
+#include <vector>
+
+#include "sxt/base/curve/example_element.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/multiexp/pippenger2/signed_partition_table.h"
+
+using namespace sxt;
+using namespace sxt::mtxpp2;
+
+TEST_CASE("we can look up entries of a signed partition table") {
+  using E = bascrv::element97;
+  std::vector<E> generators = {3u, 5u, 11u};
+  std::vector<E> table(4);
+  compute_signed_partition_table<E>(table, 3, generators);
+  for (unsigned signs = 0; signs < 8u; ++signs) {
+    auto expected = E::identity();
+    for (unsigned j = 0; j < 3u; ++j) {
+      auto e = generators[j];
+      if ((signs & (1u << j)) == 0) {
+        neg(e, e);
+      }
+      add_inplace(expected, e);
+    }
+    E res;
+    signed_partition_lookup(res, table.data(), signs, 3);
+    REQUIRE(res == expected);
+  }
+}
+
+TEST_CASE("we can compute products with a signed partition table") {
+  using E = bascrv::element97;
+  std::mt19937 rng{0};
+  unsigned window_width = 4;
+  unsigned num_outputs = 2;
+  unsigned element_num_bytes = 1;
+  unsigned num_products = num_outputs * element_num_bytes * 8u;
+  unsigned n = 7;
+  std::vector<E> generators(8);
+  for (auto& g : generators) {
+    g = std::uniform_int_distribution<unsigned>{0, 96}(rng);
+  }
+  std::vector<E> table(16);
+  compute_signed_partition_table<E>(table, window_width, generators);
+  std::vector<uint8_t> scalars(n * num_outputs);
+  for (auto& s : scalars) {
+    s = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 255}(rng));
+  }
+  scalars[0] = 0;
+  scalars[3] = 255;
+
+  // expected products from the digits of s | 1, treating generator 7 as having a zero scalar
+  std::vector<E> expected(num_products, E::identity());
+  for (unsigned product_index = 0; product_index < num_products; ++product_index) {
+    auto output_index = product_index / 8u;
+    auto k = product_index % 8u;
+    for (unsigned i = 0; i < generators.size(); ++i) {
+      unsigned s = i < n ? scalars[i * num_outputs + output_index] : 0u;
+      s |= 1u;
+      auto e = generators[i];
+      if (k != 7u && (s & (1u << (k + 1u))) == 0) {
+        neg(e, e);
+      }
+      add_inplace(expected[product_index], e);
+    }
+  }
+
+  SECTION("we can compute products with the kernel") {
+    for (unsigned product_index = 0; product_index < num_products; ++product_index) {
+      E product;
+      signed_partition_product_kernel<E>(product, table.data(), scalars.data(), product_index, 8u,
+                                         window_width, num_products, n);
+      REQUIRE(product == expected[product_index]);
+    }
+  }
+
+  SECTION("we can compute products with the host kernel") {
+    std::vector<E> products(num_products);
+    signed_partition_product_host_kernel<E>(products, num_products, 0, table.data(), window_width,
+                                            8u, scalars.data(), n);
+    REQUIRE(products == expected);
+  }
+
+  SECTION("we can compute a slice of products with the host kernel") {
+    std::vector<E> products(6);
+    signed_partition_product_host_kernel<E>(products, num_products, 5, table.data(), window_width,
+                                            8u, scalars.data(), n);
+    REQUIRE(products == std::vector<E>(expected.begin() + 5, expected.begin() + 11));
+  }
+
+  SECTION("we can compute the corrections for even scalars") {
+    std::vector<E> corrections(num_outputs);
+    compute_signed_partition_corrections<E, E>(corrections, num_outputs, 0, generators,
+                                            element_num_bytes, scalars, n, 8);
+    for (unsigned output_index = 0; output_index < num_outputs; ++output_index) {
+      auto correction = E::identity();
+      for (unsigned i = 0; i < generators.size(); ++i) {
+        if (i >= n || scalars[i * num_outputs + output_index] % 2 == 0) {
+          auto e = generators[i];
+          add_inplace(correction, e);
+        }
+      }
+      REQUIRE(corrections[output_index] == correction);
+    }
+
+    std::vector<E> correction(1);
+    compute_signed_partition_corrections<E, E>(correction, num_outputs, 1, generators,
+                                            element_num_bytes, scalars, n, 8);
+    REQUIRE(correction[0] == corrections[1]);
+  }
+}
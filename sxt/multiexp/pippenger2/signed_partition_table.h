@@ -0,0 +1,121 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/curve/element.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/base/macro/cuda_callable.h"
+#include "sxt/multiexp/pippenger2/partition_table.h"
+
+namespace sxt::mtxpp2 {
+//--------------------------------------------------------------------------------------------------
+// compute_signed_partition_table_slice
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the sums
+ *
+ *    g_0 + s_1 g_1 + ... + s_{w-1} g_{w-1},  s_j = +1 if bit j-1 of the entry index is set
+ *                                                  -1 otherwise
+ *
+ * for a group of w = window_width generators. Every signed combination of the group is either
+ * an entry of the slice or the negation of one, so the slice only needs 2^(w-1) entries.
+ */
+template <class U, bascrv::element T>
+  requires requires(const U& u, const T& e) {
+    static_cast<U>(e);
+    T{u};
+  }
+CUDA_CALLABLE void compute_signed_partition_table_slice(U* __restrict__ sums, unsigned window_width,
+                                                        const T* __restrict__ generators) noexcept {
+  assert(1u < window_width && window_width <= 32u);
+
+  // the entry with every sign negative
+  T sum = generators[0];
+  for (unsigned j = 1; j < window_width; ++j) {
+    T e;
+    neg(e, generators[j]);
+    add_inplace(sum, e);
+  }
+  sums[0] = static_cast<U>(sum);
+
+  // flipping the sign of g_{j+1} from -1 to +1 adds 2 g_{j+1}
+  for (unsigned j = 0; j + 1u < window_width; ++j) {
+    T g2;
+    double_element(g2, generators[j + 1u]);
+    auto first = 1u << j;
+    for (unsigned index = first; index < 2u * first; ++index) {
+      T sum{sums[index - first]};
+      auto e = g2;
+      add_inplace(sum, e);
+      sums[index] = static_cast<U>(sum);
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// compute_signed_partition_table
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the table of signed sums for each group of `window_width` generators. The table has
+ * half the size of the table computed by compute_partition_table.
+ */
+template <class U, bascrv::element T>
+  requires requires(const U& u, const T& e) {
+    static_cast<U>(e);
+    T{u};
+  }
+void compute_signed_partition_table(basct::span<U> sums, unsigned window_width,
+                                    basct::cspan<T> generators) noexcept {
+  auto table_size = 1u << (window_width - 1u);
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+     1u < window_width &&
+     sums.size() == table_size * generators.size() / window_width &&
+     generators.size() % window_width == 0
+      // clang-format on
+  );
+  auto n = generators.size() / window_width;
+  if constexpr (batch_compactable<U, T>) {
+    size_t slices_per_block = std::max(1u, (1u << 16u) >> (window_width - 1u));
+    std::vector<T> block(std::min(slices_per_block, n) * table_size);
+    for (size_t first = 0; first < n; first += slices_per_block) {
+      auto num_slices = std::min(slices_per_block, n - first);
+      for (size_t i = 0; i < num_slices; ++i) {
+        compute_signed_partition_table_slice<T, T>(block.data() + i * table_size, window_width,
+                                                   generators.data() + (first + i) * window_width);
+      }
+      batch_to_compact_element(sums.subspan(first * table_size, num_slices * table_size),
+                               basct::cspan<T>{block.data(), num_slices * table_size});
+    }
+    return;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    compute_signed_partition_table_slice(sums.data() + i * table_size, window_width,
+                                         generators.data() + i * window_width);
+  }
+}
+
+template <bascrv::element T>
+void compute_signed_partition_table(basct::span<T> sums, unsigned window_width,
+                                    basct::cspan<T> generators) noexcept {
+  compute_signed_partition_table<T, T>(sums, window_width, generators);
+}
+} // namespace sxt::mtxpp2
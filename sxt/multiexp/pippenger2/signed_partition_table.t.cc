@@ -0,0 +1,106 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/pippenger2/signed_partition_table.h"
+
+#include <vector>
+
+#include "sxt/base/curve/example_element.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/curve_bng1/constant/generator.h"
+#include "sxt/curve_bng1/operation/add.h"
+#include "sxt/curve_bng1/operation/double.h"
+#include "sxt/curve_bng1/operation/neg.h"
+#include "sxt/curve_bng1/type/compact_element.h"
+#include "sxt/curve_bng1/type/element_p2.h"
+
+using namespace sxt;
+using namespace sxt::mtxpp2;
+
+TEST_CASE("we can compute a slice of the signed partition table") {
+  using E = bascrv::element97;
+  std::vector<E> generators = {1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u};
+  auto window_width = static_cast<unsigned>(generators.size());
+  std::vector<E> sums(1u << (window_width - 1u));
+  compute_signed_partition_table_slice(sums.data(), window_width, generators.data());
+  for (unsigned i = 0; i < sums.size(); ++i) {
+    auto expected = generators[0];
+    for (unsigned j = 1; j < window_width; ++j) {
+      auto e = generators[j];
+      if ((i & (1u << (j - 1u))) == 0) {
+        neg(e, e);
+      }
+      add_inplace(expected, e);
+    }
+    REQUIRE(sums[i] == expected);
+  }
+}
+
+TEST_CASE("we can compute the full signed partition table") {
+  using E = bascrv::element97;
+  std::vector<E> generators(8);
+  for (unsigned i = 0; i < generators.size(); ++i) {
+    generators[i] = i + 1u;
+  }
+
+  SECTION("we can compute a table with multiple slices") {
+    std::vector<E> sums(16);
+    compute_signed_partition_table<E>(sums, 4, generators);
+    std::vector<E> expected(8);
+    compute_signed_partition_table_slice(expected.data(), 4, generators.data());
+    REQUIRE(std::vector<E>(sums.begin(), sums.begin() + 8) == expected);
+    compute_signed_partition_table_slice(expected.data(), 4, generators.data() + 4);
+    REQUIRE(std::vector<E>(sums.begin() + 8, sums.end()) == expected);
+  }
+
+  SECTION("every signed sum is an entry or the negation of an entry") {
+    std::vector<E> sums(8);
+    compute_signed_partition_table<E>(sums, 4, basct::cspan<E>{generators.data(), 4});
+    for (unsigned signs = 0; signs < 16u; ++signs) {
+      auto expected = E::identity();
+      for (unsigned j = 0; j < 4u; ++j) {
+        auto e = generators[j];
+        if ((signs & (1u << j)) == 0) {
+          neg(e, e);
+        }
+        add_inplace(expected, e);
+      }
+      auto index = (signs & 1u) != 0 ? signs >> 1u : (~signs >> 1u) & 7u;
+      auto e = sums[index];
+      if ((signs & 1u) == 0) {
+        neg(e, e);
+      }
+      REQUIRE(e == expected);
+    }
+  }
+
+  SECTION("we can compute a table of compact elements") {
+    using T = cn1t::element_p2;
+    using U = cn1t::compact_element;
+    std::vector<T> bn_generators(4);
+    bn_generators[0] = cn1cn::generator_p2_v;
+    for (unsigned i = 1; i < bn_generators.size(); ++i) {
+      add(bn_generators[i], bn_generators[i - 1], cn1cn::generator_p2_v);
+    }
+    std::vector<U> sums(8);
+    compute_signed_partition_table<U, T>(sums, 4, bn_generators);
+    std::vector<T> expected(8);
+    compute_signed_partition_table_slice(expected.data(), 4, bn_generators.data());
+    for (unsigned i = 0; i < sums.size(); ++i) {
+      REQUIRE(T{sums[i]} == expected[i]);
+    }
+  }
+}
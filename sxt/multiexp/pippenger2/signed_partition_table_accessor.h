@@ -0,0 +1,200 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/base/error/panic.h"
+#include "sxt/base/memory/alloc.h"
+#include "sxt/base/num/divide_up.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/memory/resource/pinned_resource.h"
+#include "sxt/multiexp/pippenger2/partition_table_accessor.h"
+#include "sxt/multiexp/pippenger2/partition_table_accessor_base.h"
+
+namespace sxt::mtxpp2 {
+//--------------------------------------------------------------------------------------------------
+// signed_partition_table_accessor
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host accessor for a signed partition table (see compute_signed_partition_table).
+ *
+ * Besides the table, the accessor keeps the generators padded with the identity to a multiple of
+ * the window width since signed_multiexponentiate needs them to correct for even scalars.
+ *
+ * Files have the layout
+ *
+ *    [header][generators][table]
+ *
+ * where the header has the signed flag set and stores the generator count. Since the generators
+ * come before the table, extending a table read from a file rewrites the whole file.
+ */
+template <class T>
+class signed_partition_table_accessor final : public partition_table_accessor_base {
+public:
+  explicit signed_partition_table_accessor(
+      std::string_view filename, basm::alloc_t alloc = memr::get_pinned_resource()) noexcept
+      : filename_{filename}, generators_{alloc}, table_{alloc} {
+    std::ifstream in{std::string{filename}, std::ios::binary};
+    if (!in.good()) {
+      baser::panic("failed to open {}: {}", filename, std::strerror(errno));
+    }
+    auto pos = in.tellg();
+    in.seekg(0, std::ios::end);
+    auto size = static_cast<size_t>(in.tellg() - pos);
+    in.seekg(pos);
+    auto header = read_partition_table_header(filename, in);
+    if (!header.is_signed) {
+      baser::panic("{} does not hold a signed partition table", filename);
+    }
+    if (!header.num_generators) {
+      baser::panic("{} does not store its generator count", filename);
+    }
+    window_width_ = header.window_width;
+    num_generators_ = *header.num_generators;
+    auto num_groups = basn::divide_up(num_generators_, window_width_);
+    auto table_size = size_t{num_groups} << (window_width_ - 1u);
+    size -= header.size();
+    if (size != (num_groups * window_width_ + table_size) * sizeof(T)) {
+      baser::panic("{} has a size inconsistent with {} generators", filename, num_generators_);
+    }
+    generators_.resize(num_groups * window_width_);
+    in.read(reinterpret_cast<char*>(generators_.data()), generators_.size() * sizeof(T));
+    table_.resize(table_size);
+    in.read(reinterpret_cast<char*>(table_.data()), table_.size() * sizeof(T));
+  }
+
+  signed_partition_table_accessor(memmg::managed_array<T>&& table,
+                                  memmg::managed_array<T>&& generators, unsigned num_generators,
+                                  unsigned window_width) noexcept
+      : window_width_{window_width}, num_generators_{num_generators},
+        generators_{std::move(generators)}, table_{std::move(table)} {
+    SXT_RELEASE_ASSERT(
+        // clang-format off
+        1u < window_width &&
+        generators_.size() == basn::divide_up(num_generators, window_width) * window_width &&
+        table_.size() == generators_.size() / window_width * (1u << (window_width - 1u))
+        // clang-format on
+    );
+  }
+
+  unsigned window_width() const noexcept { return window_width_; }
+
+  unsigned num_generators() const noexcept { return num_generators_; }
+
+  /**
+   * The generators padded with the identity to a multiple of the window width.
+   */
+  basct::cspan<T> generators() const noexcept { return generators_; }
+
+  basct::cspan<T> table() const noexcept { return table_; }
+
+  /**
+   * Copy the generators at the given indexes
+   */
+  void gather_generators(basct::span<T> generators,
+                         basct::cspan<uint64_t> indexes) const noexcept {
+    SXT_DEBUG_ASSERT(generators.size() == indexes.size());
+    for (size_t i = 0; i < indexes.size(); ++i) {
+      SXT_RELEASE_ASSERT(indexes[i] < num_generators_);
+      generators[i] = generators_[indexes[i]];
+    }
+  }
+
+  /**
+   * Replace the padded generators and the sums starting at partition group `first` and record
+   * that the table now holds `num_generators` generators.
+   *
+   * If the table was read from a file, the file is rewritten as well.
+   */
+  void extend(basct::cspan<T> generators, basct::cspan<T> sums, unsigned first,
+              unsigned num_generators) noexcept {
+    auto num_groups = basn::divide_up(num_generators, window_width_);
+    SXT_RELEASE_ASSERT(
+        // clang-format off
+        first <= generators_.size() / window_width_ &&
+        first <= num_groups &&
+        generators.size() == size_t{num_groups - first} * window_width_ &&
+        sums.size() == size_t{num_groups - first} << (window_width_ - 1u)
+        // clang-format on
+    );
+    auto generators_first = size_t{first} * window_width_;
+    resize(generators_, generators_first, size_t{num_groups} * window_width_);
+    std::copy(generators.begin(), generators.end(), generators_.data() + generators_first);
+    auto table_first = size_t{first} << (window_width_ - 1u);
+    resize(table_, table_first, size_t{num_groups} << (window_width_ - 1u));
+    std::copy(sums.begin(), sums.end(), table_.data() + table_first);
+    num_generators_ = num_generators;
+    if (!filename_.empty()) {
+      replace_partition_table_file(filename_, [&](std::ostream& out) noexcept { write(out); });
+    }
+  }
+
+  // partition_table_accessor_base
+  void write_to_file(std::string_view filename) const noexcept override {
+    std::ofstream out{std::string{filename}, std::ios::binary};
+    if (!out.good()) {
+      baser::panic("failed to open {}: {}", filename, std::strerror(errno));
+    }
+    write(out);
+    if (!out.good()) {
+      baser::panic("failed to write {}", filename);
+    }
+  }
+
+private:
+  // set if the table was read from a file, in which case extensions are written through to it
+  std::string filename_;
+  unsigned window_width_;
+  unsigned num_generators_;
+  memmg::managed_array<T> generators_;
+  memmg::managed_array<T> table_;
+
+  void write(std::ostream& out) const noexcept {
+    write_partition_table_header(out, {
+                                          .window_width = window_width_,
+                                          .version = partition_table_version_v,
+                                          .is_signed = true,
+                                          .is_glv = false,
+                                          .num_generators = num_generators_,
+                                      });
+    out.write(reinterpret_cast<const char*>(generators_.data()), generators_.size() * sizeof(T));
+    out.write(reinterpret_cast<const char*>(table_.data()), table_.size() * sizeof(T));
+  }
+
+  /**
+   * Resize `data` to `size` elements keeping its first `keep` elements.
+   */
+  static void resize(memmg::managed_array<T>& data, size_t keep, size_t size) noexcept {
+    if (data.size() == size) {
+      return;
+    }
+    memmg::managed_array<T> res{size, data.get_allocator()};
+    std::copy_n(data.data(), std::min(keep, size), res.data());
+    data = std::move(res);
+  }
+};
+} // namespace sxt::mtxpp2
@@ -0,0 +1,83 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/pippenger2/signed_partition_table_accessor.h"
+
+#include <random>
+#include <vector>
+
+#include "sxt/base/curve/example_element.h"
+#include "sxt/base/test/temp_file.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/multiexp/pippenger2/signed_partition_table.h"
+
+using namespace sxt;
+using namespace sxt::mtxpp2;
+
+TEST_CASE("we can access a signed partition table") {
+  using E = bascrv::element97;
+
+  std::mt19937 rng{0};
+  unsigned window_width = 4;
+  memmg::managed_array<E> generators(8);
+  for (auto& g : generators) {
+    g = std::uniform_int_distribution<unsigned>{0, 96}(rng);
+  }
+  generators[7] = E::identity();
+  memmg::managed_array<E> table(2u << (window_width - 1u));
+  compute_signed_partition_table<E>(table, window_width, generators);
+  auto expected_generators = generators;
+  auto expected_table = table;
+  signed_partition_table_accessor<E> accessor{std::move(table), std::move(generators), 7,
+                                              window_width};
+
+  SECTION("we can query the table") {
+    REQUIRE(accessor.window_width() == window_width);
+    REQUIRE(accessor.num_generators() == 7);
+    REQUIRE(accessor.generators().size() == 8);
+    REQUIRE(accessor.table().size() == expected_table.size());
+  }
+
+  SECTION("we can gather generators") {
+    std::vector<uint64_t> indexes = {6, 0, 3};
+    std::vector<E> v(indexes.size());
+    accessor.gather_generators(v, indexes);
+    std::vector<E> expected = {expected_generators[6], expected_generators[0],
+                               expected_generators[3]};
+    REQUIRE(v == expected);
+  }
+
+  SECTION("we can write the table to a file and read it back") {
+    bastst::temp_file temp_file{std::ios::binary};
+    temp_file.stream().close();
+    accessor.write_to_file(temp_file.name());
+    REQUIRE(is_signed_partition_table_file(temp_file.name()));
+    signed_partition_table_accessor<E> accessor_p{temp_file.name()};
+    REQUIRE(accessor_p.window_width() == window_width);
+    REQUIRE(accessor_p.num_generators() == 7);
+    REQUIRE(std::vector<E>(accessor_p.generators().begin(), accessor_p.generators().end()) ==
+            std::vector<E>(expected_generators.begin(), expected_generators.end()));
+    REQUIRE(std::vector<E>(accessor_p.table().begin(), accessor_p.table().end()) ==
+            std::vector<E>(expected_table.begin(), expected_table.end()));
+  }
+
+  SECTION("unsigned partition table files aren't flagged as signed") {
+    bastst::temp_file temp_file{std::ios::binary};
+    temp_file.stream().write(reinterpret_cast<const char*>(&window_width), sizeof(unsigned));
+    temp_file.stream().close();
+    REQUIRE(!is_signed_partition_table_file(temp_file.name()));
+  }
+}
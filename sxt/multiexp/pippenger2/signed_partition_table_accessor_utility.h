@@ -0,0 +1,159 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+
+#include "sxt/base/container/span.h"
+#include "sxt/base/curve/element.h"
+#include "sxt/base/error/assert.h"
+#include "sxt/base/error/panic.h"
+#include "sxt/base/memory/alloc.h"
+#include "sxt/base/num/divide_up.h"
+#include "sxt/memory/management/managed_array.h"
+#include "sxt/memory/resource/pinned_resource.h"
+#include "sxt/multiexp/pippenger2/partition_table.h"
+#include "sxt/multiexp/pippenger2/signed_partition_table.h"
+#include "sxt/multiexp/pippenger2/signed_partition_table_accessor.h"
+#include "sxt/multiexp/pippenger2/window_width.h"
+
+namespace sxt::mtxpp2 {
+//--------------------------------------------------------------------------------------------------
+// make_signed_partition_table_entries
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the sums of a signed partition table for generators padded to a multiple of the window
+ * width and convert the generators to the table's element type.
+ */
+template <class U, bascrv::element T>
+  requires requires(const U& u, const T& e) {
+    static_cast<U>(e);
+    T{u};
+  }
+void make_signed_partition_table_entries(memmg::managed_array<U>& sums,
+                                         memmg::managed_array<U>& generators_p,
+                                         basct::cspan<T> generators_data, basm::alloc_t alloc,
+                                         unsigned window_width) noexcept {
+  auto num_partitions = generators_data.size() / window_width;
+  sums = memmg::managed_array<U>{num_partitions << (window_width - 1u), alloc};
+  compute_signed_partition_table<U, T>(sums, window_width, generators_data);
+  generators_p = memmg::managed_array<U>{generators_data.size(), alloc};
+  if constexpr (std::is_same_v<U, T>) {
+    std::copy(generators_data.begin(), generators_data.end(), generators_p.begin());
+  } else if constexpr (batch_compactable<U, T>) {
+    batch_to_compact_element(basct::span<U>{generators_p}, generators_data);
+  } else {
+    std::transform(generators_data.begin(), generators_data.end(), generators_p.begin(),
+                   [](const T& e) noexcept { return static_cast<U>(e); });
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// make_signed_partition_table_accessor_impl
+//--------------------------------------------------------------------------------------------------
+template <class U, bascrv::element T>
+  requires requires(const U& u, const T& e) {
+    static_cast<U>(e);
+    T{u};
+  }
+std::unique_ptr<signed_partition_table_accessor<U>>
+make_signed_partition_table_accessor_impl(basct::cspan<T> generators, basm::alloc_t alloc,
+                                          unsigned window_width) noexcept {
+  if (window_width <= 1u) {
+    baser::panic("signed partition tables require a window width greater than 1, got {}",
+                 window_width);
+  }
+  auto n = static_cast<unsigned>(generators.size());
+  auto num_partitions = basn::divide_up(n, window_width);
+  memmg::managed_array<T> generators_data(num_partitions * window_width);
+  auto iter = std::copy(generators.begin(), generators.end(), generators_data.begin());
+  std::fill(iter, generators_data.end(), T::identity());
+  memmg::managed_array<U> sums;
+  memmg::managed_array<U> generators_p;
+  make_signed_partition_table_entries<U, T>(sums, generators_p, generators_data, alloc,
+                                            window_width);
+  return std::make_unique<signed_partition_table_accessor<U>>(
+      std::move(sums), std::move(generators_p), n, window_width);
+}
+
+//--------------------------------------------------------------------------------------------------
+// make_signed_partition_table_accessor
+//--------------------------------------------------------------------------------------------------
+/**
+ * Make a signed partition table accessor for the given generators. Compared to
+ * make_in_memory_partition_table_accessor, the table takes half the memory for the same window
+ * width.
+ */
+template <class U, class T>
+std::unique_ptr<signed_partition_table_accessor<U>>
+make_signed_partition_table_accessor(basct::cspan<T> generators,
+                                     basm::alloc_t alloc = memr::get_pinned_resource(),
+                                     unsigned window_width = get_default_window_width()) noexcept {
+  return make_signed_partition_table_accessor_impl<U, T>(generators, alloc, window_width);
+}
+
+template <class T>
+std::unique_ptr<signed_partition_table_accessor<T>>
+make_signed_partition_table_accessor(basct::cspan<T> generators,
+                                     basm::alloc_t alloc = memr::get_pinned_resource(),
+                                     unsigned window_width = get_default_window_width()) noexcept {
+  return make_signed_partition_table_accessor_impl<T, T>(generators, alloc, window_width);
+}
+
+//--------------------------------------------------------------------------------------------------
+// extend_signed_partition_table_accessor
+//--------------------------------------------------------------------------------------------------
+/**
+ * Append generators to a signed partition table accessor.
+ *
+ * Only the sums for the last partial group and the groups of the new generators are computed. The
+ * accessor copies them into its own storage.
+ */
+template <class U, bascrv::element T>
+  requires requires(const U& u, const T& e) {
+    static_cast<U>(e);
+    T{u};
+  }
+void extend_signed_partition_table_accessor(signed_partition_table_accessor<U>& accessor,
+                                            basct::cspan<T> generators) noexcept {
+  if (generators.empty()) {
+    return;
+  }
+  auto window_width = accessor.window_width();
+  auto num_generators = accessor.num_generators();
+  auto first = num_generators / window_width;
+  auto n = num_generators + static_cast<unsigned>(generators.size());
+  SXT_RELEASE_ASSERT(n > num_generators, "too many generators");
+  auto num_partitions = basn::divide_up(n, window_width) - first;
+
+  // the generators of the last partial group are recomputed along with the new ones
+  memmg::managed_array<T> generators_data(num_partitions * window_width);
+  auto partial = accessor.generators().subspan(first * window_width,
+                                               num_generators - first * window_width);
+  auto iter = std::transform(partial.begin(), partial.end(), generators_data.begin(),
+                             [](const U& u) noexcept { return T{u}; });
+  iter = std::copy(generators.begin(), generators.end(), iter);
+  std::fill(iter, generators_data.end(), T::identity());
+  memmg::managed_array<U> sums;
+  memmg::managed_array<U> generators_p;
+  make_signed_partition_table_entries<U, T>(sums, generators_p, generators_data, {},
+                                            window_width);
+  accessor.extend(generators_p, sums, first, n);
+}
+} // namespace sxt::mtxpp2
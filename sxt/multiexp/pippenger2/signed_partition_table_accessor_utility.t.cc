@@ -0,0 +1,95 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/pippenger2/signed_partition_table_accessor_utility.h"
+
+#include <random>
+#include <vector>
+
+#include "sxt/base/curve/example_element.h"
+#include "sxt/base/test/temp_file.h"
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::mtxpp2;
+
+TEST_CASE("we can make and extend signed partition table accessors") {
+  using E = bascrv::element97;
+
+  std::mt19937 rng{0};
+  unsigned window_width = 4;
+  std::vector<E> generators(11);
+  for (auto& g : generators) {
+    g = std::uniform_int_distribution<unsigned>{0, 96}(rng);
+  }
+  auto expected = make_signed_partition_table_accessor<E>(generators, memr::get_pinned_resource(),
+                                                           window_width);
+  auto check_accessor = [&](const signed_partition_table_accessor<E>& accessor) {
+    REQUIRE(accessor.window_width() == window_width);
+    REQUIRE(accessor.num_generators() == expected->num_generators());
+    REQUIRE(std::vector<E>(accessor.generators().begin(), accessor.generators().end()) ==
+            std::vector<E>(expected->generators().begin(), expected->generators().end()));
+    REQUIRE(std::vector<E>(accessor.table().begin(), accessor.table().end()) ==
+            std::vector<E>(expected->table().begin(), expected->table().end()));
+  };
+
+  SECTION("we can make an accessor") {
+    REQUIRE(expected->num_generators() == 11);
+    memmg::managed_array<E> generators_data(12);
+    std::copy(generators.begin(), generators.end(), generators_data.begin());
+    generators_data[11] = E::identity();
+    memmg::managed_array<E> table(3u << (window_width - 1u));
+    compute_signed_partition_table<E>(table, window_width, generators_data);
+    REQUIRE(std::vector<E>(expected->table().begin(), expected->table().end()) ==
+            std::vector<E>(table.begin(), table.end()));
+  }
+
+  SECTION("we can extend an accessor whose last group is partial") {
+    auto accessor = make_signed_partition_table_accessor<E, E>(
+        basct::cspan<E>{generators.data(), 5}, memr::get_pinned_resource(), window_width);
+    extend_signed_partition_table_accessor<E, E>(
+        *accessor, basct::cspan<E>{generators.data() + 5, 6});
+    check_accessor(*accessor);
+  }
+
+  SECTION("we can extend an accessor whose last group is full") {
+    auto accessor = make_signed_partition_table_accessor<E, E>(
+        basct::cspan<E>{generators.data(), 8}, memr::get_pinned_resource(), window_width);
+    extend_signed_partition_table_accessor<E, E>(
+        *accessor, basct::cspan<E>{generators.data() + 8, 3});
+    check_accessor(*accessor);
+  }
+
+  SECTION("extending an accessor with no generators does nothing") {
+    auto accessor = make_signed_partition_table_accessor<E>(generators, memr::get_pinned_resource(),
+                                                            window_width);
+    extend_signed_partition_table_accessor<E, E>(*accessor, basct::cspan<E>{});
+    check_accessor(*accessor);
+  }
+
+  SECTION("extending an accessor read from a file updates the file") {
+    bastst::temp_file temp_file{std::ios::binary};
+    temp_file.stream().close();
+    make_signed_partition_table_accessor<E, E>(basct::cspan<E>{generators.data(), 6},
+                                               memr::get_pinned_resource(), window_width)
+        ->write_to_file(temp_file.name());
+    signed_partition_table_accessor<E> accessor{temp_file.name()};
+    extend_signed_partition_table_accessor<E, E>(
+        accessor, basct::cspan<E>{generators.data() + 6, 5});
+    check_accessor(accessor);
+    check_accessor(signed_partition_table_accessor<E>{temp_file.name()});
+  }
+}
@@ -61,6 +61,33 @@ void compute_product_length_table(basct::span<unsigned>& product_lengths,
   product_lengths = product_lengths.subspan(0, product_index);
 }
 
+//--------------------------------------------------------------------------------------------------
+// compute_product_offset_table
+//--------------------------------------------------------------------------------------------------
+void compute_product_offset_table(basct::span<unsigned> product_firsts,
+                                  basct::span<unsigned> product_lengths,
+                                  basct::cspan<unsigned> bit_widths,
+                                  basct::cspan<unsigned> output_firsts,
+                                  basct::cspan<unsigned> output_lengths) noexcept {
+  auto num_outputs = bit_widths.size();
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+      product_firsts.size() == count_products(bit_widths) &&
+      product_lengths.size() == product_firsts.size() &&
+      output_firsts.size() == num_outputs &&
+      output_lengths.size() == num_outputs
+      // clang-format on
+  );
+  unsigned product_index = 0;
+  for (size_t output_index = 0; output_index < num_outputs; ++output_index) {
+    for (unsigned bit_index = 0; bit_index < bit_widths[output_index]; ++bit_index) {
+      product_firsts[product_index] = output_firsts[output_index];
+      product_lengths[product_index] = output_lengths[output_index];
+      ++product_index;
+    }
+  }
+}
+
 //--------------------------------------------------------------------------------------------------
 // count_products
 //--------------------------------------------------------------------------------------------------
@@ -27,6 +27,18 @@ void compute_product_length_table(basct::span<unsigned>& product_lengths,
                                   basct::cspan<unsigned> output_lengths, unsigned first,
                                   unsigned length) noexcept;
 
+//--------------------------------------------------------------------------------------------------
+// compute_product_offset_table
+//--------------------------------------------------------------------------------------------------
+/**
+ * Expand the first generator index and length of each output to its products.
+ */
+void compute_product_offset_table(basct::span<unsigned> product_firsts,
+                                  basct::span<unsigned> product_lengths,
+                                  basct::cspan<unsigned> bit_widths,
+                                  basct::cspan<unsigned> output_firsts,
+                                  basct::cspan<unsigned> output_lengths) noexcept;
+
 //--------------------------------------------------------------------------------------------------
 // count_products
 //--------------------------------------------------------------------------------------------------
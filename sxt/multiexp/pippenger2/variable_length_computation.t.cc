@@ -57,6 +57,18 @@ TEST_CASE("we can fill in the table of product lengths") {
   }
 }
 
+TEST_CASE("we can fill in the table of product offsets") {
+  std::vector<unsigned> bit_widths = {2, 1};
+  std::vector<unsigned> output_firsts = {3, 0};
+  std::vector<unsigned> output_lengths = {5, 7};
+  std::vector<unsigned> product_firsts(3);
+  std::vector<unsigned> product_lengths(3);
+  compute_product_offset_table(product_firsts, product_lengths, bit_widths, output_firsts,
+                               output_lengths);
+  REQUIRE(product_firsts == std::vector<unsigned>{3, 3, 0});
+  REQUIRE(product_lengths == std::vector<unsigned>{5, 5, 7});
+}
+
 TEST_CASE("we can count the number of products") {
   std::vector<unsigned> output_bit_table;
 
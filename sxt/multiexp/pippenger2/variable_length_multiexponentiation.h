@@ -25,6 +25,7 @@
 #include "sxt/base/iterator/split.h"
 #include "sxt/base/log/log.h"
 #include "sxt/execution/async/coroutine.h"
+#include "sxt/execution/cpu/thread_count.h"
 #include "sxt/execution/device/for_each.h"
 #include "sxt/execution/device/synchronization.h"
 #include "sxt/memory/management/managed_array.h"
@@ -230,4 +231,87 @@ void multiexponentiate(basct::span<T> res, const partition_table_accessor<U>& ac
   reduce_products<T>(res, output_bit_table, products);
   basl::info("completed {} reductions", num_outputs);
 }
+
+//--------------------------------------------------------------------------------------------------
+// async_offset_multiexponentiate
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute a multi-exponentiation where output i pairs its first output_lengths[i] scalars with the
+ * generators [output_firsts[i], output_firsts[i] + output_lengths[i]).
+ *
+ * Groups of generators before an output's offset are skipped; a first group that isn't aligned to
+ * the window width is masked rather than recomputed.
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+xena::future<> async_offset_multiexponentiate(basct::span<T> res,
+                                              const partition_table_accessor<U>& accessor,
+                                              basct::cspan<unsigned> output_bit_table,
+                                              basct::cspan<unsigned> output_firsts,
+                                              basct::cspan<unsigned> output_lengths,
+                                              basct::cspan<uint8_t> scalars) noexcept {
+  auto num_outputs = res.size();
+  if (num_outputs == 0) {
+    co_return;
+  }
+  auto num_products = count_products(output_bit_table);
+
+  // product offsets
+  memmg::managed_array<unsigned> product_firsts(num_products);
+  memmg::managed_array<unsigned> product_lengths(num_products);
+  compute_product_offset_table(product_firsts, product_lengths, output_bit_table, output_firsts,
+                               output_lengths);
+
+  // partition products
+  basl::info("computing {} bitwise multiexponentiation products with offsets", num_products);
+  memmg::managed_array<T> products{num_products, memr::get_device_resource()};
+  co_await async_offset_partition_product<T>(products, accessor, scalars, product_firsts,
+                                             product_lengths);
+
+  // reduce products
+  co_await combine_reduce<T>(res, output_bit_table, products);
+  basl::info("complete multiexponentiation");
+}
+
+//--------------------------------------------------------------------------------------------------
+// offset_multiexponentiate
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host version of async_offset_multiexponentiate.
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+void offset_multiexponentiate(basct::span<T> res, const partition_table_accessor<U>& accessor,
+                              basct::cspan<unsigned> output_bit_table,
+                              basct::cspan<unsigned> output_firsts,
+                              basct::cspan<unsigned> output_lengths, basct::cspan<uint8_t> scalars,
+                              unsigned num_threads = xencpu::get_num_threads()) noexcept {
+  auto num_outputs = res.size();
+  if (num_outputs == 0) {
+    return;
+  }
+  auto num_products = count_products(output_bit_table);
+  auto num_output_bytes = basn::divide_up<size_t>(num_products, 8);
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+      scalars.size() % num_output_bytes == 0
+      // clang-format on
+  );
+
+  // product offsets
+  memmg::managed_array<unsigned> product_firsts(num_products);
+  memmg::managed_array<unsigned> product_lengths(num_products);
+  compute_product_offset_table(product_firsts, product_lengths, output_bit_table, output_firsts,
+                               output_lengths);
+
+  // partition products
+  memmg::managed_array<T> products(num_products);
+  offset_partition_product<T>(products, accessor, scalars, product_firsts, product_lengths,
+                              num_threads);
+
+  // reduce products
+  basl::info("reducing {} products to {} outputs", num_products, num_outputs);
+  reduce_products<T>(res, output_bit_table, products);
+  basl::info("completed {} reductions", num_outputs);
+}
 } // namespace sxt::mtxpp2
@@ -140,3 +140,58 @@ TEST_CASE("we can compute multiexponentiations with varying lengths") {
     REQUIRE(res[0] == generators[0].value + generators[16].value);
   }
 }
+
+TEST_CASE("we can compute multiexponentiations with generator offsets") {
+  using E = bascrv::element97;
+
+  std::vector<E> generators(40);
+  std::mt19937 rng{0};
+  for (auto& g : generators) {
+    g = std::uniform_int_distribution<unsigned>{0, 96}(rng);
+  }
+
+  auto accessor = make_in_memory_partition_table_accessor<E>(generators);
+
+  std::vector<unsigned> output_bit_table = {8, 3};
+  std::vector<unsigned> output_firsts = {3, 17};
+  std::vector<unsigned> output_lengths = {20, 5};
+  std::vector<uint8_t> scalars(2 * 20);
+  for (auto& x : scalars) {
+    x = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 255}(rng));
+  }
+
+  std::vector<E> expected(2);
+  for (unsigned output_index = 0; output_index < 2; ++output_index) {
+    unsigned sum = 0;
+    for (unsigned j = 0; j < output_lengths[output_index]; ++j) {
+      // the second output only uses the low 3 bits of its byte
+      unsigned x = scalars[2 * j + output_index];
+      if (output_index == 1) {
+        x &= 0b111u;
+      }
+      sum += x * generators[output_firsts[output_index] + j].value;
+    }
+    expected[output_index] = sum % 97u;
+  }
+
+  SECTION("we handle no outputs on the host") {
+    std::vector<E> res;
+    offset_multiexponentiate<E>(res, *accessor, {}, {}, {}, {});
+  }
+
+  SECTION("we can compute a multiexponentiation on the host") {
+    std::vector<E> res(2);
+    offset_multiexponentiate<E>(res, *accessor, output_bit_table, output_firsts, output_lengths,
+                                scalars);
+    REQUIRE(res == expected);
+  }
+
+  SECTION("we can compute a multiexponentiation on the device") {
+    std::vector<E> res(2);
+    auto fut = async_offset_multiexponentiate<E>(res, *accessor, output_bit_table, output_firsts,
+                                                 output_lengths, scalars);
+    xens::get_scheduler().run();
+    REQUIRE(fut.ready());
+    REQUIRE(res == expected);
+  }
+}
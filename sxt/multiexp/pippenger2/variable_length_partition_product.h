@@ -16,16 +16,23 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <concepts>
+#include <limits>
+#include <memory_resource>
 
 #include "sxt/algorithm/iteration/for_each.h"
 #include "sxt/base/container/span.h"
+#include "sxt/base/container/span_utility.h"
 #include "sxt/base/curve/element.h"
 #include "sxt/base/device/memory_utility.h"
 #include "sxt/base/device/stream.h"
+#include "sxt/base/iterator/index_range.h"
+#include "sxt/base/iterator/split.h"
 #include "sxt/base/num/divide_up.h"
 #include "sxt/base/num/round_up.h"
 #include "sxt/execution/async/coroutine.h"
+#include "sxt/execution/cpu/for_each.h"
 #include "sxt/execution/device/synchronization.h"
 #include "sxt/memory/management/managed_array.h"
 #include "sxt/memory/resource/async_device_resource.h"
@@ -140,7 +147,8 @@ void partition_product(basct::span<T> products_slice, unsigned num_products,
   );
   std::pmr::monotonic_buffer_resource alloc;
 
-  auto partition_table = accessor.host_view(&alloc, offset, num_partitions * partition_table_size);
+  auto partition_table =
+      accessor.host_view(&alloc, offset / window_width, num_partitions * partition_table_size);
 
   for (unsigned product_index = 0; product_index < num_slice_products; ++product_index) {
     auto len = lengths[product_index];
@@ -153,4 +161,174 @@ void partition_product(basct::span<T> products_slice, unsigned num_products,
                                 bit_offset, window_width, num_products_round_8, len);
   }
 }
+
+//--------------------------------------------------------------------------------------------------
+// compute_partition_group_range
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the range of partition groups [first, last) covering the generators used by products
+ * with the given offsets and lengths.
+ */
+inline basit::index_range compute_partition_group_range(basct::cspan<unsigned> firsts,
+                                                        basct::cspan<unsigned> lengths,
+                                                        unsigned window_width) noexcept {
+  auto group_first = std::numeric_limits<size_t>::max();
+  size_t group_last = 0;
+  for (size_t product_index = 0; product_index < firsts.size(); ++product_index) {
+    auto len = lengths[product_index];
+    if (len == 0) {
+      continue;
+    }
+    auto first = firsts[product_index];
+    group_first = std::min<size_t>(group_first, first / window_width);
+    group_last = std::max<size_t>(group_last, basn::divide_up(first + len, window_width));
+  }
+  if (group_last == 0) {
+    return {};
+  }
+  return {group_first, group_last};
+}
+
+//--------------------------------------------------------------------------------------------------
+// async_offset_partition_product
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the multiproduct for the bits of an array of scalars where product i pairs its first
+ * lengths[i] scalars with the generators [firsts[i], firsts[i] + lengths[i]).
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+xena::future<> async_offset_partition_product(basct::span<T> products,
+                                              const partition_table_accessor<U>& accessor,
+                                              basct::cspan<uint8_t> scalars,
+                                              basct::cspan<unsigned> firsts,
+                                              basct::cspan<unsigned> lengths) noexcept {
+  auto num_products = static_cast<unsigned>(products.size());
+  auto window_width = accessor.window_width();
+  auto partition_table_size = 1u << window_width;
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+      firsts.size() == num_products &&
+      lengths.size() == num_products &&
+      basdv::is_active_device_pointer(products.data()) &&
+      basdv::is_host_pointer(scalars.data())
+      // clang-format on
+  );
+  auto groups = compute_partition_group_range(firsts, lengths, window_width);
+
+  // scalars_dev
+  memmg::managed_array<uint8_t> scalars_dev{scalars.size(), memr::get_device_resource()};
+  auto scalars_fut = [&]() noexcept -> xena::future<> {
+    basdv::stream stream;
+    basdv::async_copy_host_to_device(scalars_dev, scalars, stream);
+    co_await xendv::await_stream(stream);
+  }();
+
+  // firsts_dev and lengths_dev
+  memmg::managed_array<unsigned> offsets_dev{2u * num_products, memr::get_device_resource()};
+  auto offsets_fut = [&]() noexcept -> xena::future<> {
+    basdv::stream stream;
+    basdv::async_copy_host_to_device(basct::subspan(offsets_dev, 0, num_products), firsts,
+                                     stream);
+    basdv::async_copy_host_to_device(basct::subspan(offsets_dev, num_products), lengths, stream);
+    co_await xendv::await_stream(stream);
+  }();
+
+  // partition_table
+  basdv::stream stream;
+  memr::async_device_resource resource{stream};
+  memmg::managed_array<U> partition_table{std::max<size_t>(groups.size(), 1) * partition_table_size,
+                                          &resource};
+  if (groups.size() > 0) {
+    accessor.async_copy_to_device(partition_table, stream, groups.a());
+  }
+  co_await std::move(offsets_fut);
+  co_await std::move(scalars_fut);
+
+  // product
+  auto f = [
+               // clang-format off
+    products = products.data(),
+    scalars = scalars_dev.data(),
+    partition_table = partition_table.data(),
+    window_width = window_width,
+    group_first = static_cast<unsigned>(groups.a()),
+    offsets = offsets_dev.data()
+               // clang-format on
+  ] __device__
+           __host__(unsigned num_products, unsigned product_index) noexcept {
+             auto first = offsets[product_index];
+             auto n = offsets[num_products + product_index];
+             auto& product = products[product_index];
+             if (n == 0) {
+               product = T::identity();
+               return;
+             }
+             auto table = partition_table +
+                          (first / window_width - group_first) * (1u << window_width);
+             offset_partition_product_kernel<T>(product, table, scalars, product_index / 8u,
+                                                product_index % 8u, window_width,
+                                                basn::round_up(num_products, 8u), first, n);
+           };
+  algi::launch_for_each_kernel(stream, f, num_products);
+  co_await xendv::await_stream(stream);
+}
+
+//--------------------------------------------------------------------------------------------------
+// offset_partition_product
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host version of async_offset_partition_product that splits the products across num_threads
+ * threads.
+ */
+template <bascrv::element T, class U>
+  requires std::constructible_from<T, U>
+void offset_partition_product(basct::span<T> products, const partition_table_accessor<U>& accessor,
+                              basct::cspan<uint8_t> scalars, basct::cspan<unsigned> firsts,
+                              basct::cspan<unsigned> lengths, unsigned num_threads) noexcept {
+  auto num_products = static_cast<unsigned>(products.size());
+  auto window_width = accessor.window_width();
+  auto partition_table_size = 1u << window_width;
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+      firsts.size() == num_products &&
+      lengths.size() == num_products &&
+      num_threads > 0
+      // clang-format on
+  );
+  auto groups = compute_partition_group_range(firsts, lengths, window_width);
+  std::pmr::monotonic_buffer_resource alloc;
+  auto partition_table = accessor.host_view(&alloc, static_cast<unsigned>(groups.a()),
+                                            groups.size() * partition_table_size);
+
+  // Consecutive products that share an offset and a length, such as the bit products of a single
+  // output, go through the grouped host kernel together.
+  auto [product_first, product_last] =
+      basit::split(basit::index_range{0, num_products}, {.split_factor = num_threads});
+  xencpu::concurrent_for_each(
+      product_first, product_last,
+      [&](const basit::index_range& rng) noexcept {
+        auto run_first = static_cast<unsigned>(rng.a());
+        while (run_first < rng.b()) {
+          auto first = firsts[run_first];
+          auto n = lengths[run_first];
+          auto run_last = run_first + 1u;
+          while (run_last < rng.b() && firsts[run_last] == first && lengths[run_last] == n) {
+            ++run_last;
+          }
+          auto products_run = basct::subspan(products, run_first, run_last - run_first);
+          if (n == 0) {
+            std::fill(products_run.begin(), products_run.end(), T::identity());
+          } else {
+            auto table = partition_table.data() +
+                         (first / window_width - groups.a()) * partition_table_size;
+            offset_partition_product_host_kernel<T>(products_run, num_products, run_first, table,
+                                                    window_width, scalars.data(),
+                                                    first % window_width, n);
+          }
+          run_first = run_last;
+        }
+      },
+      num_threads);
+}
 } // namespace sxt::mtxpp2
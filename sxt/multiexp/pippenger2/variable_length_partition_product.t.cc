@@ -101,6 +101,13 @@ TEST_CASE("we can compute partition products of variable length") {
     REQUIRE(products == expected);
   }
 
+  SECTION("we handle a product with an offset on the host") {
+    scalars[0] = 1;
+    partition_product<E>(products, 8, accessor, scalars, lengths, 16);
+    expected[0] = partition_table[partition_table_size + 1];
+    REQUIRE(products == expected);
+  }
+
   SECTION("we handle products with length greater than 1") {
     scalars = {1u, 3u};
     products.resize(2);
@@ -118,3 +125,71 @@ TEST_CASE("we can compute partition products of variable length") {
     REQUIRE(products == expected);
   }
 }
+
+TEST_CASE("we can compute partition products with generator offsets") {
+  using E = bascrv::element97;
+
+  const unsigned window_width = 4;
+  memmg::managed_array<E> partition_table(10u << window_width);
+  std::mt19937 rng{0};
+  for (auto& e : partition_table) {
+    e = std::uniform_int_distribution<unsigned>{0, 96}(rng);
+  }
+  in_memory_partition_table_accessor accessor{memmg::managed_array<E>{partition_table},
+                                              window_width};
+
+  std::vector<unsigned> firsts = {5, 8};
+  std::vector<unsigned> lengths = {2, 1};
+  std::vector<uint8_t> scalars = {0b11u, 0b01u};
+  memmg::managed_array<E> expected = {
+      partition_table[(1u << window_width) + 0b0110u],
+      partition_table[(2u << window_width) + 0b1u],
+  };
+
+  SECTION("we handle products on the device") {
+    memmg::managed_array<E> products{2, memr::get_managed_device_resource()};
+    auto fut = async_offset_partition_product<E>(products, accessor, scalars, firsts, lengths);
+    xens::get_scheduler().run();
+    REQUIRE(fut.ready());
+    basdv::synchronize_device();
+    REQUIRE(products == expected);
+  }
+
+  SECTION("we handle products on the host") {
+    memmg::managed_array<E> products(2);
+    offset_partition_product<E>(products, accessor, scalars, firsts, lengths, 2);
+    REQUIRE(products == expected);
+  }
+
+  SECTION("we handle runs of products that share an offset on the host") {
+    firsts = {3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 8, 8};
+    lengths = {9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 4, 0};
+    scalars.resize(9 * 2);
+    for (auto& x : scalars) {
+      x = static_cast<uint8_t>(std::uniform_int_distribution<unsigned>{0, 255}(rng));
+    }
+    expected = memmg::managed_array<E>(firsts.size());
+    for (unsigned i = 0; i < firsts.size(); ++i) {
+      if (lengths[i] == 0) {
+        expected[i] = E::identity();
+        continue;
+      }
+      auto table = partition_table.data() + (firsts[i] / window_width) * (1u << window_width);
+      offset_partition_product_kernel<E>(expected[i], table, scalars.data(), i / 8u, i % 8u,
+                                         window_width, 16, firsts[i], lengths[i]);
+    }
+    for (unsigned num_threads : {1u, 3u}) {
+      memmg::managed_array<E> products(firsts.size());
+      offset_partition_product<E>(products, accessor, scalars, firsts, lengths, num_threads);
+      REQUIRE(products == expected);
+    }
+  }
+
+  SECTION("we handle products of length zero") {
+    lengths[1] = 0;
+    expected[1] = E::identity();
+    memmg::managed_array<E> products(2);
+    offset_partition_product<E>(products, accessor, scalars, firsts, lengths, 1);
+    REQUIRE(products == expected);
+  }
+}
@@ -0,0 +1,54 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/selection/active_profile.h"
+
+#include <cstdlib>
+
+#include "sxt/base/log/log.h"
+#include "sxt/multiexp/selection/cost_profile.h"
+
+namespace sxt::mtxsel {
+//--------------------------------------------------------------------------------------------------
+// active_profile
+//--------------------------------------------------------------------------------------------------
+static cost_profile& active_profile() noexcept {
+  static cost_profile res;
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// init_active_cost_profile
+//--------------------------------------------------------------------------------------------------
+void init_active_cost_profile() noexcept {
+  auto filename = std::getenv("BLITZAR_MULTIEXP_PROFILE");
+  if (filename == nullptr) {
+    return;
+  }
+  set_active_cost_profile(read_cost_profile(filename));
+  basl::info("loaded multiexponentiation cost profile {}", filename);
+}
+
+//--------------------------------------------------------------------------------------------------
+// get_active_cost_profile
+//--------------------------------------------------------------------------------------------------
+const cost_profile& get_active_cost_profile() noexcept { return active_profile(); }
+
+//--------------------------------------------------------------------------------------------------
+// set_active_cost_profile
+//--------------------------------------------------------------------------------------------------
+void set_active_cost_profile(const cost_profile& profile) noexcept { active_profile() = profile; }
+} // namespace sxt::mtxsel
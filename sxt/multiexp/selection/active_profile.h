@@ -0,0 +1,47 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+namespace sxt::mtxsel {
+class cost_profile;
+
+//--------------------------------------------------------------------------------------------------
+// init_active_cost_profile
+//--------------------------------------------------------------------------------------------------
+/**
+ * Load the cost profile named by the environment variable BLITZAR_MULTIEXP_PROFILE, if set, and
+ * make it the active profile.
+ */
+void init_active_cost_profile() noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// get_active_cost_profile
+//--------------------------------------------------------------------------------------------------
+/**
+ * The profile used to select host multiexponentiation engines. Without a loaded profile, every
+ * coefficient is 1.
+ */
+const cost_profile& get_active_cost_profile() noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// set_active_cost_profile
+//--------------------------------------------------------------------------------------------------
+/**
+ * Replace the active profile. Not thread-safe: call during initialization only.
+ */
+void set_active_cost_profile(const cost_profile& profile) noexcept;
+} // namespace sxt::mtxsel
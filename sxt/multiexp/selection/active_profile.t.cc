@@ -0,0 +1,34 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/selection/active_profile.h"
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/multiexp/selection/cost_profile.h"
+
+using namespace sxt;
+using namespace sxt::mtxsel;
+
+TEST_CASE("we can set the active cost profile") {
+  auto original = get_active_cost_profile();
+
+  cost_profile profile;
+  profile.set_coefficient("bn254", engine_t::straus, 2.0);
+  set_active_cost_profile(profile);
+  REQUIRE(get_active_cost_profile().coefficient("bn254", engine_t::straus) == 2.0);
+
+  set_active_cost_profile(original);
+}
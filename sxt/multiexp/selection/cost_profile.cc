@@ -0,0 +1,143 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/selection/cost_profile.h"
+
+#include <charconv>
+#include <format>
+#include <fstream>
+#include <iterator>
+
+#include "sxt/base/error/panic.h"
+
+namespace sxt::mtxsel {
+//--------------------------------------------------------------------------------------------------
+// next_token
+//--------------------------------------------------------------------------------------------------
+static std::string_view next_token(std::string_view& line) noexcept {
+  auto first = line.find_first_not_of(" \t\r");
+  if (first == std::string_view::npos) {
+    line = {};
+    return {};
+  }
+  line.remove_prefix(first);
+  auto last = std::min(line.find_first_of(" \t\r"), line.size());
+  auto res = line.substr(0, last);
+  line.remove_prefix(last);
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// coefficient
+//--------------------------------------------------------------------------------------------------
+double cost_profile::coefficient(std::string_view curve, engine_t engine) const noexcept {
+  auto iter = coefficients_.find(curve);
+  if (iter == coefficients_.end()) {
+    return 1.0;
+  }
+  return iter->second[static_cast<unsigned>(engine)];
+}
+
+//--------------------------------------------------------------------------------------------------
+// set_coefficient
+//--------------------------------------------------------------------------------------------------
+void cost_profile::set_coefficient(std::string_view curve, engine_t engine, double value) noexcept {
+  auto iter = coefficients_.find(curve);
+  if (iter == coefficients_.end()) {
+    std::array<double, num_engines_v> defaults;
+    defaults.fill(1.0);
+    iter = coefficients_.emplace(std::string{curve}, defaults).first;
+  }
+  iter->second[static_cast<unsigned>(engine)] = value;
+}
+
+//--------------------------------------------------------------------------------------------------
+// parse_cost_profile
+//--------------------------------------------------------------------------------------------------
+cost_profile parse_cost_profile(std::string_view text) noexcept {
+  cost_profile res;
+  unsigned line_number = 0;
+  while (!text.empty()) {
+    ++line_number;
+    auto pos = std::min(text.find('\n'), text.size());
+    auto line = text.substr(0, pos);
+    text.remove_prefix(std::min(pos + 1, text.size()));
+
+    auto curve = next_token(line);
+    if (curve.empty() || curve.front() == '#') {
+      continue;
+    }
+    auto engine_name = next_token(line);
+    auto engine = parse_engine(engine_name);
+    if (!engine) {
+      baser::panic("line {} of cost profile has an unknown engine '{}'", line_number, engine_name);
+    }
+    auto value_str = next_token(line);
+    double value;
+    auto parse_result =
+        std::from_chars(value_str.data(), value_str.data() + value_str.size(), value);
+    if (parse_result.ec != std::errc{} ||
+        parse_result.ptr != value_str.data() + value_str.size() || !(value > 0)) {
+      baser::panic("line {} of cost profile has an invalid coefficient '{}'", line_number,
+                   value_str);
+    }
+    if (!next_token(line).empty()) {
+      baser::panic("line {} of cost profile has trailing characters", line_number);
+    }
+    res.set_coefficient(curve, *engine, value);
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// format_cost_profile
+//--------------------------------------------------------------------------------------------------
+std::string format_cost_profile(const cost_profile& profile) noexcept {
+  std::string res = "# <curve> <engine> <coefficient>\n";
+  for (auto& [curve, values] : profile.coefficients()) {
+    for (unsigned i = 0; i < num_engines_v; ++i) {
+      res += std::format("{} {} {}\n", curve, to_string(static_cast<engine_t>(i)), values[i]);
+    }
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// read_cost_profile
+//--------------------------------------------------------------------------------------------------
+cost_profile read_cost_profile(const char* filename) noexcept {
+  std::ifstream in{filename};
+  if (!in.good()) {
+    baser::panic("failed to open cost profile {}", filename);
+  }
+  std::string text{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+  return parse_cost_profile(text);
+}
+
+//--------------------------------------------------------------------------------------------------
+// write_cost_profile
+//--------------------------------------------------------------------------------------------------
+void write_cost_profile(const char* filename, const cost_profile& profile) noexcept {
+  std::ofstream out{filename};
+  if (!out.good()) {
+    baser::panic("failed to open cost profile {} for writing", filename);
+  }
+  out << format_cost_profile(profile);
+  if (!out.good()) {
+    baser::panic("failed to write cost profile {}", filename);
+  }
+}
+} // namespace sxt::mtxsel
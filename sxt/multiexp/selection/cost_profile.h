@@ -0,0 +1,75 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+
+#include "sxt/multiexp/selection/engine.h"
+
+namespace sxt::mtxsel {
+//--------------------------------------------------------------------------------------------------
+// cost_profile
+//--------------------------------------------------------------------------------------------------
+/**
+ * Per-curve scaling coefficients for the multiexponentiation cost models.
+ *
+ * The cost models count abstract group operations; a coefficient converts that count into the
+ * measured time per operation of an engine on a given curve for the host machine. Curves or
+ * engines without an entry use a coefficient of 1.
+ */
+class cost_profile {
+public:
+  double coefficient(std::string_view curve, engine_t engine) const noexcept;
+
+  void set_coefficient(std::string_view curve, engine_t engine, double value) noexcept;
+
+  bool empty() const noexcept { return coefficients_.empty(); }
+
+  const auto& coefficients() const noexcept { return coefficients_; }
+
+private:
+  std::map<std::string, std::array<double, num_engines_v>, std::less<>> coefficients_;
+};
+
+//--------------------------------------------------------------------------------------------------
+// parse_cost_profile
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parse a profile from text with one `<curve> <engine> <coefficient>` entry per line. Blank lines
+ * and lines starting with `#` are ignored. Panics on malformed input.
+ */
+cost_profile parse_cost_profile(std::string_view text) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// format_cost_profile
+//--------------------------------------------------------------------------------------------------
+std::string format_cost_profile(const cost_profile& profile) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// read_cost_profile
+//--------------------------------------------------------------------------------------------------
+cost_profile read_cost_profile(const char* filename) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// write_cost_profile
+//--------------------------------------------------------------------------------------------------
+void write_cost_profile(const char* filename, const cost_profile& profile) noexcept;
+} // namespace sxt::mtxsel
@@ -0,0 +1,51 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/selection/cost_profile.h"
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::mtxsel;
+
+TEST_CASE("we can parse cost profiles") {
+  SECTION("an empty profile uses unit coefficients") {
+    auto profile = parse_cost_profile("");
+    REQUIRE(profile.empty());
+    REQUIRE(profile.coefficient("bn254", engine_t::straus) == 1.0);
+  }
+
+  SECTION("we can parse entries") {
+    auto profile = parse_cost_profile("# comment\n"
+                                      "\n"
+                                      "bn254 straus 2.5\n"
+                                      "  bn254\tmultiproduct 0.5  \n"
+                                      "grumpkin signed_bucket 3");
+    REQUIRE(profile.coefficient("bn254", engine_t::straus) == 2.5);
+    REQUIRE(profile.coefficient("bn254", engine_t::signed_bucket) == 1.0);
+    REQUIRE(profile.coefficient("bn254", engine_t::multiproduct) == 0.5);
+    REQUIRE(profile.coefficient("grumpkin", engine_t::signed_bucket) == 3.0);
+    REQUIRE(profile.coefficient("bls12_381", engine_t::signed_bucket) == 1.0);
+  }
+
+  SECTION("formatting and parsing a profile round-trips") {
+    cost_profile profile;
+    profile.set_coefficient("curve25519", engine_t::signed_bucket, 0.125);
+    profile.set_coefficient("bn254", engine_t::straus, 4.0);
+    auto other = parse_cost_profile(format_cost_profile(profile));
+    REQUIRE(other.coefficients() == profile.coefficients());
+  }
+}
@@ -0,0 +1,52 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/selection/engine.h"
+
+#include <array>
+
+namespace sxt::mtxsel {
+//--------------------------------------------------------------------------------------------------
+// engine_names_v
+//--------------------------------------------------------------------------------------------------
+static constexpr std::array<std::string_view, num_engines_v> engine_names_v = {
+    "straus",
+    "signed_bucket",
+    "multiproduct",
+    "small_width",
+    "histogram",
+    "glv",
+};
+
+//--------------------------------------------------------------------------------------------------
+// to_string
+//--------------------------------------------------------------------------------------------------
+std::string_view to_string(engine_t engine) noexcept {
+  return engine_names_v[static_cast<unsigned>(engine)];
+}
+
+//--------------------------------------------------------------------------------------------------
+// parse_engine
+//--------------------------------------------------------------------------------------------------
+std::optional<engine_t> parse_engine(std::string_view s) noexcept {
+  for (unsigned i = 0; i < num_engines_v; ++i) {
+    if (engine_names_v[i] == s) {
+      return static_cast<engine_t>(i);
+    }
+  }
+  return std::nullopt;
+}
+} // namespace sxt::mtxsel
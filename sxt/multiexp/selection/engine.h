@@ -0,0 +1,65 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <optional>
+#include <string_view>
+
+namespace sxt::mtxsel {
+//--------------------------------------------------------------------------------------------------
+// engine_t
+//--------------------------------------------------------------------------------------------------
+/**
+ * The host multiexponentiation engines that a plan can choose between.
+ */
+enum class engine_t : unsigned {
+  // interleaved double-and-add over wNAF digits (mtxcrv::multiexponentiate_straus)
+  straus = 0,
+
+  // Pippenger's bucket method with signed digits (mtxbk2::multiexponentiate_cpu)
+  signed_bucket = 1,
+
+  // bitwise multiproduct decomposition (mtxcrv::compute_multiexponentiation_cpu)
+  multiproduct = 2,
+
+  // buckets by the full value of 1 or 2 byte exponents (mtxbk2::multiexponentiate_small_width_cpu)
+  small_width = 3,
+
+  // sums generators by exponent value for low cardinality columns
+  // (mtxbk2::multiexponentiate_histogram_cpu)
+  histogram = 4,
+
+  // signed bucket method over scalars decomposed with a curve endomorphism
+  // (mtxglv::multiexponentiate_cpu)
+  glv = 5,
+};
+
+//--------------------------------------------------------------------------------------------------
+// num_engines_v
+//--------------------------------------------------------------------------------------------------
+static constexpr unsigned num_engines_v = 6;
+
+//--------------------------------------------------------------------------------------------------
+// to_string
+//--------------------------------------------------------------------------------------------------
+std::string_view to_string(engine_t engine) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// parse_engine
+//--------------------------------------------------------------------------------------------------
+std::optional<engine_t> parse_engine(std::string_view s) noexcept;
+} // namespace sxt::mtxsel
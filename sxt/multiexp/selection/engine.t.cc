@@ -0,0 +1,31 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/selection/engine.h"
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::mtxsel;
+
+TEST_CASE("we can convert engines to and from strings") {
+  for (unsigned i = 0; i < num_engines_v; ++i) {
+    auto engine = static_cast<engine_t>(i);
+    REQUIRE(parse_engine(to_string(engine)) == engine);
+  }
+  REQUIRE(to_string(engine_t::signed_bucket) == "signed_bucket");
+  REQUIRE(!parse_engine("abc"));
+}
@@ -0,0 +1,346 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/selection/engine_selection.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+
+#include "sxt/base/error/assert.h"
+#include "sxt/base/num/divide_up.h"
+#include "sxt/execution/cpu/thread_count.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/bucket_method2/cpu_multiexponentiation.h"
+#include "sxt/multiexp/bucket_method2/histogram_multiexponentiation.h"
+#include "sxt/multiexp/bucket_method2/signed_digit.h"
+#include "sxt/multiexp/bucket_method2/small_width_multiexponentiation.h"
+#include "sxt/multiexp/curve/cpu_multiexponentiation.h"
+#include "sxt/multiexp/curve/straus_multiexponentiation.h"
+#include "sxt/multiexp/glv/scalar_decomposition.h"
+#include "sxt/multiexp/selection/cost_profile.h"
+
+namespace sxt::mtxsel {
+//--------------------------------------------------------------------------------------------------
+// get_available_memory
+//--------------------------------------------------------------------------------------------------
+static size_t get_available_memory() noexcept {
+  auto num_pages = sysconf(_SC_AVPHYS_PAGES);
+  auto page_size = sysconf(_SC_PAGESIZE);
+  if (num_pages <= 0 || page_size <= 0) {
+    return static_cast<size_t>(-1);
+  }
+  return static_cast<size_t>(num_pages) * static_cast<size_t>(page_size);
+}
+
+//--------------------------------------------------------------------------------------------------
+// plan_straus
+//--------------------------------------------------------------------------------------------------
+static multiexp_plan plan_straus(const multiexp_descriptor& descriptor) noexcept {
+  // Each output doubles once per bit and adds a table entry for each nonzero wNAF digit, which
+  // occur on average once every w + 1 bits; building the tables of odd multiples takes
+  // 2^(w - 2) operations per generator. The engine runs on a single thread.
+  unsigned w = mtxcrv::straus_window_width_v;
+  double num_bits = 8.0 * descriptor.element_num_bytes;
+  auto n = static_cast<double>(descriptor.n);
+  auto cost = static_cast<double>(descriptor.num_outputs) * (num_bits + n * num_bits / (w + 1)) +
+              n * static_cast<double>(1u << (w - 2u));
+  return {
+      .engine = engine_t::straus,
+      .num_threads = 1,
+      .cost = cost,
+  };
+}
+
+//--------------------------------------------------------------------------------------------------
+// plan_signed_bucket
+//--------------------------------------------------------------------------------------------------
+static multiexp_plan plan_signed_bucket(const multiexp_descriptor& descriptor) noexcept {
+  auto n = descriptor.n;
+  auto element_num_bytes = descriptor.element_num_bytes;
+  auto num_threads = descriptor.num_threads;
+
+  // every thread holds its own buckets, so narrow the digits until they fit in memory
+  auto bit_width = mtxbk2::compute_signed_digit_bit_width(n, element_num_bytes);
+  auto bucket_memory = [&](unsigned w) noexcept {
+    return static_cast<size_t>(num_threads) * (size_t{1} << (w - 1u)) * descriptor.element_size;
+  };
+  while (bit_width > 1 && bucket_memory(bit_width) > descriptor.available_memory) {
+    --bit_width;
+  }
+
+  // digits run in parallel and are further split into chunks of generators when there are fewer
+  // digits than threads
+  size_t num_digits = mtxbk2::count_signed_digits(element_num_bytes, bit_width);
+  auto num_chunks =
+      std::clamp<size_t>(basn::divide_up<size_t>(n, mtxbk2::min_cpu_chunk_size_v), 1,
+                         basn::divide_up<size_t>(num_threads, num_digits));
+  auto num_tasks = num_digits * num_chunks;
+  auto parallelism = static_cast<double>(std::min<size_t>(num_threads, num_tasks));
+  auto ops = static_cast<double>(mtxbk2::estimate_signed_bucket_cost(n, element_num_bytes,
+                                                                      bit_width)) *
+             static_cast<double>(descriptor.num_outputs);
+  return {
+      .engine = engine_t::signed_bucket,
+      .bit_width = bit_width,
+      .num_threads = num_threads,
+      .cost = ops / parallelism + static_cast<double>(num_tasks * descriptor.num_outputs),
+  };
+}
+
+//--------------------------------------------------------------------------------------------------
+// plan_multiproduct
+//--------------------------------------------------------------------------------------------------
+static multiexp_plan plan_multiproduct(const multiexp_descriptor& descriptor) noexcept {
+  auto n = descriptor.n;
+  auto num_threads = descriptor.num_threads;
+  double num_bits = 8.0 * descriptor.element_num_bytes;
+
+  // each concurrently processed chunk holds intermediate products in proportion to its size, so
+  // shrink chunks to fit in memory
+  auto chunk_size = std::max<size_t>(basn::divide_up<size_t>(n, num_threads),
+                                     mtxcrv::min_cpu_chunk_size_v);
+  auto max_chunk_size = descriptor.available_memory /
+                        std::max<size_t>(1, 2 * num_threads * descriptor.element_size *
+                                                std::max<size_t>(descriptor.num_outputs, 1));
+  chunk_size = std::max(std::min(chunk_size, max_chunk_size), mtxcrv::min_cpu_chunk_size_v);
+  auto num_chunks = basn::divide_up<size_t>(n, chunk_size);
+  auto parallelism = static_cast<double>(std::clamp<size_t>(num_chunks, 1, num_threads));
+
+  // Half the bits of a random scalar are set and the multiproduct solver roughly halves the
+  // remaining additions by sharing partial sums between the bitwise products. Each chunk also
+  // combines its bitwise products with a doubling per bit.
+  auto num_outputs = static_cast<double>(descriptor.num_outputs);
+  auto ops = num_outputs * static_cast<double>(n) * num_bits / 4.0 +
+             num_outputs * static_cast<double>(num_chunks) * num_bits;
+  return {
+      .engine = engine_t::multiproduct,
+      .chunk_size = chunk_size,
+      .num_threads = num_threads,
+      .cost = ops / parallelism,
+  };
+}
+
+//--------------------------------------------------------------------------------------------------
+// plan_small_width
+//--------------------------------------------------------------------------------------------------
+static multiexp_plan plan_small_width(const multiexp_descriptor& descriptor) noexcept {
+  auto n = descriptor.n;
+  auto num_threads = descriptor.num_threads;
+  auto num_outputs = descriptor.num_outputs;
+
+  // Every exponent takes an addition into its bucket and each chunk reduces a column's buckets
+  // with two additions per bucket. Columns share passes over the generators in groups of bounded
+  // bucket counts.
+  size_t num_buckets = std::max(descriptor.max_magnitude, 1u);
+  auto num_groups = basn::divide_up<size_t>(num_outputs * num_buckets,
+                                            mtxbk2::max_small_width_group_buckets_v);
+  auto min_chunk_size = std::max<size_t>(mtxbk2::min_cpu_chunk_size_v, 2 * num_buckets);
+  auto num_chunks = std::clamp<size_t>(basn::divide_up<size_t>(n, min_chunk_size), 1,
+                                       basn::divide_up<size_t>(num_threads, num_groups));
+  auto parallelism =
+      static_cast<double>(std::clamp<size_t>(num_groups * num_chunks, 1, num_threads));
+  auto ops = static_cast<double>(num_outputs) *
+             (static_cast<double>(n) + 2.0 * static_cast<double>(num_chunks * num_buckets));
+  return {
+      .engine = engine_t::small_width,
+      .num_threads = num_threads,
+      .cost = ops / parallelism,
+  };
+}
+
+//--------------------------------------------------------------------------------------------------
+// plan_histogram
+//--------------------------------------------------------------------------------------------------
+static multiexp_plan plan_histogram(const multiexp_descriptor& descriptor) noexcept {
+  auto n = descriptor.n;
+  auto num_threads = descriptor.num_threads;
+  auto element_num_bytes = descriptor.element_num_bytes;
+  auto num_values = std::max<size_t>(descriptor.max_num_distinct, 1);
+
+  // Every row takes an addition into the sum of its value, split into chunks across threads, and
+  // the sums are combined with a signed bucket multiexponentiation of the distinct values.
+  auto num_chunks = std::clamp<size_t>(basn::divide_up<size_t>(n, mtxbk2::min_cpu_chunk_size_v),
+                                       1, num_threads);
+  auto bit_width = mtxbk2::compute_signed_digit_bit_width(num_values, element_num_bytes);
+  auto num_digits = mtxbk2::count_signed_digits(element_num_bytes, bit_width);
+  auto sum_ops = static_cast<double>(n + num_chunks * num_values) / static_cast<double>(num_chunks);
+  auto value_ops = static_cast<double>(mtxbk2::estimate_signed_bucket_cost(
+                       num_values, element_num_bytes, bit_width)) /
+                   static_cast<double>(std::min<size_t>(num_threads, num_digits));
+  return {
+      .engine = engine_t::histogram,
+      .num_threads = num_threads,
+      .cost = static_cast<double>(descriptor.num_outputs) * (sum_ops + value_ops),
+  };
+}
+
+//--------------------------------------------------------------------------------------------------
+// plan_glv
+//--------------------------------------------------------------------------------------------------
+static multiexp_plan plan_glv(const multiexp_descriptor& descriptor) noexcept {
+  // Decomposition doubles the generators and halves the scalar width, after which the signed
+  // bucket method runs as usual. Computing an endomorphism per generator and a decomposition per
+  // scalar each take a few field multiplications, which we count as a quarter of an addition; the
+  // expansion runs on a single thread.
+  auto expanded = descriptor;
+  expanded.n = 2 * descriptor.n;
+  expanded.element_num_bytes = mtxglv::decomposition_num_bytes_v;
+  auto res = plan_signed_bucket(expanded);
+  res.engine = engine_t::glv;
+  res.cost += static_cast<double>(descriptor.n * (descriptor.num_outputs + 1)) / 4.0;
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// describe_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+multiexp_descriptor
+describe_multiexponentiation(std::string_view curve, size_t element_size,
+                             basct::cspan<mtxb::exponent_sequence> exponents,
+                             basct::cspan<size_t> distinct_value_counts,
+                             basct::cspan<unsigned> max_magnitudes) noexcept {
+  SXT_DEBUG_ASSERT(
+      // clang-format off
+      (distinct_value_counts.empty() || distinct_value_counts.size() == exponents.size()) &&
+      (max_magnitudes.empty() || max_magnitudes.size() == exponents.size())
+      // clang-format on
+  );
+  multiexp_descriptor res{
+      .curve = curve,
+      .num_outputs = exponents.size(),
+      .element_size = element_size,
+      .num_threads = xencpu::get_num_threads(),
+      .available_memory = get_available_memory(),
+  };
+  for (auto& seq : exponents) {
+    res.n = std::max(res.n, seq.n);
+    res.element_num_bytes = std::max<unsigned>(res.element_num_bytes, seq.element_nbytes);
+    res.is_signed = res.is_signed || seq.is_signed != 0;
+  }
+  if (res.element_num_bytes <= mtxbk2::max_small_width_num_bytes_v) {
+    for (size_t output_index = 0; output_index < exponents.size(); ++output_index) {
+      auto max_magnitude = max_magnitudes.empty()
+                               ? mtxbk2::compute_max_small_magnitude(exponents[output_index])
+                               : max_magnitudes[output_index];
+      res.max_magnitude = std::max(res.max_magnitude, max_magnitude);
+    }
+  }
+  res.max_num_distinct = 0;
+  for (size_t output_index = 0; output_index < exponents.size(); ++output_index) {
+    auto num_distinct = distinct_value_counts.empty()
+                            ? mtxbk2::count_distinct_values(exponents[output_index],
+                                                            mtxbk2::max_histogram_num_values_v)
+                            : distinct_value_counts[output_index];
+    res.max_num_distinct = std::max(res.max_num_distinct, num_distinct);
+    if (res.max_num_distinct > mtxbk2::max_histogram_num_values_v) {
+      break;
+    }
+  }
+  return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// estimate_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+std::optional<multiexp_plan> estimate_multiexponentiation(const multiexp_descriptor& descriptor,
+                                                          engine_t engine) noexcept {
+  SXT_DEBUG_ASSERT(descriptor.num_threads > 0);
+  switch (engine) {
+  case engine_t::straus:
+    if (descriptor.n > mtxcrv::straus_max_num_generators_v) {
+      return std::nullopt;
+    }
+    return plan_straus(descriptor);
+  case engine_t::signed_bucket:
+    if (descriptor.is_signed || descriptor.n == 0) {
+      return std::nullopt;
+    }
+    return plan_signed_bucket(descriptor);
+  case engine_t::multiproduct:
+    return plan_multiproduct(descriptor);
+  case engine_t::small_width:
+    if (descriptor.element_num_bytes > mtxbk2::max_small_width_num_bytes_v ||
+        descriptor.n == 0) {
+      return std::nullopt;
+    }
+    return plan_small_width(descriptor);
+  case engine_t::histogram:
+    if (descriptor.max_num_distinct > mtxbk2::max_histogram_num_values_v || descriptor.n == 0) {
+      return std::nullopt;
+    }
+    return plan_histogram(descriptor);
+  case engine_t::glv:
+    if (!descriptor.has_endomorphism || descriptor.is_signed ||
+        descriptor.element_num_bytes <= mtxglv::decomposition_num_bytes_v || descriptor.n == 0) {
+      return std::nullopt;
+    }
+    return plan_glv(descriptor);
+  }
+  __builtin_unreachable();
+}
+
+//--------------------------------------------------------------------------------------------------
+// plan_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+multiexp_plan plan_multiexponentiation(const multiexp_descriptor& descriptor,
+                                       const cost_profile& profile) noexcept {
+  std::optional<multiexp_plan> res;
+  for (unsigned i = 0; i < num_engines_v; ++i) {
+    auto engine = static_cast<engine_t>(i);
+    auto plan = estimate_multiexponentiation(descriptor, engine);
+    if (!plan) {
+      continue;
+    }
+    plan->cost *= profile.coefficient(descriptor.curve, engine);
+    if (!res || plan->cost < res->cost) {
+      res = plan;
+    }
+  }
+  return *res;
+}
+
+//--------------------------------------------------------------------------------------------------
+// max_planned_histogram_num_values
+//--------------------------------------------------------------------------------------------------
+size_t max_planned_histogram_num_values(const multiexp_descriptor& descriptor,
+                                        const cost_profile& profile) noexcept {
+  auto without_histogram = descriptor;
+  without_histogram.max_num_distinct = mtxbk2::max_histogram_num_values_v + 1;
+  auto cost = plan_multiexponentiation(without_histogram, profile).cost;
+  auto coefficient = profile.coefficient(descriptor.curve, engine_t::histogram);
+  auto is_chosen = [&](size_t num_values) noexcept {
+    auto with_histogram = descriptor;
+    with_histogram.max_num_distinct = num_values;
+    auto plan = estimate_multiexponentiation(with_histogram, engine_t::histogram);
+    return plan && plan->cost * coefficient < cost;
+  };
+
+  // find the largest count in [0, max_histogram_num_values_v] that is chosen, treating 0 as
+  // always chosen
+  size_t first = 0;
+  size_t last = mtxbk2::max_histogram_num_values_v;
+  while (first < last) {
+    auto mid = first + (last - first + 1) / 2;
+    if (is_chosen(mid)) {
+      first = mid;
+    } else {
+      last = mid - 1;
+    }
+  }
+  return first;
+}
+} // namespace sxt::mtxsel
@@ -0,0 +1,131 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <string_view>
+
+#include "sxt/base/container/span.h"
+#include "sxt/multiexp/selection/engine.h"
+
+namespace sxt::mtxb {
+struct exponent_sequence;
+}
+
+namespace sxt::mtxsel {
+class cost_profile;
+
+//--------------------------------------------------------------------------------------------------
+// multiexp_descriptor
+//--------------------------------------------------------------------------------------------------
+/**
+ * The shape of a multiexponentiation and the resources available to compute it.
+ *
+ * max_magnitude is the largest absolute value of any exponent and is only known when every
+ * exponent fits in mtxbk2::max_small_width_num_bytes_v bytes. max_num_distinct is the largest
+ * number of distinct nonzero magnitudes in an output's exponents; it's only counted up to just
+ * past mtxbk2::max_histogram_num_values_v.
+ */
+struct multiexp_descriptor {
+  std::string_view curve;
+  size_t n = 0;
+  size_t num_outputs = 0;
+  unsigned element_num_bytes = 0;
+  bool is_signed = false;
+  bool has_endomorphism = false;
+  unsigned max_magnitude = 0;
+  size_t max_num_distinct = std::numeric_limits<size_t>::max();
+  size_t element_size = 0;
+  unsigned num_threads = 1;
+  size_t available_memory = 0;
+};
+
+//--------------------------------------------------------------------------------------------------
+// multiexp_plan
+//--------------------------------------------------------------------------------------------------
+/**
+ * The engine chosen for a multiexponentiation together with its parameters.
+ *
+ * bit_width only applies to the signed bucket engine and chunk_size only to the multiproduct
+ * engine. cost is the profile-scaled estimate the plan was chosen by.
+ */
+struct multiexp_plan {
+  engine_t engine = engine_t::multiproduct;
+  unsigned bit_width = 0;
+  size_t chunk_size = 0;
+  unsigned num_threads = 1;
+  double cost = 0;
+};
+
+//--------------------------------------------------------------------------------------------------
+// describe_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+/**
+ * Describe a multiexponentiation using the configured host thread count and the physical memory
+ * currently available.
+ *
+ * Callers that have already counted the distinct values of each output up to
+ * mtxbk2::max_histogram_num_values_v can pass the counts in distinct_value_counts, and callers
+ * that have already computed mtxbk2::compute_max_small_magnitude of each output can pass the
+ * magnitudes in max_magnitudes, so that the exponents aren't scanned again.
+ */
+multiexp_descriptor
+describe_multiexponentiation(std::string_view curve, size_t element_size,
+                             basct::cspan<mtxb::exponent_sequence> exponents,
+                             basct::cspan<size_t> distinct_value_counts = {},
+                             basct::cspan<unsigned> max_magnitudes = {}) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// estimate_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+/**
+ * Plan a multiexponentiation with the given engine and estimate its unscaled cost or return
+ * nullopt if the engine can't compute it.
+ *
+ * Estimates count curve operations divided by the number of threads an engine can keep busy.
+ * Memory-hungry parameters (bucket counts and chunk sizes) are reduced to fit the available
+ * memory.
+ */
+std::optional<multiexp_plan> estimate_multiexponentiation(const multiexp_descriptor& descriptor,
+                                                          engine_t engine) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// plan_multiexponentiation
+//--------------------------------------------------------------------------------------------------
+/**
+ * Estimate the cost of every engine that can compute a multiexponentiation, scale the estimates by
+ * the profile's coefficients for the curve, and choose the cheapest.
+ */
+multiexp_plan plan_multiexponentiation(const multiexp_descriptor& descriptor,
+                                       const cost_profile& profile) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// max_planned_histogram_num_values
+//--------------------------------------------------------------------------------------------------
+/**
+ * The largest number of distinct values for which plan_multiexponentiation would choose the
+ * histogram engine for a multiexponentiation of this shape, or 0 if it never would.
+ *
+ * Callers can count the distinct values of a column only up to this limit and skip counting them
+ * when it's 0. The histogram engine's estimate grows with the number of values, so the limit is
+ * found with a binary search.
+ */
+size_t max_planned_histogram_num_values(const multiexp_descriptor& descriptor,
+                                        const cost_profile& profile) noexcept;
+} // namespace sxt::mtxsel
@@ -0,0 +1,224 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/multiexp/selection/engine_selection.h"
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/multiexp/base/exponent_sequence.h"
+#include "sxt/multiexp/bucket_method2/histogram_multiexponentiation.h"
+#include "sxt/multiexp/selection/cost_profile.h"
+
+using namespace sxt;
+using namespace sxt::mtxsel;
+
+TEST_CASE("we can select a multiexponentiation engine") {
+  cost_profile profile;
+  multiexp_descriptor descriptor{
+      .curve = "bn254",
+      .n = 1,
+      .num_outputs = 1,
+      .element_num_bytes = 32,
+      .element_size = 96,
+      .num_threads = 4,
+      .available_memory = size_t{1} << 32,
+  };
+
+  SECTION("we use straus's method for tiny multiexponentiations") {
+    auto plan = plan_multiexponentiation(descriptor, profile);
+    REQUIRE(plan.engine == engine_t::straus);
+  }
+
+  SECTION("we use the signed bucket method for large unsigned multiexponentiations") {
+    descriptor.n = 1u << 16;
+    auto plan = plan_multiexponentiation(descriptor, profile);
+    REQUIRE(plan.engine == engine_t::signed_bucket);
+    REQUIRE(plan.bit_width > 1);
+    REQUIRE(plan.num_threads == 4);
+  }
+
+  SECTION("we don't use the signed bucket method for signed exponents") {
+    descriptor.n = 1u << 16;
+    descriptor.is_signed = true;
+    auto plan = plan_multiexponentiation(descriptor, profile);
+    REQUIRE(plan.engine == engine_t::multiproduct);
+    REQUIRE(plan.chunk_size == descriptor.n / 4);
+  }
+
+  SECTION("we use the small width engine for boolean columns") {
+    descriptor.n = 1u << 16;
+    descriptor.num_outputs = 10;
+    descriptor.element_num_bytes = 1;
+    descriptor.max_magnitude = 1;
+    auto plan = plan_multiexponentiation(descriptor, profile);
+    REQUIRE(plan.engine == engine_t::small_width);
+
+    descriptor.is_signed = true;
+    plan = plan_multiexponentiation(descriptor, profile);
+    REQUIRE(plan.engine == engine_t::small_width);
+  }
+
+  SECTION("we don't use the small width engine for wide exponents") {
+    descriptor.n = 1u << 16;
+    REQUIRE(!estimate_multiexponentiation(descriptor, engine_t::small_width));
+  }
+
+  SECTION("we use the histogram engine for low cardinality columns") {
+    descriptor.n = 1u << 16;
+    descriptor.max_num_distinct = 100;
+    auto plan = plan_multiexponentiation(descriptor, profile);
+    REQUIRE(plan.engine == engine_t::histogram);
+
+    descriptor.max_num_distinct = 1u << 20;
+    REQUIRE(!estimate_multiexponentiation(descriptor, engine_t::histogram));
+  }
+
+  SECTION("we limit the distinct values counted to those the histogram engine could be chosen "
+          "for") {
+    descriptor.n = 16;
+    auto limit = max_planned_histogram_num_values(descriptor, profile);
+    REQUIRE(0 < limit);
+    REQUIRE(limit < mtxbk2::max_histogram_num_values_v);
+    descriptor.max_num_distinct = limit;
+    REQUIRE(plan_multiexponentiation(descriptor, profile).engine == engine_t::histogram);
+    descriptor.max_num_distinct = limit + 1;
+    REQUIRE(plan_multiexponentiation(descriptor, profile).engine != engine_t::histogram);
+
+    descriptor.n = 1u << 20;
+    REQUIRE(max_planned_histogram_num_values(descriptor, profile) ==
+            mtxbk2::max_histogram_num_values_v);
+
+    profile.set_coefficient("bn254", engine_t::histogram, 1.0e6);
+    REQUIRE(max_planned_histogram_num_values(descriptor, profile) == 0);
+  }
+
+  SECTION("we only consider glv decomposition for wide exponents on curves with an endomorphism") {
+    descriptor.n = 1u << 16;
+    REQUIRE(!estimate_multiexponentiation(descriptor, engine_t::glv));
+    descriptor.has_endomorphism = true;
+    auto plan = estimate_multiexponentiation(descriptor, engine_t::glv);
+    REQUIRE(plan);
+    REQUIRE(plan->engine == engine_t::glv);
+    REQUIRE(plan->bit_width > 1);
+    descriptor.element_num_bytes = 16;
+    REQUIRE(!estimate_multiexponentiation(descriptor, engine_t::glv));
+  }
+
+  SECTION("profile coefficients change the selection") {
+    descriptor.n = 1u << 16;
+    profile.set_coefficient("bn254", engine_t::signed_bucket, 1000.0);
+    auto plan = plan_multiexponentiation(descriptor, profile);
+    REQUIRE(plan.engine == engine_t::multiproduct);
+
+    descriptor.curve = "grumpkin";
+    plan = plan_multiexponentiation(descriptor, profile);
+    REQUIRE(plan.engine == engine_t::signed_bucket);
+  }
+
+  SECTION("we narrow digits when memory is limited") {
+    descriptor.n = 1u << 20;
+    auto plan = plan_multiexponentiation(descriptor, profile);
+    REQUIRE(plan.engine == engine_t::signed_bucket);
+    descriptor.available_memory = 4u * 96u * 8u;
+    auto plan_p = plan_multiexponentiation(descriptor, profile);
+    REQUIRE(plan_p.bit_width <= 4);
+  }
+}
+
+TEST_CASE("we can estimate the cost of a multiexponentiation engine") {
+  multiexp_descriptor descriptor{
+      .curve = "bn254",
+      .n = 100,
+      .num_outputs = 1,
+      .element_num_bytes = 32,
+      .is_signed = true,
+      .element_size = 96,
+      .num_threads = 1,
+      .available_memory = size_t{1} << 32,
+  };
+  REQUIRE(!estimate_multiexponentiation(descriptor, engine_t::straus));
+  REQUIRE(!estimate_multiexponentiation(descriptor, engine_t::signed_bucket));
+  auto plan = estimate_multiexponentiation(descriptor, engine_t::multiproduct);
+  REQUIRE(plan);
+  REQUIRE(plan->engine == engine_t::multiproduct);
+  REQUIRE(plan->cost > 0);
+}
+
+TEST_CASE("we can describe a multiexponentiation") {
+  uint8_t data[64] = {};
+  mtxb::exponent_sequence exponents[] = {
+      {.element_nbytes = 8, .n = 3, .data = data},
+      {.element_nbytes = 4, .n = 10, .data = data, .is_signed = 1},
+  };
+  auto descriptor = describe_multiexponentiation("bn254", 96, exponents);
+  REQUIRE(descriptor.curve == "bn254");
+  REQUIRE(descriptor.n == 10);
+  REQUIRE(descriptor.num_outputs == 2);
+  REQUIRE(descriptor.element_num_bytes == 8);
+  REQUIRE(descriptor.is_signed);
+  REQUIRE(descriptor.element_size == 96);
+  REQUIRE(descriptor.num_threads > 0);
+  REQUIRE(descriptor.available_memory > 0);
+  REQUIRE(descriptor.max_magnitude == 0);
+  REQUIRE(descriptor.max_num_distinct == 0);
+}
+
+TEST_CASE("we compute the largest magnitude of small width exponents") {
+  uint8_t data[] = {3, 0xfe, 1};
+  mtxb::exponent_sequence exponents[] = {
+      {.element_nbytes = 1, .n = 3, .data = data},
+      {.element_nbytes = 1, .n = 2, .data = data, .is_signed = 1},
+  };
+  auto descriptor = describe_multiexponentiation("bn254", 96, {exponents, 1});
+  REQUIRE(descriptor.max_magnitude == 254);
+  REQUIRE(descriptor.max_num_distinct == 3);
+  descriptor = describe_multiexponentiation("bn254", 96, {exponents + 1, 1});
+  REQUIRE(descriptor.max_magnitude == 3);
+}
+
+TEST_CASE("we can describe a multiexponentiation with precomputed distinct value counts") {
+  uint8_t data[] = {3, 0xfe, 1};
+  mtxb::exponent_sequence exponents[] = {
+      {.element_nbytes = 1, .n = 3, .data = data},
+      {.element_nbytes = 1, .n = 2, .data = data},
+  };
+  size_t counts[] = {3, 2};
+  auto descriptor = describe_multiexponentiation("bn254", 96, exponents, counts);
+  REQUIRE(descriptor.max_num_distinct == 3);
+  REQUIRE(descriptor.max_num_distinct == describe_multiexponentiation("bn254", 96, exponents)
+                                            .max_num_distinct);
+
+  // the counts are used as given
+  counts[1] = 5;
+  descriptor = describe_multiexponentiation("bn254", 96, exponents, counts);
+  REQUIRE(descriptor.max_num_distinct == 5);
+}
+
+TEST_CASE("we can describe a multiexponentiation with precomputed magnitudes") {
+  uint8_t data[] = {3, 0xfe, 1};
+  mtxb::exponent_sequence exponents[] = {
+      {.element_nbytes = 1, .n = 3, .data = data},
+      {.element_nbytes = 1, .n = 2, .data = data},
+  };
+  size_t counts[] = {3, 2};
+  unsigned magnitudes[] = {254, 254};
+  auto descriptor = describe_multiexponentiation("bn254", 96, exponents, counts, magnitudes);
+  REQUIRE(descriptor.max_magnitude == 254);
+
+  // the magnitudes are used as given
+  magnitudes[1] = 300;
+  descriptor = describe_multiexponentiation("bn254", 96, exponents, counts, magnitudes);
+  REQUIRE(descriptor.max_magnitude == 300);
+}
@@ -29,6 +29,7 @@
 #include "sxt/memory/management/managed_array.h"
 #include "sxt/multiexp/base/exponent_sequence.h"
 #include "sxt/multiexp/curve/multiexponentiation.h"
+#include "sxt/multiexp/curve/straus_multiexponentiation.h"
 #include "sxt/proof/inner_product/fold.h"
 #include "sxt/proof/inner_product/generator_fold.h"
 #include "sxt/proof/inner_product/proof_descriptor.h"
@@ -77,7 +78,6 @@ static void multiexponentiate(c21t::element_p3& res, basct::cspan<c21t::element_
 
 static void multiexponentiate(c21t::element_p3 c_commits[2], const c21t::element_p3& q_value,
                               const s25t::element c_values[2]) noexcept {
-  memmg::managed_array<c21t::element_p3> inout;
   mtxb::exponent_sequence exponents[2] = {
       {
           .element_nbytes = 32,
@@ -92,9 +92,7 @@ static void multiexponentiate(c21t::element_p3 c_commits[2], const c21t::element
           .is_signed = 0,
       },
   };
-  auto values = mtxcrv::compute_multiexponentiation<c21t::element_p3>({&q_value, 1}, exponents);
-  c_commits[0] = values[0];
-  c_commits[1] = values[1];
+  mtxcrv::multiexponentiate_straus<c21t::element_p3>({c_commits, 2}, {&q_value, 1}, exponents);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -56,7 +56,7 @@ void compute_lr_exponents_part1(basct::span<s25t::element> l_exponents,
   auto num_rounds = l_exponents.size();
 
   // 0
-  s25o::inv(allinv, x_vector[0]);
+  s25o::inv_vartime(allinv, x_vector[0]);
   s25o::sq(l_exponents[0], x_vector[0]);
   s25o::sq(r_exponents[0], allinv);
   s25o::neg(r_exponents[0], r_exponents[0]);
@@ -65,7 +65,7 @@ void compute_lr_exponents_part1(basct::span<s25t::element> l_exponents,
   for (size_t i = 1; i < num_rounds; ++i) {
     auto& xi = x_vector[i];
     s25t::element xi_inv;
-    s25o::inv(xi_inv, xi);
+    s25o::inv_vartime(xi_inv, xi);
     s25o::mul(allinv, allinv, xi_inv);
 
     // li
@@ -20,6 +20,7 @@
 #include "sxt/base/num/ceil_log2.h"
 #include "sxt/execution/async/coroutine.h"
 #include "sxt/memory/management/managed_array.h"
+#include "sxt/memory/resource/huge_page_resource.h"
 #include "sxt/proof/sumcheck/driver.h"
 #include "sxt/proof/sumcheck/polynomial_utility.h"
 
@@ -32,6 +33,7 @@ template <basfld::element T> class cpu_driver final : public driver<T> {
     memmg::managed_array<T> mles;
     basct::cspan<std::pair<T, unsigned>> product_table;
     basct::cspan<unsigned> product_terms;
+    unsigned num_mles;
     unsigned n;
     unsigned num_variables;
   };
@@ -42,9 +44,11 @@ public:
   make_workspace(basct::cspan<T> mles, basct::cspan<std::pair<T, unsigned>> product_table,
                  basct::cspan<unsigned> product_terms, unsigned n) const noexcept override {
     auto res = std::make_unique<cpu_workspace>();
-    res->mles = memmg::managed_array<T>{mles.begin(), mles.end()};
+    res->mles = memmg::managed_array<T>{mles.begin(), mles.end(),
+                                        memr::get_huge_page_alloc(mles.size() * sizeof(T))};
     res->product_table = product_table;
     res->product_terms = product_terms;
+    res->num_mles = static_cast<unsigned>(mles.size() / n);
     res->n = n;
     res->num_variables = std::max(basn::ceil_log2(n), 1);
     return xena::make_ready_future<std::unique_ptr<workspace>>(std::move(res));
@@ -104,22 +108,24 @@ public:
     auto& work = static_cast<cpu_workspace&>(ws);
     auto n = work.n;
     auto mid = 1u << (work.num_variables - 1u);
-    auto num_mles = work.mles.size() / n;
+    auto num_mles = work.num_mles;
     SXT_RELEASE_ASSERT(
         // clang-format off
-      work.n >= mid && work.mles.size() % n == 0
+      work.n >= mid && work.mles.size() >= num_mles * n
         // clang-format on
     );
 
+    // The mles are folded in place so that the buffer allocated in make_workspace is reused for
+    // every round. Row i of mle k is written to k * mid + i, which is never past a value that is
+    // still to be read.
     auto mles = work.mles.data();
-    memmg::managed_array<T> mles_p(num_mles * mid);
 
     T one_m_r = T::one();
     sub(one_m_r, one_m_r, r);
     auto n1 = work.n - mid;
     for (auto mle_index = 0; mle_index < num_mles; ++mle_index) {
       auto data = mles + n * mle_index;
-      auto data_p = mles_p.data() + mid * mle_index;
+      auto data_p = mles + mid * mle_index;
 
       // fold paired terms
       for (unsigned i = 0; i < n1; ++i) {
@@ -139,7 +145,6 @@ public:
 
     work.n = mid;
     --work.num_variables;
-    work.mles = std::move(mles_p);
     return xena::make_ready_future();
   }
 };
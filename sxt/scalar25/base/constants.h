@@ -0,0 +1,61 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace sxt::s25b {
+//--------------------------------------------------------------------------------------------------
+// l_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * l_v = 2^252 + 27742317777372353535851937790883648493
+ *     = 0x1000000000000000000000000000000014def9dea2f79cd65812631a5cf5d3ed
+ */
+static constexpr std::array<uint64_t, 4> l_v{0x5812631a5cf5d3ed, 0x14def9dea2f79cd6, 0x0,
+                                             0x1000000000000000};
+
+//--------------------------------------------------------------------------------------------------
+// r_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * r_v = 2^256 mod l_v
+ *     = 0xffffffffffffffffffffffffffffffec6ef5bf4737dcf70d6ec31748d98951d
+ */
+static constexpr std::array<uint64_t, 4> r_v{0xd6ec31748d98951d, 0xc6ef5bf4737dcf70,
+                                             0xfffffffffffffffe, 0x0fffffffffffffff};
+
+//--------------------------------------------------------------------------------------------------
+// r2_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * r2_v = 2^(256*2) mod l_v
+ *      = 0x399411b7c309a3dceec73d217f5be65d00e1ba768859347a40611e3449c0f01
+ */
+static constexpr std::array<uint64_t, 4> r2_v{0xa40611e3449c0f01, 0xd00e1ba768859347,
+                                              0xceec73d217f5be65, 0x0399411b7c309a3d};
+
+//--------------------------------------------------------------------------------------------------
+// inv_v
+//--------------------------------------------------------------------------------------------------
+/**
+ * inv_v = -(l_v^{-1} mod 2^64) mod 2^64
+ *       = 0xd2b51da312547e1b
+ */
+static constexpr uint64_t inv_v = 0xd2b51da312547e1b;
+} // namespace sxt::s25b
@@ -0,0 +1,176 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/scalar25/base/montgomery.h"
+
+#include "sxt/base/field/arithmetic_utility.h"
+#include "sxt/scalar25/base/constants.h"
+
+namespace sxt::s25b {
+//--------------------------------------------------------------------------------------------------
+// subtract_l
+//--------------------------------------------------------------------------------------------------
+/**
+ * h = t - l if t >= l and h = t otherwise, for a five-limb t < 2l
+ */
+CUDA_CALLABLE
+static void subtract_l(uint64_t h[4], const uint64_t t[5]) noexcept {
+  uint64_t r[4];
+  uint64_t borrow = 0;
+  for (int j = 0; j < 4; ++j) {
+    basfld::sbb(r[j], borrow, t[j], l_v[j]);
+  }
+  uint64_t ignore;
+  basfld::sbb(ignore, borrow, t[4], 0);
+
+  // borrow is all ones if t < l and zero otherwise
+  for (int j = 0; j < 4; ++j) {
+    h[j] = (t[j] & borrow) | (r[j] & ~borrow);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// reduce_step
+//--------------------------------------------------------------------------------------------------
+/**
+ * t = (t + m * l) / 2^64 where m is chosen so that the low limb cancels.
+ *
+ * l[2] is zero and l[3] is 2^60, so only the two low limbs of l need a multiplication.
+ */
+CUDA_CALLABLE
+static void reduce_step(uint64_t t[6]) noexcept {
+  auto m = t[0] * inv_v;
+  uint64_t carry = 0;
+  uint64_t discard;
+  basfld::mac(discard, carry, t[0], m, l_v[0]);
+  basfld::mac(t[0], carry, t[1], m, l_v[1]);
+  basfld::adc(t[1], carry, t[2], 0, carry);
+  uint64_t carry_p;
+  basfld::adc(t[2], carry_p, t[3], m << 60, carry);
+  carry = carry_p + (m >> 4);
+  basfld::adc(t[3], carry, t[4], carry, 0);
+  t[4] = t[5] + carry;
+  t[5] = 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+// multiply_add_step
+//--------------------------------------------------------------------------------------------------
+/**
+ * t += a * b
+ */
+CUDA_CALLABLE
+static void multiply_add_step(uint64_t t[6], const uint64_t a[4], uint64_t b) noexcept {
+  uint64_t carry = 0;
+  basfld::mac(t[0], carry, t[0], a[0], b);
+  basfld::mac(t[1], carry, t[1], a[1], b);
+  basfld::mac(t[2], carry, t[2], a[2], b);
+  basfld::mac(t[3], carry, t[3], a[3], b);
+  basfld::adc(t[4], t[5], t[4], carry, 0);
+}
+
+//--------------------------------------------------------------------------------------------------
+// montgomery_multiply
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE void montgomery_multiply(uint64_t h[4], const uint64_t a[4],
+                                       const uint64_t b[4]) noexcept {
+  // coarsely integrated operand scanning (CIOS)
+  uint64_t t[6] = {};
+  multiply_add_step(t, a, b[0]);
+  reduce_step(t);
+  multiply_add_step(t, a, b[1]);
+  reduce_step(t);
+  multiply_add_step(t, a, b[2]);
+  reduce_step(t);
+  multiply_add_step(t, a, b[3]);
+  reduce_step(t);
+
+  // t < 2l, so a single conditional subtraction reduces it
+  subtract_l(h, t);
+}
+
+//--------------------------------------------------------------------------------------------------
+// add_reduced
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE void add_reduced(uint64_t h[4], const uint64_t a[4], const uint64_t b[4]) noexcept {
+  uint64_t t[5];
+  uint64_t carry = 0;
+  for (int j = 0; j < 4; ++j) {
+    basfld::adc(t[j], carry, a[j], b[j], carry);
+  }
+  t[4] = carry;
+  subtract_l(h, t);
+}
+
+//--------------------------------------------------------------------------------------------------
+// subtract_reduced
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE void subtract_reduced(uint64_t h[4], const uint64_t a[4],
+                                    const uint64_t b[4]) noexcept {
+  uint64_t borrow = 0;
+  for (int j = 0; j < 4; ++j) {
+    basfld::sbb(h[j], borrow, a[j], b[j]);
+  }
+
+  // borrow is all ones if a < b, in which case add back l
+  uint64_t carry = 0;
+  for (int j = 0; j < 4; ++j) {
+    basfld::adc(h[j], carry, h[j], l_v[j] & borrow, carry);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// reduce256
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE void reduce256(uint64_t h[4], const uint64_t s[4]) noexcept {
+  // Since l = 2^252 + delta with delta < 2^125, q = floor(s / 2^252) is either the quotient of s
+  // by l or one more than it, so s - q * l lies in (-l, l).
+  auto q = s[3] >> 60;
+  uint64_t ql[4];
+  uint64_t carry = 0;
+  basfld::mac(ql[0], carry, 0, q, l_v[0]);
+  basfld::mac(ql[1], carry, 0, q, l_v[1]);
+  ql[2] = carry;
+  ql[3] = q << 60;
+
+  uint64_t borrow = 0;
+  for (int j = 0; j < 4; ++j) {
+    basfld::sbb(h[j], borrow, s[j], ql[j]);
+  }
+
+  // borrow is all ones if s - q * l is negative, in which case add back l
+  carry = 0;
+  for (int j = 0; j < 4; ++j) {
+    basfld::adc(h[j], carry, h[j], l_v[j] & borrow, carry);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// to_montgomery_form
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE void to_montgomery_form(uint64_t h[4], const uint64_t s[4]) noexcept {
+  constexpr uint64_t r2[4] = {r2_v[0], r2_v[1], r2_v[2], r2_v[3]};
+  montgomery_multiply(h, s, r2);
+}
+
+//--------------------------------------------------------------------------------------------------
+// from_montgomery_form
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE void from_montgomery_form(uint64_t h[4], const uint64_t s[4]) noexcept {
+  constexpr uint64_t one[4] = {1, 0, 0, 0};
+  montgomery_multiply(h, s, one);
+}
+} // namespace sxt::s25b
@@ -0,0 +1,81 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+#include "sxt/base/macro/cuda_callable.h"
+
+namespace sxt::s25b {
+//--------------------------------------------------------------------------------------------------
+// montgomery_multiply
+//--------------------------------------------------------------------------------------------------
+/**
+ * h = a * b * r^-1 mod l where r = 2^256 and the operands are 4x64-bit little-endian limbs
+ *
+ * Uses the coarsely integrated operand scanning (CIOS) method, interleaving each row of the
+ * product with a step of the Montgomery reduction. The result is fully reduced provided
+ * a * b < l * r, which holds whenever either operand is below l.
+ */
+CUDA_CALLABLE void montgomery_multiply(uint64_t h[4], const uint64_t a[4],
+                                       const uint64_t b[4]) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// add_reduced
+//--------------------------------------------------------------------------------------------------
+/**
+ * h = a + b mod l for a, b < l
+ *
+ * Montgomery form is preserved by addition, so this also adds elements in Montgomery form.
+ */
+CUDA_CALLABLE void add_reduced(uint64_t h[4], const uint64_t a[4], const uint64_t b[4]) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// subtract_reduced
+//--------------------------------------------------------------------------------------------------
+/**
+ * h = a - b mod l for a, b < l
+ */
+CUDA_CALLABLE void subtract_reduced(uint64_t h[4], const uint64_t a[4],
+                                    const uint64_t b[4]) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// reduce256
+//--------------------------------------------------------------------------------------------------
+/**
+ * h = s mod l for any s < 2^256
+ *
+ * Reduces an operand so that montgomery_multiply can be applied to unreduced input.
+ */
+CUDA_CALLABLE void reduce256(uint64_t h[4], const uint64_t s[4]) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// to_montgomery_form
+//--------------------------------------------------------------------------------------------------
+/**
+ * h = s * r mod l for any s < 2^256
+ */
+CUDA_CALLABLE void to_montgomery_form(uint64_t h[4], const uint64_t s[4]) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// from_montgomery_form
+//--------------------------------------------------------------------------------------------------
+/**
+ * h = s * r^-1 mod l for any s < 2^256
+ */
+CUDA_CALLABLE void from_montgomery_form(uint64_t h[4], const uint64_t s[4]) noexcept;
+} // namespace sxt::s25b
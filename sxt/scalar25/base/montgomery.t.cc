@@ -0,0 +1,202 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/scalar25/base/montgomery.h"
+
+#include <array>
+
+#include "sxt/base/test/unit_test.h"
+#include "sxt/scalar25/base/constants.h"
+
+using namespace sxt::s25b;
+
+TEST_CASE("conversion to Montgomery form") {
+  SECTION("with zero returns zero") {
+    constexpr std::array<uint64_t, 4> a = {0, 0, 0, 0};
+    std::array<uint64_t, 4> ret;
+
+    to_montgomery_form(ret.data(), a.data());
+
+    REQUIRE(ret == a);
+  }
+
+  SECTION("with one returns one in Montgomery form") {
+    constexpr std::array<uint64_t, 4> a = {1, 0, 0, 0};
+    std::array<uint64_t, 4> ret;
+
+    to_montgomery_form(ret.data(), a.data());
+
+    REQUIRE(ret == r_v);
+  }
+
+  SECTION("with the modulus returns zero") {
+    constexpr std::array<uint64_t, 4> expect = {0, 0, 0, 0};
+    std::array<uint64_t, 4> ret;
+
+    to_montgomery_form(ret.data(), l_v.data());
+
+    REQUIRE(ret == expect);
+  }
+
+  SECTION("round trips through Montgomery form reduce unreduced values") {
+    constexpr std::array<uint64_t, 4> a = {0xffffffffffffffff, 0xffffffffffffffff,
+                                           0xffffffffffffffff, 0xffffffffffffffff};
+    constexpr std::array<uint64_t, 4> expect = {0xd6ec31748d98951c, 0xc6ef5bf4737dcf70,
+                                                0xfffffffffffffffe, 0x0fffffffffffffff};
+    std::array<uint64_t, 4> ret;
+
+    to_montgomery_form(ret.data(), a.data());
+    from_montgomery_form(ret.data(), ret.data());
+
+    REQUIRE(ret == expect);
+  }
+}
+
+TEST_CASE("Montgomery multiplication") {
+  constexpr std::array<uint64_t, 4> a = {0x8796a5b4c3d2e1f0, 0x0f1e2d3c4b5a6978,
+                                         0xfedcba9876543210, 0x0123456789abcdef};
+  constexpr std::array<uint64_t, 4> b = {0x0011223344556677, 0xdeadbeefcafebabe,
+                                         0x123456789abcdef0, 0x0fedcba987654321};
+
+  SECTION("multiplies elements in Montgomery form") {
+    constexpr std::array<uint64_t, 4> expect = {0x6fee3ade9bf3a0e3, 0x1b52b0d5ec4fd7c2,
+                                                0x2b9dd8bba9642e52, 0x02866fffe07a573a};
+    std::array<uint64_t, 4> a_m, b_m, ret;
+    to_montgomery_form(a_m.data(), a.data());
+    to_montgomery_form(b_m.data(), b.data());
+
+    montgomery_multiply(ret.data(), a_m.data(), b_m.data());
+    from_montgomery_form(ret.data(), ret.data());
+
+    REQUIRE(ret == expect);
+  }
+
+  SECTION("multiplying by one in Montgomery form is the identity") {
+    std::array<uint64_t, 4> ret;
+
+    montgomery_multiply(ret.data(), a.data(), r_v.data());
+
+    REQUIRE(ret == a);
+  }
+
+  SECTION("the largest reduced elements multiply correctly") {
+    constexpr std::array<uint64_t, 4> expect = {1, 0, 0, 0};
+    std::array<uint64_t, 4> x = l_v;
+    x[0] -= 1;
+    std::array<uint64_t, 4> x_m, ret;
+    to_montgomery_form(x_m.data(), x.data());
+
+    montgomery_multiply(ret.data(), x_m.data(), x_m.data());
+    from_montgomery_form(ret.data(), ret.data());
+
+    REQUIRE(ret == expect);
+  }
+}
+
+TEST_CASE("reduction of 256-bit values") {
+  SECTION("reduced values are unchanged") {
+    std::array<uint64_t, 4> a = l_v;
+    a[0] -= 1;
+    std::array<uint64_t, 4> ret;
+
+    reduce256(ret.data(), a.data());
+
+    REQUIRE(ret == a);
+  }
+
+  SECTION("the modulus reduces to zero") {
+    constexpr std::array<uint64_t, 4> expect = {0, 0, 0, 0};
+    std::array<uint64_t, 4> ret;
+
+    reduce256(ret.data(), l_v.data());
+
+    REQUIRE(ret == expect);
+  }
+
+  SECTION("values whose top bits overestimate the quotient are reduced") {
+    // 15 * 2^252 is below 15 * l, so the quotient is 14
+    constexpr std::array<uint64_t, 4> a = {0, 0, 0, 0xf000000000000000};
+    constexpr std::array<uint64_t, 4> expect = {0x2efe948eea8e690a, 0xdbce55d316756c47,
+                                                0xfffffffffffffffe, 0x0fffffffffffffff};
+    std::array<uint64_t, 4> ret;
+
+    reduce256(ret.data(), a.data());
+
+    REQUIRE(ret == expect);
+  }
+
+  SECTION("the largest value is reduced") {
+    constexpr std::array<uint64_t, 4> a = {0xffffffffffffffff, 0xffffffffffffffff,
+                                           0xffffffffffffffff, 0xffffffffffffffff};
+    constexpr std::array<uint64_t, 4> expect = {0xd6ec31748d98951c, 0xc6ef5bf4737dcf70,
+                                                0xfffffffffffffffe, 0x0fffffffffffffff};
+    std::array<uint64_t, 4> ret;
+
+    reduce256(ret.data(), a.data());
+
+    REQUIRE(ret == expect);
+  }
+}
+
+TEST_CASE("addition of reduced values") {
+  SECTION("sums below the modulus are unchanged") {
+    constexpr std::array<uint64_t, 4> a = {1, 2, 3, 4};
+    constexpr std::array<uint64_t, 4> b = {5, 6, 7, 8};
+    constexpr std::array<uint64_t, 4> expect = {6, 8, 10, 12};
+    std::array<uint64_t, 4> ret;
+
+    add_reduced(ret.data(), a.data(), b.data());
+
+    REQUIRE(ret == expect);
+  }
+
+  SECTION("sums above the modulus are reduced") {
+    std::array<uint64_t, 4> a = l_v;
+    a[0] -= 1;
+    constexpr std::array<uint64_t, 4> b = {3, 0, 0, 0};
+    constexpr std::array<uint64_t, 4> expect = {2, 0, 0, 0};
+    std::array<uint64_t, 4> ret;
+
+    add_reduced(ret.data(), a.data(), b.data());
+
+    REQUIRE(ret == expect);
+  }
+}
+
+TEST_CASE("subtraction of reduced values") {
+  SECTION("differences that are nonnegative are unchanged") {
+    constexpr std::array<uint64_t, 4> a = {5, 0, 0, 7};
+    constexpr std::array<uint64_t, 4> b = {3, 0, 0, 2};
+    constexpr std::array<uint64_t, 4> expect = {2, 0, 0, 5};
+    std::array<uint64_t, 4> ret;
+
+    subtract_reduced(ret.data(), a.data(), b.data());
+
+    REQUIRE(ret == expect);
+  }
+
+  SECTION("negative differences wrap around the modulus") {
+    constexpr std::array<uint64_t, 4> a = {1, 0, 0, 0};
+    constexpr std::array<uint64_t, 4> b = {3, 0, 0, 0};
+    std::array<uint64_t, 4> expect = l_v;
+    expect[0] -= 2;
+    std::array<uint64_t, 4> ret;
+
+    subtract_reduced(ret.data(), a.data(), b.data());
+
+    REQUIRE(ret == expect);
+  }
+}
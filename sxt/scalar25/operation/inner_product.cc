@@ -19,6 +19,8 @@
 #include <algorithm>
 
 #include "sxt/algorithm/reduction/reduction.h"
+#include "sxt/base/bit/load.h"
+#include "sxt/base/bit/store.h"
 #include "sxt/base/device/memory_utility.h"
 #include "sxt/base/device/property.h"
 #include "sxt/base/device/stream.h"
@@ -29,6 +31,8 @@
 #include "sxt/execution/device/for_each.h"
 #include "sxt/memory/management/managed_array.h"
 #include "sxt/memory/resource/async_device_resource.h"
+#include "sxt/scalar25/base/constants.h"
+#include "sxt/scalar25/base/montgomery.h"
 #include "sxt/scalar25/operation/accumulator.h"
 #include "sxt/scalar25/operation/mul.h"
 #include "sxt/scalar25/operation/muladd.h"
@@ -61,9 +65,24 @@ void inner_product(s25t::element& res, basct::cspan<s25t::element> lhs,
                    basct::cspan<s25t::element> rhs) noexcept {
   auto n = std::min(lhs.size(), rhs.size());
   SXT_DEBUG_ASSERT(n > 0);
-  s25o::mul(res, lhs[0], rhs[0]);
-  for (size_t i = 1; i < n; ++i) {
-    s25o::muladd(res, lhs[i], rhs[i], res);
+
+  // Accumulate the Montgomery products lhs[i] * rhs[i] * r^-1 and convert the sum back once at
+  // the end so that each term costs a single Montgomery multiplication.
+  uint64_t sum[4] = {};
+  for (size_t i = 0; i < n; ++i) {
+    uint64_t a[4];
+    uint64_t b[4];
+    for (int j = 0; j < 4; ++j) {
+      a[j] = basbt::load64_le(lhs[i].data() + 8 * j);
+      b[j] = basbt::load64_le(rhs[i].data() + 8 * j);
+    }
+    s25b::reduce256(b, b);
+    s25b::montgomery_multiply(a, a, b);
+    s25b::add_reduced(sum, sum, a);
+  }
+  s25b::montgomery_multiply(sum, sum, s25b::r2_v.data());
+  for (int j = 0; j < 4; ++j) {
+    basbt::store64_le(res.data() + 8 * j, sum[j]);
   }
 }
 
@@ -77,6 +77,22 @@ TEST_CASE("we can compute the inner product of two scalar vectors") {
     inner_product(res, rhs, lhs);
     REQUIRE(res == expected);
   }
+
+  SECTION("we handle random and unreduced elements") {
+    basn::fast_random_number_generator rng{1, 2};
+    std::vector<s25t::element> lhs(10), rhs(10);
+    s25rn::generate_random_elements(lhs, rng);
+    s25rn::generate_random_elements(rhs, rng);
+    // 2 * L + 1 and 2^256 - 1
+    lhs[3] = 0x2000000000000000000000000000000029bdf3bd45ef39acb024c634b9eba7db_s25;
+    rhs[7] = 0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff_s25;
+    inner_product(res, lhs, rhs);
+    auto expected = lhs[0] * rhs[0];
+    for (size_t i = 1; i < lhs.size(); ++i) {
+      expected = expected + lhs[i] * rhs[i];
+    }
+    REQUIRE(res == expected);
+  }
 }
 
 TEST_CASE("we can compute inner products asynchronously on the GPU") {
@@ -26,6 +26,10 @@
 
 #include <cassert>
 
+#include "sxt/base/bit/load.h"
+#include "sxt/base/bit/store.h"
+#include "sxt/base/field/safegcd.h"
+#include "sxt/scalar25/base/constants.h"
 #include "sxt/scalar25/operation/mul.h"
 #include "sxt/scalar25/operation/sq.h"
 #include "sxt/scalar25/operation/sqmul.h"
@@ -40,6 +44,16 @@ CUDA_CALLABLE
 void inv(s25t::element& s_inv, const s25t::element& s) noexcept {
   assert(!s25p::is_zero(s));
 
+#ifndef __CUDA_ARCH__
+  uint64_t limbs[4];
+  for (int i = 0; i < 4; ++i) {
+    limbs[i] = basbt::load64_le(s.data() + 8 * i);
+  }
+  basfld::invert4_safegcd(limbs, limbs, s25b::l_v.data());
+  for (int i = 0; i < 4; ++i) {
+    basbt::store64_le(s_inv.data() + 8 * i, limbs[i]);
+  }
+#else
   s25t::element _10, _100, _1000, _10000, _100000, _1000000, _10010011, _10010111, _100110, _1010,
       _1010000, _1010011, _1011, _10110, _10111101, _11, _1100011, _1100111, _11010011, _1101011,
       _11100111, _11101011, _11110101;
@@ -84,6 +98,23 @@ void inv(s25t::element& s_inv, const s25t::element& s) noexcept {
   sqmul(s_inv, 10, _11110101);
   sqmul(s_inv, 8, _11010011);
   sqmul(s_inv, 8, _11101011);
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+// inv_vartime
+//--------------------------------------------------------------------------------------------------
+void inv_vartime(s25t::element& s_inv, const s25t::element& s) noexcept {
+  assert(!s25p::is_zero(s));
+
+  uint64_t limbs[4];
+  for (int i = 0; i < 4; ++i) {
+    limbs[i] = basbt::load64_le(s.data() + 8 * i);
+  }
+  basfld::invert4_safegcd_vartime(limbs, limbs, s25b::l_v.data());
+  for (int i = 0; i < 4; ++i) {
+    basbt::store64_le(s_inv.data() + 8 * i, limbs[i]);
+  }
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -38,6 +38,13 @@ namespace sxt::s25o {
 CUDA_CALLABLE
 void inv(s25t::element& s_inv, const s25t::element& s) noexcept;
 
+//--------------------------------------------------------------------------------------------------
+// inv_vartime
+//--------------------------------------------------------------------------------------------------
+//
+// Host-only variant of inv whose running time depends on s. Only use with public data.
+void inv_vartime(s25t::element& s_inv, const s25t::element& s) noexcept;
+
 //--------------------------------------------------------------------------------------------------
 // batch_inv
 //--------------------------------------------------------------------------------------------------
@@ -16,13 +16,36 @@
  */
 #include "sxt/scalar25/operation/inv.h"
 
+#include "sxt/base/num/fast_random_number_generator.h"
 #include "sxt/base/test/unit_test.h"
+#include "sxt/scalar25/operation/mul.h"
+#include "sxt/scalar25/operation/sq.h"
+#include "sxt/scalar25/random/element.h"
 #include "sxt/scalar25/type/element.h"
 #include "sxt/scalar25/type/literal.h"
 
+using namespace sxt;
 using namespace sxt::s25o;
 using namespace sxt::s25t;
 
+//--------------------------------------------------------------------------------------------------
+// pow_l_minus_2
+//--------------------------------------------------------------------------------------------------
+// Computes s^(l - 2), the inverse of s by Fermat's little theorem
+static element pow_l_minus_2(const element& s) noexcept {
+  constexpr uint64_t e[4] = {0x5812631a5cf5d3eb, 0x14def9dea2f79cd6, 0x0, 0x1000000000000000};
+  element res = 0x1_s25;
+  for (int i = 4; i-- > 0;) {
+    for (int j = 64; j-- > 0;) {
+      sq(res, res);
+      if ((e[i] >> j) & 1) {
+        mul(res, res, s);
+      }
+    }
+  }
+  return res;
+}
+
 TEST_CASE("we check that the identity value has a valid inverse") {
   element s;
   inv(s, 0x1_s25);
@@ -67,3 +90,33 @@ TEST_CASE("we can do bulk inversion") {
   inv(expected, sx[1]);
   REQUIRE(sx_inv[1] == expected);
 }
+
+TEST_CASE("we can invert in variable time") {
+  element s;
+  inv_vartime(s, 0x1_s25);
+  REQUIRE(s == 0x1_s25);
+
+  inv_vartime(s, 0x4_s25);
+  REQUIRE(s == 0xc0000000000000000000000000000000fa73b66fa39b5a0c20dca53c5b85ef2_s25);
+
+  element a =
+      0x2000000000000000000000000000000029bdf3bd45ef39acb024c634b9eba7df_s25; // a = 2 * L + 5
+  inv_vartime(s, a);
+  REQUIRE(s == 0x3333333333333333333333333333333375fcb92ed64b8f7ab36e09edf645d96_s25);
+}
+
+TEST_CASE("inversion matches the inverse computed with Fermat's little theorem") {
+  basn::fast_random_number_generator rng{1, 2};
+  for (int i = 0; i < 100; ++i) {
+    element a;
+    s25rn::generate_random_element(a, rng);
+    auto expected = pow_l_minus_2(a);
+
+    element s;
+    inv(s, a);
+    REQUIRE(s == expected);
+
+    inv_vartime(s, a);
+    REQUIRE(s == expected);
+  }
+}
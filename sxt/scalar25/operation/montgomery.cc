@@ -0,0 +1,94 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/scalar25/operation/montgomery.h"
+
+#include "sxt/base/bit/load.h"
+#include "sxt/base/bit/store.h"
+#include "sxt/scalar25/base/montgomery.h"
+
+namespace sxt::s25o {
+//--------------------------------------------------------------------------------------------------
+// to_montgomery
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE
+void to_montgomery(s25t::montgomery_element& res, const s25t::element& e) noexcept {
+  auto data = res.data();
+  for (int i = 0; i < 4; ++i) {
+    data[i] = basbt::load64_le(e.data() + 8 * i);
+  }
+  s25b::to_montgomery_form(data, data);
+}
+
+//--------------------------------------------------------------------------------------------------
+// from_montgomery
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE
+void from_montgomery(s25t::element& res, const s25t::montgomery_element& e) noexcept {
+  uint64_t limbs[4];
+  s25b::from_montgomery_form(limbs, e.data());
+  for (int i = 0; i < 4; ++i) {
+    basbt::store64_le(res.data() + 8 * i, limbs[i]);
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+// add
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE
+void add(s25t::montgomery_element& res, const s25t::montgomery_element& a,
+         const s25t::montgomery_element& b) noexcept {
+  s25b::add_reduced(res.data(), a.data(), b.data());
+}
+
+//--------------------------------------------------------------------------------------------------
+// sub
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE
+void sub(s25t::montgomery_element& res, const s25t::montgomery_element& a,
+         const s25t::montgomery_element& b) noexcept {
+  s25b::subtract_reduced(res.data(), a.data(), b.data());
+}
+
+//--------------------------------------------------------------------------------------------------
+// neg
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE
+void neg(s25t::montgomery_element& res, const s25t::montgomery_element& e) noexcept {
+  constexpr uint64_t zero[4] = {};
+  s25b::subtract_reduced(res.data(), zero, e.data());
+}
+
+//--------------------------------------------------------------------------------------------------
+// mul
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE
+void mul(s25t::montgomery_element& res, const s25t::montgomery_element& a,
+         const s25t::montgomery_element& b) noexcept {
+  s25b::montgomery_multiply(res.data(), a.data(), b.data());
+}
+
+//--------------------------------------------------------------------------------------------------
+// muladd
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE
+void muladd(s25t::montgomery_element& res, const s25t::montgomery_element& a,
+            const s25t::montgomery_element& b, const s25t::montgomery_element& c) noexcept {
+  uint64_t t[4];
+  s25b::montgomery_multiply(t, a.data(), b.data());
+  s25b::add_reduced(res.data(), t, c.data());
+}
+} // namespace sxt::s25o
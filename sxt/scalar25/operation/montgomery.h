@@ -0,0 +1,78 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "sxt/base/macro/cuda_callable.h"
+#include "sxt/scalar25/type/element.h"
+#include "sxt/scalar25/type/montgomery_element.h"
+
+namespace sxt::s25o {
+//--------------------------------------------------------------------------------------------------
+// to_montgomery
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert a (possibly unreduced) scalar into Montgomery form.
+ */
+CUDA_CALLABLE
+void to_montgomery(s25t::montgomery_element& res, const s25t::element& e) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// from_montgomery
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert a scalar in Montgomery form back into its reduced 32-byte form.
+ */
+CUDA_CALLABLE
+void from_montgomery(s25t::element& res, const s25t::montgomery_element& e) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// add
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE
+void add(s25t::montgomery_element& res, const s25t::montgomery_element& a,
+         const s25t::montgomery_element& b) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// sub
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE
+void sub(s25t::montgomery_element& res, const s25t::montgomery_element& a,
+         const s25t::montgomery_element& b) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// neg
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE
+void neg(s25t::montgomery_element& res, const s25t::montgomery_element& e) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// mul
+//--------------------------------------------------------------------------------------------------
+CUDA_CALLABLE
+void mul(s25t::montgomery_element& res, const s25t::montgomery_element& a,
+         const s25t::montgomery_element& b) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// muladd
+//--------------------------------------------------------------------------------------------------
+/**
+ * res = a * b + c
+ */
+CUDA_CALLABLE
+void muladd(s25t::montgomery_element& res, const s25t::montgomery_element& a,
+            const s25t::montgomery_element& b, const s25t::montgomery_element& c) noexcept;
+} // namespace sxt::s25o
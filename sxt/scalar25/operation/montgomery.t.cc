@@ -0,0 +1,119 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/scalar25/operation/montgomery.h"
+
+#include "sxt/base/num/fast_random_number_generator.h"
+#include "sxt/base/test/unit_test.h"
+#include "sxt/scalar25/operation/add.h"
+#include "sxt/scalar25/operation/mul.h"
+#include "sxt/scalar25/operation/muladd.h"
+#include "sxt/scalar25/operation/neg.h"
+#include "sxt/scalar25/operation/sub.h"
+#include "sxt/scalar25/random/element.h"
+#include "sxt/scalar25/type/literal.h"
+
+using namespace sxt;
+using namespace sxt::s25o;
+using s25t::operator""_s25;
+
+TEST_CASE("we can convert to and from Montgomery form") {
+  s25t::montgomery_element x;
+  s25t::element e;
+
+  SECTION("zero and one map to the identities") {
+    to_montgomery(x, 0x0_s25);
+    REQUIRE(x == s25t::montgomery_element::identity());
+    to_montgomery(x, 0x1_s25);
+    REQUIRE(x == s25t::montgomery_element::one());
+  }
+
+  SECTION("we can round trip an element") {
+    to_montgomery(x, 0x123_s25);
+    from_montgomery(e, x);
+    REQUIRE(e == 0x123_s25);
+  }
+
+  SECTION("unreduced elements are reduced") {
+    s25t::element y;
+    for (int i = 0; i < 32; ++i) {
+      y.data()[i] = 0xff;
+    }
+    to_montgomery(x, y);
+    from_montgomery(e, x);
+    s25t::element expected;
+    add(expected, y, 0x0_s25);
+    REQUIRE(e == expected);
+  }
+}
+
+TEST_CASE("Montgomery arithmetic matches the arithmetic of regular elements") {
+  basn::fast_random_number_generator rng{1, 2};
+  s25t::element a, b, c;
+  s25rn::generate_random_element(a, rng);
+  s25rn::generate_random_element(b, rng);
+  s25rn::generate_random_element(c, rng);
+
+  s25t::montgomery_element am, bm, cm, resm;
+  to_montgomery(am, a);
+  to_montgomery(bm, b);
+  to_montgomery(cm, c);
+
+  s25t::element expected, res;
+
+  SECTION("we can add elements") {
+    add(resm, am, bm);
+    from_montgomery(res, resm);
+    add(expected, a, b);
+    REQUIRE(res == expected);
+  }
+
+  SECTION("we can subtract elements") {
+    sub(resm, am, bm);
+    from_montgomery(res, resm);
+    sub(expected, a, b);
+    REQUIRE(res == expected);
+
+    sub(resm, bm, am);
+    from_montgomery(res, resm);
+    sub(expected, b, a);
+    REQUIRE(res == expected);
+  }
+
+  SECTION("we can negate elements") {
+    neg(resm, am);
+    from_montgomery(res, resm);
+    neg(expected, a);
+    REQUIRE(res == expected);
+
+    neg(resm, s25t::montgomery_element::identity());
+    REQUIRE(resm == s25t::montgomery_element::identity());
+  }
+
+  SECTION("we can multiply elements") {
+    mul(resm, am, bm);
+    from_montgomery(res, resm);
+    mul(expected, a, b);
+    REQUIRE(res == expected);
+  }
+
+  SECTION("we can multiply and add elements") {
+    muladd(resm, am, bm, cm);
+    from_montgomery(res, resm);
+    muladd(expected, a, b, c);
+    REQUIRE(res == expected);
+  }
+}
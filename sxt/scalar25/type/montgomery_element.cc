@@ -0,0 +1,46 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/scalar25/type/montgomery_element.h"
+
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace sxt::s25t {
+//--------------------------------------------------------------------------------------------------
+// operator==
+//--------------------------------------------------------------------------------------------------
+bool operator==(const montgomery_element& lhs, const montgomery_element& rhs) noexcept {
+  return std::memcmp(static_cast<const void*>(lhs.data()), static_cast<const void*>(rhs.data()),
+                     sizeof(montgomery_element)) == 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+// operator<<
+//--------------------------------------------------------------------------------------------------
+std::ostream& operator<<(std::ostream& out, const montgomery_element& c) noexcept {
+  auto flags = out.flags();
+  out << "0x" << std::hex << std::setfill('0');
+  auto data = c.data();
+  for (int i = 4; i-- > 0;) {
+    out << std::setw(16) << data[i];
+  }
+  out << "_m";
+  out.flags(flags);
+  return out;
+}
+} // namespace sxt::s25t
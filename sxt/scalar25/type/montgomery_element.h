@@ -0,0 +1,76 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+
+#include "sxt/base/macro/cuda_callable.h"
+#include "sxt/scalar25/base/constants.h"
+#include "sxt/scalar25/type/operation_adl_stub.h"
+
+namespace sxt::s25t {
+//--------------------------------------------------------------------------------------------------
+// montgomery_element
+//--------------------------------------------------------------------------------------------------
+/**
+ * A scalar stored in Montgomery form as four little-endian 64-bit limbs.
+ *
+ * An element x is represented by x * 2^256 mod L, so that multiplications can use Montgomery
+ * reduction instead of a full reduction modulo L. Limbs are always kept in the [0..L) interval.
+ * Convert to and from element only at API boundaries.
+ */
+class montgomery_element : public s25o::operation_adl_stub {
+public:
+  montgomery_element() noexcept = default;
+
+  constexpr montgomery_element(uint64_t x0, uint64_t x1, uint64_t x2, uint64_t x3) noexcept
+      : data_{x0, x1, x2, x3} {}
+
+  CUDA_CALLABLE
+  uint64_t* data() noexcept { return data_; }
+
+  CUDA_CALLABLE
+  const uint64_t* data() const noexcept { return data_; }
+
+  static constexpr montgomery_element identity() noexcept { return {0, 0, 0, 0}; }
+
+  static constexpr montgomery_element one() noexcept {
+    return {s25b::r_v[0], s25b::r_v[1], s25b::r_v[2], s25b::r_v[3]};
+  }
+
+private:
+  uint64_t data_[4];
+};
+
+//--------------------------------------------------------------------------------------------------
+// operator==
+//--------------------------------------------------------------------------------------------------
+bool operator==(const montgomery_element& lhs, const montgomery_element& rhs) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+// operator!=
+//--------------------------------------------------------------------------------------------------
+inline bool operator!=(const montgomery_element& lhs, const montgomery_element& rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+//--------------------------------------------------------------------------------------------------
+// operator<<
+//--------------------------------------------------------------------------------------------------
+std::ostream& operator<<(std::ostream& out, const montgomery_element& c) noexcept;
+} // namespace sxt::s25t
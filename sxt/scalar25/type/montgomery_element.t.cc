@@ -0,0 +1,37 @@
+/** Proofs GPU - Space and Time's cryptographic proof algorithms on the CPU and GPU.
+ *
+ * Copyright 2025-present Space and Time Labs, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sxt/scalar25/type/montgomery_element.h"
+
+#include <sstream>
+
+#include "sxt/base/test/unit_test.h"
+
+using namespace sxt;
+using namespace sxt::s25t;
+
+TEST_CASE("montgomery_element") {
+  SECTION("identity and one differ") {
+    REQUIRE(montgomery_element::identity() != montgomery_element::one());
+    REQUIRE(montgomery_element::identity() == montgomery_element{0, 0, 0, 0});
+  }
+
+  SECTION("we can print an element") {
+    std::ostringstream oss;
+    oss << montgomery_element{1, 2, 3, 4};
+    REQUIRE(oss.str() == "0x0000000000000004000000000000000300000000000000020000000000000001_m");
+  }
+}